@@ -23,3 +23,33 @@ if (${GoogleBenchmark_FOUND})
     GoogleBenchmark
     )
 endif()
+
+# Adds Google Benchmark sources that live next to the code they measure to the
+# `Benchmark` executable (see src/Executables/Benchmark), along with the
+# libraries they need. The executable is only built in non-Debug builds with
+# Google Benchmark, so the sources are ignored otherwise.
+#
+# Usage:
+#   spectre_add_benchmark_sources(
+#     SOURCES Benchmark_Foo.cpp
+#     LIBRARIES ${LIBRARY})
+#
+# Sources added from directories that are configured before the executable is
+# created are collected in global properties, the others are added to the
+# executable directly.
+function(spectre_add_benchmark_sources)
+  cmake_parse_arguments(ARG "" "" "SOURCES;LIBRARIES" ${ARGN})
+  if(NOT "${GoogleBenchmark_FOUND}" OR "${CMAKE_BUILD_TYPE}" STREQUAL "Debug")
+    return()
+  endif()
+  list(TRANSFORM ARG_SOURCES PREPEND "${CMAKE_CURRENT_SOURCE_DIR}/")
+  if(TARGET Benchmark)
+    target_sources(Benchmark PRIVATE ${ARG_SOURCES})
+    target_link_libraries(Benchmark PRIVATE ${ARG_LIBRARIES})
+  else()
+    set_property(
+      GLOBAL APPEND PROPERTY SPECTRE_BENCHMARK_SOURCES ${ARG_SOURCES})
+    set_property(
+      GLOBAL APPEND PROPERTY SPECTRE_BENCHMARK_LIBRARIES ${ARG_LIBRARIES})
+  endif()
+endfunction()
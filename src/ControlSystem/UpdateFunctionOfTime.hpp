@@ -6,15 +6,21 @@
 #include <memory>
 #include <pup.h>
 #include <string>
+#include <tuple>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataVector.hpp"
 #include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
+#include "IO/Observer/ReductionActions.hpp"
 #include "Parallel/GlobalCache.hpp"
+#include "Parallel/Invoke.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/Serialization/Serialize.hpp"
+#include "Utilities/System/ParallelInfo.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
 
@@ -26,6 +32,7 @@ namespace control_system::Tags {
 struct UpdateAggregators;
 struct SystemToCombinedNames;
 struct MeasurementTimescales;
+struct WriteDataToDisk;
 }  // namespace control_system::Tags
 /// \endcond
 
@@ -168,7 +175,22 @@ struct UpdateAggregator {
  *
  * When the `UpdateAggregator::is_ready`, the measurement timescale is mutated
  * with `UpdateSingleFunctionOfTime` and the functions of time are mutated with
- * `UpdateMultipleFunctionsOfTime`, both using `Parallel::mutate`.
+ * `UpdateMultipleFunctionsOfTime`, both using `Parallel::mutate`. These updates
+ * are already compact deltas: `UpdateMultipleFunctionsOfTime` only carries the
+ * new highest derivative and expiration time of each function of time, which
+ * `domain::FunctionsOfTime::FunctionOfTime::update` appends to the existing
+ * data on every node. The updates of all control systems sharing a
+ * measurement are sent together, so there is one broadcast of each tag per
+ * measurement.
+ *
+ * If `control_system::Tags::WriteDataToDisk` is true, the cost of each
+ * functions of time broadcast is written to the reduction file in the subfile
+ * `/ControlSystems/FunctionOfTimeUpdates/<combined name>.dat`. The columns are
+ * - %Time
+ * - NumberOfFunctionsOfTime
+ * - UpdateSizeInBytes
+ * - NumberOfNodes
+ * - TotalBytesSent
  *
  * The "appropriate" `UpdateAggregator` is chosen from the
  * `control_system::Tags::SystemToCombinedNames` for the templated
@@ -218,6 +240,29 @@ struct AggregateUpdate {
       const std::pair<double, double> combined_measurement_expiration_time =
           aggregator.combined_measurement_expiration_time();
 
+      if (Parallel::get<Tags::WriteDataToDisk>(cache)) {
+        // The update is sent to every node, which the per-node cost in the
+        // reduction file reflects
+        const auto update_size = static_cast<double>(
+            size_of_object_in_bytes(combined_fot_expiration_times));
+        const auto number_of_nodes =
+            static_cast<double>(sys::number_of_nodes());
+        auto& observer_writer_proxy = Parallel::get_parallel_component<
+            observers::ObserverWriter<Metavariables>>(cache);
+        Parallel::threaded_action<
+            observers::ThreadedActions::WriteReductionDataRow>(
+            // Node 0 is always the writer
+            observer_writer_proxy[0],
+            "/ControlSystems/FunctionOfTimeUpdates/" + combined_name,
+            std::vector<std::string>{"Time", "NumberOfFunctionsOfTime",
+                                     "UpdateSizeInBytes", "NumberOfNodes",
+                                     "TotalBytesSent"},
+            std::make_tuple(
+                old_fot_expiration_time,
+                static_cast<double>(combined_fot_expiration_times.size()),
+                update_size, number_of_nodes, update_size * number_of_nodes));
+      }
+
       Parallel::mutate<Tags::MeasurementTimescales, UpdateSingleFunctionOfTime>(
           cache, combined_name, old_measurement_expiration_time,
           DataVector{1, combined_measurement_expiration_time.first},
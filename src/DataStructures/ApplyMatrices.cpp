@@ -15,8 +15,13 @@
 #include "Utilities/Blas.hpp"
 #include "Utilities/DereferenceWrapper.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/System/ThreadPool.hpp"
 
 namespace {
+// Number of values below which a transformation is not split among threads,
+// since the cost of waking the workers would outweigh the gain.
+constexpr size_t minimum_size_for_threading = 32768;
+
 void multiply_in_first_dimension(const gsl::not_null<double*> result,
                                  const gsl::not_null<size_t*> data_size,
                                  const Matrix& matrix, const double* data) {
@@ -97,6 +102,42 @@ void Impl<ElementType, Dim, DimensionIsIdentity...>::apply(
     const gsl::not_null<ElementType*> result,
     const std::array<MatrixType, Dim>& matrices, const ElementType* const data,
     const Index<Dim>& extents, const size_t number_of_independent_components) {
+  if constexpr (sizeof...(DimensionIsIdentity) == 0) {
+    // The components are transformed independently and are stored
+    // contiguously in both `data` and `result`, so large transformations are
+    // split into blocks of components that are shared among the threads of the
+    // node thread pool.
+    auto& thread_pool = sys::node_thread_pool();
+    if (thread_pool.number_of_threads() > 1 and
+        number_of_independent_components > 1 and
+        number_of_independent_components * extents.product() >=
+            minimum_size_for_threading) {
+      const size_t result_points =
+          apply_matrices_detail::result_size(matrices, extents);
+      thread_pool.parallel_for(
+          number_of_independent_components,
+          [&result, &matrices, &data, &extents, &result_points](
+              const size_t first_component, const size_t last_component) {
+            // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            select_identity_dimensions(
+                make_not_null(result.get() + first_component * result_points),
+                matrices, data + first_component * extents.product(),
+                extents, last_component - first_component);
+            // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+          });
+      return;
+    }
+  }
+  select_identity_dimensions(result, matrices, data, extents,
+                             number_of_independent_components);
+}
+
+template <typename ElementType, size_t Dim, bool... DimensionIsIdentity>
+template <typename MatrixType>
+void Impl<ElementType, Dim, DimensionIsIdentity...>::select_identity_dimensions(
+    const gsl::not_null<ElementType*> result,
+    const std::array<MatrixType, Dim>& matrices, const ElementType* const data,
+    const Index<Dim>& extents, const size_t number_of_independent_components) {
   if (dereference_wrapper(matrices[sizeof...(DimensionIsIdentity)]) ==
       Matrix{}) {
     Impl<ElementType, Dim, DimensionIsIdentity..., true>::apply(
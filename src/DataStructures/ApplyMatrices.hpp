@@ -27,6 +27,12 @@ struct Impl {
                     const std::array<MatrixType, Dim>& matrices,
                     const ElementType* data, const Index<Dim>& extents,
                     size_t number_of_independent_components);
+
+  template <typename MatrixType>
+  static void select_identity_dimensions(
+      gsl::not_null<ElementType*> result,
+      const std::array<MatrixType, Dim>& matrices, const ElementType* data,
+      const Index<Dim>& extents, size_t number_of_independent_components);
 };
 
 template <typename MatrixType, size_t Dim>
@@ -59,6 +65,9 @@ size_t result_size(const std::array<MatrixType, Dim>& matrices,
 /// will be treated as the identity, but the matrix multiplications
 /// will be skipped for increased efficiency.
 ///
+/// If `sys::node_thread_pool()` has more than one thread, large
+/// transformations are split by tensor component among its threads.
+///
 /// \note The element type stored in the vectors to be transformed may be either
 /// `double` or `std::complex<double>`. The matrix, however, must be real. In
 /// the case of acting on a vector of complex values, the matrix is treated as
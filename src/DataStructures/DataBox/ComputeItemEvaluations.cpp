@@ -0,0 +1,56 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "DataStructures/DataBox/ComputeItemEvaluations.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <map>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace db {
+namespace {
+// Elements of an unordered_map are never moved, so references to the counts
+// handed out by `compute_item_evaluation_counter` remain valid.
+std::unordered_map<std::string, size_t>& evaluation_counts() {
+  thread_local std::unordered_map<std::string, size_t> counts{};
+  return counts;
+}
+}  // namespace
+
+std::map<std::string, size_t> compute_item_evaluations() {
+  const auto& counts = evaluation_counts();
+  return {counts.begin(), counts.end()};
+}
+
+void reset_compute_item_evaluations() {
+  for (auto& [tag_name, count] : evaluation_counts()) {
+    (void)tag_name;
+    count = 0;
+  }
+}
+
+void write_compute_item_evaluations(std::ostream& os) {
+  const auto& counts = evaluation_counts();
+  std::vector<std::pair<std::string, size_t>> sorted_counts(counts.begin(),
+                                                            counts.end());
+  std::sort(sorted_counts.begin(), sorted_counts.end(),
+            [](const auto& lhs, const auto& rhs) {
+              return lhs.second != rhs.second ? lhs.second > rhs.second
+                                              : lhs.first < rhs.first;
+            });
+  for (const auto& [tag_name, count] : sorted_counts) {
+    os << tag_name << ": " << count << "\n";
+  }
+}
+
+namespace detail {
+size_t& compute_item_evaluation_counter(const std::string& tag_name) {
+  return evaluation_counts()[tag_name];
+}
+}  // namespace detail
+}  // namespace db
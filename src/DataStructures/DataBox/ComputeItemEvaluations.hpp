@@ -0,0 +1,46 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <iosfwd>
+#include <map>
+#include <string>
+
+namespace db {
+/*!
+ * \ingroup DataBoxGroup
+ * \brief The number of times each compute item was evaluated on this thread,
+ * keyed by the name of the compute tag.
+ *
+ * \details Evaluations are only counted in builds with `ENABLE_PROFILING`, so
+ * the result is empty otherwise. Comparing the counts with the number of steps
+ * taken shows which compute items are reset more often than their inputs
+ * actually change, e.g. candidates for db::reset_dependents_only_if_changed.
+ */
+std::map<std::string, size_t> compute_item_evaluations();
+
+/// \ingroup DataBoxGroup
+/// \brief Sets all counts returned by db::compute_item_evaluations() on this
+/// thread to zero.
+void reset_compute_item_evaluations();
+
+/*!
+ * \ingroup DataBoxGroup
+ * \brief Writes the counts returned by db::compute_item_evaluations() on this
+ * thread to `os`, one compute tag per line, most evaluated first.
+ *
+ * \details To dump the counts of a thread during profiling, e.g. from an
+ * action, write them to a `std::stringstream` and pass its string to
+ * `Parallel::printf`. Nothing is written if there are no counts, in
+ * particular in builds without `ENABLE_PROFILING`.
+ */
+void write_compute_item_evaluations(std::ostream& os);
+
+namespace detail {
+// The evaluation count of the compute item named `tag_name` on this thread.
+// The reference stays valid for the lifetime of the thread.
+size_t& compute_item_evaluation_counter(const std::string& tag_name);
+}  // namespace detail
+}  // namespace db
@@ -323,7 +323,9 @@ class DataBox<tmpl::list<Tags...>> : public Access,
   template <bool PrintImmutableItems = true>
   std::string print_items() const;
 
-  /// The size in bytes of each item (excluding reference items)
+  /// The size in bytes of each item (excluding reference items and the items
+  /// in `TagsToSkip`)
+  template <typename TagsToSkip = tmpl::list<>>
   std::map<std::string, size_t> size_of_items() const;
 
   /// Retrieve the tag `Tag`, should be called by the free function db::get
@@ -340,6 +342,11 @@ class DataBox<tmpl::list<Tags...>> : public Access,
   template <typename Tag>
   auto& get_mutable_reference();
 
+  /// Reset the compute items with tags `ComputeTagsList` and free their
+  /// memory, should be called by the free function db::release_compute_items
+  template <typename ComputeTagsList>
+  void release_compute_items();
+
   /// Check whether a tags depends on another tag.  Should be called
   /// through the metafunction db::tag_depends_on.
   template <typename Consumer, typename Provider>
@@ -552,13 +559,15 @@ std::string DataBox<tmpl::list<Tags...>>::print_items() const {
 }
 
 template <typename... Tags>
+template <typename TagsToSkip>
 std::map<std::string, size_t> DataBox<tmpl::list<Tags...>>::size_of_items()
     const {
   std::map<std::string, size_t> result{};
   const auto add_item_size = [this, &result](auto tag_v) {
     (void)this;
     using tag = tmpl::type_from<decltype(tag_v)>;
-    if constexpr (not db::is_reference_tag_v<tag>) {
+    if constexpr (not db::is_reference_tag_v<tag> and
+                  not tmpl::list_contains_v<TagsToSkip, tag>) {
       // For item of ItemType::Compute, this will not evaluate its function
       // (i.e. if the item has never been evaluated its size will be that of a
       // default initialized object)
@@ -1102,6 +1111,37 @@ db::DataBox<tmpl::list<Tags...>>::reset_all_subitems() {
   });
 }
 
+namespace detail {
+// The value of a mutable item before it is mutated, for items whose dependents
+// are only reset if the value changes.  Other items store nothing and are
+// always considered changed.
+template <typename Tag, bool = reset_dependents_only_if_changed_v<Tag>>
+class ValueBeforeMutate {
+ public:
+  template <typename T>
+  explicit ValueBeforeMutate(const T& /*value*/) {}
+
+  template <typename T>
+  bool changed(const T& /*value*/) const {
+    return true;
+  }
+};
+
+template <typename Tag>
+class ValueBeforeMutate<Tag, true> {
+ public:
+  explicit ValueBeforeMutate(const typename Tag::type& value)
+      : value_(value) {}
+
+  bool changed(const typename Tag::type& value) const {
+    return not(value_ == value);
+  }
+
+ private:
+  typename Tag::type value_;
+};
+}  // namespace detail
+
 /*!
  * \ingroup DataBoxGroup
  * \brief Allows changing the state of one or more non-computed elements in
@@ -1126,6 +1166,10 @@ db::DataBox<tmpl::list<Tags...>>::reset_all_subitems() {
  * The `invokable` may have function return values, and any returns are
  * forwarded as returns to the `db::mutate` call.
  *
+ * All compute items that depend on the mutated items are reset, unless a
+ * mutated item opts into db::reset_dependents_only_if_changed and its value
+ * compares equal to its value before the mutation.
+ *
  * For convenience in generic programming, if `::Tags::DataBox` is
  * passed as the sole `MutateTags` parameter, this function will
  * simply call its first argument with its remaining arguments.
@@ -1167,13 +1211,26 @@ decltype(auto) mutate(Invokable&& invokable,
           "passed to the mutate function.");
     }
 
-    const CleanupRoutine unlock_box = [&box]() {
+    const std::tuple<detail::ValueBeforeMutate<
+        detail::first_matching_tag<TagList, MutateTags>>...>
+        values_before_mutate{
+            box->template get_item<
+                   detail::first_matching_tag<TagList, MutateTags>>()
+                .get()...};
+    const CleanupRoutine unlock_box = [&box, &values_before_mutate]() {
       box->mutate_locked_box_ = false;
       EXPAND_PACK_LEFT_TO_RIGHT(
           box->template mutate_mutable_subitems<MutateTags>());
-      EXPAND_PACK_LEFT_TO_RIGHT(
-          box->template reset_compute_items_after_mutate<
-              detail::first_matching_tag<TagList, MutateTags>>());
+      const auto reset_if_changed = [&box,
+                                     &values_before_mutate](auto tag_v) {
+        using item_tag = tmpl::type_from<decltype(tag_v)>;
+        if (std::get<detail::ValueBeforeMutate<item_tag>>(values_before_mutate)
+                .changed(box->template get_item<item_tag>().get())) {
+          box->template reset_compute_items_after_mutate<item_tag>();
+        }
+      };
+      EXPAND_PACK_LEFT_TO_RIGHT(reset_if_changed(
+          tmpl::type_<detail::first_matching_tag<TagList, MutateTags>>{}));
     };
     box->mutate_locked_box_ = true;
     return invokable(
@@ -1404,6 +1461,58 @@ SPECTRE_ALWAYS_INLINE auto& get_mutable_reference(
   return box->template get_mutable_reference<Tag>();
 }
 
+/// \cond
+template <typename... Tags>
+template <typename ComputeTagsList>
+void DataBox<tmpl::list<Tags...>>::release_compute_items() {
+  if (UNLIKELY(mutate_locked_box_)) {
+    ERROR("Unable to release compute items from within a call to mutate.");
+  }
+  tmpl::for_each<ComputeTagsList>([this](auto tag_v) {
+    using tag = tmpl::type_from<decltype(tag_v)>;
+    DEBUG_STATIC_ASSERT(
+        not detail::has_no_matching_tag_v<tmpl::list<Tags...>, tag>,
+        "Found no tags in the DataBox that match the tag being released.");
+    DEBUG_STATIC_ASSERT(
+        detail::has_unique_matching_tag_v<tmpl::list<Tags...>, tag>,
+        "Found more than one tag in the DataBox that matches the tag "
+        "being released.");
+    using item_tag = detail::first_matching_tag<tmpl::list<Tags...>, tag>;
+    DEBUG_STATIC_ASSERT(
+        detail::Item<item_tag>::item_type == detail::ItemType::Compute,
+        "Can only release compute items");
+    DEBUG_STATIC_ASSERT(not detail::has_subitems_v<item_tag>,
+                        "Cannot release compute items with subitems.");
+    auto& item = get_item<item_tag>();
+    if (item.evaluated()) {
+      // Items computed from this one may hold references or copies of its
+      // value, so they must be recomputed as well.
+      const std::string item_name =
+          pretty_type::get_name<detail::get_base<item_tag>>();
+      if (tag_graphs_.tags_and_dependents.find(item_name) !=
+          tag_graphs_.tags_and_dependents.end()) {
+        reset_compute_items(item_name);
+      }
+    }
+    item.release();
+  });
+}
+/// \endcond
+
+/*!
+ * \ingroup DataBoxGroup
+ * \brief Free the memory held by the compute items with tags
+ * `ComputeTagsList`.
+ *
+ * The items, and all compute items depending on them, are reset so they are
+ * recomputed the next time they are retrieved. This is useful for items that
+ * are expensive to store but are only needed some of the time.
+ */
+template <typename ComputeTagsList, typename TagList>
+void release_compute_items(const gsl::not_null<DataBox<TagList>*> box) {
+  box->template release_compute_items<ComputeTagsList>();
+}
+
 /// @{
 /*!
  * \ingroup DataBoxGroup
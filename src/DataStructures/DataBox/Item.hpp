@@ -7,8 +7,10 @@
 #include <pup.h>
 #include <utility>
 
+#include "DataStructures/DataBox/ComputeItemEvaluations.hpp"
 #include "DataStructures/DataBox/TagTraits.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/PrettyType.hpp"
 #include "Utilities/Requires.hpp"
 
 /// \cond
@@ -86,6 +88,9 @@ class Item<Tag, ItemType::Mutable> {
 // (directly or indirectly) on the mutated item will have their reset function
 // called.
 //
+// db::release_compute_items calls release, which resets the item and replaces
+// its value by a default constructed object to free its memory.
+//
 // A compute item may not be directly mutated (its value only changes after one
 // of its dependencies changes and it is fetched again)
 template <typename Tag>
@@ -108,8 +113,19 @@ class Item<Tag, ItemType::Compute> {
 
   void reset() { evaluated_ = false; }
 
+  // Like reset, but also frees the memory held by the value.
+  void release() {
+    value_ = value_type{};
+    evaluated_ = false;
+  }
+
   template <typename... Args>
   void evaluate(const Args&... args) const {
+#ifdef SPECTRE_PROFILING
+    static thread_local size_t& evaluations =
+        compute_item_evaluation_counter(pretty_type::get_name<Tag>());
+    ++evaluations;
+#endif  // SPECTRE_PROFILING
     Tag::function(make_not_null(&value_), args...);
     evaluated_ = true;
   }
@@ -144,4 +144,35 @@ struct is_base_tag
 template <typename Tag>
 constexpr bool is_base_tag_v = is_base_tag<Tag>::value;
 
+/*!
+ * \ingroup DataBoxGroup
+ * \brief Check if the items depending on the simple tag `Tag` are only reset by
+ * `db::mutate` when the value of `Tag` changes.
+ *
+ * \details A simple tag opts in by defining
+ * `static constexpr bool reset_dependents_only_if_changed = true;`. Its value
+ * is then copied before each `db::mutate` of the tag and compared with
+ * `operator==` afterwards, so this should only be used for tags whose values
+ * are cheap to copy and compare, and whose dependents are expensive to
+ * recompute.
+ *
+ * \see reset_dependents_only_if_changed_v
+ */
+template <typename Tag, typename = std::void_t<>>
+struct reset_dependents_only_if_changed : std::false_type {};
+
+/// \cond
+template <typename Tag>
+struct reset_dependents_only_if_changed<
+    Tag, std::void_t<decltype(Tag::reset_dependents_only_if_changed)>>
+    : std::bool_constant<Tag::reset_dependents_only_if_changed> {};
+/// \endcond
+
+/// \ingroup DataBoxGroup
+/// \brief True if the items depending on `Tag` are only reset when its value
+/// changes.
+template <typename Tag>
+constexpr bool reset_dependents_only_if_changed_v =
+    reset_dependents_only_if_changed<Tag>::value;
+
 }  // namespace db
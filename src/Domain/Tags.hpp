@@ -58,9 +58,14 @@ struct Element : db::SimpleTag {
 /// \brief The computational grid of the Element in the DataBox
 /// \details The corresponding interface tag uses Mesh::slice_through to compute
 /// the mesh on the face of the element.
+///
+/// Items depending on the mesh are only reset when it actually changes, since
+/// the mesh is often in the return tags of mutators that leave it unchanged,
+/// e.g. AMR projectors of elements that are not p-refined.
 template <size_t VolumeDim>
 struct Mesh : db::SimpleTag {
   using type = ::Mesh<VolumeDim>;
+  static constexpr bool reset_dependents_only_if_changed = true;
 };
 
 /// \ingroup DataBoxTagsGroup
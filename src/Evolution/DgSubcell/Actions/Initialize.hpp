@@ -31,6 +31,7 @@
 #include "Evolution/DgSubcell/Tags/Jacobians.hpp"
 #include "Evolution/DgSubcell/Tags/Mesh.hpp"
 #include "Evolution/DgSubcell/Tags/ReconstructionOrder.hpp"
+#include "Evolution/DgSubcell/Tags/StepsOnDg.hpp"
 #include "Evolution/DgSubcell/Tags/StepsSinceTciCall.hpp"
 #include "Evolution/DgSubcell/Tags/SubcellOptions.hpp"
 #include "Evolution/DgSubcell/Tags/TciCallsSinceRollback.hpp"
@@ -40,11 +41,15 @@
 #include "NumericalAlgorithms/Interpolation/IrregularInterpolant.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "Parallel/AlgorithmExecution.hpp"
+#include "Parallel/ArrayCollection/IsDgElementCollection.hpp"
+#include "Parallel/ArrayCollection/SendDataToElement.hpp"
 #include "Parallel/GlobalCache.hpp"
+#include "Parallel/Invoke.hpp"
 #include "Time/Tags/HistoryEvolvedVariables.hpp"
 #include "Utilities/CallWithDynamicType.hpp"
 #include "Utilities/ContainerHelpers.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
 
@@ -72,6 +77,7 @@ namespace evolution::dg::subcell::Actions {
  *   - `subcell::Tags::DidRollback`
  *   - `subcell::Tags::TciGridHistory`
  *   - `subcell::Tags::TciCallsSinceRollback`
+ *   - `subcell::Tags::StepsOnDg`
  *   - `subcell::Tags::GhostDataForReconstruction<Dim>`
  *   - `subcell::Tags::TciDecision`
  *   - `subcell::Tags::DataForRdmpTci`
@@ -93,7 +99,7 @@ struct SetSubcellGrid {
 
   using simple_tags = tmpl::list<
       Tags::ActiveGrid, Tags::DidRollback, Tags::TciGridHistory,
-      Tags::TciCallsSinceRollback, Tags::StepsSinceTciCall,
+      Tags::TciCallsSinceRollback, Tags::StepsSinceTciCall, Tags::StepsOnDg,
       Tags::GhostDataForReconstruction<Dim>, Tags::TciDecision,
       Tags::NeighborTciDecisions<Dim>, Tags::DataForRdmpTci,
       subcell::Tags::CellCenteredFlux<typename System::flux_variables, Dim>,
@@ -188,7 +194,7 @@ struct SetSubcellGrid {
         tmpl::list<Tags::ActiveGrid, Tags::DidRollback,
                    typename System::variables_tag, subcell::Tags::TciDecision,
                    subcell::Tags::TciCallsSinceRollback,
-                   subcell::Tags::StepsSinceTciCall>,
+                   subcell::Tags::StepsSinceTciCall, subcell::Tags::StepsOnDg>,
         tmpl::list<>>(
         [&cell_is_not_on_external_boundary, &dg_mesh,
          subcell_allowed_in_element, &subcell_mesh](
@@ -197,7 +203,8 @@ struct SetSubcellGrid {
             const auto active_vars_ptr,
             const gsl::not_null<int*> tci_decision_ptr,
             const gsl::not_null<size_t*> tci_calls_since_rollback_ptr,
-            const gsl::not_null<size_t*> steps_since_tci_call_ptr) {
+            const gsl::not_null<size_t*> steps_since_tci_call_ptr,
+            const gsl::not_null<size_t*> steps_on_dg_ptr) {
           // We don't consider setting the initial grid to subcell as rolling
           // back. Since no time step is undone, we just continue on the
           // subcells as a normal solve.
@@ -216,6 +223,7 @@ struct SetSubcellGrid {
           *tci_decision_ptr = 0;
           *tci_calls_since_rollback_ptr = 0;
           *steps_since_tci_call_ptr = 0;
+          *steps_on_dg_ptr = 0;
         },
         make_not_null(&box));
     if constexpr (System::has_primitive_and_conservative_vars) {
@@ -297,12 +305,24 @@ struct SetAndCommunicateInitialRdmpData {
         evolution::dg::subcell::InitialTciData data{{}, rdmp_data};
         // We use temporal ID 0 for sending RDMP data
         const int temporal_id = 0;
-        Parallel::receive_data<
-            evolution::dg::subcell::Tags::InitialTciData<Dim>>(
-            receiver_proxy[neighbor], temporal_id,
-            std::make_pair(
-                DirectionalId<Dim>{direction_from_neighbor, element.id()},
-                std::move(data)));
+        if constexpr (Parallel::is_dg_element_collection_v<
+                          ParallelComponent>) {
+          Parallel::local_synchronous_action<
+              Parallel::Actions::SendDataToElement>(
+              receiver_proxy, make_not_null(&cache),
+              evolution::dg::subcell::Tags::InitialTciData<Dim>{}, neighbor,
+              temporal_id,
+              std::make_pair(
+                  DirectionalId<Dim>{direction_from_neighbor, element.id()},
+                  std::move(data)));
+        } else {
+          Parallel::receive_data<
+              evolution::dg::subcell::Tags::InitialTciData<Dim>>(
+              receiver_proxy[neighbor], temporal_id,
+              std::make_pair(
+                  DirectionalId<Dim>{direction_from_neighbor, element.id()},
+                  std::move(data)));
+        }
       }
     }
 
@@ -431,12 +451,24 @@ struct ComputeAndSendTciOnInitialGrid {
           evolution::dg::subcell::InitialTciData data{tci_decision, {}};
           // We use temporal ID 1 for ending the TCI decision.
           const int temporal_id = 1;
-          Parallel::receive_data<
-              evolution::dg::subcell::Tags::InitialTciData<Dim>>(
-              receiver_proxy[neighbor], temporal_id,
-              std::make_pair(
-                  DirectionalId<Dim>{direction_from_neighbor, element.id()},
-                  std::move(data)));
+          if constexpr (Parallel::is_dg_element_collection_v<
+                            ParallelComponent>) {
+            Parallel::local_synchronous_action<
+                Parallel::Actions::SendDataToElement>(
+                receiver_proxy, make_not_null(&cache),
+                evolution::dg::subcell::Tags::InitialTciData<Dim>{}, neighbor,
+                temporal_id,
+                std::make_pair(
+                    DirectionalId<Dim>{direction_from_neighbor, element.id()},
+                    std::move(data)));
+          } else {
+            Parallel::receive_data<
+                evolution::dg::subcell::Tags::InitialTciData<Dim>>(
+                receiver_proxy[neighbor], temporal_id,
+                std::make_pair(
+                    DirectionalId<Dim>{direction_from_neighbor, element.id()},
+                    std::move(data)));
+          }
         }
       }
     };
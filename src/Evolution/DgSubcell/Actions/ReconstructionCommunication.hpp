@@ -46,6 +46,8 @@
 #include "Evolution/DgSubcell/Tags/Reconstructor.hpp"
 #include "Evolution/DgSubcell/Tags/TciStatus.hpp"
 #include "Evolution/DiscontinuousGalerkin/BoundaryData.hpp"
+#include "Evolution/DiscontinuousGalerkin/BoundaryDataEncoding.hpp"
+#include "Evolution/DiscontinuousGalerkin/BoundaryDataEncodingTags.hpp"
 #include "Evolution/DiscontinuousGalerkin/InboxTags.hpp"
 #include "Evolution/DiscontinuousGalerkin/MortarData.hpp"
 #include "Evolution/DiscontinuousGalerkin/MortarTags.hpp"
@@ -53,7 +55,10 @@
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
 #include "Parallel/AlgorithmExecution.hpp"
+#include "Parallel/ArrayCollection/IsDgElementCollection.hpp"
+#include "Parallel/ArrayCollection/SendDataToElement.hpp"
 #include "Parallel/GlobalCache.hpp"
+#include "Parallel/Invoke.hpp"
 #include "Time/TimeStepId.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/Gsl.hpp"
@@ -146,11 +151,6 @@ struct SendDataForReconstruction {
         db::get<evolution::dg::subcell::Tags::Reconstructor>(box)
             .ghost_zone_size();
 
-    // Optimization note: could save a copy+allocation if we moved
-    // all_sliced_data when possible before sending.
-    //
-    // Note: RDMP size doesn't help here since we need to slice data after
-    // anyway, so no way to save an allocation through that.
     const auto& cell_centered_flux =
         db::get<Tags::CellCenteredFlux<flux_variables, Dim>>(box);
     DataVector volume_data_to_slice = db::mutate_apply(
@@ -168,16 +168,24 @@ struct SendDataForReconstruction {
               static_cast<std::ptrdiff_t>(volume_data_to_slice.size() -
                                           cell_centered_flux.value().size())));
     }
-    const DirectionMap<Dim, DataVector> all_sliced_data = slice_data(
+    const RdmpTciData& rdmp_tci_data = db::get<Tags::DataForRdmpTci>(box);
+    const size_t rdmp_size = rdmp_tci_data.max_variables_values.size() +
+                             rdmp_tci_data.min_variables_values.size();
+    // The sliced data for each direction is allocated with room for the RDMP
+    // data at its end, so that it can be moved into the message to the
+    // neighbor without another allocation and copy.
+    DirectionMap<Dim, DataVector> all_sliced_data = slice_data(
         volume_data_to_slice, subcell_mesh.extents(), ghost_zone_size,
-        element.internal_boundaries(), 0,
+        element.internal_boundaries(), rdmp_size,
         db::get<
             evolution::dg::subcell::Tags::InterpolatorsFromFdToNeighborFd<Dim>>(
             box));
 
     auto& receiver_proxy =
         Parallel::get_parallel_component<ParallelComponent>(cache);
-    const RdmpTciData& rdmp_tci_data = db::get<Tags::DataForRdmpTci>(box);
+    const evolution::dg::BoundaryDataEncoding ghost_cell_data_encoding =
+        evolution::dg::boundary_data_encoding<
+            evolution::dg::Tags::GhostCellDataEncoding>(cache);
     const TimeStepId& time_step_id = db::get<::Tags::TimeStepId>(box);
     const TimeStepId& next_time_step_id = [&box]() {
       if (LocalTimeStepping) {
@@ -199,50 +207,58 @@ struct SendDataForReconstruction {
              "condition could be relaxed to support AMR only where the "
              "evolution is using DG without any changes to subcell.");
 
+      DataVector& sliced_data_in_direction = all_sliced_data.at(direction);
+      // Note: Currently we interpolate our solution to our neighbor FD grid
+      // even when grid points align but are oriented differently. There's a
+      // possible optimization for the rare (almost never?) edge case where
+      // two blocks have the same ghost zone coordinates but have different
+      // orientations (e.g. RotatedBricks). Since this shouldn't ever happen
+      // outside of tests, we currently don't bother with it. If we wanted to,
+      // here's the code:
+      //
+      // if (not orientation.is_aligned()) {
+      //   std::array<size_t, Dim> slice_extents{};
+      //   for (size_t d = 0; d < Dim; ++d) {
+      //     gsl::at(slice_extents, d) = subcell_mesh.extents(d);
+      //   }
+      //   gsl::at(slice_extents, direction.dimension()) = ghost_zone_size;
+      //   // Need views so we only get the subcell data and not the rdmp
+      //   // data
+      //   DataVector oriented_data{sliced_data_in_direction.size()};
+      //   DataVector oriented_data_view{oriented_data.data(),
+      //                                 oriented_data.size() - rdmp_size};
+      //   const DataVector sliced_data_view{
+      //       sliced_data_in_direction.data(),
+      //       sliced_data_in_direction.size() - rdmp_size};
+      //   orient_variables(make_not_null(&oriented_data_view),
+      //                    sliced_data_view, Index<Dim>{slice_extents},
+      //                    orientation);
+      //   sliced_data_in_direction = std::move(oriented_data);
+      // }
+      //
+      // The data is already oriented from interpolation, so we only need to
+      // copy the rdmp data to the end of the sliced data.
+      std::copy(rdmp_tci_data.max_variables_values.cbegin(),
+                rdmp_tci_data.max_variables_values.cend(),
+                std::prev(sliced_data_in_direction.end(),
+                          static_cast<int>(rdmp_size)));
+      std::copy(rdmp_tci_data.min_variables_values.cbegin(),
+                rdmp_tci_data.min_variables_values.cend(),
+                std::prev(sliced_data_in_direction.end(),
+                          static_cast<int>(
+                              rdmp_tci_data.min_variables_values.size())));
+      evolution::dg::round_to_encoding_precision(
+          make_not_null(&sliced_data_in_direction), ghost_cell_data_encoding);
+
+      const size_t total_neighbors = neighbors_in_direction.size();
+      size_t neighbor_count = 1;
       for (const ElementId<Dim>& neighbor : neighbors_in_direction) {
-        const size_t rdmp_size = rdmp_tci_data.max_variables_values.size() +
-                                 rdmp_tci_data.min_variables_values.size();
-        const auto& sliced_data_in_direction = all_sliced_data.at(direction);
-        // Allocate with subcell data and rdmp data
-        DataVector subcell_data_to_send{sliced_data_in_direction.size() +
-                                        rdmp_size};
-        // Note: Currently we interpolate our solution to our neighbor FD grid
-        // even when grid points align but are oriented differently. There's a
-        // possible optimization for the rare (almost never?) edge case where
-        // two blocks have the same ghost zone coordinates but have different
-        // orientations (e.g. RotatedBricks). Since this shouldn't ever happen
-        // outside of tests, we currently don't bother with it. If we wanted to,
-        // here's the code:
-        //
-        // if (not orientation.is_aligned()) {
-        //   std::array<size_t, Dim> slice_extents{};
-        //   for (size_t d = 0; d < Dim; ++d) {
-        //     gsl::at(slice_extents, d) = subcell_mesh.extents(d);
-        //   }
-        //   gsl::at(slice_extents, direction.dimension()) = ghost_zone_size;
-        //   // Need a view so we only get the subcell data and not the rdmp
-        //   // data
-        //   DataVector subcell_data_to_send_view{
-        //       subcell_data_to_send.data(),
-        //       subcell_data_to_send.size() - rdmp_size};
-        //   orient_variables(make_not_null(&subcell_data_to_send_view),
-        //                  sliced_data_in_direction, Index<Dim>{slice_extents},
-        //                  orientation);
-        // } else { std::copy(...); }
-        //
-        // Copy over data since it's already oriented from interpolation
-        std::copy(sliced_data_in_direction.begin(),
-                  sliced_data_in_direction.end(), subcell_data_to_send.begin());
-        // Copy rdmp data to end of subcell_data_to_send
-        std::copy(
-            rdmp_tci_data.max_variables_values.cbegin(),
-            rdmp_tci_data.max_variables_values.cend(),
-            std::prev(subcell_data_to_send.end(), static_cast<int>(rdmp_size)));
-        std::copy(rdmp_tci_data.min_variables_values.cbegin(),
-                  rdmp_tci_data.min_variables_values.cend(),
-                  std::prev(subcell_data_to_send.end(),
-                            static_cast<int>(
-                                rdmp_tci_data.min_variables_values.size())));
+        // Move instead of copy for the last neighbor in the direction.
+        DataVector subcell_data_to_send =
+            neighbor_count == total_neighbors
+                ? std::move(sliced_data_in_direction)
+                : DataVector{sliced_data_in_direction};
+        ++neighbor_count;
 
         evolution::dg::BoundaryData<Dim> data{
             subcell_mesh,
@@ -250,13 +266,31 @@ struct SendDataForReconstruction {
             std::move(subcell_data_to_send),
             std::nullopt,
             next_time_step_id,
-            tci_decision};
+            tci_decision,
+            ghost_cell_data_encoding,
+            evolution::dg::BoundaryDataEncoding::Double};
 
-        Parallel::receive_data<
-            evolution::dg::Tags::BoundaryCorrectionAndGhostCellsInbox<Dim>>(
-            receiver_proxy[neighbor], time_step_id,
-            std::pair{DirectionalId<Dim>{direction_from_neighbor, element.id()},
-                      std::move(data)});
+        // Elements on the same node in a DgElementCollection receive the data
+        // directly in their inbox, so the buffer is handed over without
+        // being serialized or copied.
+        if constexpr (Parallel::is_dg_element_collection_v<
+                          ParallelComponent>) {
+          Parallel::local_synchronous_action<
+              Parallel::Actions::SendDataToElement>(
+              receiver_proxy, make_not_null(&cache),
+              evolution::dg::Tags::BoundaryCorrectionAndGhostCellsInbox<Dim>{},
+              neighbor, time_step_id,
+              std::pair{
+                  DirectionalId<Dim>{direction_from_neighbor, element.id()},
+                  std::move(data)});
+        } else {
+          Parallel::receive_data<
+              evolution::dg::Tags::BoundaryCorrectionAndGhostCellsInbox<Dim>>(
+              receiver_proxy[neighbor], time_step_id,
+              std::pair{
+                  DirectionalId<Dim>{direction_from_neighbor, element.id()},
+                  std::move(data)});
+        }
       }
     }
     return {Parallel::AlgorithmExecution::Continue, std::nullopt};
@@ -419,7 +453,8 @@ struct ReceiveDataForReconstruction {
 
               evolution::dg::subcell::insert_neighbor_rdmp_and_volume_data(
                   rdmp_tci_data_ptr, ghost_data_ptr,
-                  *received_data[directional_element_id].ghost_cell_data,
+                  std::move(
+                      *received_data[directional_element_id].ghost_cell_data),
                   number_of_rdmp_vars, directional_element_id,
                   neighbor_mesh->at(directional_element_id), element,
                   subcell_mesh, ghost_zone_size,
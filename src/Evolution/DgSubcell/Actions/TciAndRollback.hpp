@@ -37,8 +37,10 @@
 #include "Evolution/DgSubcell/Tags/DidRollback.hpp"
 #include "Evolution/DgSubcell/Tags/GhostDataForReconstruction.hpp"
 #include "Evolution/DgSubcell/Tags/Interpolators.hpp"
+#include "Evolution/DgSubcell/Tags/Jacobians.hpp"
 #include "Evolution/DgSubcell/Tags/Mesh.hpp"
 #include "Evolution/DgSubcell/Tags/Reconstructor.hpp"
+#include "Evolution/DgSubcell/Tags/StepsOnDg.hpp"
 #include "Evolution/DgSubcell/Tags/SubcellOptions.hpp"
 #include "Evolution/DgSubcell/Tags/TciStatus.hpp"
 #include "Evolution/DiscontinuousGalerkin/InboxTags.hpp"
@@ -52,6 +54,7 @@
 #include "Time/Tags/HistoryEvolvedVariables.hpp"
 #include "Utilities/ContainerHelpers.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
 
@@ -85,6 +88,15 @@ namespace evolution::dg::subcell::Actions {
  * \f$G\f$ to the subcells for the scheme to be conservative. The subcell
  * actions know if a rollback was done because the local mortar data would
  * already be computed.
+ *
+ * If the cell stays on DG, `subcell::Tags::StepsOnDg` is incremented at the
+ * start of each step. When it reaches
+ * `subcell_options.steps_on_dg_before_freeing_subcell_data()` the memory of
+ * the subcell coordinate and Jacobian compute items is freed using
+ * `db::release_compute_items`. This is done only once per stay on the DG grid:
+ * nothing on the DG grid retrieves these items, so they stay unallocated until
+ * the element switches to the subcell grid. `TciAndSwitchToDg` resets the
+ * counter when the element returns to DG.
  */
 template <typename TciMutator>
 struct TciAndRollback {
@@ -206,6 +218,8 @@ struct TciAndRollback {
             *rdmp_tci_data_ptr = std::move(std::get<1>(std::move(tci_result)));
           },
           make_not_null(&box));
+      free_subcell_data_if_on_dg_long_enough<Dim>(make_not_null(&box),
+                                                  subcell_options);
       return {Parallel::AlgorithmExecution::Continue, std::nullopt};
     }
 
@@ -319,5 +333,42 @@ struct TciAndRollback {
                                      BeginSubcellAfterDgRollback>>::value +
                 1};
   }
+
+ private:
+  // The subcell coordinates and Jacobians are compute items that keep their
+  // memory once evaluated, even though they are only needed on the subcell
+  // grid. We free them once the element has been on the DG grid for
+  // `subcell_options.steps_on_dg_before_freeing_subcell_data()` steps. They
+  // are recomputed when they are next retrieved. Since the counter keeps
+  // increasing, this happens only once per stay on the DG grid.
+  template <size_t Dim, typename DbTags>
+  static void free_subcell_data_if_on_dg_long_enough(
+      const gsl::not_null<db::DataBox<DbTags>*> box,
+      const SubcellOptions& subcell_options) {
+    if (not subcell_options.steps_on_dg_before_freeing_subcell_data()
+                .has_value() or
+        db::get<::Tags::TimeStepId>(*box).substep() != 0) {
+      return;
+    }
+    db::mutate<Tags::StepsOnDg>(
+        [](const gsl::not_null<size_t*> steps_on_dg_ptr) {
+          ++(*steps_on_dg_ptr);
+        },
+        box);
+    if (db::get<Tags::StepsOnDg>(*box) ==
+        subcell_options.steps_on_dg_before_freeing_subcell_data().value()) {
+      using subcell_data_tags = tmpl::filter<
+          tmpl::list<Tags::Coordinates<Dim, Frame::ElementLogical>,
+                     Tags::Coordinates<Dim, Frame::Grid>,
+                     Tags::Coordinates<Dim, Frame::Inertial>,
+                     fd::Tags::InverseJacobianLogicalToGrid<Dim>,
+                     fd::Tags::DetInverseJacobianLogicalToGrid,
+                     fd::Tags::InverseJacobianLogicalToInertial<Dim>,
+                     fd::Tags::DetInverseJacobianLogicalToInertial>,
+          tmpl::bind<db::tag_is_retrievable, tmpl::_1,
+                     tmpl::pin<db::DataBox<DbTags>>>>;
+      db::release_compute_items<subcell_data_tags>(box);
+    }
+  }
 };
 }  // namespace evolution::dg::subcell::Actions
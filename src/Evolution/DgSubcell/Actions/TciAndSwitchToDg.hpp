@@ -30,6 +30,7 @@
 #include "Evolution/DgSubcell/Tags/DidRollback.hpp"
 #include "Evolution/DgSubcell/Tags/GhostDataForReconstruction.hpp"
 #include "Evolution/DgSubcell/Tags/Mesh.hpp"
+#include "Evolution/DgSubcell/Tags/StepsOnDg.hpp"
 #include "Evolution/DgSubcell/Tags/StepsSinceTciCall.hpp"
 #include "Evolution/DgSubcell/Tags/SubcellOptions.hpp"
 #include "Evolution/DgSubcell/Tags/TciCallsSinceRollback.hpp"
@@ -140,6 +141,7 @@ namespace evolution::dg::subcell::Actions {
  *   - `subcell::Tags::GhostDataForReconstruction<Dim>`
  *     if the cell is not troubled
  *   - `subcell::Tags::TciGridHistory` if the time stepper is a multistep method
+ *   - `subcell::Tags::StepsOnDg` is reset to zero if the cell is not troubled
  */
 template <typename TciMutator>
 struct TciAndSwitchToDg {
@@ -309,6 +311,7 @@ struct TciAndSwitchToDg {
           Tags::ActiveGrid, subcell::Tags::GhostDataForReconstruction<Dim>,
           evolution::dg::subcell::Tags::TciGridHistory,
           evolution::dg::subcell::Tags::TciCallsSinceRollback,
+          evolution::dg::subcell::Tags::StepsOnDg,
           evolution::dg::subcell::Tags::CellCenteredFlux<flux_variables, Dim>>(
           [&dg_mesh, &subcell_mesh, &subcell_options](
               const auto active_vars_ptr, const auto active_history_ptr,
@@ -318,6 +321,7 @@ struct TciAndSwitchToDg {
                   std::deque<evolution::dg::subcell::ActiveGrid>*>
                   tci_grid_history_ptr,
               const gsl::not_null<size_t*> tci_calls_since_rollback_ptr,
+              const gsl::not_null<size_t*> steps_on_dg_ptr,
               const auto subcell_cell_centered_fluxes) {
             // Note: strictly speaking, to be conservative this should
             // reconstruct uJ instead of u.
@@ -345,6 +349,7 @@ struct TciAndSwitchToDg {
 
             // Reset tci_calls_since_rollback
             *tci_calls_since_rollback_ptr = 0;
+            *steps_on_dg_ptr = 0;
 
             // Clear the allocation for the cell-centered fluxes.
             *subcell_cell_centered_fluxes = std::nullopt;
@@ -3,13 +3,17 @@
 
 #include "Evolution/DgSubcell/GhostData.hpp"
 
+#include <algorithm>
 #include <cstddef>
+#include <iterator>
 #include <ostream>
 #include <pup.h>
 #include <pup_stl.h>
+#include <utility>
 #include <vector>
 
 #include "DataStructures/DataVector.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/Serialization/PupStlCpp17.hpp"
 
@@ -22,9 +26,27 @@ GhostData::GhostData(const size_t number_of_buffers)
 
   local_ghost_data_.resize(number_of_buffers_);
   neighbor_ghost_data_for_reconstruction_.resize(number_of_buffers_);
+  neighbor_received_buffers_.resize(number_of_buffers_);
   buffer_index_ = 0;
 }
 
+GhostData::GhostData(const GhostData& rhs)
+    : number_of_buffers_(rhs.number_of_buffers_),
+      buffer_index_(rhs.buffer_index_),
+      local_ghost_data_(rhs.local_ghost_data_),
+      // Copying a non-owning DataVector gives an owning DataVector, so the
+      // received buffers are not needed.
+      neighbor_ghost_data_for_reconstruction_(
+          rhs.neighbor_ghost_data_for_reconstruction_),
+      neighbor_received_buffers_(rhs.number_of_buffers_) {}
+
+GhostData& GhostData::operator=(const GhostData& rhs) {
+  if (this != &rhs) {
+    *this = GhostData{rhs};
+  }
+  return *this;
+}
+
 void GhostData::next_buffer() {
   buffer_index_ =
       buffer_index_ + 1 == number_of_buffers_ ? 0 : buffer_index_ + 1;
@@ -50,13 +72,57 @@ const DataVector& GhostData::neighbor_ghost_data_for_reconstruction() const {
   return neighbor_ghost_data_for_reconstruction_[buffer_index_];
 }
 
+void GhostData::set_neighbor_ghost_data_for_reconstruction(
+    DataVector data, const size_t number_of_ghost_values) {
+  ASSERT(number_of_ghost_values <= data.size(),
+         "Cannot use " << number_of_ghost_values
+                       << " values of a buffer of size " << data.size()
+                       << " as neighbor ghost data.");
+  DataVector& neighbor_data =
+      neighbor_ghost_data_for_reconstruction_[buffer_index_];
+  DataVector& received_buffer = neighbor_received_buffers_[buffer_index_];
+  // The neighbor data may be a view into the received buffer, so release it
+  // before replacing the buffer.
+  neighbor_data.clear();
+  received_buffer.clear();
+  if (not data.is_owning()) {
+    // A non-owning DataVector cannot be moved from, so copy the values.
+    neighbor_data.destructive_resize(number_of_ghost_values);
+    std::copy(data.begin(),
+              std::next(data.begin(),
+                        static_cast<std::ptrdiff_t>(number_of_ghost_values)),
+              neighbor_data.begin());
+  } else if (number_of_ghost_values == data.size()) {
+    neighbor_data = std::move(data);
+  } else {
+    received_buffer = std::move(data);
+    neighbor_data.set_data_ref(received_buffer.data(), number_of_ghost_values);
+  }
+}
+
 void GhostData::pup(PUP::er& p) {
   p | number_of_buffers_;
   p | buffer_index_;
   p | local_ghost_data_;
-  // Once Charm++ messages are implemented, this will most likely contain
-  // non-owning DataVectors which we will have to account for
-  p | neighbor_ghost_data_for_reconstruction_;
+  // The neighbor ghost data may be non-owning, which a DataVector cannot
+  // serialize, so the values are serialized directly and are owned after
+  // unpacking.
+  if (p.isUnpacking()) {
+    neighbor_ghost_data_for_reconstruction_.clear();
+    neighbor_ghost_data_for_reconstruction_.resize(number_of_buffers_);
+    neighbor_received_buffers_.clear();
+    neighbor_received_buffers_.resize(number_of_buffers_);
+  }
+  for (DataVector& neighbor_data : neighbor_ghost_data_for_reconstruction_) {
+    size_t size = neighbor_data.size();
+    p | size;
+    if (p.isUnpacking()) {
+      neighbor_data.destructive_resize(size);
+    }
+    if (size > 0) {
+      PUParray(p, neighbor_data.data(), size);
+    }
+  }
 }
 
 bool operator==(const GhostData& lhs, const GhostData& rhs) {
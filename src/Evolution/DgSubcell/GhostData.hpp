@@ -26,10 +26,22 @@ namespace evolution::dg::subcell {
  *
  * With Charm++ messages, storing the local ghost data is necessary because it
  * must live somewhere so we can send a pointer to our neighbor.
+ *
+ * The neighbor ghost data can be set from a received buffer without copying
+ * using `set_neighbor_ghost_data_for_reconstruction()`. The buffer is then
+ * owned by the `GhostData` and the neighbor ghost data is a non-owning view of
+ * its leading values, which allows the buffer to carry additional data (e.g.
+ * the RDMP TCI data) at its end. Copies and serialized `GhostData` always own
+ * their neighbor ghost data.
  */
 class GhostData {
  public:
   GhostData(size_t number_of_buffers = 1);
+  GhostData(const GhostData& rhs);
+  GhostData& operator=(const GhostData& rhs);
+  GhostData(GhostData&& rhs) = default;
+  GhostData& operator=(GhostData&& rhs) = default;
+  ~GhostData() = default;
 
   /// Move to the next internal mortar buffer
   void next_buffer();
@@ -60,6 +72,12 @@ class GhostData {
   const DataVector& neighbor_ghost_data_for_reconstruction() const;
   /// @}
 
+  /// Take ownership of `data` and use its first `number_of_ghost_values`
+  /// values as the neighbor ghost data in the current buffer, replacing any
+  /// previous neighbor ghost data.
+  void set_neighbor_ghost_data_for_reconstruction(
+      DataVector data, size_t number_of_ghost_values);
+
   // NOLINTNEXTLINE(google-runtime-references)
   void pup(PUP::er& p);
 
@@ -71,6 +89,10 @@ class GhostData {
   size_t buffer_index_{0};
   std::vector<DataVector> local_ghost_data_{};
   std::vector<DataVector> neighbor_ghost_data_for_reconstruction_{};
+  // The buffers viewed by non-owning neighbor ghost data. Moving a
+  // `std::vector` does not move its elements, so the views remain valid when
+  // the `GhostData` is moved.
+  std::vector<DataVector> neighbor_received_buffers_{};
 };
 
 bool operator!=(const GhostData& lhs, const GhostData& rhs);
@@ -147,15 +147,17 @@ void insert_or_update_neighbor_volume_data(
     }
   }
 
-  ghost_data = std::move(computed_ghost_data);
+  const size_t number_of_ghost_values = computed_ghost_data.size();
+  (*ghost_data_ptr)[directional_element_id]
+      .set_neighbor_ghost_data_for_reconstruction(
+          std::move(computed_ghost_data), number_of_ghost_values);
 }
 
 template <size_t Dim>
 void insert_neighbor_rdmp_and_volume_data(
     const gsl::not_null<RdmpTciData*> rdmp_tci_data_ptr,
     const gsl::not_null<DirectionalIdMap<Dim, GhostData>*> ghost_data_ptr,
-    const DataVector& received_neighbor_subcell_data,
-    const size_t number_of_rdmp_vars,
+    DataVector received_neighbor_subcell_data, const size_t number_of_rdmp_vars,
     const DirectionalId<Dim>& directional_element_id,
     const Mesh<Dim>& neighbor_mesh, const Element<Dim>& element,
     const Mesh<Dim>& subcell_mesh, const size_t number_of_ghost_zones,
@@ -181,6 +183,20 @@ void insert_neighbor_rdmp_and_volume_data(
   // Note: it would be good to assert that the neighbor is at the same
   // refinement level as us, but such a function does not yet exist.
 
+  if (neighbor_mesh.basis(0) == Spectral::Basis::FiniteDifference) {
+    ASSERT(neighbor_mesh == subcell_mesh,
+           "Neighbor mesh ("
+               << neighbor_mesh << ") and my mesh (" << subcell_mesh
+               << ") must be the same if we are both doing subcell.");
+    // The neighbor already reoriented/interpolated the ghost data for us, so
+    // we keep the received buffer and use the values before the RDMP data
+    // without copying them.
+    (*ghost_data_ptr)[directional_element_id] = GhostData{1};
+    ghost_data_ptr->at(directional_element_id)
+        .set_neighbor_ghost_data_for_reconstruction(
+            std::move(received_neighbor_subcell_data), max_offset);
+    return;
+  }
   insert_or_update_neighbor_volume_data<true>(
       ghost_data_ptr, received_neighbor_subcell_data, number_of_rdmp_vars,
       directional_element_id, neighbor_mesh, element, subcell_mesh,
@@ -194,7 +210,7 @@ void insert_neighbor_rdmp_and_volume_data(
       gsl::not_null<RdmpTciData*> rdmp_tci_data_ptr,                         \
       gsl::not_null<DirectionalIdMap<GET_DIM(data), GhostData>*>             \
           ghost_data_ptr,                                                    \
-      const DataVector& neighbor_subcell_data, size_t number_of_rdmp_vars,   \
+      DataVector neighbor_subcell_data, size_t number_of_rdmp_vars,          \
       const DirectionalId<GET_DIM(data)>& directional_element_id,            \
       const Mesh<GET_DIM(data)>& neighbor_mesh,                              \
       const Element<GET_DIM(data)>& element,                                 \
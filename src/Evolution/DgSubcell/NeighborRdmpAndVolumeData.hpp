@@ -47,13 +47,17 @@ void insert_or_update_neighbor_volume_data(
  * \brief Check whether the neighbor sent is DG volume or FD ghost data, and
  * orient project DG volume data if necessary.
  *
+ * FD ghost data is not copied: the `GhostData` takes ownership of
+ * `received_neighbor_subcell_data` and views the ghost data at its start, so
+ * callers should move the received buffer in.
+ *
  * This is intended to be used by the `ReceiveDataForReconstruction` action.
  */
 template <size_t Dim>
 void insert_neighbor_rdmp_and_volume_data(
     gsl::not_null<RdmpTciData*> rdmp_tci_data_ptr,
     gsl::not_null<DirectionalIdMap<Dim, GhostData>*> ghost_data_ptr,
-    const DataVector& received_neighbor_subcell_data,
+    DataVector received_neighbor_subcell_data,
     size_t number_of_rdmp_vars,
     const DirectionalId<Dim>& directional_element_id,
     const Mesh<Dim>& neighbor_mesh, const Element<Dim>& element,
@@ -29,7 +29,8 @@ SubcellOptions::SubcellOptions(
     ::fd::DerivativeOrder finite_difference_derivative_order,
     const size_t number_of_steps_between_tci_calls,
     const size_t min_tci_calls_after_rollback,
-    const size_t min_clear_tci_before_dg)
+    const size_t min_clear_tci_before_dg,
+    const std::optional<size_t> steps_on_dg_before_freeing_subcell_data)
     : persson_exponent_(persson_exponent),
       persson_num_highest_modes_(persson_num_highest_modes),
       rdmp_delta0_(rdmp_delta0),
@@ -41,7 +42,9 @@ SubcellOptions::SubcellOptions(
       finite_difference_derivative_order_(finite_difference_derivative_order),
       number_of_steps_between_tci_calls_(number_of_steps_between_tci_calls),
       min_tci_calls_after_rollback_(min_tci_calls_after_rollback),
-      min_clear_tci_before_dg_(min_clear_tci_before_dg) {
+      min_clear_tci_before_dg_(min_clear_tci_before_dg),
+      steps_on_dg_before_freeing_subcell_data_(
+          steps_on_dg_before_freeing_subcell_data) {
   if (not only_dg_block_and_group_names_.has_value()) {
     only_dg_block_ids_ = std::vector<size_t>{};
   }
@@ -51,6 +54,10 @@ SubcellOptions::SubcellOptions(
          "min_tci_calls_after_rollback_ must be greater than zero.");
   ASSERT(min_clear_tci_before_dg_ > 0,
          "min_clear_tci_before_dg_ must be greater than zero.");
+  if (steps_on_dg_before_freeing_subcell_data_.value_or(1) == 0) {
+    ERROR(
+        "StepsOnDgBeforeFreeingSubcellData must be positive or 'None', not 0.");
+  }
 }
 
 template <size_t Dim>
@@ -91,6 +98,7 @@ void SubcellOptions::pup(PUP::er& p) {
   p | number_of_steps_between_tci_calls_;
   p | min_tci_calls_after_rollback_;
   p | min_clear_tci_before_dg_;
+  p | steps_on_dg_before_freeing_subcell_data_;
 }
 
 bool operator==(const SubcellOptions& lhs, const SubcellOptions& rhs) {
@@ -110,7 +118,9 @@ bool operator==(const SubcellOptions& lhs, const SubcellOptions& rhs) {
              rhs.number_of_steps_between_tci_calls_ and
          lhs.min_tci_calls_after_rollback_ ==
              rhs.min_tci_calls_after_rollback_ and
-         lhs.min_clear_tci_before_dg_ == rhs.min_clear_tci_before_dg_;
+         lhs.min_clear_tci_before_dg_ == rhs.min_clear_tci_before_dg_ and
+         lhs.steps_on_dg_before_freeing_subcell_data_ ==
+             rhs.steps_on_dg_before_freeing_subcell_data_;
 }
 
 bool operator!=(const SubcellOptions& lhs, const SubcellOptions& rhs) {
@@ -189,11 +189,28 @@ class SubcellOptions {
     using group = FdToDgTci;
   };
 
+  /// \brief The number of time steps an element must have been on the DG
+  /// grid before the data it only needs on the subcell grid is freed.
+  ///
+  /// The data is recomputed if the element switches back to the subcell grid.
+  /// Set to `None` to never free the data.
+  struct StepsOnDgBeforeFreeingSubcellData {
+    using type = Options::Auto<size_t, Options::AutoLabel::None>;
+    static constexpr Options::String help = {
+        "The number of time steps an element must have been on the DG grid "
+        "before the data it only needs on the subcell grid (e.g. the subcell "
+        "coordinates and Jacobians) is freed. The data is freed once per stay "
+        "on the DG grid and is recomputed if the element switches back to the "
+        "subcell grid.\n"
+        "Must be positive. Set to 'None' to never free the data."};
+  };
+
   using options = tmpl::list<
       PerssonExponent, PerssonNumHighestModes, RdmpDelta0, RdmpEpsilon,
       AlwaysUseSubcells, SubcellToDgReconstructionMethod, UseHalo,
       OnlyDgBlocksAndGroups, FiniteDifferenceDerivativeOrder,
-      NumberOfStepsBetweenTciCalls, MinTciCallsAfterRollback, MinimumClearTcis>;
+      NumberOfStepsBetweenTciCalls, MinTciCallsAfterRollback, MinimumClearTcis,
+      StepsOnDgBeforeFreeingSubcellData>;
 
   static constexpr Options::String help{
       "System-agnostic options for the DG-subcell method."};
@@ -206,7 +223,9 @@ class SubcellOptions {
       std::optional<std::vector<std::string>> only_dg_block_and_group_names,
       ::fd::DerivativeOrder finite_difference_derivative_order,
       size_t number_of_steps_between_tci_calls,
-      size_t min_tci_calls_after_rollback, size_t min_clear_tci_before_dg);
+      size_t min_tci_calls_after_rollback, size_t min_clear_tci_before_dg,
+      std::optional<size_t> steps_on_dg_before_freeing_subcell_data =
+          std::nullopt);
 
   /// \brief Given an existing SubcellOptions that was created from block and
   /// group names, create one that stores block IDs.
@@ -276,6 +295,14 @@ class SubcellOptions {
   /// `0 means
   size_t min_clear_tci_before_dg() const { return min_clear_tci_before_dg_; }
 
+  /// The number of time steps an element must have been on the DG grid before
+  /// the data only needed on the subcell grid is freed, or `std::nullopt` if
+  /// the data is never freed.
+  const std::optional<size_t>& steps_on_dg_before_freeing_subcell_data()
+      const {
+    return steps_on_dg_before_freeing_subcell_data_;
+  }
+
  private:
   friend bool operator==(const SubcellOptions& lhs, const SubcellOptions& rhs);
 
@@ -294,6 +321,7 @@ class SubcellOptions {
   size_t number_of_steps_between_tci_calls_{1};
   size_t min_tci_calls_after_rollback_{1};
   size_t min_clear_tci_before_dg_{0};
+  std::optional<size_t> steps_on_dg_before_freeing_subcell_data_{};
 };
 
 bool operator!=(const SubcellOptions& lhs, const SubcellOptions& rhs);
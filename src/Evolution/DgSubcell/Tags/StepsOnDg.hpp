@@ -0,0 +1,16 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+
+#include "DataStructures/DataBox/Tag.hpp"
+
+namespace evolution::dg::subcell::Tags {
+/// \brief Keeps track of the number of steps taken on the DG grid since the
+/// last switch from the FD grid. This is not used on the FD grid.
+struct StepsOnDg : db::SimpleTag {
+  using type = size_t;
+};
+}  // namespace evolution::dg::subcell::Tags
@@ -44,11 +44,14 @@
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
 #include "Parallel/AlgorithmExecution.hpp"
 #include "Parallel/GlobalCache.hpp"
+#include "Time/AdaptiveSteppingDiagnostics.hpp"
 #include "Time/BoundaryHistory.hpp"
 #include "Time/EvolutionOrdering.hpp"
 #include "Time/SelfStart.hpp"
+#include "Time/Tags/AdaptiveSteppingDiagnostics.hpp"
 #include "Time/Time.hpp"
 #include "Time/TimeStepId.hpp"
+#include "Time/TimeSteppers/AdamsLts.hpp"
 #include "Time/TimeSteppers/LtsTimeStepper.hpp"
 #include "Time/TimeSteppers/TimeStepper.hpp"
 #include "Utilities/Algorithm.hpp"
@@ -1088,9 +1091,27 @@ struct ApplyLtsBoundaryCorrections {
       return {Parallel::AlgorithmExecution::Continue, std::nullopt};
     }
 
+    const auto cache_statistics_before =
+        TimeSteppers::adams_lts::lts_coefficients_cache_statistics();
     db::mutate_apply<
         ApplyBoundaryCorrections<true, System, VolumeDim, DenseOutput>>(
         make_not_null(&box));
+    if constexpr (db::tag_is_retrievable_v<::Tags::AdaptiveSteppingDiagnostics,
+                                           db::DataBox<DbTagsList>>) {
+      // The action runs on a single thread, so the change in the
+      // thread's counts is the lookups made for this element.
+      const auto& cache_statistics_after =
+          TimeSteppers::adams_lts::lts_coefficients_cache_statistics();
+      db::mutate<::Tags::AdaptiveSteppingDiagnostics>(
+          [&cache_statistics_before, &cache_statistics_after](
+              const gsl::not_null<AdaptiveSteppingDiagnostics*> diags) {
+            diags->number_of_lts_coefficient_cache_hits +=
+                cache_statistics_after.hits - cache_statistics_before.hits;
+            diags->number_of_lts_coefficient_cache_misses +=
+                cache_statistics_after.misses - cache_statistics_before.misses;
+          },
+          make_not_null(&box));
+    }
     return {Parallel::AlgorithmExecution::Continue, std::nullopt};
   }
 };
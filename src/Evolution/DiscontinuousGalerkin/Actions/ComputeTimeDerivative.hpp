@@ -32,6 +32,8 @@
 #include "Evolution/DiscontinuousGalerkin/Actions/PackageDataImpl.hpp"
 #include "Evolution/DiscontinuousGalerkin/Actions/VolumeTermsImpl.hpp"
 #include "Evolution/DiscontinuousGalerkin/BoundaryData.hpp"
+#include "Evolution/DiscontinuousGalerkin/BoundaryDataEncoding.hpp"
+#include "Evolution/DiscontinuousGalerkin/BoundaryDataEncodingTags.hpp"
 #include "Evolution/DiscontinuousGalerkin/InboxTags.hpp"
 #include "Evolution/DiscontinuousGalerkin/MortarData.hpp"
 #include "Evolution/DiscontinuousGalerkin/MortarTags.hpp"
@@ -651,6 +653,33 @@ void ComputeTimeDerivative<Dim, EvolutionSystem, DgStepChoosers,
   const auto& element = db::get<domain::Tags::Element<Dim>>(*box);
 
   const auto& time_step_id = db::get<::Tags::TimeStepId>(*box);
+  const evolution::dg::BoundaryDataEncoding ghost_cell_data_encoding =
+      evolution::dg::boundary_data_encoding<
+          evolution::dg::Tags::GhostCellDataEncoding>(*cache);
+  const evolution::dg::BoundaryDataEncoding boundary_correction_data_encoding =
+      evolution::dg::boundary_data_encoding<
+          evolution::dg::Tags::BoundaryCorrectionDataEncoding>(*cache);
+  if (boundary_correction_data_encoding ==
+      evolution::dg::BoundaryDataEncoding::Float) {
+    // Round our own copy of the data the same way as the copy sent to the
+    // neighbors so both sides of each mortar compute the same boundary
+    // correction.
+    db::mutate<evolution::dg::Tags::MortarData<Dim>>(
+        [](const gsl::not_null<
+            DirectionalIdMap<Dim, evolution::dg::MortarData<Dim>>*>
+               mortar_data) {
+          for (auto& [mortar_id, data] : *mortar_data) {
+            (void)mortar_id;
+            auto& local_mortar_data = data.local_mortar_data();
+            if (local_mortar_data.has_value()) {
+              evolution::dg::round_to_encoding_precision(
+                  make_not_null(&local_mortar_data->second),
+                  evolution::dg::BoundaryDataEncoding::Float);
+            }
+          }
+        },
+        box);
+  }
   const auto& all_mortar_data =
       db::get<evolution::dg::Tags::MortarData<Dim>>(*box);
   const auto& mortar_meshes = get<evolution::dg::Tags::MortarMesh<Dim>>(*box);
@@ -669,6 +698,12 @@ void ComputeTimeDerivative<Dim, EvolutionSystem, DgStepChoosers,
     evolution::dg::subcell::prepare_neighbor_data<Metavariables>(
         make_not_null(&all_neighbor_data_for_reconstruction.value()),
         make_not_null(&ghost_data_mesh), box, volume_fluxes);
+    for (auto& [direction, ghost_data] :
+         all_neighbor_data_for_reconstruction.value()) {
+      (void)direction;
+      evolution::dg::round_to_encoding_precision(make_not_null(&ghost_data),
+                                                 ghost_cell_data_encoding);
+    }
     tci_decision = evolution::dg::subcell::get_tci_decision(*box);
   }
 
@@ -727,14 +762,18 @@ void ComputeTimeDerivative<Dim, EvolutionSystem, DgStepChoosers,
                         std::move(ghost_and_subcell_data),
                         {std::move(neighbor_boundary_data_on_mortar.second)},
                         next_time_step_id,
-                        tci_decision};
+                        tci_decision,
+                        ghost_cell_data_encoding,
+                        boundary_correction_data_encoding};
       } else {
         data = SendData{ghost_data_mesh,
                         neighbor_boundary_data_on_mortar.first,
                         ghost_and_subcell_data,
                         {std::move(neighbor_boundary_data_on_mortar.second)},
                         next_time_step_id,
-                        tci_decision};
+                        tci_decision,
+                        ghost_cell_data_encoding,
+                        boundary_correction_data_encoding};
       }
 
       // Send mortar data (the `std::tuple` named `data`) to neighbor
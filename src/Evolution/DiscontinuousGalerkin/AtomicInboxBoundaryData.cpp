@@ -71,6 +71,15 @@ size_t AtomicInboxBoundaryData<Dim>::index(
   }
 }
 
+template <size_t Dim>
+size_t AtomicInboxBoundaryData<Dim>::number_of_overflows() const {
+  size_t result = 0;
+  for (const auto& queue : boundary_data_in_directions) {
+    result += queue.number_of_overflows();
+  }
+  return result;
+}
+
 template <size_t Dim>
 void AtomicInboxBoundaryData<Dim>::pup(PUP::er& p) {
   if (UNLIKELY(number_of_neighbors.load(std::memory_order_acquire) != 0)) {
@@ -82,7 +91,7 @@ void AtomicInboxBoundaryData<Dim>::pup(PUP::er& p) {
   for (size_t i = 0; i < boundary_data_in_directions.size(); ++i) {
     if (UNLIKELY(not gsl::at(boundary_data_in_directions, i).empty())) {
       ERROR(
-          "We can only serialize empty StaticSpscQueues but the queue in "
+          "We can only serialize empty GrowableSpscQueues but the queue in "
           "element "
           << i << " is not empty.");
     }
@@ -8,7 +8,7 @@
 
 #include "Domain/Structure/MaxNumberOfNeighbors.hpp"
 #include "Evolution/DiscontinuousGalerkin/BoundaryData.hpp"
-#include "Parallel/StaticSpscQueue.hpp"
+#include "Parallel/GrowableSpscQueue.hpp"
 #include "Time/TimeStepId.hpp"
 
 /// \cond
@@ -34,6 +34,12 @@ namespace evolution::dg {
  * local time stepping, since not every message entry "counts" since it
  * depends on the time level of neighboring elements.
  *
+ * Each neighbor slot holds a `Parallel::GrowableSpscQueue`, which allocates
+ * no memory until the neighbor sends its first message and grows when a
+ * neighbor gets further ahead than expected, e.g. with large local time
+ * stepping ratios. Only the slots of actual neighbors therefore use memory.
+ * `number_of_overflows()` reports how often a queue had to grow.
+ *
  * \warning Only `AtomicInboxBoundaryData` with zero messages can be move
  * constructed. A non-zero number of neighbors is allowed. This is necessary
  * in order to be able to serialize a
@@ -74,14 +80,19 @@ struct AtomicInboxBoundaryData {
    */
   static size_t index(const DirectionalId<Dim>& directional_id);
 
+  /// The number of times a queue in `boundary_data_in_directions` was full
+  /// and had to grow.
+  size_t number_of_overflows() const;
+
   void pup(PUP::er& p);
 
-  // We use 20 entries in the SPSC under the assumption that each neighbor
-  // will never insert more than 20 entries before the element uses
-  // them. While in practice a smaller buffer could be used, this is to
-  // safeguard against future features.
-  std::array<Parallel::StaticSpscQueue<
-                 std::tuple<::TimeStepId, stored_type, DirectionalId<Dim>>, 20>,
+  // Each block holds enough messages for a neighbor that is a few substeps
+  // ahead. Neighbors that get further ahead make the queue grow.
+  static constexpr size_t queue_block_capacity = 4;
+
+  std::array<Parallel::GrowableSpscQueue<
+                 std::tuple<::TimeStepId, stored_type, DirectionalId<Dim>>,
+                 queue_block_capacity>,
              maximum_number_of_neighbors(Dim)>
       boundary_data_in_directions{};
   std::atomic_uint message_count{};
@@ -6,7 +6,9 @@
 #include <pup.h>
 #include <pup_stl.h>
 
+#include "Evolution/DiscontinuousGalerkin/BoundaryDataEncoding.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/Serialization/PupStlCpp17.hpp"
 #include "Utilities/StdHelpers.hpp"
 
@@ -15,8 +17,13 @@ template <size_t Dim>
 void BoundaryData<Dim>::pup(PUP::er& p) {
   p | volume_mesh_ghost_cell_data;
   p | interface_mesh;
-  p | ghost_cell_data;
-  p | boundary_correction_data;
+  // The encodings must be known before the data can be unpacked
+  p | ghost_cell_data_encoding;
+  p | boundary_correction_data_encoding;
+  detail::pup_encoded(p, make_not_null(&ghost_cell_data),
+                      ghost_cell_data_encoding);
+  detail::pup_encoded(p, make_not_null(&boundary_correction_data),
+                      boundary_correction_data_encoding);
   p | validity_range;
   p | tci_status;
 }
@@ -28,7 +35,10 @@ bool operator==(const BoundaryData<Dim>& lhs, const BoundaryData<Dim>& rhs) {
          lhs.ghost_cell_data == rhs.ghost_cell_data and
          lhs.boundary_correction_data == rhs.boundary_correction_data and
          lhs.validity_range == rhs.validity_range and
-         lhs.tci_status == rhs.tci_status;
+         lhs.tci_status == rhs.tci_status and
+         lhs.ghost_cell_data_encoding == rhs.ghost_cell_data_encoding and
+         lhs.boundary_correction_data_encoding ==
+             rhs.boundary_correction_data_encoding;
 }
 
 template <size_t Dim>
@@ -43,7 +53,11 @@ std::ostream& operator<<(std::ostream& os, const BoundaryData<Dim>& value) {
             << "Ghost cell data: " << value.ghost_cell_data << '\n'
             << "Boundary correction: " << value.boundary_correction_data << '\n'
             << "Validy range: " << value.validity_range << '\n'
-            << "TCI status: " << value.tci_status;
+            << "TCI status: " << value.tci_status << '\n'
+            << "Ghost cell data encoding: " << value.ghost_cell_data_encoding
+            << '\n'
+            << "Boundary correction encoding: "
+            << value.boundary_correction_data_encoding;
 }
 
 #define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
@@ -8,6 +8,7 @@
 #include <optional>
 
 #include "DataStructures/DataVector.hpp"
+#include "Evolution/DiscontinuousGalerkin/BoundaryDataEncoding.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "Time/TimeStepId.hpp"
 
@@ -28,6 +29,10 @@ namespace evolution::dg {
  *    using local time stepping.
  * 6. the troubled cell indicator status used for determining halos around
  *    troubled cells.
+ * 7. the encodings of the ghost cell and boundary correction data used when the
+ *    data is serialized. See `evolution::dg::BoundaryDataEncoding`.
+ *    Serialization is exact for every encoding; the sender rounds the data
+ *    with `evolution::dg::round_to_encoding_precision` before sending it.
  */
 template <size_t Dim>
 struct BoundaryData {
@@ -40,6 +45,9 @@ struct BoundaryData {
   std::optional<DataVector> boundary_correction_data{};
   ::TimeStepId validity_range{};
   int tci_status{};
+  BoundaryDataEncoding ghost_cell_data_encoding{BoundaryDataEncoding::Double};
+  BoundaryDataEncoding boundary_correction_data_encoding{
+      BoundaryDataEncoding::Double};
 };
 
 template <size_t Dim>
@@ -0,0 +1,252 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Evolution/DiscontinuousGalerkin/BoundaryDataEncoding.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <limits>
+#include <optional>
+#include <ostream>
+#include <pup.h>
+#include <pup_stl.h>
+#include <string>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "Options/Options.hpp"
+#include "Options/ParseOptions.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Serialization/PupStlCpp17.hpp"
+
+namespace evolution::dg {
+std::ostream& operator<<(std::ostream& os,
+                         const BoundaryDataEncoding encoding) {
+  switch (encoding) {
+    case BoundaryDataEncoding::Double:
+      return os << "Double";
+    case BoundaryDataEncoding::Float:
+      return os << "Float";
+    case BoundaryDataEncoding::Lossless:
+      return os << "Lossless";
+    default:
+      ERROR("Unknown BoundaryDataEncoding " << static_cast<int>(encoding));
+  }
+}
+
+namespace {
+// Whether `value` can be converted to a `float` without undefined behavior.
+// Infinities and NaNs have `float` representations, but finite values larger
+// than the largest `float` do not.
+bool in_float_range(const double value) {
+  return not std::isfinite(value) or
+         std::abs(value) <=
+             static_cast<double>(std::numeric_limits<float>::max());
+}
+
+bool is_exact_float(const double value) {
+  return in_float_range(value) and
+         static_cast<double>(static_cast<float>(value)) == value;
+}
+
+// The encoded form of one DataVector. Charm++ serializes each message twice,
+// first with a `PUP::sizer` and then with a `PUP::toMem`, so the encoding is
+// computed in the sizing pass and reused by the packing pass of the same
+// message. The cache holds the most recently sized vectors of this thread,
+// identified by their buffer and size, and an entry is removed when it is
+// packed. A vector must therefore not be modified between the sizing and
+// packing of a message, which Charm++ guarantees.
+struct EncodedData {
+  const double* data = nullptr;
+  size_t size = 0;
+  bool is_float = false;
+  std::vector<uint8_t> compressed{};
+};
+
+constexpr size_t maximum_cached_encodings = 8;
+
+std::deque<EncodedData>& encoding_cache() {
+  thread_local std::deque<EncodedData> cache{};
+  return cache;
+}
+
+// The encoding of `data`, taken from the cache when packing a message that
+// was sized before.
+EncodedData take_encoding(const PUP::er& p, const DataVector& data,
+                          const BoundaryDataEncoding encoding) {
+  auto& cache = encoding_cache();
+  const auto entry =
+      std::find_if(cache.begin(), cache.end(), [&data](const auto& cached) {
+        return cached.data == data.data() and cached.size == data.size();
+      });
+  if (entry != cache.end()) {
+    EncodedData cached = std::move(*entry);
+    cache.erase(entry);
+    if (p.isPacking()) {
+      return cached;
+    }
+  }
+
+  EncodedData result{};
+  result.data = data.data();
+  result.size = data.size();
+  if (encoding == BoundaryDataEncoding::Float) {
+    result.is_float = std::all_of(data.begin(), data.end(), is_exact_float);
+  } else {
+    result.compressed = detail::lossless_compress(data);
+  }
+  return result;
+}
+
+void cache_encoding(EncodedData encoded) {
+  auto& cache = encoding_cache();
+  if (cache.size() == maximum_cached_encodings) {
+    cache.pop_front();
+  }
+  cache.push_back(std::move(encoded));
+}
+}  // namespace
+
+void round_to_encoding_precision(const gsl::not_null<DataVector*> data,
+                                 const BoundaryDataEncoding encoding) {
+  // Converting a value outside the range of a float is undefined behavior, so
+  // such data is left unchanged and `pup_encoded` sends it in double precision.
+  if (encoding != BoundaryDataEncoding::Float or
+      not std::all_of(data->begin(), data->end(), in_float_range)) {
+    return;
+  }
+  for (double& value : *data) {
+    value = static_cast<double>(static_cast<float>(value));
+  }
+}
+
+namespace detail {
+void pup_encoded(PUP::er& p,
+                 const gsl::not_null<std::optional<DataVector>*> data,
+                 const BoundaryDataEncoding encoding) {
+  if (encoding == BoundaryDataEncoding::Double) {
+    p | *data;
+    return;
+  }
+
+  bool has_value = data->has_value();
+  p | has_value;
+  if (not has_value) {
+    if (p.isUnpacking()) {
+      *data = std::nullopt;
+    }
+    return;
+  }
+  size_t size = p.isUnpacking() ? 0 : (*data)->size();
+  p | size;
+
+  // The encoding is computed once per message and shared between the sizing
+  // and packing passes.
+  EncodedData encoded{};
+  if (not p.isUnpacking()) {
+    encoded = take_encoding(p, **data, encoding);
+  }
+
+  if (encoding == BoundaryDataEncoding::Float) {
+    // Only send single precision values if that does not change the data, so
+    // that checkpoints and migrations are exact.
+    p | encoded.is_float;
+    if (p.isUnpacking()) {
+      *data = DataVector(size);
+    }
+    if (not encoded.is_float) {
+      PUParray(p, (*data)->data(), size);
+    } else {
+      std::vector<float> buffer(size);
+      if (p.isPacking()) {
+        std::transform(
+            (*data)->begin(), (*data)->end(), buffer.begin(),
+            [](const double value) { return static_cast<float>(value); });
+      }
+      PUParray(p, buffer.data(), size);
+      if (p.isUnpacking()) {
+        std::copy(buffer.begin(), buffer.end(), (*data)->begin());
+      }
+    }
+  } else {
+    p | encoded.compressed;
+    if (p.isUnpacking()) {
+      *data = DataVector(size);
+      lossless_decompress(make_not_null(&**data), encoded.compressed);
+    }
+  }
+  if (p.isSizing()) {
+    cache_encoding(std::move(encoded));
+  }
+}
+
+// The compressed data starts with a 4-bit count of the stored bytes for each
+// value, two to a byte, followed by the stored bytes of each value in order.
+std::vector<uint8_t> lossless_compress(const DataVector& data) {
+  static_assert(sizeof(double) == sizeof(uint64_t));
+  std::vector<uint8_t> compressed((data.size() + 1) / 2, 0);
+  compressed.reserve(compressed.size() + sizeof(double) * data.size());
+  uint64_t previous = 0;
+  for (size_t i = 0; i < data.size(); ++i) {
+    uint64_t bits = 0;
+    std::memcpy(&bits, &data[i], sizeof(bits));
+    uint64_t difference = bits ^ previous;
+    previous = bits;
+    uint8_t number_of_bytes = 0;
+    for (; difference != 0; difference >>= 8) {
+      compressed.push_back(static_cast<uint8_t>(difference & 0xff));
+      ++number_of_bytes;
+    }
+    compressed[i / 2] |= static_cast<uint8_t>(number_of_bytes << (4 * (i % 2)));
+  }
+  return compressed;
+}
+
+void lossless_decompress(const gsl::not_null<DataVector*> result,
+                         const std::vector<uint8_t>& compressed) {
+  size_t offset = (result->size() + 1) / 2;
+  ASSERT(compressed.size() >= offset,
+         "Compressed data is too short to hold " << result->size()
+                                                 << " values.");
+  uint64_t previous = 0;
+  for (size_t i = 0; i < result->size(); ++i) {
+    const auto number_of_bytes =
+        static_cast<size_t>((compressed[i / 2] >> (4 * (i % 2))) & 0x0f);
+    ASSERT(offset + number_of_bytes <= compressed.size(),
+           "Compressed data ends before value " << i << ".");
+    uint64_t difference = 0;
+    for (size_t byte = 0; byte < number_of_bytes; ++byte) {
+      difference |= static_cast<uint64_t>(compressed[offset + byte])
+                    << (8 * byte);
+    }
+    offset += number_of_bytes;
+    previous ^= difference;
+    std::memcpy(&(*result)[i], &previous, sizeof(previous));
+  }
+  ASSERT(offset == compressed.size(),
+         "Compressed data is longer than " << result->size() << " values.");
+}
+}  // namespace detail
+}  // namespace evolution::dg
+
+template <>
+evolution::dg::BoundaryDataEncoding
+Options::create_from_yaml<evolution::dg::BoundaryDataEncoding>::create<void>(
+    const Options::Option& options) {
+  const auto encoding = options.parse_as<std::string>();
+  if (encoding == "Double") {
+    return evolution::dg::BoundaryDataEncoding::Double;
+  } else if (encoding == "Float") {
+    return evolution::dg::BoundaryDataEncoding::Float;
+  } else if (encoding == "Lossless") {
+    return evolution::dg::BoundaryDataEncoding::Lossless;
+  }
+  PARSE_ERROR(options.context(),
+              "BoundaryDataEncoding must be 'Double', 'Float', or 'Lossless'.");
+}
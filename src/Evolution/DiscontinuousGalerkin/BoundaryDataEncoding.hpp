@@ -0,0 +1,99 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstdint>
+#include <iosfwd>
+#include <optional>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "Utilities/Gsl.hpp"
+
+/// \cond
+namespace Options {
+struct Option;
+template <typename T>
+struct create_from_yaml;
+}  // namespace Options
+namespace PUP {
+class er;
+}  // namespace PUP
+/// \endcond
+
+namespace evolution::dg {
+/*!
+ * \brief How the data in an `evolution::dg::BoundaryData` is encoded when it is
+ * serialized to be sent to a neighboring element.
+ *
+ * - `Double`: the data is sent unchanged.
+ * - `Float`: the data is rounded to single precision, halving the size of the
+ *   message. If any value is outside the range of a `float`, the whole vector
+ *   is sent in double precision instead. This should only be used for data
+ *   whose accuracy is not limited by the roundoff of the sending element,
+ *   e.g. ghost data that is only used for a low-order reconstruction. The
+ *   rounding is done by the sender with `round_to_encoding_precision` before
+ *   the data is sent, not during serialization, so the received values do not
+ *   depend on whether the neighbor is on the same node, and checkpoints and
+ *   migration reproduce the data exactly. The sender also rounds its own copy
+ *   of the boundary correction data, so both sides of a mortar compute the
+ *   boundary correction from the same values and the scheme remains
+ *   conservative. Ghost cell data is only used by the receiver, so rounding it
+ *   makes the reconstructed face values on the two sides of an interface
+ *   differ at the level of single-precision roundoff, and conservation across
+ *   element boundaries then only holds to that level.
+ * - `Lossless`: each value is XORed with the previous one and only the bytes
+ *   below the highest nonzero byte of the result are sent. Neighboring values
+ *   of smooth data share their sign, exponent, and leading mantissa bits, so
+ *   this typically saves one to three bytes per value while reproducing the
+ *   data exactly. This trades CPU time on both ends for message size.
+ *
+ * The receiving element always reconstructs a `DataVector`, so the encoding is
+ * invisible outside of serialization.
+ */
+enum class BoundaryDataEncoding { Double, Float, Lossless };
+
+std::ostream& operator<<(std::ostream& os, BoundaryDataEncoding encoding);
+
+/// Round `data` to the values that can be sent with `encoding`. This does
+/// nothing unless `encoding` is `BoundaryDataEncoding::Float`, and also leaves
+/// the data unchanged if any finite value is outside the range of a `float`, in
+/// which case the whole vector is sent in double precision.
+void round_to_encoding_precision(gsl::not_null<DataVector*> data,
+                                 BoundaryDataEncoding encoding);
+
+namespace detail {
+// Serialize `data` using `encoding`. The encoding must be the same when packing
+// and unpacking. This is lossless: with `BoundaryDataEncoding::Float`, data
+// that has not been rounded by `round_to_encoding_precision` is sent in double
+// precision. The check for that and the `BoundaryDataEncoding::Lossless`
+// compression are done once per message: the result of the sizing pass is
+// reused by the following packing pass of the same data.
+void pup_encoded(PUP::er& p, gsl::not_null<std::optional<DataVector>*> data,
+                 BoundaryDataEncoding encoding);
+
+// The `BoundaryDataEncoding::Lossless` representation of `data`. The number of
+// values is not stored, and must be provided to `lossless_decompress`.
+std::vector<uint8_t> lossless_compress(const DataVector& data);
+
+// Inverse of `lossless_compress`. `result` must have the size of the
+// compressed data.
+void lossless_decompress(gsl::not_null<DataVector*> result,
+                         const std::vector<uint8_t>& compressed);
+}  // namespace detail
+}  // namespace evolution::dg
+
+template <>
+struct Options::create_from_yaml<evolution::dg::BoundaryDataEncoding> {
+  template <typename Metavariables>
+  static evolution::dg::BoundaryDataEncoding create(
+      const Options::Option& options) {
+    return create<void>(options);
+  }
+};
+
+template <>
+evolution::dg::BoundaryDataEncoding
+Options::create_from_yaml<evolution::dg::BoundaryDataEncoding>::create<void>(
+    const Options::Option& options);
@@ -0,0 +1,75 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include "DataStructures/DataBox/Tag.hpp"
+#include "Evolution/DiscontinuousGalerkin/BoundaryDataEncoding.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/Tags/OptionsGroup.hpp"
+#include "Options/String.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/ParallelComponentHelpers.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace evolution::dg {
+namespace OptionTags {
+/// The encoding of the ghost cell data sent to neighboring elements.
+struct GhostCellDataEncoding {
+  using type = BoundaryDataEncoding;
+  using group = ::dg::OptionTags::DiscontinuousGalerkinGroup;
+  static constexpr Options::String help =
+      "How the ghost cell data for subcell reconstruction is encoded when sent "
+      "to neighboring elements (Double, Float, or Lossless).";
+  static type default_value() { return BoundaryDataEncoding::Double; }
+};
+
+/// The encoding of the boundary correction data sent to neighboring elements.
+struct BoundaryCorrectionDataEncoding {
+  using type = BoundaryDataEncoding;
+  using group = ::dg::OptionTags::DiscontinuousGalerkinGroup;
+  static constexpr Options::String help =
+      "How the mortar data for the boundary correction is encoded when sent to "
+      "neighboring elements (Double, Float, or Lossless).";
+  static type default_value() { return BoundaryDataEncoding::Double; }
+};
+}  // namespace OptionTags
+
+namespace Tags {
+/// \brief The encoding of the ghost cell data sent to neighboring elements.
+///
+/// Sending is opt-in: the data is sent as `BoundaryDataEncoding::Double`
+/// unless this tag is in the global cache.
+struct GhostCellDataEncoding : db::SimpleTag {
+  using type = BoundaryDataEncoding;
+
+  using option_tags = tmpl::list<OptionTags::GhostCellDataEncoding>;
+  static constexpr bool pass_metavariables = false;
+  static type create_from_options(const type& encoding) { return encoding; }
+};
+
+/// \brief The encoding of the boundary correction data sent to neighboring
+/// elements.
+///
+/// Sending is opt-in: the data is sent as `BoundaryDataEncoding::Double`
+/// unless this tag is in the global cache.
+struct BoundaryCorrectionDataEncoding : db::SimpleTag {
+  using type = BoundaryDataEncoding;
+
+  using option_tags = tmpl::list<OptionTags::BoundaryCorrectionDataEncoding>;
+  static constexpr bool pass_metavariables = false;
+  static type create_from_options(const type& encoding) { return encoding; }
+};
+}  // namespace Tags
+
+/// \brief The encoding stored in `EncodingTag` if it is in the global cache,
+/// and `BoundaryDataEncoding::Double` otherwise.
+template <typename EncodingTag, typename Metavariables>
+BoundaryDataEncoding boundary_data_encoding(
+    [[maybe_unused]] const Parallel::GlobalCache<Metavariables>& cache) {
+  if constexpr (Parallel::is_in_global_cache<Metavariables, EncodingTag>) {
+    return Parallel::get<EncodingTag>(cache);
+  } else {
+    return BoundaryDataEncoding::Double;
+  }
+}
+}  // namespace evolution::dg
@@ -26,7 +26,6 @@
 #include "Evolution/DiscontinuousGalerkin/Messages/BoundaryMessage.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "Parallel/InboxInserters.hpp"
-#include "Parallel/StaticSpscQueue.hpp"
 #include "Time/TimeStepId.hpp"
 #include "Utilities/TMPL.hpp"
 
@@ -142,14 +141,9 @@ struct BoundaryCorrectionAndGhostCellsInbox {
     const DirectionalId<Dim>& neighbor_id = data.first;
     // Note: This assumes the neighbor_id is oriented into our (the element
     // whose inbox this is) frame.
-    const size_t neighbor_index = hash_value(neighbor_id);
-    if (UNLIKELY(not gsl::at(inbox->boundary_data_in_directions, neighbor_index)
-                         .try_emplace(time_step_id, std::move(data.second),
-                                      std::move(data.first)))) {
-      ERROR("Failed to emplace data into inbox. neighbor_id: ("
-            << neighbor_id.direction() << ',' << neighbor_id.id()
-            << ") at TimeStepID: " << time_step_id);
-    }
+    const size_t neighbor_index = type_spsc::index(neighbor_id);
+    gsl::at(inbox->boundary_data_in_directions, neighbor_index)
+        .emplace(time_step_id, std::move(data.second), std::move(data.first));
     // Notes:
     // 1. fetch_add does a post-increment.
     // 2. We need thread synchronization here, so doing relaxed_order would be a
@@ -13,14 +13,17 @@
 #include "Parallel/CharmMain.tpp"
 #include "Utilities/Serialization/RegisterDerivedClassesWithCharm.hpp"
 
+// Chosen in CMakeLists.txt
+using metavariables = EvolutionMetavars<USE_DG_ELEMENT_COLLECTION>;
+
 extern "C" void CkRegisterMainModule() {
-  Parallel::charmxx::register_main_module<EvolutionMetavars>();
+  Parallel::charmxx::register_main_module<metavariables>();
   Parallel::charmxx::register_init_node_and_proc(
       {&domain::creators::register_derived_with_charm,
        &domain::creators::time_dependence::register_derived_with_charm,
        &domain::FunctionsOfTime::register_derived_with_charm,
        &Burgers::BoundaryCorrections::register_derived_with_charm,
        &Burgers::fd::register_derived_with_charm,
-       &register_factory_classes_with_charm<EvolutionMetavars>},
+       &register_factory_classes_with_charm<metavariables>},
       {});
 }
@@ -28,6 +28,7 @@
 #include "Evolution/DgSubcell/Tags/TciStatus.hpp"
 #include "Evolution/DiscontinuousGalerkin/Actions/ApplyBoundaryCorrections.hpp"
 #include "Evolution/DiscontinuousGalerkin/Actions/ComputeTimeDerivative.hpp"
+#include "Evolution/DiscontinuousGalerkin/BoundaryDataEncodingTags.hpp"
 #include "Evolution/DiscontinuousGalerkin/DgElementArray.hpp"
 #include "Evolution/DiscontinuousGalerkin/Initialization/Mortars.hpp"
 #include "Evolution/DiscontinuousGalerkin/Initialization/QuadratureTag.hpp"
@@ -56,6 +57,7 @@
 #include "NumericalAlgorithms/DiscontinuousGalerkin/Tags.hpp"
 #include "Options/Protocols/FactoryCreation.hpp"
 #include "Options/String.hpp"
+#include "Parallel/ArrayCollection/DgElementCollection.hpp"
 #include "Parallel/Local.hpp"
 #include "Parallel/Phase.hpp"
 #include "Parallel/PhaseControl/CheckpointAndExitAfterWallclock.hpp"
@@ -117,6 +119,7 @@ class CProxy_GlobalCache;
 }  // namespace Parallel
 /// \endcond
 
+template <bool UseDgElementCollection>
 struct EvolutionMetavars {
   static constexpr size_t volume_dim = 1;
   using system = Burgers::System;
@@ -130,6 +133,10 @@ struct EvolutionMetavars {
   // or a DG-FD hybrid scheme (true).
   static constexpr bool use_dg_subcell = true;
 
+  // Whether the elements are stored in a `Parallel::DgElementCollection` on
+  // each node or in a `DgElementArray`.
+  static constexpr bool use_dg_element_collection = UseDgElementCollection;
+
   using initial_data_list = tmpl::append<Burgers::Solutions::all_solutions,
                                          Burgers::AnalyticData::all_data>;
 
@@ -279,6 +286,8 @@ struct EvolutionMetavars {
 
   using const_global_cache_tags = tmpl::list<
       evolution::initial_data::Tags::InitialData,
+      evolution::dg::Tags::BoundaryCorrectionDataEncoding,
+      evolution::dg::Tags::GhostCellDataEncoding,
       tmpl::conditional_t<use_dg_subcell,
                           tmpl::list<Burgers::fd::Tags::Reconstructor>,
                           tmpl::list<>>>;
@@ -315,26 +324,30 @@ struct EvolutionMetavars {
       evolution::Actions::InitializeRunEventsAndDenseTriggers,
       Parallel::Actions::TerminatePhase>;
 
-  using dg_element_array = DgElementArray<
-      EvolutionMetavars,
-      tmpl::list<
-          Parallel::PhaseActions<Parallel::Phase::Initialization,
-                                 initialization_actions>,
-
-          Parallel::PhaseActions<Parallel::Phase::Register,
-                                 tmpl::list<dg_registration_list,
-                                            Parallel::Actions::TerminatePhase>>,
-
-          Parallel::PhaseActions<
-              Parallel::Phase::InitializeTimeStepperHistory,
-              SelfStart::self_start_procedure<step_actions, system>>,
-
-          Parallel::PhaseActions<
-              Parallel::Phase::Evolve,
-              tmpl::list<evolution::Actions::RunEventsAndTriggers,
-                         Actions::ChangeSlabSize, step_actions,
-                         Actions::AdvanceTime,
-                         PhaseControl::Actions::ExecutePhaseChange>>>>;
+  using dg_element_array_pdal = tmpl::list<
+      Parallel::PhaseActions<Parallel::Phase::Initialization,
+                             initialization_actions>,
+
+      Parallel::PhaseActions<Parallel::Phase::Register,
+                             tmpl::list<dg_registration_list,
+                                        Parallel::Actions::TerminatePhase>>,
+
+      Parallel::PhaseActions<
+          Parallel::Phase::InitializeTimeStepperHistory,
+          SelfStart::self_start_procedure<step_actions, system>>,
+
+      Parallel::PhaseActions<
+          Parallel::Phase::Evolve,
+          tmpl::list<evolution::Actions::RunEventsAndTriggers,
+                     Actions::ChangeSlabSize, step_actions,
+                     Actions::AdvanceTime,
+                     PhaseControl::Actions::ExecutePhaseChange>>>;
+
+  using dg_element_array = tmpl::conditional_t<
+      use_dg_element_collection,
+      Parallel::DgElementCollection<volume_dim, EvolutionMetavars,
+                                    dg_element_array_pdal>,
+      DgElementArray<EvolutionMetavars, dg_element_array_pdal>>;
 
   struct registration
       : tt::ConformsTo<Parallel::protocols::RegistrationMetavariables> {
@@ -14,6 +14,7 @@
 #include "Evolution/Systems/Cce/AnalyticSolutions/WorldtubeData.hpp"
 #include "Evolution/Systems/Cce/BoundaryData.hpp"
 #include "Evolution/Systems/Cce/Components/CharacteristicEvolution.hpp"
+#include "Evolution/Systems/Cce/Components/NodeThreadPoolHelpers.hpp"
 #include "Evolution/Systems/Cce/Components/WorldtubeBoundary.hpp"
 #include "Evolution/Systems/Cce/Events/ObserveFields.hpp"
 #include "Evolution/Systems/Cce/Events/ObserveTimeStep.hpp"
@@ -58,7 +59,8 @@ struct EvolutionMetavars : CharacteristicExtractDefaults<false> {
   using component_list =
       tmpl::list<observers::ObserverWriter<EvolutionMetavars>,
                  cce_boundary_component,
-                 Cce::CharacteristicEvolution<EvolutionMetavars>>;
+                 Cce::CharacteristicEvolution<EvolutionMetavars>,
+                 Cce::NodeThreadPoolHelpers<EvolutionMetavars>>;
 
   struct factory_creation
       : tt::ConformsTo<Options::protocols::FactoryCreation> {
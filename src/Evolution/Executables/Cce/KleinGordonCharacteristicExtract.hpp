@@ -12,6 +12,7 @@
 #include "Evolution/Systems/Cce/AnalyticSolutions/SphericalMetricData.hpp"
 #include "Evolution/Systems/Cce/AnalyticSolutions/TeukolskyWave.hpp"
 #include "Evolution/Systems/Cce/Components/KleinGordonCharacteristicEvolution.hpp"
+#include "Evolution/Systems/Cce/Components/NodeThreadPoolHelpers.hpp"
 #include "Evolution/Systems/Cce/Events/ObserveFields.hpp"
 #include "Evolution/Systems/Cce/Events/ObserveTimeStep.hpp"
 #include "Evolution/Systems/Cce/Initialize/ConformalFactor.hpp"
@@ -119,7 +120,8 @@ struct EvolutionMetavars : CharacteristicExtractDefaults<false> {
   using component_list =
       tmpl::list<observers::ObserverWriter<EvolutionMetavars>,
                  cce_boundary_component,
-                 Cce::KleinGordonCharacteristicEvolution<EvolutionMetavars>>;
+                 Cce::KleinGordonCharacteristicEvolution<EvolutionMetavars>,
+                 Cce::NodeThreadPoolHelpers<EvolutionMetavars>>;
 
   struct factory_creation
       : tt::ConformsTo<Options::protocols::FactoryCreation> {
@@ -20,6 +20,7 @@
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Invoke.hpp"
 #include "Parallel/Local.hpp"
+#include "Parallel/Printf/Printf.hpp"
 #include "Time/SelfStart.hpp"
 #include "Time/TimeStepId.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
@@ -73,9 +74,16 @@ struct SendToEvolution;
  * Metavariables::cce_boundary_communication_tags>` back to the
  * `EvolutionComponent`
  *
+ * When the requested time reaches `Tags::EndTime`, the
+ * `WorldtubeBufferStatistics` of the data manager are printed so that the
+ * time spent waiting on the H5 file can be compared with and without
+ * `OptionTags::H5PrefetchNextWindow`.
+ *
  * Uses:
  * - DataBox:
  *  - `Tags::H5WorldtubeBoundaryDataManager`
+ * - GlobalCache:
+ *  - `Tags::EndTime`
  *
  * \ref DataBoxGroup changes:
  * - Adds: nothing
@@ -120,6 +128,12 @@ struct BoundaryComputeAndSendToEvolution<H5WorldtubeBoundary<Metavariables>,
       ERROR("Insufficient boundary data to proceed, exiting early at time " +
             std::to_string(time.substep_time()));
     }
+    if (time.substep_time() >= Parallel::get<Tags::EndTime>(cache)) {
+      Parallel::printf(
+          "CCE worldtube buffer: %s\n",
+          db::get<Tags::H5WorldtubeBoundaryDataManager>(box)
+              ->get_buffer_statistics());
+    }
     Parallel::receive_data<Cce::ReceiveTags::BoundaryData<
         typename Metavariables::cce_boundary_communication_tags>>(
         Parallel::get_parallel_component<EvolutionComponent>(cache), time,
@@ -143,10 +157,15 @@ struct BoundaryComputeAndSendToEvolution<H5WorldtubeBoundary<Metavariables>,
  * Metavariables::klein_gordon_boundary_communication_tags>` back to the
  * `EvolutionComponent`
  *
+ * When the requested time reaches `Tags::EndTime`, the
+ * `WorldtubeBufferStatistics` of both data managers are printed.
+ *
  * Uses:
  * - DataBox:
  *  - `Tags::H5WorldtubeBoundaryDataManager`
  *  - `Tags::KleinGordonH5WorldtubeBoundaryDataManager`
+ * - GlobalCache:
+ *  - `Tags::EndTime`
  *
  * \ref DataBoxGroup changes:
  * - Adds: nothing
@@ -221,6 +240,14 @@ struct BoundaryComputeAndSendToEvolution<
           "time " +
           std::to_string(time.substep_time()));
     }
+    if (time.substep_time() >= Parallel::get<Tags::EndTime>(cache)) {
+      Parallel::printf(
+          "CCE worldtube buffer: %s\nCCE Klein-Gordon worldtube buffer: %s\n",
+          db::get<Tags::H5WorldtubeBoundaryDataManager>(box)
+              ->get_buffer_statistics(),
+          db::get<Tags::KleinGordonH5WorldtubeBoundaryDataManager>(box)
+              ->get_buffer_statistics());
+    }
     Parallel::receive_data<Cce::ReceiveTags::BoundaryData<
         typename Metavariables::cce_boundary_communication_tags>>(
         Parallel::get_parallel_component<EvolutionComponent>(cache), time,
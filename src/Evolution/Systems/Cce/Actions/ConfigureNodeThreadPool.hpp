@@ -0,0 +1,120 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <optional>
+#include <tuple>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "Evolution/Systems/Cce/Components/NodeThreadPoolHelpers.hpp"
+#include "Evolution/Systems/Cce/OptionTags.hpp"
+#include "Parallel/AlgorithmExecution.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Info.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Parallel/NodeLock.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/System/ThreadPool.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
+#include "Utilities/TypeTraits/CreateGetTypeAliasOrDefault.hpp"
+
+namespace Cce {
+namespace Actions {
+namespace detail {
+CREATE_GET_TYPE_ALIAS_OR_DEFAULT(component_being_mocked)
+
+// Whether the (possibly mocked) `NodeThreadPoolHelpers` component is in the
+// `component_list`
+template <typename Metavariables>
+constexpr bool has_node_thread_pool_helpers = tmpl::list_contains_v<
+    tmpl::transform<typename Metavariables::component_list,
+                    get_component_being_mocked_or_default<tmpl::_1, tmpl::_1>>,
+    NodeThreadPoolHelpers<Metavariables>>;
+}  // namespace detail
+
+/*!
+ * \ingroup ActionsGroup
+ * \brief Processes chunks of the loop that is running on
+ * `sys::node_thread_pool()`, if any.
+ *
+ * \details This threaded action is invoked on the local branch of
+ * `Cce::NodeThreadPoolHelpers` by the thread pool set up by
+ * `Actions::ConfigureNodeThreadPool`.
+ */
+struct HelpNodeThreadPool {
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, typename ArrayIndex>
+  static void apply(db::DataBox<DbTagsList>& /*box*/,
+                    Parallel::GlobalCache<Metavariables>& /*cache*/,
+                    const ArrayIndex& /*array_index*/,
+                    const gsl::not_null<Parallel::NodeLock*> /*node_lock*/) {
+    sys::node_thread_pool().help();
+  }
+};
+
+/*!
+ * \ingroup ActionsGroup
+ * \brief Sizes the `sys::node_thread_pool()` of the node on which the
+ * characteristic evolution runs according to `Cce::Tags::NumberOfThreads`.
+ *
+ * \details The thread pool is shared by the hypersurface computations of the
+ * characteristic evolution, which split their angular work across the threads
+ * of the pool. If `Cce::NodeThreadPoolHelpers` is in the `component_list`, the
+ * work is shared with up to `Cce::Tags::NumberOfThreads - 1` other PEs of the
+ * node through that nodegroup. Otherwise, the pool creates its own worker
+ * threads, which are not managed by Charm++.
+ *
+ * The pool is not serialized, so this action should be placed at the start of
+ * each phase in which the evolution runs, so that the pool is set up again
+ * after restarts and migrations.
+ *
+ * Uses:
+ * - GlobalCache:
+ *   - `Cce::Tags::NumberOfThreads`
+ *
+ * \ref DataBoxGroup changes:
+ * - Adds: nothing
+ * - Removes: nothing
+ * - Modifies: nothing
+ */
+struct ConfigureNodeThreadPool {
+  using const_global_cache_tags = tmpl::list<Tags::NumberOfThreads>;
+
+  template <typename DbTags, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent>
+  static Parallel::iterable_action_return_t apply(
+      db::DataBox<DbTags>& box,
+      const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+      const Parallel::GlobalCache<Metavariables>& cache,
+      const ArrayIndex& /*array_index*/, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) {
+    const size_t number_of_threads = db::get<Tags::NumberOfThreads>(box);
+    if constexpr (detail::has_node_thread_pool_helpers<Metavariables>) {
+      const size_t number_of_helpers =
+          std::min(number_of_threads,
+                   Parallel::procs_on_node<size_t>(
+                       Parallel::my_node<size_t>(cache), cache)) -
+          1;
+      auto helpers = Parallel::get_parallel_component<
+          NodeThreadPoolHelpers<Metavariables>>(
+          cache)[Parallel::my_node<int>(cache)];
+      sys::node_thread_pool().use_external_helpers(
+          number_of_helpers,
+          [helpers](const size_t number_of_requested_helpers) mutable {
+            for (size_t i = 0; i < number_of_requested_helpers; ++i) {
+              Parallel::threaded_action<HelpNodeThreadPool>(helpers);
+            }
+          });
+    } else {
+      sys::node_thread_pool().resize(number_of_threads);
+    }
+    return {Parallel::AlgorithmExecution::Continue, std::nullopt};
+  }
+};
+}  // namespace Actions
+}  // namespace Cce
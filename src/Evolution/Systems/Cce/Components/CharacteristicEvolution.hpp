@@ -10,6 +10,7 @@
 #include "Evolution/Systems/Cce/Actions/BoundaryComputeAndSendToEvolution.hpp"
 #include "Evolution/Systems/Cce/Actions/CalculateScriInputs.hpp"
 #include "Evolution/Systems/Cce/Actions/CharacteristicEvolutionBondiCalculations.hpp"
+#include "Evolution/Systems/Cce/Actions/ConfigureNodeThreadPool.hpp"
 #include "Evolution/Systems/Cce/Actions/FilterSwshVolumeQuantity.hpp"
 #include "Evolution/Systems/Cce/Actions/InitializeCharacteristicEvolutionScri.hpp"
 #include "Evolution/Systems/Cce/Actions/InitializeCharacteristicEvolutionTime.hpp"
@@ -54,6 +55,15 @@ struct CceEvolutionLabelTag {};
  * computation, as well as storage for the boundary values and quantities
  * related to managing the evolution.
  *
+ * The component is a singleton, but the radial integration of the Bondi
+ * quantities, the spin-weighted angular derivatives of each hypersurface
+ * computation and the interpolation of the scri+ quantities to the output
+ * times are split across the threads of `sys::node_thread_pool()`,
+ * which is set up from the `Cce.NumberOfThreads` option by
+ * `Actions::ConfigureNodeThreadPool` at the start of each phase of the
+ * evolution. When the `Metavariables` include `Cce::NodeThreadPoolHelpers`
+ * in their `component_list`, the threads are the Charm++ PEs of the node.
+ *
  * Metavariables requirements:
  * - Phases:
  *  - `Initialization`
@@ -167,6 +177,7 @@ struct CharacteristicEvolution {
           typename Metavariables::cce_boundary_component>>;
 
   using self_start_extract_action_list = tmpl::list<
+      Actions::ConfigureNodeThreadPool,
       Actions::RequestBoundaryData<
           typename Metavariables::cce_boundary_component,
           CharacteristicEvolution<Metavariables>>,
@@ -199,6 +210,7 @@ struct CharacteristicEvolution {
       ::Actions::CleanHistory<cce_system, false>>;
 
   using extract_action_list = tmpl::list<
+      Actions::ConfigureNodeThreadPool,
       Actions::RequestBoundaryData<
           typename Metavariables::cce_boundary_component,
           CharacteristicEvolution<Metavariables>>,
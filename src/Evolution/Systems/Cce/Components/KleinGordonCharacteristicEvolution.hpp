@@ -76,6 +76,7 @@ struct KleinGordonCharacteristicEvolution
   using typename cce_base::compute_scri_quantities_and_observe;
 
   using self_start_extract_action_list = tmpl::list<
+      Actions::ConfigureNodeThreadPool,
       Actions::RequestBoundaryData<
           typename Metavariables::cce_boundary_component,
           KleinGordonCharacteristicEvolution<Metavariables>>,
@@ -118,6 +119,7 @@ struct KleinGordonCharacteristicEvolution
       ::Actions::UpdateU<cce_system>>;
 
   using extract_action_list = tmpl::list<
+      Actions::ConfigureNodeThreadPool,
       Actions::RequestBoundaryData<
           typename Metavariables::cce_boundary_component,
           KleinGordonCharacteristicEvolution<Metavariables>>,
@@ -0,0 +1,50 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include "Parallel/Algorithms/AlgorithmNodegroup.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Local.hpp"
+#include "Parallel/ParallelComponentHelpers.hpp"
+#include "Parallel/Phase.hpp"
+#include "Parallel/PhaseDependentActionList.hpp"
+#include "ParallelAlgorithms/Actions/TerminatePhase.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace Cce {
+/*!
+ * \brief A nodegroup whose PEs share the loops of `sys::node_thread_pool()`
+ * with the `CharacteristicEvolution` component.
+ *
+ * \details The component holds no data. When it is part of the
+ * `component_list` of the `Metavariables`, `Actions::ConfigureNodeThreadPool`
+ * sets up the node's thread pool to request help for each loop by invoking
+ * `Actions::HelpNodeThreadPool` on the local branch of this nodegroup, so that
+ * the angular work of each hypersurface computation is split across the
+ * Charm++ PEs of the node rather than across threads owned by the pool. Any
+ * PE that is busy when the help is requested simply picks up the request
+ * after the loop has completed, at which point it returns immediately.
+ */
+template <typename Metavariables>
+struct NodeThreadPoolHelpers {
+  using chare_type = Parallel::Algorithms::Nodegroup;
+  using metavariables = Metavariables;
+  using phase_dependent_action_list = tmpl::list<
+      Parallel::PhaseActions<Parallel::Phase::Initialization,
+                             tmpl::list<Parallel::Actions::TerminatePhase>>>;
+  using simple_tags_from_options = Parallel::get_simple_tags_from_options<
+      Parallel::get_initialization_actions_list<phase_dependent_action_list>>;
+
+  static void initialize(
+      Parallel::CProxy_GlobalCache<Metavariables>& /*global_cache*/) {}
+
+  static void execute_next_phase(
+      const Parallel::Phase next_phase,
+      Parallel::CProxy_GlobalCache<Metavariables>& global_cache) {
+    auto& local_cache = *Parallel::local_branch(global_cache);
+    Parallel::get_parallel_component<NodeThreadPoolHelpers>(local_cache)
+        .start_phase(next_phase);
+  }
+};
+}  // namespace Cce
@@ -102,6 +102,21 @@ struct NumberOfRadialPoints {
   using group = Cce;
 };
 
+struct NumberOfThreads {
+  using type = size_t;
+  static constexpr Options::String help{
+      "Number of threads on the node of the characteristic evolution that "
+      "share the angular work of each hypersurface computation. In "
+      "executables with the NodeThreadPoolHelpers nodegroup these are the "
+      "Charm++ PEs of the node (at most the number of PEs on the node); "
+      "otherwise the extra threads are not Charm++ PEs, so they should be "
+      "given cores that are not in use by Charm++. Set to 1 to run "
+      "serially."};
+  static size_t lower_bound() { return 1; }
+  static size_t suggested_value() { return 1; }
+  using group = Cce;
+};
+
 struct ExtractionRadius {
   using type = double;
   static constexpr Options::String help{"Extraction radius of the CCE system."};
@@ -158,6 +173,17 @@ struct H5LookaheadTimes {
   using group = Cce;
 };
 
+struct H5PrefetchNextWindow {
+  using type = bool;
+  static constexpr Options::String help{
+      "Read the next window of `H5LookaheadTimes` time steps on a background "
+      "thread while the current window is in use, so that the evolution does "
+      "not stall each time the buffer is refilled. This doubles the memory "
+      "used for the worldtube data buffer."};
+  static type default_value() { return false; }
+  using group = Cce;
+};
+
 struct H5Interpolator {
   using type = std::unique_ptr<intrp::SpanInterpolator>;
   static constexpr Options::String help{
@@ -314,14 +340,15 @@ struct H5WorldtubeBoundaryDataManager : db::SimpleTag {
       Tags::characteristic_worldtube_boundary_tags<Tags::BoundaryValue>>>;
   using option_tags =
       tmpl::list<OptionTags::LMax, OptionTags::BoundaryDataFilename,
-                 OptionTags::H5LookaheadTimes, OptionTags::H5Interpolator,
+                 OptionTags::H5LookaheadTimes,
+                 OptionTags::H5PrefetchNextWindow, OptionTags::H5Interpolator,
                  OptionTags::H5IsBondiData, OptionTags::FixSpecNormalization,
                  OptionTags::StandaloneExtractionRadius>;
 
   static constexpr bool pass_metavariables = false;
   static type create_from_options(
       const size_t l_max, const std::string& filename,
-      const size_t number_of_lookahead_times,
+      const size_t number_of_lookahead_times, const bool prefetch_next_window,
       const std::unique_ptr<intrp::SpanInterpolator>& interpolator,
       const bool h5_is_bondi_data, const bool fix_spec_normalization,
       const std::optional<double> extraction_radius) {
@@ -338,13 +365,14 @@ struct H5WorldtubeBoundaryDataManager : db::SimpleTag {
       return std::make_unique<BondiWorldtubeDataManager>(
           std::make_unique<BondiWorldtubeH5BufferUpdater>(filename,
                                                           extraction_radius),
-          l_max, number_of_lookahead_times, interpolator->get_clone());
+          l_max, number_of_lookahead_times, interpolator->get_clone(),
+          prefetch_next_window);
     } else {
       return std::make_unique<MetricWorldtubeDataManager>(
           std::make_unique<MetricWorldtubeH5BufferUpdater>(filename,
                                                            extraction_radius),
           l_max, number_of_lookahead_times, interpolator->get_clone(),
-          fix_spec_normalization);
+          fix_spec_normalization, prefetch_next_window);
     }
   }
 };
@@ -355,19 +383,21 @@ struct KleinGordonH5WorldtubeBoundaryDataManager : db::SimpleTag {
       WorldtubeDataManager<Tags::klein_gordon_worldtube_boundary_tags>>;
   using option_tags =
       tmpl::list<OptionTags::LMax, OptionTags::KleinGordonBoundaryDataFilename,
-                 OptionTags::H5LookaheadTimes, OptionTags::H5Interpolator,
+                 OptionTags::H5LookaheadTimes,
+                 OptionTags::H5PrefetchNextWindow, OptionTags::H5Interpolator,
                  OptionTags::StandaloneExtractionRadius>;
 
   static constexpr bool pass_metavariables = false;
   static type create_from_options(
       const size_t l_max, const std::string& filename,
-      const size_t number_of_lookahead_times,
+      const size_t number_of_lookahead_times, const bool prefetch_next_window,
       const std::unique_ptr<intrp::SpanInterpolator>& interpolator,
       const std::optional<double> extraction_radius) {
     return std::make_unique<KleinGordonWorldtubeDataManager>(
         std::make_unique<KleinGordonWorldtubeH5BufferUpdater>(
             filename, extraction_radius),
-        l_max, number_of_lookahead_times, interpolator->get_clone());
+        l_max, number_of_lookahead_times, interpolator->get_clone(),
+        prefetch_next_window);
   }
 };
 
@@ -390,6 +420,16 @@ struct NumberOfRadialPoints : db::SimpleTag,
   }
 };
 
+struct NumberOfThreads : db::SimpleTag {
+  using type = size_t;
+  using option_tags = tmpl::list<OptionTags::NumberOfThreads>;
+
+  static constexpr bool pass_metavariables = false;
+  static size_t create_from_options(const size_t number_of_threads) {
+    return number_of_threads;
+  }
+};
+
 struct ObservationLMax : db::SimpleTag {
   using type = size_t;
   using option_tags = tmpl::list<OptionTags::ObservationLMax>;
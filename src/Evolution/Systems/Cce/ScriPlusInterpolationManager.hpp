@@ -25,6 +25,7 @@
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/Literals.hpp"
 #include "Utilities/MakeArray.hpp"
+#include "Utilities/System/ThreadPool.hpp"
 
 namespace Cce {
 
@@ -210,56 +211,66 @@ std::pair<double, VectorTypeToInterpolate> ScriPlusInterpolationManager<
   VectorTypeToInterpolate result{vector_size_};
   const size_t interpolation_data_size = to_interpolate_values_.size();
 
-  VectorTypeToInterpolate interpolation_values{2 * target_number_of_points_};
-  DataVector interpolation_times{2 * target_number_of_points_};
-  for (size_t i = 0; i < vector_size_; ++i) {
-    // binary search assumes times placed in sorted order
-    auto upper_bound_offset = static_cast<size_t>(std::distance(
-        u_bondi_values_.begin(),
-        std::upper_bound(u_bondi_values_.begin(), u_bondi_values_.end(),
-                         target_times_.front(),
-                         [&i](const double rhs, const DataVector& lhs) {
-                           return rhs < lhs[i];
-                         })));
-    size_t lower_bound_offset =
-        upper_bound_offset == 0 ? 0 : upper_bound_offset - 1;
-
-    if (upper_bound_offset + target_number_of_points_ >
-        interpolation_data_size) {
-      upper_bound_offset = interpolation_data_size;
-      lower_bound_offset =
-          interpolation_data_size - 2 * target_number_of_points_;
-    } else if (lower_bound_offset < target_number_of_points_ - 1) {
-      lower_bound_offset = 0;
-      upper_bound_offset = 2 * target_number_of_points_;
-    } else {
-      lower_bound_offset = lower_bound_offset + 1 - target_number_of_points_;
-      upper_bound_offset = lower_bound_offset + 2 * target_number_of_points_;
-    }
-    auto interpolation_values_begin =
-        to_interpolate_values_.begin() +
-        static_cast<ptrdiff_t>(lower_bound_offset);
-    auto interpolation_times_begin =
-        u_bondi_values_.begin() + static_cast<ptrdiff_t>(lower_bound_offset);
-    auto interpolation_times_end =
-        u_bondi_values_.begin() + static_cast<ptrdiff_t>(upper_bound_offset);
-
-    // interpolate using the data sets in the restricted iterators
-    auto value_it = interpolation_values_begin;
-    size_t vector_position = 0;
-    for (auto time_it = interpolation_times_begin;
-         time_it != interpolation_times_end;
-         ++time_it, ++value_it, ++vector_position) {
-      interpolation_values[vector_position] = (*value_it)[i];
-      interpolation_times[vector_position] = (*time_it)[i];
-    }
-    result[i] = interpolator_->interpolate(
-        gsl::span<const double>(interpolation_times.data(),
-                                interpolation_times.size()),
-        gsl::span<const typename VectorTypeToInterpolate::value_type>(
-            interpolation_values.data(), interpolation_values.size()),
-        target_times_.front());
-  }
+  // The interpolation at each angular point is independent, so blocks of
+  // points are split across the threads of the node.
+  sys::node_thread_pool().parallel_for(
+      vector_size_, [&](const size_t begin, const size_t end) {
+        VectorTypeToInterpolate interpolation_values{
+            2 * target_number_of_points_};
+        DataVector interpolation_times{2 * target_number_of_points_};
+        for (size_t i = begin; i < end; ++i) {
+          // binary search assumes times placed in sorted order
+          auto upper_bound_offset = static_cast<size_t>(std::distance(
+              u_bondi_values_.begin(),
+              std::upper_bound(u_bondi_values_.begin(), u_bondi_values_.end(),
+                               target_times_.front(),
+                               [&i](const double rhs, const DataVector& lhs) {
+                                 return rhs < lhs[i];
+                               })));
+          size_t lower_bound_offset =
+              upper_bound_offset == 0 ? 0 : upper_bound_offset - 1;
+
+          if (upper_bound_offset + target_number_of_points_ >
+              interpolation_data_size) {
+            upper_bound_offset = interpolation_data_size;
+            lower_bound_offset =
+                interpolation_data_size - 2 * target_number_of_points_;
+          } else if (lower_bound_offset < target_number_of_points_ - 1) {
+            lower_bound_offset = 0;
+            upper_bound_offset = 2 * target_number_of_points_;
+          } else {
+            lower_bound_offset =
+                lower_bound_offset + 1 - target_number_of_points_;
+            upper_bound_offset =
+                lower_bound_offset + 2 * target_number_of_points_;
+          }
+          auto interpolation_values_begin =
+              to_interpolate_values_.begin() +
+              static_cast<ptrdiff_t>(lower_bound_offset);
+          auto interpolation_times_begin =
+              u_bondi_values_.begin() +
+              static_cast<ptrdiff_t>(lower_bound_offset);
+          auto interpolation_times_end =
+              u_bondi_values_.begin() +
+              static_cast<ptrdiff_t>(upper_bound_offset);
+
+          // interpolate using the data sets in the restricted iterators
+          auto value_it = interpolation_values_begin;
+          size_t vector_position = 0;
+          for (auto time_it = interpolation_times_begin;
+               time_it != interpolation_times_end;
+               ++time_it, ++value_it, ++vector_position) {
+            interpolation_values[vector_position] = (*value_it)[i];
+            interpolation_times[vector_position] = (*time_it)[i];
+          }
+          result[i] = interpolator_->interpolate(
+              gsl::span<const double>(interpolation_times.data(),
+                                      interpolation_times.size()),
+              gsl::span<const typename VectorTypeToInterpolate::value_type>(
+                  interpolation_values.data(), interpolation_values.size()),
+              target_times_.front());
+        }
+      });
   return std::make_pair(target_times_.front(), std::move(result));
 }
 
@@ -588,12 +599,6 @@ std::pair<double, VectorTypeToInterpolate> ScriPlusInterpolationManager<
   // reasonable method.
   VectorTypeToInterpolate result{argument_interpolation_manager_.vector_size_};
 
-  VectorTypeToInterpolate interpolation_values{2 * target_number_of_points};
-  VectorTypeToInterpolate lobatto_collocation_values{2 *
-                                                     target_number_of_points};
-  VectorTypeToInterpolate derivative_lobatto_collocation_values{
-      2 * target_number_of_points};
-  DataVector interpolation_times{2 * target_number_of_points};
   DataVector collocation_points =
       Spectral::collocation_points<Spectral::Basis::Legendre,
                                    Spectral::Quadrature::GaussLobatto>(
@@ -602,93 +607,108 @@ std::pair<double, VectorTypeToInterpolate> ScriPlusInterpolationManager<
   const size_t interpolation_data_size =
       argument_interpolation_manager_.to_interpolate_values_.size();
 
-  for (size_t i = 0; i < argument_interpolation_manager_.vector_size_; ++i) {
-    // binary search assumes times placed in sorted order
-    auto upper_bound_offset = static_cast<size_t>(std::distance(
-        argument_interpolation_manager_.u_bondi_values_.begin(),
-        std::upper_bound(
-            argument_interpolation_manager_.u_bondi_values_.begin(),
-            argument_interpolation_manager_.u_bondi_values_.end(),
-            argument_interpolation_manager_.target_times_.front(),
-            [&i](const double rhs, const DataVector& lhs) {
-              return rhs < lhs[i];
-            })));
-    size_t lower_bound_offset =
-        upper_bound_offset == 0 ? 0 : upper_bound_offset - 1;
-
-    if (upper_bound_offset + target_number_of_points >
-        interpolation_data_size) {
-      upper_bound_offset = interpolation_data_size;
-      lower_bound_offset =
-          interpolation_data_size - 2 * target_number_of_points;
-    } else if (lower_bound_offset < target_number_of_points - 1) {
-      lower_bound_offset = 0;
-      upper_bound_offset = 2 * target_number_of_points;
-    } else {
-      lower_bound_offset = lower_bound_offset + 1 - target_number_of_points;
-      upper_bound_offset = lower_bound_offset + 2 * target_number_of_points;
-    }
-    auto interpolation_values_begin =
-        argument_interpolation_manager_.to_interpolate_values_.begin() +
-        static_cast<ptrdiff_t>(lower_bound_offset);
-    auto interpolation_times_begin =
-        argument_interpolation_manager_.u_bondi_values_.begin() +
-        static_cast<ptrdiff_t>(lower_bound_offset);
-    auto interpolation_times_end =
-        argument_interpolation_manager_.u_bondi_values_.begin() +
-        static_cast<ptrdiff_t>(upper_bound_offset);
-
-    // interpolate using the data sets in the restricted iterators
-    auto value_it = interpolation_values_begin;
-    size_t vector_position = 0;
-    for (auto time_it = interpolation_times_begin;
-         time_it != interpolation_times_end;
-         ++time_it, ++value_it, ++vector_position) {
-      interpolation_values[vector_position] = (*value_it)[i];
-      interpolation_times[vector_position] = (*time_it)[i];
-    }
-    for (size_t j = 0; j < lobatto_collocation_values.size(); ++j) {
-      lobatto_collocation_values[j] =
-          argument_interpolation_manager_.interpolator_->interpolate(
-              gsl::span<const double>(interpolation_times.data(),
-                                      interpolation_times.size()),
-              gsl::span<const typename VectorTypeToInterpolate::value_type>(
-                  interpolation_values.data(), interpolation_values.size()),
-              // affine transformation between the Gauss-Lobatto collocation
-              // points and the physical times
-              (collocation_points[j] + 1.0) * 0.5 *
-                      (interpolation_times[interpolation_times.size() - 1] -
-                       interpolation_times[0]) +
-                  interpolation_times[0]);
-    }
-    // note the coordinate transformation to and from the Gauss-Lobatto basis
-    // range [-1, 1]
-    apply_matrices(
-        make_not_null(&derivative_lobatto_collocation_values),
-        make_array<1>(
-            Spectral::differentiation_matrix<
-                Spectral::Basis::Legendre, Spectral::Quadrature::GaussLobatto>(
-                lobatto_collocation_values.size())),
-        lobatto_collocation_values,
-        Index<1>(lobatto_collocation_values.size()));
-
-    result[i] =
-        argument_interpolation_manager_.interpolator_->interpolate(
-            gsl::span<const double>(collocation_points.data(),
-                                    collocation_points.size()),
-            gsl::span<const typename VectorTypeToInterpolate::value_type>(
-                derivative_lobatto_collocation_values.data(),
-                derivative_lobatto_collocation_values.size()),
-            2.0 *
-                    (argument_interpolation_manager_.target_times_.front() -
-                     interpolation_times[0]) /
-                    (interpolation_times[interpolation_times.size() - 1] -
-                     interpolation_times[0]) -
-                1.0) *
-        2.0 /
-        (interpolation_times[interpolation_times.size() - 1] -
-         interpolation_times[0]);
-  }
+  // The interpolation at each angular point is independent, so blocks of
+  // points are split across the threads of the node.
+  sys::node_thread_pool().parallel_for(
+      argument_interpolation_manager_.vector_size_,
+      [&](const size_t begin, const size_t end) {
+        using value_type = typename VectorTypeToInterpolate::value_type;
+        VectorTypeToInterpolate interpolation_values{2 *
+                                                     target_number_of_points};
+        VectorTypeToInterpolate lobatto_collocation_values{
+            2 * target_number_of_points};
+        VectorTypeToInterpolate derivative_lobatto_collocation_values{
+            2 * target_number_of_points};
+        DataVector interpolation_times{2 * target_number_of_points};
+        for (size_t i = begin; i < end; ++i) {
+          // binary search assumes times placed in sorted order
+          auto upper_bound_offset = static_cast<size_t>(std::distance(
+              argument_interpolation_manager_.u_bondi_values_.begin(),
+              std::upper_bound(
+                  argument_interpolation_manager_.u_bondi_values_.begin(),
+                  argument_interpolation_manager_.u_bondi_values_.end(),
+                  argument_interpolation_manager_.target_times_.front(),
+                  [&i](const double rhs, const DataVector& lhs) {
+                    return rhs < lhs[i];
+                  })));
+          size_t lower_bound_offset =
+              upper_bound_offset == 0 ? 0 : upper_bound_offset - 1;
+
+          if (upper_bound_offset + target_number_of_points >
+              interpolation_data_size) {
+            upper_bound_offset = interpolation_data_size;
+            lower_bound_offset =
+                interpolation_data_size - 2 * target_number_of_points;
+          } else if (lower_bound_offset < target_number_of_points - 1) {
+            lower_bound_offset = 0;
+            upper_bound_offset = 2 * target_number_of_points;
+          } else {
+            lower_bound_offset =
+                lower_bound_offset + 1 - target_number_of_points;
+            upper_bound_offset =
+                lower_bound_offset + 2 * target_number_of_points;
+          }
+          auto interpolation_values_begin =
+              argument_interpolation_manager_.to_interpolate_values_.begin() +
+              static_cast<ptrdiff_t>(lower_bound_offset);
+          auto interpolation_times_begin =
+              argument_interpolation_manager_.u_bondi_values_.begin() +
+              static_cast<ptrdiff_t>(lower_bound_offset);
+          auto interpolation_times_end =
+              argument_interpolation_manager_.u_bondi_values_.begin() +
+              static_cast<ptrdiff_t>(upper_bound_offset);
+
+          // interpolate using the data sets in the restricted iterators
+          auto value_it = interpolation_values_begin;
+          size_t vector_position = 0;
+          for (auto time_it = interpolation_times_begin;
+               time_it != interpolation_times_end;
+               ++time_it, ++value_it, ++vector_position) {
+            interpolation_values[vector_position] = (*value_it)[i];
+            interpolation_times[vector_position] = (*time_it)[i];
+          }
+          const double first_time = interpolation_times[0];
+          const double time_range =
+              interpolation_times[interpolation_times.size() - 1] - first_time;
+          for (size_t j = 0; j < lobatto_collocation_values.size(); ++j) {
+            lobatto_collocation_values[j] =
+                argument_interpolation_manager_.interpolator_->interpolate(
+                    gsl::span<const double>(interpolation_times.data(),
+                                            interpolation_times.size()),
+                    gsl::span<const value_type>(interpolation_values.data(),
+                                                interpolation_values.size()),
+                    // affine transformation between the Gauss-Lobatto
+                    // collocation points and the physical times
+                    (collocation_points[j] + 1.0) * 0.5 * time_range +
+                        first_time);
+          }
+          // note the coordinate transformation to and from the Gauss-Lobatto
+          // basis range [-1, 1]
+          apply_matrices(
+              make_not_null(&derivative_lobatto_collocation_values),
+              make_array<1>(Spectral::differentiation_matrix<
+                            Spectral::Basis::Legendre,
+                            Spectral::Quadrature::GaussLobatto>(
+                  lobatto_collocation_values.size())),
+              lobatto_collocation_values,
+              Index<1>(lobatto_collocation_values.size()));
+
+          result[i] =
+              argument_interpolation_manager_.interpolator_->interpolate(
+                  gsl::span<const double>(collocation_points.data(),
+                                          collocation_points.size()),
+                  gsl::span<const value_type>(
+                      derivative_lobatto_collocation_values.data(),
+                      derivative_lobatto_collocation_values.size()),
+                  2.0 *
+                          (argument_interpolation_manager_.target_times_
+                               .front() -
+                           first_time) /
+                          time_range -
+                      1.0) *
+              2.0 / time_range;
+        }
+      });
   return std::make_pair(argument_interpolation_manager_.target_times_.front(),
                         std::move(result));
 }
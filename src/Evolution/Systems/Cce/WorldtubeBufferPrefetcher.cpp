@@ -0,0 +1,184 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Evolution/Systems/Cce/WorldtubeBufferPrefetcher.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <pup.h>
+#include <utility>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Evolution/Systems/Cce/WorldtubeBufferUpdater.hpp"
+#include "Parallel/NodeLock.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace Cce {
+void WorldtubeBufferStatistics::pup(PUP::er& p) {
+  p | number_of_refills;
+  p | number_of_prefetch_hits;
+  p | stall_time;
+}
+
+std::ostream& operator<<(std::ostream& os,
+                         const WorldtubeBufferStatistics& statistics) {
+  return os << statistics.number_of_refills << " refills, "
+            << statistics.number_of_prefetch_hits << " prefetch hits, "
+            << statistics.stall_time << "s stalled";
+}
+
+namespace detail {
+template <typename InputTags>
+WorldtubeBufferPrefetcher<InputTags>::WorldtubeBufferPrefetcher(
+    const bool prefetch_next_window)
+    : prefetch_next_window_{prefetch_next_window} {}
+
+template <typename InputTags>
+WorldtubeBufferPrefetcher<InputTags>::~WorldtubeBufferPrefetcher() {
+  wait();
+}
+
+template <typename InputTags>
+void WorldtubeBufferPrefetcher<InputTags>::update_buffers_for_time(
+    const gsl::not_null<Variables<InputTags>*> buffers,
+    const gsl::not_null<size_t*> time_span_start,
+    const gsl::not_null<size_t*> time_span_end,
+    const gsl::not_null<Parallel::NodeLock*> hdf5_lock, const double time,
+    const std::unique_ptr<WorldtubeBufferUpdater<InputTags>>& buffer_updater,
+    const size_t l_max, const size_t interpolator_length,
+    const size_t buffer_depth) {
+  const DataVector& time_buffer = buffer_updater->get_time_buffer();
+  if (not buffer_update_required(*time_span_end, time, interpolator_length,
+                                 time_buffer)) {
+    return;
+  }
+  const auto refill_start = std::chrono::steady_clock::now();
+  const std::pair<size_t, size_t> previous_span{*time_span_start,
+                                                *time_span_end};
+  bool used_prefetched_window = false;
+  if (pending_read_.valid()) {
+    // `get()` rather than `wait()` so that any error raised during the
+    // background read is reported here.
+    pending_read_.get();
+    const auto expected_span = create_span_for_time_value(
+        time, buffer_depth, interpolator_length, 0, time_buffer.size(),
+        time_buffer);
+    if (expected_span.first == prefetched_span_start_ and
+        expected_span.second == prefetched_span_end_) {
+      using std::swap;
+      swap(*buffers, prefetched_buffers_);
+      *time_span_start = prefetched_span_start_;
+      *time_span_end = prefetched_span_end_;
+      used_prefetched_window = true;
+    }
+  }
+  if (not used_prefetched_window) {
+    const std::lock_guard hold_lock(*hdf5_lock);
+    buffer_updater->update_buffers_for_time(
+        buffers, time_span_start, time_span_end, time, l_max,
+        interpolator_length, buffer_depth);
+  }
+  if (previous_span ==
+      std::pair<size_t, size_t>{*time_span_start, *time_span_end}) {
+    return;
+  }
+  statistics_.stall_time += std::chrono::duration<double>(
+                                std::chrono::steady_clock::now() - refill_start)
+                                .count();
+  ++statistics_.number_of_refills;
+  if (used_prefetched_window) {
+    ++statistics_.number_of_prefetch_hits;
+  }
+
+  if (prefetch_next_window_ and *time_span_end < time_buffer.size() and
+      *time_span_end > interpolator_length) {
+    // The first time that will fall outside of the current window is
+    // `time_buffer[*time_span_end - interpolator_length]`. Unless a step lands
+    // exactly on that time, the next refill will be requested with a time
+    // bracketed by that value and the subsequent one, which all produce the
+    // same window as the subsequent time.
+    launch_read(hdf5_lock,
+                time_buffer[std::min(*time_span_end - interpolator_length + 1,
+                                     time_buffer.size() - 1)],
+                buffer_updater, buffers->number_of_grid_points(), l_max,
+                interpolator_length, buffer_depth);
+  }
+}
+
+template <typename InputTags>
+void WorldtubeBufferPrefetcher<InputTags>::wait() const {
+  if (pending_read_.valid()) {
+    pending_read_.wait();
+  }
+}
+
+template <typename InputTags>
+void WorldtubeBufferPrefetcher<InputTags>::launch_read(
+    const gsl::not_null<Parallel::NodeLock*> hdf5_lock, const double time,
+    const std::unique_ptr<WorldtubeBufferUpdater<InputTags>>& buffer_updater,
+    const size_t number_of_buffer_points, const size_t l_max,
+    const size_t interpolator_length, const size_t buffer_depth) {
+  if (prefetched_buffers_.number_of_grid_points() != number_of_buffer_points) {
+    prefetched_buffers_.initialize(number_of_buffer_points);
+  }
+  // an empty span forces the updater to read the full window for `time`
+  prefetched_span_start_ = 0;
+  prefetched_span_end_ = 0;
+  const WorldtubeBufferUpdater<InputTags>* const updater =
+      buffer_updater.get();
+  pending_read_ =
+      std::async(std::launch::async, [this, updater, hdf5_lock, time, l_max,
+                                      interpolator_length, buffer_depth]() {
+        const std::lock_guard hold_lock(*hdf5_lock);
+        updater->update_buffers_for_time(
+            make_not_null(&prefetched_buffers_),
+            make_not_null(&prefetched_span_start_),
+            make_not_null(&prefetched_span_end_), time, l_max,
+            interpolator_length, buffer_depth);
+      });
+}
+
+template <typename InputTags>
+void pup_buffer_prefetcher(
+    const gsl::not_null<PUP::er*> p,
+    const gsl::not_null<std::unique_ptr<WorldtubeBufferPrefetcher<InputTags>>*>
+        buffer_prefetcher) {
+  bool prefetch_next_window = false;
+  if (not p->isUnpacking()) {
+    // the background read uses the buffer updater
+    (*buffer_prefetcher)->wait();
+    prefetch_next_window = (*buffer_prefetcher)->prefetch_next_window();
+  }
+  *p | prefetch_next_window;
+  if (p->isUnpacking()) {
+    *buffer_prefetcher = std::make_unique<WorldtubeBufferPrefetcher<InputTags>>(
+        prefetch_next_window);
+  }
+  *p | (*buffer_prefetcher)->statistics();
+}
+
+#define INPUT_TAGS(data) BOOST_PP_TUPLE_ELEM(0, data)
+
+#define INSTANTIATE(_, data)                                             \
+  template class WorldtubeBufferPrefetcher<INPUT_TAGS(data)>;            \
+  template void pup_buffer_prefetcher(                                   \
+      gsl::not_null<PUP::er*> p,                                         \
+      gsl::not_null<                                                     \
+          std::unique_ptr<WorldtubeBufferPrefetcher<INPUT_TAGS(data)>>*> \
+          buffer_prefetcher);
+
+GENERATE_INSTANTIATIONS(INSTANTIATE, (cce_metric_input_tags,
+                                      cce_bondi_input_tags,
+                                      klein_gordon_input_tags))
+
+#undef INSTANTIATE
+#undef INPUT_TAGS
+}  // namespace detail
+}  // namespace Cce
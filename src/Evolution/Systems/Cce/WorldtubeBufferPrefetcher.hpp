@@ -0,0 +1,128 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <ostream>
+
+#include "DataStructures/Variables.hpp"
+#include "Evolution/Systems/Cce/WorldtubeBufferUpdater.hpp"
+#include "Parallel/NodeLock.hpp"
+#include "Utilities/Gsl.hpp"
+
+/// \cond
+namespace PUP {
+class er;
+}  // namespace PUP
+/// \endcond
+
+namespace Cce {
+
+/// Diagnostics for the refills of the time-series buffer held by a
+/// `WorldtubeDataManager`.
+struct WorldtubeBufferStatistics {
+  /// The number of times the buffer was refilled with a new time window
+  size_t number_of_refills = 0;
+  /// The number of refills that were satisfied by a window that had already
+  /// been read on a background thread
+  size_t number_of_prefetch_hits = 0;
+  /// The total wall time in seconds that the calling thread spent blocked on
+  /// refills, either waiting for a background read to complete or reading the
+  /// window synchronously. Calls that leave the window unchanged are not
+  /// counted.
+  double stall_time = 0.0;
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p);
+};
+
+std::ostream& operator<<(std::ostream& os,
+                         const WorldtubeBufferStatistics& statistics);
+
+namespace detail {
+/*!
+ * \brief Manages the refills of the buffer of a `WorldtubeDataManager`,
+ * optionally reading the next time window on a background thread while the
+ * current window is in use.
+ *
+ * \details When the prefetch is enabled, each refill of the buffer launches a
+ * read of the window that the following refill is expected to need, i.e. the
+ * window that `create_span_for_time_value()` produces for the first time that
+ * is no longer covered by the current window. That read is performed by the
+ * `buffer_updater` on a separate thread into a second buffer of the same size.
+ * At the next refill, the calling thread waits for the background read (if it
+ * hasn't already finished), and if the prefetched window is the one that would
+ * have been read synchronously, the two buffers are swapped. Otherwise, the
+ * prefetched data is discarded and the window is read synchronously.
+ *
+ * The background read holds the `hdf5_lock` for its full duration, so it never
+ * overlaps with any other H5 access on the node. The `buffer_updater` is only
+ * called from one thread at a time: a pending read is always completed before
+ * the calling thread accesses the updater's file.
+ *
+ * \note The decision of whether a refill is required is made by
+ * `buffer_update_required()` rather than by the `buffer_updater` itself, so
+ * updaters used with the prefetch must not refill the buffer earlier than that
+ * function indicates.
+ */
+template <typename InputTags>
+class WorldtubeBufferPrefetcher {
+ public:
+  explicit WorldtubeBufferPrefetcher(bool prefetch_next_window);
+
+  WorldtubeBufferPrefetcher(const WorldtubeBufferPrefetcher&) = delete;
+  WorldtubeBufferPrefetcher& operator=(const WorldtubeBufferPrefetcher&) =
+      delete;
+  // the background read refers to `this`, so the object must not move.
+  WorldtubeBufferPrefetcher(WorldtubeBufferPrefetcher&&) = delete;
+  WorldtubeBufferPrefetcher& operator=(WorldtubeBufferPrefetcher&&) = delete;
+  ~WorldtubeBufferPrefetcher();
+
+  /// Refill `buffers` if they no longer cover `time`, and launch the read of
+  /// the following window if the prefetch is enabled. The arguments have the
+  /// same meaning as in `WorldtubeBufferUpdater::update_buffers_for_time()`.
+  void update_buffers_for_time(
+      gsl::not_null<Variables<InputTags>*> buffers,
+      gsl::not_null<size_t*> time_span_start,
+      gsl::not_null<size_t*> time_span_end,
+      gsl::not_null<Parallel::NodeLock*> hdf5_lock, double time,
+      const std::unique_ptr<WorldtubeBufferUpdater<InputTags>>& buffer_updater,
+      size_t l_max, size_t interpolator_length, size_t buffer_depth);
+
+  /// Block until any background read has completed.
+  void wait() const;
+
+  bool prefetch_next_window() const { return prefetch_next_window_; }
+
+  const WorldtubeBufferStatistics& statistics() const { return statistics_; }
+
+  WorldtubeBufferStatistics& statistics() { return statistics_; }
+
+ private:
+  void launch_read(
+      gsl::not_null<Parallel::NodeLock*> hdf5_lock, double time,
+      const std::unique_ptr<WorldtubeBufferUpdater<InputTags>>& buffer_updater,
+      size_t number_of_buffer_points, size_t l_max, size_t interpolator_length,
+      size_t buffer_depth);
+
+  bool prefetch_next_window_ = false;
+  std::future<void> pending_read_{};
+  Variables<InputTags> prefetched_buffers_{};
+  size_t prefetched_span_start_ = 0;
+  size_t prefetched_span_end_ = 0;
+  WorldtubeBufferStatistics statistics_{};
+};
+
+/// Serialize the `buffer_prefetcher` of a `WorldtubeDataManager`. Any
+/// background read is completed first since it uses the buffer updater, and a
+/// new prefetcher is created when unpacking.
+template <typename InputTags>
+void pup_buffer_prefetcher(
+    gsl::not_null<PUP::er*> p,
+    gsl::not_null<std::unique_ptr<WorldtubeBufferPrefetcher<InputTags>>*>
+        buffer_prefetcher);
+}  // namespace detail
+}  // namespace Cce
@@ -72,6 +72,16 @@ std::pair<size_t, size_t> create_span_for_time_value(
   return std::make_pair(span_start, span_end);
 }
 
+bool buffer_update_required(const size_t time_span_end, const double time,
+                            const size_t interpolator_length,
+                            const DataVector& time_buffer) {
+  if (time_span_end >= time_buffer.size()) {
+    return false;
+  }
+  return not(time_span_end > interpolator_length and
+             time_buffer[time_span_end - interpolator_length] > time);
+}
+
 void set_time_buffer_and_lmax(const gsl::not_null<DataVector*> time_buffer,
                               size_t& l_max, const h5::Dat& data) {
   const auto data_table_dimensions = data.get_dimensions();
@@ -179,8 +189,8 @@ double update_buffers_for_time(
   if (*time_span_end >= time_buffer.size()) {
     return std::numeric_limits<double>::quiet_NaN();
   }
-  if (*time_span_end > interpolator_length and
-      time_buffer[*time_span_end - interpolator_length] > time) {
+  if (not buffer_update_required(*time_span_end, time, interpolator_length,
+                                 time_buffer)) {
     // the next time an update will be required
     return time_buffer[*time_span_end - interpolator_length + 1];
   }
@@ -259,8 +269,8 @@ double MetricWorldtubeH5BufferUpdater::update_buffers_for_time(
   if (*time_span_end >= time_buffer_.size()) {
     return std::numeric_limits<double>::quiet_NaN();
   }
-  if (*time_span_end > interpolator_length and
-      time_buffer_[*time_span_end - interpolator_length] > time) {
+  if (not detail::buffer_update_required(*time_span_end, time,
+                                         interpolator_length, time_buffer_)) {
     // the next time an update will be required
     return time_buffer_[*time_span_end - interpolator_length + 1];
   }
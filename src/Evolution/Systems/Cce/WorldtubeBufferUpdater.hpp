@@ -82,6 +82,13 @@ std::pair<size_t, size_t> create_span_for_time_value(
     double time, size_t pad, size_t interpolator_length, size_t lower_bound,
     size_t upper_bound, const DataVector& time_buffer);
 
+// returns `true` if a buffer ending at index `time_span_end` of `time_buffer`
+// can no longer supply an interpolation of length `interpolator_length` about
+// `time`, so that the buffer must be refilled before interpolating to `time`.
+bool buffer_update_required(size_t time_span_end, double time,
+                            size_t interpolator_length,
+                            const DataVector& time_buffer);
+
 // retrieves time stamps and lmax the from the specified file.
 void set_time_buffer_and_lmax(gsl::not_null<DataVector*> time_buffer,
                               size_t& l_max, const h5::Dat& data);
@@ -6,7 +6,6 @@
 #include <complex>
 #include <cstddef>
 #include <memory>
-#include <mutex>
 #include <utility>
 
 #include "DataStructures/ComplexModalVector.hpp"
@@ -17,6 +16,7 @@
 #include "Evolution/Systems/Cce/BoundaryData.hpp"
 #include "Evolution/Systems/Cce/SpecBoundaryData.hpp"
 #include "Evolution/Systems/Cce/Tags.hpp"
+#include "Evolution/Systems/Cce/WorldtubeBufferPrefetcher.hpp"
 #include "NumericalAlgorithms/Interpolation/SpanInterpolator.hpp"
 #include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/SwshCoefficients.hpp"
 #include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/SwshTransform.hpp"
@@ -82,14 +82,13 @@ void populate_hypersurface_boundary_data(
     const gsl::not_null<Parallel::NodeLock*> hdf5_lock, const double time,
     const std::unique_ptr<intrp::SpanInterpolator>& interpolator,
     const std::unique_ptr<WorldtubeBufferUpdater<InputTags>>& buffer_updater,
+    const gsl::not_null<WorldtubeBufferPrefetcher<InputTags>*>
+        buffer_prefetcher,
     const size_t l_max, const size_t buffer_depth) {
-  {
-    const std::lock_guard hold_lock(*hdf5_lock);
-    buffer_updater->update_buffers_for_time(
-        coefficients_buffers, time_span_start, time_span_end, time, l_max,
-        interpolator->required_number_of_points_before_and_after(),
-        buffer_depth);
-  }
+  buffer_prefetcher->update_buffers_for_time(
+      coefficients_buffers, time_span_start, time_span_end, hdf5_lock, time,
+      buffer_updater, l_max,
+      interpolator->required_number_of_points_before_and_after(), buffer_depth);
 
   auto interpolation_time_span = detail::create_span_for_time_value(
       time, 0, interpolator->required_number_of_points_before_and_after(),
@@ -166,14 +165,17 @@ MetricWorldtubeDataManager::MetricWorldtubeDataManager(
         buffer_updater,
     const size_t l_max, const size_t buffer_depth,
     std::unique_ptr<intrp::SpanInterpolator> interpolator,
-    const bool fix_spec_normalization)
+    const bool fix_spec_normalization, const bool prefetch_next_window)
     : buffer_updater_{std::move(buffer_updater)},
       l_max_{l_max},
       fix_spec_normalization_{fix_spec_normalization},
       interpolated_coefficients_{
           Spectral::Swsh::size_of_libsharp_coefficient_vector(l_max)},
       buffer_depth_{buffer_depth},
-      interpolator_{std::move(interpolator)} {
+      interpolator_{std::move(interpolator)},
+      buffer_prefetcher_{std::make_unique<
+          detail::WorldtubeBufferPrefetcher<cce_metric_input_tags>>(
+          prefetch_next_window)} {
   detail::initialize_buffers<cce_metric_input_tags>(
       make_not_null(&buffer_depth_), make_not_null(&coefficients_buffers_),
       buffer_updater_->get_time_buffer().size(),
@@ -189,14 +191,11 @@ bool MetricWorldtubeDataManager::populate_hypersurface_boundary_data(
   if (buffer_updater_->time_is_outside_range(time)) {
     return false;
   }
-  {
-    const std::lock_guard hold_lock(*hdf5_lock);
-    buffer_updater_->update_buffers_for_time(
-        make_not_null(&coefficients_buffers_), make_not_null(&time_span_start_),
-        make_not_null(&time_span_end_), time, l_max_,
-        interpolator_->required_number_of_points_before_and_after(),
-        buffer_depth_);
-  }
+  buffer_prefetcher_->update_buffers_for_time(
+      make_not_null(&coefficients_buffers_), make_not_null(&time_span_start_),
+      make_not_null(&time_span_end_), hdf5_lock, time, buffer_updater_, l_max_,
+      interpolator_->required_number_of_points_before_and_after(),
+      buffer_depth_);
   const auto interpolation_time_span = detail::create_span_for_time_value(
       time, 0, interpolator_->required_number_of_points_before_and_after(),
       time_span_start_, time_span_end_, buffer_updater_->get_time_buffer());
@@ -351,14 +350,22 @@ std::unique_ptr<WorldtubeDataManager<
 MetricWorldtubeDataManager::get_clone() const {
   return std::make_unique<MetricWorldtubeDataManager>(
       buffer_updater_->get_clone(), l_max_, buffer_depth_,
-      interpolator_->get_clone(), fix_spec_normalization_);
+      interpolator_->get_clone(), fix_spec_normalization_,
+      buffer_prefetcher_->prefetch_next_window());
 }
 
 std::pair<size_t, size_t> MetricWorldtubeDataManager::get_time_span() const {
   return std::make_pair(time_span_start_, time_span_end_);
 }
 
+const WorldtubeBufferStatistics&
+MetricWorldtubeDataManager::get_buffer_statistics() const {
+  return buffer_prefetcher_->statistics();
+}
+
 void MetricWorldtubeDataManager::pup(PUP::er& p) {
+  detail::pup_buffer_prefetcher(make_not_null(&p),
+                                make_not_null(&buffer_prefetcher_));
   p | buffer_updater_;
   p | time_span_start_;
   p | time_span_end_;
@@ -379,13 +386,17 @@ BondiWorldtubeDataManager::BondiWorldtubeDataManager(
     std::unique_ptr<WorldtubeBufferUpdater<cce_bondi_input_tags>>
         buffer_updater,
     const size_t l_max, const size_t buffer_depth,
-    std::unique_ptr<intrp::SpanInterpolator> interpolator)
+    std::unique_ptr<intrp::SpanInterpolator> interpolator,
+    const bool prefetch_next_window)
     : buffer_updater_{std::move(buffer_updater)},
       l_max_{l_max},
       interpolated_coefficients_{
           Spectral::Swsh::size_of_libsharp_coefficient_vector(l_max)},
       buffer_depth_{buffer_depth},
-      interpolator_{std::move(interpolator)} {
+      interpolator_{std::move(interpolator)},
+      buffer_prefetcher_{std::make_unique<
+          detail::WorldtubeBufferPrefetcher<cce_bondi_input_tags>>(
+          prefetch_next_window)} {
   detail::initialize_buffers<cce_bondi_input_tags>(
       make_not_null(&buffer_depth_), make_not_null(&coefficients_buffers_),
       buffer_updater_->get_time_buffer().size(),
@@ -408,7 +419,8 @@ bool BondiWorldtubeDataManager::populate_hypersurface_boundary_data(
       boundary_data_variables, make_not_null(&interpolated_coefficients_),
       make_not_null(&coefficients_buffers_), make_not_null(&time_span_start_),
       make_not_null(&time_span_end_), hdf5_lock, time, interpolator_,
-      buffer_updater_, l_max_, buffer_depth_);
+      buffer_updater_, make_not_null(buffer_prefetcher_.get()), l_max_,
+      buffer_depth_);
 
   const auto& du_r = get(get<Tags::BoundaryValue<Tags::Du<Tags::BondiR>>>(
       *boundary_data_variables));
@@ -447,14 +459,21 @@ std::unique_ptr<WorldtubeDataManager<
 BondiWorldtubeDataManager::get_clone() const {
   return std::make_unique<BondiWorldtubeDataManager>(
       buffer_updater_->get_clone(), l_max_, buffer_depth_,
-      interpolator_->get_clone());
+      interpolator_->get_clone(), buffer_prefetcher_->prefetch_next_window());
 }
 
 std::pair<size_t, size_t> BondiWorldtubeDataManager::get_time_span() const {
   return std::make_pair(time_span_start_, time_span_end_);
 }
 
+const WorldtubeBufferStatistics&
+BondiWorldtubeDataManager::get_buffer_statistics() const {
+  return buffer_prefetcher_->statistics();
+}
+
 void BondiWorldtubeDataManager::pup(PUP::er& p) {
+  detail::pup_buffer_prefetcher(make_not_null(&p),
+                                make_not_null(&buffer_prefetcher_));
   p | buffer_updater_;
   p | time_span_start_;
   p | time_span_end_;
@@ -474,13 +493,17 @@ KleinGordonWorldtubeDataManager::KleinGordonWorldtubeDataManager(
     std::unique_ptr<WorldtubeBufferUpdater<klein_gordon_input_tags>>
         buffer_updater,
     const size_t l_max, const size_t buffer_depth,
-    std::unique_ptr<intrp::SpanInterpolator> interpolator)
+    std::unique_ptr<intrp::SpanInterpolator> interpolator,
+    const bool prefetch_next_window)
     : buffer_updater_{std::move(buffer_updater)},
       l_max_{l_max},
       interpolated_coefficients_{
           Spectral::Swsh::size_of_libsharp_coefficient_vector(l_max)},
       buffer_depth_{buffer_depth},
-      interpolator_{std::move(interpolator)} {
+      interpolator_{std::move(interpolator)},
+      buffer_prefetcher_{std::make_unique<
+          detail::WorldtubeBufferPrefetcher<klein_gordon_input_tags>>(
+          prefetch_next_window)} {
   detail::initialize_buffers<klein_gordon_input_tags>(
       make_not_null(&buffer_depth_), make_not_null(&coefficients_buffers_),
       buffer_updater_->get_time_buffer().size(),
@@ -501,7 +524,8 @@ bool KleinGordonWorldtubeDataManager::populate_hypersurface_boundary_data(
       boundary_data_variables, make_not_null(&interpolated_coefficients_),
       make_not_null(&coefficients_buffers_), make_not_null(&time_span_start_),
       make_not_null(&time_span_end_), hdf5_lock, time, interpolator_,
-      buffer_updater_, l_max_, buffer_depth_);
+      buffer_updater_, make_not_null(buffer_prefetcher_.get()), l_max_,
+      buffer_depth_);
 
   return true;
 }
@@ -511,7 +535,7 @@ std::unique_ptr<
 KleinGordonWorldtubeDataManager::get_clone() const {
   return std::make_unique<KleinGordonWorldtubeDataManager>(
       buffer_updater_->get_clone(), l_max_, buffer_depth_,
-      interpolator_->get_clone());
+      interpolator_->get_clone(), buffer_prefetcher_->prefetch_next_window());
 }
 
 std::pair<size_t, size_t> KleinGordonWorldtubeDataManager::get_time_span()
@@ -519,7 +543,14 @@ std::pair<size_t, size_t> KleinGordonWorldtubeDataManager::get_time_span()
   return std::make_pair(time_span_start_, time_span_end_);
 }
 
+const WorldtubeBufferStatistics&
+KleinGordonWorldtubeDataManager::get_buffer_statistics() const {
+  return buffer_prefetcher_->statistics();
+}
+
 void KleinGordonWorldtubeDataManager::pup(PUP::er& p) {
+  detail::pup_buffer_prefetcher(make_not_null(&p),
+                                make_not_null(&buffer_prefetcher_));
   p | buffer_updater_;
   p | time_span_start_;
   p | time_span_end_;
@@ -11,6 +11,7 @@
 #include "DataStructures/DataBox/Tag.hpp"
 #include "Evolution/Systems/Cce/BoundaryData.hpp"
 #include "Evolution/Systems/Cce/Tags.hpp"
+#include "Evolution/Systems/Cce/WorldtubeBufferPrefetcher.hpp"
 #include "Evolution/Systems/Cce/WorldtubeBufferUpdater.hpp"
 #include "NumericalAlgorithms/Interpolation/SpanInterpolator.hpp"
 #include "Parallel/NodeLock.hpp"
@@ -46,6 +47,7 @@ void populate_hypersurface_boundary_data(
     gsl::not_null<Parallel::NodeLock*> hdf5_lock, double time,
     const std::unique_ptr<intrp::SpanInterpolator>& interpolator,
     const std::unique_ptr<WorldtubeBufferUpdater<InputTags>>& buffer_updater,
+    gsl::not_null<WorldtubeBufferPrefetcher<InputTags>*> buffer_prefetcher,
     size_t l_max, size_t buffer_depth);
 }  // namespace detail
 
@@ -77,6 +79,9 @@ class KleinGordonWorldtubeDataManager;
  *   `std::pair` of indices that represent the start and end point of the
  *   underlying data source. This is primarily used for monitoring the frequency
  *   and size of the buffer updates.
+ * - `WorldtubeDataManager::get_buffer_statistics()`: The override should
+ *   return the `WorldtubeBufferStatistics` accumulated by the buffer refills,
+ *   for monitoring how long the evolution waits on the data source.
  */
 template <typename BoundaryTags>
 class WorldtubeDataManager : public PUP::able {
@@ -96,6 +101,8 @@ class WorldtubeDataManager : public PUP::able {
   virtual size_t get_l_max() const = 0;
 
   virtual std::pair<size_t, size_t> get_time_span() const = 0;
+
+  virtual const WorldtubeBufferStatistics& get_buffer_statistics() const = 0;
 };
 
 /*!
@@ -107,6 +114,9 @@ class WorldtubeDataManager : public PUP::able {
  * the `Interpolator` and the `buffer_depth` also passed to the constructor. A
  * longer depth will ensure that the buffer updater is called less frequently,
  * which is useful for slow updaters (e.g. those that perform file access).
+ * If `prefetch_next_window` is `true`, the next buffer is read on a background
+ * thread while the current one is in use (see
+ * `detail::WorldtubeBufferPrefetcher`).
  * The main functionality is provided by the
  * `WorldtubeDataManager::populate_hypersurface_boundary_data()` member
  * function that handles buffer updating and boundary computation.
@@ -123,7 +133,7 @@ class MetricWorldtubeDataManager
           buffer_updater,
       size_t l_max, size_t buffer_depth,
       std::unique_ptr<intrp::SpanInterpolator> interpolator,
-      bool fix_spec_normalization);
+      bool fix_spec_normalization, bool prefetch_next_window = false);
 
   WRAPPED_PUPable_decl_template(MetricWorldtubeDataManager);  // NOLINT
 
@@ -162,6 +172,10 @@ class MetricWorldtubeDataManager
   /// diagnostics
   std::pair<size_t, size_t> get_time_span() const override;
 
+  /// retrieves the timing and prefetch statistics of the buffer refills for
+  /// diagnostics
+  const WorldtubeBufferStatistics& get_buffer_statistics() const override;
+
   /// Serialization for Charm++.
   void pup(PUP::er& p) override;  // NOLINT
 
@@ -187,6 +201,11 @@ class MetricWorldtubeDataManager
   size_t buffer_depth_ = 0;
 
   std::unique_ptr<intrp::SpanInterpolator> interpolator_;
+
+  // declared after `buffer_updater_` so that any background read completes
+  // before the updater is destroyed
+  std::unique_ptr<detail::WorldtubeBufferPrefetcher<cce_metric_input_tags>>
+      buffer_prefetcher_;
 };
 
 /*!
@@ -198,6 +217,9 @@ class MetricWorldtubeDataManager
  * the `Interpolator` and the `buffer_depth` also passed to the constructor. A
  * longer depth will ensure that the buffer updater is called less frequently,
  * which is useful for slow updaters (e.g. those that perform file access).
+ * If `prefetch_next_window` is `true`, the next buffer is read on a background
+ * thread while the current one is in use (see
+ * `detail::WorldtubeBufferPrefetcher`).
  * The main functionality is provided by the
  * `WorldtubeDataManager::populate_hypersurface_boundary_data()` member
  * function that handles buffer updating and boundary computation. This version
@@ -217,7 +239,8 @@ class BondiWorldtubeDataManager
       std::unique_ptr<WorldtubeBufferUpdater<cce_bondi_input_tags>>
           buffer_updater,
       size_t l_max, size_t buffer_depth,
-      std::unique_ptr<intrp::SpanInterpolator> interpolator);
+      std::unique_ptr<intrp::SpanInterpolator> interpolator,
+      bool prefetch_next_window = false);
 
   WRAPPED_PUPable_decl_template(BondiWorldtubeDataManager);  // NOLINT
 
@@ -255,6 +278,10 @@ class BondiWorldtubeDataManager
   /// diagnostics
   std::pair<size_t, size_t> get_time_span() const override;
 
+  /// retrieves the timing and prefetch statistics of the buffer refills for
+  /// diagnostics
+  const WorldtubeBufferStatistics& get_buffer_statistics() const override;
+
   /// Serialization for Charm++.
   void pup(PUP::er& p) override;  // NOLINT
 
@@ -278,6 +305,11 @@ class BondiWorldtubeDataManager
   size_t buffer_depth_ = 0;
 
   std::unique_ptr<intrp::SpanInterpolator> interpolator_;
+
+  // declared after `buffer_updater_` so that any background read completes
+  // before the updater is destroyed
+  std::unique_ptr<detail::WorldtubeBufferPrefetcher<cce_bondi_input_tags>>
+      buffer_prefetcher_;
 };
 
 class KleinGordonWorldtubeDataManager
@@ -290,7 +322,8 @@ class KleinGordonWorldtubeDataManager
       std::unique_ptr<WorldtubeBufferUpdater<klein_gordon_input_tags>>
           buffer_updater,
       size_t l_max, size_t buffer_depth,
-      std::unique_ptr<intrp::SpanInterpolator> interpolator);
+      std::unique_ptr<intrp::SpanInterpolator> interpolator,
+      bool prefetch_next_window = false);
 
   WRAPPED_PUPable_decl_template(KleinGordonWorldtubeDataManager);  // NOLINT
 
@@ -325,6 +358,10 @@ class KleinGordonWorldtubeDataManager
   /// diagnostics
   std::pair<size_t, size_t> get_time_span() const override;
 
+  /// retrieves the timing and prefetch statistics of the buffer refills for
+  /// diagnostics
+  const WorldtubeBufferStatistics& get_buffer_statistics() const override;
+
   /// Serialization for Charm++.
   void pup(PUP::er& p) override;  // NOLINT
 
@@ -349,5 +386,10 @@ class KleinGordonWorldtubeDataManager
   size_t buffer_depth_ = 0;
 
   std::unique_ptr<intrp::SpanInterpolator> interpolator_;
+
+  // declared after `buffer_updater_` so that any background read completes
+  // before the updater is destroyed
+  std::unique_ptr<detail::WorldtubeBufferPrefetcher<klein_gordon_input_tags>>
+      buffer_prefetcher_;
 };
 }  // namespace Cce
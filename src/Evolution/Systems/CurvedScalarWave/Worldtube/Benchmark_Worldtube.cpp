@@ -0,0 +1,115 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wredundant-decls"
+#include <benchmark/benchmark.h>
+#pragma GCC diagnostic pop
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include "DataStructures/DataBox/Prefixes.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/EagerMath/DotProduct.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Evolution/Systems/CurvedScalarWave/Tags.hpp"
+#include "Evolution/Systems/CurvedScalarWave/Worldtube/KerrSchildDerivatives.hpp"
+#include "Evolution/Systems/CurvedScalarWave/Worldtube/PunctureField.hpp"
+#include "NumericalAlgorithms/LinearOperators/PartialDerivatives.hpp"
+#include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+// In this anonymous namespace are microbenchmarks of the scalar-wave worldtube:
+// the puncture field evaluated on the grid points of the worldtube boundary,
+// and the derivatives of the Kerr-Schild background at the particle position
+// that enter the acceleration terms. The benchmark argument of the puncture
+// field is the number of grid points, and the rate of points is reported.
+
+// clang-tidy: don't pass be non-const reference
+template <size_t Order>
+void bench_worldtube_puncture_field(benchmark::State& state) {  // NOLINT
+  const auto number_of_points = static_cast<size_t>(state.range(0));
+  const double orbital_radius = 7.;
+  const double angular_velocity = 1. / (orbital_radius * sqrt(orbital_radius));
+  const tnsr::I<double, 3> particle_position{{orbital_radius, 0., 0.}};
+  const tnsr::I<double, 3> particle_velocity{
+      {0., orbital_radius * angular_velocity, 0.}};
+  const tnsr::I<double, 3> particle_acceleration{
+      {-orbital_radius * square(angular_velocity), 0., 0.}};
+  // Points on a sphere of radius 1.5 around the particle
+  tnsr::I<DataVector, 3, Frame::Inertial> centered_coords(number_of_points);
+  for (size_t s = 0; s < number_of_points; ++s) {
+    const double theta = M_PI * (static_cast<double>(s) + 0.5) /
+                         static_cast<double>(number_of_points);
+    const double phi = 2. * M_PI * static_cast<double>(s % 16) / 16.;
+    get<0>(centered_coords)[s] = 1.5 * sin(theta) * cos(phi);
+    get<1>(centered_coords)[s] = 1.5 * sin(theta) * sin(phi);
+    get<2>(centered_coords)[s] = 1.5 * cos(theta);
+  }
+  Variables<tmpl::list<
+      CurvedScalarWave::Tags::Psi, ::Tags::dt<CurvedScalarWave::Tags::Psi>,
+      ::Tags::deriv<CurvedScalarWave::Tags::Psi, tmpl::size_t<3>,
+                    Frame::Inertial>>>
+      puncture_field{};
+
+  while (state.KeepRunning()) {
+    CurvedScalarWave::Worldtube::puncture_field(
+        make_not_null(&puncture_field), centered_coords, particle_position,
+        particle_velocity, particle_acceleration, 1., Order);
+    benchmark::DoNotOptimize(puncture_field.data());
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(number_of_points));
+}
+// NOLINTNEXTLINE
+BENCHMARK_TEMPLATE(bench_worldtube_puncture_field, 0)
+    ->RangeMultiplier(4)
+    ->Range(64, 4096);
+// NOLINTNEXTLINE
+BENCHMARK_TEMPLATE(bench_worldtube_puncture_field, 1)
+    ->RangeMultiplier(4)
+    ->Range(64, 4096);
+
+// clang-tidy: don't pass be non-const reference
+void bench_kerr_schild_derivatives(benchmark::State& state) {  // NOLINT
+  const tnsr::I<double, 3> position{{5., 4., 1.}};
+  const double r = sqrt(get(dot_product(position, position)));
+  // The Kerr-Schild metric with M = 1 and zero spin,
+  // g_ab = eta_ab + 2 / r l_a l_b with l_a = (1, x_i / r)
+  tnsr::aa<double, 3> metric{};
+  tnsr::AA<double, 3> inverse_metric{};
+  for (size_t a = 0; a < 4; ++a) {
+    const double l_a = a == 0 ? 1. : position.get(a - 1) / r;
+    for (size_t b = 0; b <= a; ++b) {
+      const double l_b = b == 0 ? 1. : position.get(b - 1) / r;
+      const double minkowski = a != b ? 0. : (a == 0 ? -1. : 1.);
+      metric.get(a, b) = minkowski + 2. / r * l_a * l_b;
+      inverse_metric.get(a, b) =
+          minkowski - 2. / r * (a == 0 ? -1. : l_a) * (b == 0 ? -1. : l_b);
+    }
+  }
+
+  while (state.KeepRunning()) {
+    const auto di_imetric =
+        CurvedScalarWave::Worldtube::spatial_derivative_inverse_ks_metric(
+            position);
+    const auto dij_imetric = CurvedScalarWave::Worldtube::
+        second_spatial_derivative_inverse_ks_metric(position);
+    const auto di_metric =
+        CurvedScalarWave::Worldtube::spatial_derivative_ks_metric(metric,
+                                                                  di_imetric);
+    const auto dij_metric =
+        CurvedScalarWave::Worldtube::second_spatial_derivative_metric(
+            metric, di_metric, di_imetric, dij_imetric);
+    const auto di_christoffel =
+        CurvedScalarWave::Worldtube::spatial_derivative_christoffel(
+            di_metric, dij_metric, inverse_metric, di_imetric);
+    benchmark::DoNotOptimize(di_christoffel.data());
+  }
+}
+BENCHMARK(bench_kerr_schild_derivatives);  // NOLINT
+}  // namespace
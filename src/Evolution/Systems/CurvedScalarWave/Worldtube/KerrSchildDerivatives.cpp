@@ -4,52 +4,63 @@
 
 #include "Evolution/Systems/CurvedScalarWave/Worldtube/KerrSchildDerivatives.hpp"
 
+#include <array>
+#include <cmath>
 #include <cstddef>
 
 #include "DataStructures/Tensor/EagerMath/DotProduct.hpp"
-#include "DataStructures/Tensor/EagerMath/Magnitude.hpp"
-#include "DataStructures/Tensor/EagerMath/Trace.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
+#include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/Gsl.hpp"
 
 namespace CurvedScalarWave::Worldtube {
+namespace {
+// The contraction $g_{ac} T^{cd}$ of the metric with the last two indices of
+// `di_inverse_metric`, shared by the derivatives of the metric.
+std::array<std::array<std::array<double, 4>, 4>, 3> lower_first_index(
+    const tnsr::aa<double, 3>& metric,
+    const tnsr::iAA<double, 3>& di_inverse_metric) {
+  std::array<std::array<std::array<double, 4>, 4>, 3> result{};
+  for (size_t i = 0; i < 3; ++i) {
+    for (size_t a = 0; a < 4; ++a) {
+      for (size_t d = 0; d < 4; ++d) {
+        double sum = 0.;
+        for (size_t c = 0; c < 4; ++c) {
+          sum += metric.get(a, c) * di_inverse_metric.get(i, c, d);
+        }
+        gsl::at(gsl::at(gsl::at(result, i), a), d) = sum;
+      }
+    }
+  }
+  return result;
+}
+}  // namespace
+
 tnsr::iAA<double, 3> spatial_derivative_inverse_ks_metric(
     const tnsr::I<double, 3>& pos) {
   const double r_sq = get(dot_product(pos, pos));
-  const double r = sqrt(r_sq);
-  const double one_over_r = 1. / r;
   const double one_over_r_2 = 1. / r_sq;
-  const double one_over_r_3 = one_over_r_2 * one_over_r;
+  const double one_over_r_3 = one_over_r_2 / sqrt(r_sq);
+  const double one_over_r_4 = square(one_over_r_2);
+  const double one_over_r_5 = one_over_r_3 * one_over_r_2;
 
   tnsr::iAA<double, 3> di_imetric{};
-  tnsr::ii<double, 3> delta_ll{0.};
-  tnsr::Ij<double, 3> delta_ul{0.};
-  tnsr::i<double, 3> pos_lower{};
-
-  for (size_t i = 0; i < 3; ++i) {
-    delta_ll.get(i, i) = 1.;
-    delta_ul.get(i, i) = 1.;
-    pos_lower.get(i) = pos.get(i);
-  }
-
-  const auto d_imetric_ij = tenex::evaluate<ti::i, ti::J, ti::K>(
-      one_over_r_3 *
-      (6. * pos(ti::J) * pos(ti::K) * pos_lower(ti::i) * one_over_r_2 -
-       2. * delta_ul(ti::J, ti::i) * pos(ti::K) -
-       2. * delta_ul(ti::K, ti::i) * pos(ti::J)));
-  const auto d_imetric_i0 = tenex::evaluate<ti::i, ti::J>(
-      one_over_r_2 * (-4. * pos_lower(ti::i) * pos(ti::J) * one_over_r_2 +
-                      2. * delta_ul(ti::J, ti::i)));
-  const auto d_imetric_00 =
-      tenex::evaluate<ti::i>(2. * pos_lower(ti::i) * one_over_r_3);
   for (size_t i = 0; i < 3; ++i) {
-    di_imetric.get(i, 0, 0) = d_imetric_00.get(i);
+    di_imetric.get(i, 0, 0) = 2. * pos.get(i) * one_over_r_3;
     for (size_t j = 0; j < 3; ++j) {
-      di_imetric.get(i, j + 1, 0) = d_imetric_i0.get(i, j);
-      for (size_t k = 0; k < 3; ++k) {
-        di_imetric.get(i, j + 1, k + 1) = d_imetric_ij.get(i, j, k);
+      di_imetric.get(i, j + 1, 0) =
+          -4. * pos.get(i) * pos.get(j) * one_over_r_4;
+      const double six_x_i_x_j_over_r_5 =
+          6. * pos.get(i) * pos.get(j) * one_over_r_5;
+      for (size_t k = 0; k <= j; ++k) {
+        di_imetric.get(i, j + 1, k + 1) = six_x_i_x_j_over_r_5 * pos.get(k);
       }
     }
+    di_imetric.get(i, i + 1, 0) += 2. * one_over_r_2;
+    for (size_t j = 0; j < 3; ++j) {
+      di_imetric.get(i, i + 1, j + 1) -= 2. * pos.get(j) * one_over_r_3;
+    }
+    di_imetric.get(i, i + 1, i + 1) -= 2. * pos.get(i) * one_over_r_3;
   }
   return di_imetric;
 }
@@ -57,62 +68,61 @@ tnsr::iAA<double, 3> spatial_derivative_inverse_ks_metric(
 tnsr::iaa<double, 3> spatial_derivative_ks_metric(
     const tnsr::aa<double, 3>& metric,
     const tnsr::iAA<double, 3>& di_inverse_metric) {
+  const auto lowered = lower_first_index(metric, di_inverse_metric);
   tnsr::iaa<double, 3> di_metric{};
-  tenex::evaluate<ti::i, ti::a, ti::b>(
-      make_not_null(&di_metric), -metric(ti::a, ti::c) * metric(ti::b, ti::d) *
-                                     di_inverse_metric(ti::i, ti::C, ti::D));
+  for (size_t i = 0; i < 3; ++i) {
+    for (size_t a = 0; a < 4; ++a) {
+      for (size_t b = 0; b <= a; ++b) {
+        double sum = 0.;
+        for (size_t d = 0; d < 4; ++d) {
+          sum += gsl::at(gsl::at(gsl::at(lowered, i), a), d) * metric.get(b, d);
+        }
+        di_metric.get(i, a, b) = -sum;
+      }
+    }
+  }
   return di_metric;
 }
 
 tnsr::iiAA<double, 3> second_spatial_derivative_inverse_ks_metric(
     const tnsr::I<double, 3>& pos) {
   const double r_sq = get(dot_product(pos, pos));
-  const double r = sqrt(r_sq);
-  const double one_over_r = 1. / r;
   const double one_over_r_2 = 1. / r_sq;
-  const double one_over_r_3 = one_over_r_2 * one_over_r;
-  const double one_over_r_4 = one_over_r_2 * one_over_r_2;
+  const double one_over_r_3 = one_over_r_2 / sqrt(r_sq);
+  const double one_over_r_4 = square(one_over_r_2);
+  const double one_over_r_5 = one_over_r_3 * one_over_r_2;
+  const double one_over_r_6 = one_over_r_4 * one_over_r_2;
+  const double one_over_r_7 = one_over_r_5 * one_over_r_2;
+  const auto delta = [](const size_t i, const size_t j) {
+    return i == j ? 1. : 0.;
+  };
 
   tnsr::iiAA<double, 3> dij_imetric{};
-  tnsr::ii<double, 3> delta_ll{0.};
-  tnsr::Ij<double, 3> delta_ul{0.};
-  tnsr::i<double, 3> pos_lower{};
-
   for (size_t i = 0; i < 3; ++i) {
-    delta_ll.get(i, i) = 1.;
-    delta_ul.get(i, i) = 1.;
-    pos_lower.get(i) = pos.get(i);
-  }
-
-  const auto d2_imetric_ij = tenex::evaluate<ti::i, ti::j, ti::K, ti::L>(
-      one_over_r_3 *
-      (-2. * (delta_ul(ti::L, ti::i) * delta_ul(ti::K, ti::j) +
-              delta_ul(ti::K, ti::i) * delta_ul(ti::L, ti::j)) +
-       one_over_r_2 *
-           (6. * (delta_ll(ti::i, ti::j) * pos(ti::K) * pos(ti::L) +
-                  delta_ul(ti::K, ti::i) * pos_lower(ti::j) * pos(ti::L) +
-                  delta_ul(ti::K, ti::j) * pos_lower(ti::i) * pos(ti::L) +
-                  delta_ul(ti::L, ti::i) * pos_lower(ti::j) * pos(ti::K) +
-                  delta_ul(ti::L, ti::j) * pos_lower(ti::i) * pos(ti::K)) -
-            one_over_r_2 * 30. * pos_lower(ti::i) * pos_lower(ti::j) *
-                pos(ti::K) * pos(ti::L))));
-
-  const auto d2_imetric_i0 = tenex::evaluate<ti::j, ti::k, ti::I>(
-      one_over_r_4 *
-      (-4. * (delta_ll(ti::k, ti::j) * pos(ti::I) +
-              delta_ul(ti::I, ti::k) * pos_lower(ti::j) +
-              delta_ul(ti::I, ti::j) * pos_lower(ti::k)) +
-       one_over_r_2 * 16. * pos(ti::I) * pos_lower(ti::j) * pos_lower(ti::k)));
-  const auto d2_imetric_00 = tenex::evaluate<ti::i, ti::j>(
-      one_over_r_3 * (2. * delta_ll(ti::i, ti::j) -
-                      one_over_r_2 * 6. * pos_lower(ti::i) * pos_lower(ti::j)));
-  for (size_t i = 0; i < 3; ++i) {
-    for (size_t j = 0; j < 3; ++j) {
-      dij_imetric.get(i, j, 0, 0) = d2_imetric_00.get(i, j);
+    for (size_t j = 0; j <= i; ++j) {
+      const double x_i_x_j = pos.get(i) * pos.get(j);
+      dij_imetric.get(i, j, 0, 0) =
+          2. * delta(i, j) * one_over_r_3 - 6. * x_i_x_j * one_over_r_5;
       for (size_t k = 0; k < 3; ++k) {
-        dij_imetric.get(i, j, k + 1, 0) = d2_imetric_i0.get(i, j, k);
-        for (size_t l = 0; l < 3; ++l) {
-          dij_imetric.get(i, j, k + 1, l + 1) = d2_imetric_ij.get(i, j, k, l);
+        dij_imetric.get(i, j, k + 1, 0) =
+            16. * x_i_x_j * pos.get(k) * one_over_r_6 -
+            4. *
+                (delta(i, j) * pos.get(k) + delta(i, k) * pos.get(j) +
+                 delta(j, k) * pos.get(i)) *
+                one_over_r_4;
+        for (size_t l = 0; l <= k; ++l) {
+          dij_imetric.get(i, j, k + 1, l + 1) =
+              -2. *
+                  (delta(i, l) * delta(j, k) + delta(i, k) * delta(j, l)) *
+                  one_over_r_3 +
+              6. *
+                  (delta(i, j) * pos.get(k) * pos.get(l) +
+                   delta(i, k) * pos.get(j) * pos.get(l) +
+                   delta(j, k) * pos.get(i) * pos.get(l) +
+                   delta(i, l) * pos.get(j) * pos.get(k) +
+                   delta(j, l) * pos.get(i) * pos.get(k)) *
+                  one_over_r_5 -
+              30. * x_i_x_j * pos.get(k) * pos.get(l) * one_over_r_7;
         }
       }
     }
@@ -124,13 +134,39 @@ tnsr::iiaa<double, 3> second_spatial_derivative_metric(
     const tnsr::aa<double, 3>& metric, const tnsr::iaa<double, 3>& di_metric,
     const tnsr::iAA<double, 3>& di_inverse_metric,
     const tnsr::iiAA<double, 3>& dij_inverse_metric) {
+  // Differentiating $\partial_i g_{ab} = -g_{ac} g_{bd} \partial_i g^{cd}$
+  // gives the two terms with a first derivative of the metric, which are
+  // related by exchanging $a$ and $b$.
+  const auto lowered = lower_first_index(metric, di_inverse_metric);
   tnsr::iiaa<double, 3> dij_metric{};
-  tenex::evaluate<ti::j, ti::i, ti::a, ti::b>(
-      make_not_null(&dij_metric),
-      -metric(ti::a, ti::c) * metric(ti::b, ti::d) *
-              dij_inverse_metric(ti::j, ti::i, ti::C, ti::D) -
-          2. * metric(ti::a, ti::c) * di_metric(ti::j, ti::b, ti::d) *
-              di_inverse_metric(ti::i, ti::C, ti::D));
+  std::array<std::array<double, 4>, 4> lowered_second_derivative{};
+  for (size_t i = 0; i < 3; ++i) {
+    for (size_t j = 0; j <= i; ++j) {
+      for (size_t a = 0; a < 4; ++a) {
+        for (size_t d = 0; d < 4; ++d) {
+          double sum = 0.;
+          for (size_t c = 0; c < 4; ++c) {
+            sum += metric.get(a, c) * dij_inverse_metric.get(i, j, c, d);
+          }
+          gsl::at(gsl::at(lowered_second_derivative, a), d) = sum;
+        }
+      }
+      for (size_t a = 0; a < 4; ++a) {
+        for (size_t b = 0; b <= a; ++b) {
+          double sum = 0.;
+          for (size_t d = 0; d < 4; ++d) {
+            sum += gsl::at(gsl::at(lowered_second_derivative, a), d) *
+                       metric.get(b, d) +
+                   gsl::at(gsl::at(gsl::at(lowered, j), a), d) *
+                       di_metric.get(i, b, d) +
+                   gsl::at(gsl::at(gsl::at(lowered, j), b), d) *
+                       di_metric.get(i, a, d);
+          }
+          dij_metric.get(i, j, a, b) = -sum;
+        }
+      }
+    }
+  }
   return dij_metric;
 }
 
@@ -139,30 +175,50 @@ tnsr::iAbb<double, 3> spatial_derivative_christoffel(
     const tnsr::iiaa<double, 3>& dij_metric,
     const tnsr::AA<double, 3>& inverse_metric,
     const tnsr::iAA<double, 3>& di_inverse_metric) {
+  // The metric is static, so only the spatial derivatives contribute to the
+  // Christoffel symbols of the first kind $\Gamma_{dbc}$ and their spatial
+  // derivatives.
+  const auto d_metric = [&di_metric](const size_t c, const size_t a,
+                                     const size_t b) {
+    return c == 0 ? 0. : di_metric.get(c - 1, a, b);
+  };
+  const auto di_d_metric = [&dij_metric](const size_t i, const size_t c,
+                                         const size_t a, const size_t b) {
+    return c == 0 ? 0. : dij_metric.get(i, c - 1, a, b);
+  };
+  tnsr::abb<double, 3> christoffel_first_kind{};
+  tnsr::iabb<double, 3> di_christoffel_first_kind{};
+  for (size_t d = 0; d < 4; ++d) {
+    for (size_t b = 0; b < 4; ++b) {
+      for (size_t c = 0; c <= b; ++c) {
+        christoffel_first_kind.get(d, b, c) =
+            0.5 * (d_metric(b, c, d) + d_metric(c, b, d) - d_metric(d, b, c));
+        for (size_t i = 0; i < 3; ++i) {
+          di_christoffel_first_kind.get(i, d, b, c) =
+              0.5 * (di_d_metric(i, b, c, d) + di_d_metric(i, c, b, d) -
+                     di_d_metric(i, d, b, c));
+        }
+      }
+    }
+  }
+
   tnsr::iAbb<double, 3> di_christoffel{};
-  tnsr::abb<double, 3> d_metric{};
-  tnsr::iabb<double, 3> di_d_metric{};
-  for (size_t a = 0; a <= 3; ++a) {
-    for (size_t b = 0; b <= 3; ++b) {
-      d_metric.get(0, a, b) = 0.;
-      for (size_t i = 0; i < 3; ++i) {
-        d_metric.get(i + 1, a, b) = di_metric.get(i, a, b);
-        di_d_metric.get(i, 0, a, b) = 0.;
-        for (size_t j = 0; j < 3; ++j) {
-          di_d_metric.get(i, j + 1, a, b) = dij_metric.get(i, j, a, b);
+  for (size_t i = 0; i < 3; ++i) {
+    for (size_t a = 0; a < 4; ++a) {
+      for (size_t b = 0; b < 4; ++b) {
+        for (size_t c = 0; c <= b; ++c) {
+          double sum = 0.;
+          for (size_t d = 0; d < 4; ++d) {
+            sum += di_inverse_metric.get(i, a, d) *
+                       christoffel_first_kind.get(d, b, c) +
+                   inverse_metric.get(a, d) *
+                       di_christoffel_first_kind.get(i, d, b, c);
+          }
+          di_christoffel.get(i, a, b, c) = sum;
         }
       }
     }
   }
-  tenex::evaluate<ti::i, ti::A, ti::b, ti::c>(
-      make_not_null(&di_christoffel),
-      0.5 * di_inverse_metric(ti::i, ti::A, ti::D) *
-              (d_metric(ti::b, ti::c, ti::d) + d_metric(ti::c, ti::b, ti::d) -
-               d_metric(ti::d, ti::b, ti::c)) +
-          0.5 * inverse_metric(ti::A, ti::D) *
-              (di_d_metric(ti::i, ti::b, ti::c, ti::d) +
-               di_d_metric(ti::i, ti::c, ti::b, ti::d) -
-               di_d_metric(ti::i, ti::d, ti::b, ti::c)));
   return di_christoffel;
 }
 
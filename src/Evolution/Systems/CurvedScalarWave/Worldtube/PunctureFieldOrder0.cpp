@@ -239,7 +239,7 @@ void puncture_field_0(
       0.5 *
       (4.0 * M * dv_12 - d_18 * dv_25 * dv_26 + d_20 * dv_32 - 2.0 * dv_10 +
        dv_17 + dv_21) /
-      (dv_16 * sqrt(dv_16));
+      (dv_16 * dv_37);
   get(get<::Tags::dt<CurvedScalarWave::Tags::Psi>>(*result)) =
       -dv_59 / d_21 / d_23 *
       (-2.0 * d_21 * d_23 * dv_37 * dv_45 - 7.0 * d_26 * dv_36 * dv_38 +
@@ -274,6 +274,6 @@ void puncture_field_0(
       0.5 * d_20 * z *
       (4.0 * M * dv_16 * (d_15 + d_16) * (-dv_34 + dv_8 * (d_3 + rp)) -
        d_44 * dv_35 - d_46 * dv_16 - 3.0 * dv_32) /
-      (square(dv_16) * sqrt(dv_16));
+      (square(dv_16) * dv_37);
 }
 }  // namespace CurvedScalarWave::Worldtube
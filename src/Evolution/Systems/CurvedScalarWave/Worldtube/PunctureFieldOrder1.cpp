@@ -887,7 +887,7 @@ void puncture_field_1(
   DataVector& dv_341 = temps.at(239);
   dv_341 = -d_6 * dv_1 * xpdot + d_88 * dv_326 + dv_257 - dv_5 * xp;
   DataVector& dv_342 = temps.at(272);
-  dv_342 = sqrt(dv_19) * dv_19;
+  dv_342 = dv_20 * dv_19;
   DataVector& dv_343 = temps.at(273);
   dv_343 = d_106 * dv_342;
   DataVector& dv_344 = temps.at(53);
@@ -1269,7 +1269,7 @@ void puncture_field_1(
        d_7 * dv_374 * dv_63 - d_78 * dv_410 * dv_413 - 24.0 * dv_11 +
        24.0 * dv_14 + 24.0 * dv_15 - dv_260 * dv_368 + dv_336 * dv_410 -
        dv_359 * dv_63 + dv_364 + dv_365 - dv_367 - dv_370 * dv_376 - dv_372 +
-       dv_401 - dv_403 + dv_404 * dv_44 - dv_405 + dv_46 * dv_65) /
-      (square(dv_19) * sqrt(dv_19));
+       dv_401 - dv_403 + dv_404 * dv_44 - dv_405 + dv_46 * dv_65) *
+      dv_377 / dv_19;
 }
 }  // namespace CurvedScalarWave::Worldtube
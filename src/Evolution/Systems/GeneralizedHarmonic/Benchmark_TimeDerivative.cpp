@@ -0,0 +1,111 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wredundant-decls"
+#include <benchmark/benchmark.h>
+#pragma GCC diagnostic pop
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/GaugeSourceFunctions/Harmonic.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/TimeDerivative.hpp"
+#include "NumericalAlgorithms/Spectral/LogicalCoordinates.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+// In this anonymous namespace is a microbenchmark of the generalized harmonic
+// time derivative in harmonic gauge on a 3d element, with the temporaries
+// stored in a buffer as in a DG evolution. The benchmark argument is the
+// number of grid points in each dimension, and the rate of grid points is
+// reported.
+
+// clang-tidy: don't pass be non-const reference
+void bench_gh_time_derivative(benchmark::State& state) {  // NOLINT
+  constexpr size_t Dim = 3;
+  const auto pts_1d = static_cast<size_t>(state.range(0));
+  const Mesh<Dim> mesh{pts_1d, Spectral::Basis::Legendre,
+                       Spectral::Quadrature::GaussLobatto};
+  const size_t number_of_points = mesh.number_of_grid_points();
+
+  // Small, smoothly varying perturbations of Minkowski space
+  size_t component = 0;
+  const auto perturbation = [&component, &number_of_points]() {
+    DataVector result(number_of_points);
+    for (size_t s = 0; s < number_of_points; ++s) {
+      result[s] = 1.e-2 * sin(static_cast<double>(s + 7 * component));
+    }
+    ++component;
+    return result;
+  };
+  tnsr::aa<DataVector, Dim> spacetime_metric{};
+  for (size_t a = 0; a < Dim + 1; ++a) {
+    for (size_t b = a; b < Dim + 1; ++b) {
+      const double minkowski = a != b ? 0. : (a == 0 ? -1. : 1.);
+      spacetime_metric.get(a, b) = minkowski + perturbation();
+    }
+  }
+  tnsr::aa<DataVector, Dim> pi{};
+  tnsr::iaa<DataVector, Dim> phi{};
+  tnsr::iaa<DataVector, Dim> d_spacetime_metric{};
+  tnsr::iaa<DataVector, Dim> d_pi{};
+  tnsr::ijaa<DataVector, Dim> d_phi{};
+  for (size_t i = 0; i < pi.size(); ++i) {
+    pi[i] = perturbation();
+  }
+  for (size_t i = 0; i < phi.size(); ++i) {
+    phi[i] = perturbation();
+    d_spacetime_metric[i] = perturbation();
+    d_pi[i] = perturbation();
+  }
+  for (size_t i = 0; i < d_phi.size(); ++i) {
+    d_phi[i] = perturbation();
+  }
+  const Scalar<DataVector> gamma0{DataVector(number_of_points, 1.)};
+  const Scalar<DataVector> gamma1{DataVector(number_of_points, -1.)};
+  const Scalar<DataVector> gamma2{DataVector(number_of_points, 1.)};
+
+  const auto logical_coords = logical_coordinates(mesh);
+  tnsr::I<DataVector, Dim, Frame::Inertial> inertial_coords{};
+  InverseJacobian<DataVector, Dim, Frame::ElementLogical, Frame::Inertial>
+      inv_jac{};
+  for (size_t i = 0; i < Dim; ++i) {
+    inertial_coords.get(i) = logical_coords.get(i);
+    for (size_t j = 0; j < Dim; ++j) {
+      inv_jac.get(i, j) = DataVector(number_of_points, i == j ? 1. : 0.);
+    }
+  }
+  const gh::gauges::Harmonic gauge_condition{};
+
+  tnsr::aa<DataVector, Dim> dt_spacetime_metric(number_of_points);
+  tnsr::aa<DataVector, Dim> dt_pi(number_of_points);
+  tnsr::iaa<DataVector, Dim> dt_phi(number_of_points);
+  using temporary_tags = typename gh::TimeDerivative<Dim>::temporary_tags;
+  Variables<temporary_tags> temporaries(number_of_points);
+
+  while (state.KeepRunning()) {
+    tmpl::as_pack<temporary_tags>([&](auto... temporary_tag) {
+      gh::TimeDerivative<Dim>::apply(
+          make_not_null(&dt_spacetime_metric), make_not_null(&dt_pi),
+          make_not_null(&dt_phi),
+          make_not_null(&get<tmpl::type_from<decltype(temporary_tag)>>(
+              temporaries))...,
+          d_spacetime_metric, d_pi, d_phi, spacetime_metric, pi, phi, gamma0,
+          gamma1, gamma2, gauge_condition, mesh, 0., inertial_coords, inv_jac,
+          std::nullopt);
+    });
+    benchmark::DoNotOptimize(get<0, 0>(dt_pi).data());
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(number_of_points));
+}
+// NOLINTNEXTLINE
+BENCHMARK(bench_gh_time_derivative)->DenseRange(4, 12, 4);
+}  // namespace
@@ -3,6 +3,7 @@
 
 #include "Evolution/Systems/GeneralizedHarmonic/TimeDerivative.hpp"
 
+#include <algorithm>
 #include <cstddef>
 
 #include "DataStructures/DataVector.hpp"
@@ -27,6 +28,37 @@
 #include "Utilities/Gsl.hpp"
 
 namespace gh {
+namespace {
+// The number of grid points the equations are evaluated on at once. The
+// temporaries of a block of this size fit in the L2 cache even in 3d, while
+// the blocks are still long enough to be vectorized efficiently.
+constexpr size_t points_per_block = 32;
+
+// Point the components of `view` to the grid points `[offset, offset + size)`
+// of the components of `tensor`.
+template <typename TensorType>
+void set_block_view(const gsl::not_null<TensorType*> view,
+                    const gsl::not_null<TensorType*> tensor,
+                    const size_t offset, const size_t size) {
+  for (size_t storage_index = 0; storage_index < tensor->size();
+       ++storage_index) {
+    (*view)[storage_index].set_data_ref(
+        (*tensor)[storage_index].data() + offset, size);  // NOLINT
+  }
+}
+
+template <typename TensorType>
+void set_block_view(const gsl::not_null<const TensorType*> view,
+                    const TensorType& tensor, const size_t offset,
+                    const size_t size) {
+  for (size_t storage_index = 0; storage_index < tensor.size();
+       ++storage_index) {
+    make_const_view(make_not_null(&(*view)[storage_index]),
+                    tensor[storage_index], offset, size);
+  }
+}
+}  // namespace
+
 template <size_t Dim>
 void TimeDerivative<Dim>::apply(
     const gsl::not_null<tnsr::aa<DataVector, Dim>*> dt_spacetime_metric,
@@ -122,67 +154,8 @@ void TimeDerivative<Dim>::apply(
     }
   }
 
-  gr::christoffel_first_kind(christoffel_first_kind,
-                             da_spacetime_metric.value());
-  trace_last_indices(trace_christoffel, *christoffel_first_kind,
-                     *inverse_spacetime_metric);
   gr::spacetime_normal_vector(normal_spacetime_vector, *lapse, *shift);
 
-  get(*gamma1gamma2) = get(gamma1) * get(gamma2);
-  const DataVector& gamma12 = get(*gamma1gamma2);
-
-  for (size_t m = 0; m < Dim; ++m) {
-    for (size_t mu = 0; mu < Dim + 1; ++mu) {
-      for (size_t nu = mu; nu < Dim + 1; ++nu) {
-        phi_1_up->get(m, mu, nu) =
-            inverse_spatial_metric->get(m, 0) * phi.get(0, mu, nu);
-        for (size_t n = 1; n < Dim; ++n) {
-          phi_1_up->get(m, mu, nu) +=
-              inverse_spatial_metric->get(m, n) * phi.get(n, mu, nu);
-        }
-      }
-    }
-  }
-
-  for (size_t m = 0; m < Dim; ++m) {
-    for (size_t nu = 0; nu < Dim + 1; ++nu) {
-      for (size_t alpha = 0; alpha < Dim + 1; ++alpha) {
-        phi_3_up->get(m, nu, alpha) =
-            inverse_spacetime_metric->get(alpha, 0) * phi.get(m, nu, 0);
-        for (size_t beta = 1; beta < Dim + 1; ++beta) {
-          phi_3_up->get(m, nu, alpha) +=
-              inverse_spacetime_metric->get(alpha, beta) * phi.get(m, nu, beta);
-        }
-      }
-    }
-  }
-
-  for (size_t nu = 0; nu < Dim + 1; ++nu) {
-    for (size_t alpha = 0; alpha < Dim + 1; ++alpha) {
-      pi_2_up->get(nu, alpha) =
-          inverse_spacetime_metric->get(alpha, 0) * pi.get(nu, 0);
-      for (size_t beta = 1; beta < Dim + 1; ++beta) {
-        pi_2_up->get(nu, alpha) +=
-            inverse_spacetime_metric->get(alpha, beta) * pi.get(nu, beta);
-      }
-    }
-  }
-
-  for (size_t mu = 0; mu < Dim + 1; ++mu) {
-    for (size_t nu = 0; nu < Dim + 1; ++nu) {
-      for (size_t alpha = 0; alpha < Dim + 1; ++alpha) {
-        christoffel_first_kind_3_up->get(mu, nu, alpha) =
-            inverse_spacetime_metric->get(alpha, 0) *
-            christoffel_first_kind->get(mu, nu, 0);
-        for (size_t beta = 1; beta < Dim + 1; ++beta) {
-          christoffel_first_kind_3_up->get(mu, nu, alpha) +=
-              inverse_spacetime_metric->get(alpha, beta) *
-              christoffel_first_kind->get(mu, nu, beta);
-        }
-      }
-    }
-  }
-
   for (size_t mu = 0; mu < Dim + 1; ++mu) {
     pi_one_normal->get(mu) = get<0>(*normal_spacetime_vector) * pi.get(0, mu);
     for (size_t nu = 1; nu < Dim + 1; ++nu) {
@@ -220,64 +193,16 @@ void TimeDerivative<Dim>::apply(
     half_phi_two_normals->get(n) *= 0.5;
   }
 
-  for (size_t n = 0; n < Dim; ++n) {
-    for (size_t mu = 0; mu < Dim + 1; ++mu) {
-      for (size_t nu = mu; nu < Dim + 1; ++nu) {
-        three_index_constraint->get(n, mu, nu) =
-            d_spacetime_metric.get(n, mu, nu) - phi.get(n, mu, nu);
-      }
-    }
-  }
-
-  get(*gamma1_plus_1) = 1.0 + gamma1.get();
-  const DataVector& gamma1p1 = get(*gamma1_plus_1);
-
-  for (size_t mu = 0; mu < Dim + 1; ++mu) {
-    gauge_constraint->get(mu) = trace_christoffel->get(mu);
-    for (size_t nu = mu; nu < Dim + 1; ++nu) {
-      shift_dot_three_index_constraint->get(mu, nu) =
-          get<0>(*shift) * three_index_constraint->get(0, mu, nu);
-      if (mesh_velocity.has_value()) {
-        mesh_velocity_dot_three_index_constraint->get(mu, nu) =
-            get<0>(*mesh_velocity) * three_index_constraint->get(0, mu, nu);
-      }
-      for (size_t m = 1; m < Dim; ++m) {
-        shift_dot_three_index_constraint->get(mu, nu) +=
-            shift->get(m) * three_index_constraint->get(m, mu, nu);
-        if (mesh_velocity.has_value()) {
-          mesh_velocity_dot_three_index_constraint->get(mu, nu) +=
-              mesh_velocity->get(m) * three_index_constraint->get(m, mu, nu);
-        }
-      }
-    }
-  }
-
   const bool using_harmonic_gauge = gauge_condition.is_harmonic();
   if (not using_harmonic_gauge) {
     // Compute gauge condition.
     get(*sqrt_det_spatial_metric) = sqrt(get(*det_spatial_metric));
-    raise_or_lower_first_index(christoffel_second_kind, *christoffel_first_kind,
-                               *inverse_spacetime_metric);
   }
   gauges::dispatch<Dim>(
       gauge_function, spacetime_deriv_gauge_function, *lapse, *shift,
       *sqrt_det_spatial_metric, *inverse_spatial_metric, *da_spacetime_metric,
       *half_pi_two_normals, *half_phi_two_normals, spacetime_metric, phi, mesh,
       time, inertial_coords, inverse_jacobian, gauge_condition);
-  if (not using_harmonic_gauge) {
-    // Compute source function last so that we don't need to recompute any of
-    // the other temporary tags.
-    for (size_t nu = 0; nu < Dim + 1; ++nu) {
-      gauge_constraint->get(nu) += gauge_function->get(nu);
-    }
-  }
-
-  get(*normal_dot_gauge_constraint) =
-      get<0>(*normal_spacetime_vector) * get<0>(*gauge_constraint);
-  for (size_t mu = 1; mu < Dim + 1; ++mu) {
-    get(*normal_dot_gauge_constraint) +=
-        normal_spacetime_vector->get(mu) * gauge_constraint->get(mu);
-  }
 
   // Invalidate da_spacetime_metric since we will be modifying some of the
   // data it points to.
@@ -285,121 +210,385 @@ void TimeDerivative<Dim>::apply(
   const_cast<std::optional<tnsr::abb<DataVector, Dim>>&>(da_spacetime_metric) =
       std::nullopt;
 
-  // Here are the actual equations
-
-  // Equation for dt_spacetime_metric
-  for (size_t mu = 0; mu < Dim + 1; ++mu) {
-    for (size_t nu = mu; nu < Dim + 1; ++nu) {
-      dt_spacetime_metric->get(mu, nu) +=
-          gamma1p1 * shift_dot_three_index_constraint->get(mu, nu);
-      if (mesh_velocity.has_value()) {
-        dt_spacetime_metric->get(mu, nu) +=
-            get(gamma1) * mesh_velocity_dot_three_index_constraint->get(mu, nu);
+  // The remaining temporaries are only needed by the equations themselves, so
+  // we compute them together with the equations one block of points at a
+  // time. That way the temporaries of a block are still in cache when the
+  // equations read them, instead of being written to and read back from main
+  // memory one component at a time for the whole element. Every point is
+  // computed with the same operations as for the whole element at once.
+  //
+  // Views into the inputs and already computed temporaries for one block
+  const tnsr::aa<DataVector, Dim> spacetime_metric_block{};
+  const tnsr::aa<DataVector, Dim> pi_block{};
+  const tnsr::iaa<DataVector, Dim> phi_block{};
+  const tnsr::iaa<DataVector, Dim> d_spacetime_metric_block{};
+  const tnsr::iaa<DataVector, Dim> d_pi_block{};
+  const tnsr::ijaa<DataVector, Dim> d_phi_block{};
+  const Scalar<DataVector> gamma0_block{};
+  const Scalar<DataVector> gamma1_block{};
+  const Scalar<DataVector> gamma2_block{};
+  const Scalar<DataVector> lapse_block{};
+  const tnsr::I<DataVector, Dim> shift_block{};
+  const tnsr::II<DataVector, Dim> inverse_spatial_metric_block{};
+  const tnsr::AA<DataVector, Dim> inverse_spacetime_metric_block{};
+  const tnsr::A<DataVector, Dim> normal_spacetime_vector_block{};
+  const tnsr::a<DataVector, Dim> pi_one_normal_block{};
+  const Scalar<DataVector> half_pi_two_normals_block{};
+  const tnsr::ia<DataVector, Dim> phi_one_normal_block{};
+  const tnsr::i<DataVector, Dim> half_phi_two_normals_block{};
+  const tnsr::a<DataVector, Dim> gauge_function_block{};
+  const tnsr::ab<DataVector, Dim> spacetime_deriv_gauge_function_block{};
+  const tnsr::I<DataVector, Dim, Frame::Inertial> mesh_velocity_block{};
+  const tnsr::abb<DataVector, Dim> da_spacetime_metric_block{};
+  // Views into the temporaries and time derivatives computed for one block
+  tnsr::abb<DataVector, Dim> christoffel_first_kind_block{};
+  tnsr::Abb<DataVector, Dim> christoffel_second_kind_block{};
+  tnsr::a<DataVector, Dim> trace_christoffel_block{};
+  Scalar<DataVector> gamma1gamma2_block{};
+  Scalar<DataVector> gamma1_plus_1_block{};
+  tnsr::iaa<DataVector, Dim> three_index_constraint_block{};
+  tnsr::a<DataVector, Dim> gauge_constraint_block{};
+  tnsr::aa<DataVector, Dim> shift_dot_three_index_constraint_block{};
+  tnsr::aa<DataVector, Dim> mesh_velocity_dot_three_index_constraint_block{};
+  tnsr::Iaa<DataVector, Dim> phi_1_up_block{};
+  tnsr::iaB<DataVector, Dim> phi_3_up_block{};
+  tnsr::aB<DataVector, Dim> pi_2_up_block{};
+  tnsr::abC<DataVector, Dim> christoffel_first_kind_3_up_block{};
+  Scalar<DataVector> normal_dot_gauge_constraint_block{};
+  tnsr::aa<DataVector, Dim> dt_spacetime_metric_block{};
+  tnsr::aa<DataVector, Dim> dt_pi_block{};
+  tnsr::iaa<DataVector, Dim> dt_phi_block{};
+
+  for (size_t offset = 0; offset < number_of_points;
+       offset += points_per_block) {
+    const size_t size = std::min(points_per_block, number_of_points - offset);
+    set_block_view(make_not_null(&spacetime_metric_block), spacetime_metric,
+                   offset, size);
+    set_block_view(make_not_null(&pi_block), pi, offset, size);
+    set_block_view(make_not_null(&phi_block), phi, offset, size);
+    set_block_view(make_not_null(&d_spacetime_metric_block),
+                   d_spacetime_metric, offset, size);
+    set_block_view(make_not_null(&d_pi_block), d_pi, offset, size);
+    set_block_view(make_not_null(&d_phi_block), d_phi, offset, size);
+    set_block_view(make_not_null(&gamma0_block), gamma0, offset, size);
+    set_block_view(make_not_null(&gamma1_block), gamma1, offset, size);
+    set_block_view(make_not_null(&gamma2_block), gamma2, offset, size);
+    set_block_view(make_not_null(&lapse_block), *lapse, offset, size);
+    set_block_view(make_not_null(&shift_block), *shift, offset, size);
+    set_block_view(make_not_null(&inverse_spatial_metric_block),
+                   *inverse_spatial_metric, offset, size);
+    set_block_view(make_not_null(&inverse_spacetime_metric_block),
+                   *inverse_spacetime_metric, offset, size);
+    set_block_view(make_not_null(&normal_spacetime_vector_block),
+                   *normal_spacetime_vector, offset, size);
+    set_block_view(make_not_null(&pi_one_normal_block), *pi_one_normal,
+                   offset, size);
+    set_block_view(make_not_null(&half_pi_two_normals_block),
+                   *half_pi_two_normals, offset, size);
+    set_block_view(make_not_null(&phi_one_normal_block), *phi_one_normal,
+                   offset, size);
+    set_block_view(make_not_null(&half_phi_two_normals_block),
+                   *half_phi_two_normals, offset, size);
+    if (not using_harmonic_gauge) {
+      set_block_view(make_not_null(&gauge_function_block), *gauge_function,
+                     offset, size);
+      set_block_view(make_not_null(&spacetime_deriv_gauge_function_block),
+                     *spacetime_deriv_gauge_function, offset, size);
+      set_block_view(make_not_null(&christoffel_second_kind_block),
+                     christoffel_second_kind, offset, size);
+    }
+    if (mesh_velocity.has_value()) {
+      set_block_view(make_not_null(&mesh_velocity_block), *mesh_velocity,
+                     offset, size);
+      set_block_view(
+          make_not_null(&mesh_velocity_dot_three_index_constraint_block),
+          mesh_velocity_dot_three_index_constraint, offset, size);
+    }
+    set_block_view(make_not_null(&christoffel_first_kind_block),
+                   christoffel_first_kind, offset, size);
+    set_block_view(make_not_null(&trace_christoffel_block), trace_christoffel,
+                   offset, size);
+    set_block_view(make_not_null(&gamma1gamma2_block), gamma1gamma2, offset,
+                   size);
+    set_block_view(make_not_null(&gamma1_plus_1_block), gamma1_plus_1, offset,
+                   size);
+    set_block_view(make_not_null(&three_index_constraint_block),
+                   three_index_constraint, offset, size);
+    set_block_view(make_not_null(&gauge_constraint_block), gauge_constraint,
+                   offset, size);
+    set_block_view(make_not_null(&shift_dot_three_index_constraint_block),
+                   shift_dot_three_index_constraint, offset, size);
+    set_block_view(make_not_null(&phi_1_up_block), phi_1_up, offset, size);
+    set_block_view(make_not_null(&phi_3_up_block), phi_3_up, offset, size);
+    set_block_view(make_not_null(&pi_2_up_block), pi_2_up, offset, size);
+    set_block_view(make_not_null(&christoffel_first_kind_3_up_block),
+                   christoffel_first_kind_3_up, offset, size);
+    set_block_view(make_not_null(&normal_dot_gauge_constraint_block),
+                   normal_dot_gauge_constraint, offset, size);
+    set_block_view(make_not_null(&dt_spacetime_metric_block),
+                   dt_spacetime_metric, offset, size);
+    set_block_view(make_not_null(&dt_pi_block), dt_pi, offset, size);
+    set_block_view(make_not_null(&dt_phi_block), dt_phi, offset, size);
+
+    // dt_spacetime_metric doesn't contain the constraint terms yet, so we can
+    // use it for da_spacetime_metric to compute Christoffel symbols.
+    for (size_t a = 0; a < Dim + 1; ++a) {
+      for (size_t b = a; b < Dim + 1; ++b) {
+        make_const_view(make_not_null(&da_spacetime_metric_block.get(0, a, b)),
+                        dt_spacetime_metric->get(a, b), offset, size);
+        for (size_t i = 0; i < Dim; ++i) {
+          make_const_view(
+              make_not_null(&da_spacetime_metric_block.get(i + 1, a, b)),
+              phi.get(i, a, b), offset, size);
+        }
       }
     }
-  }
-
-  // Equation for dt_pi
 
-  // We first compute the n_a contributions but only for a=0 since n_i=0
-  // identically. We also use dt_Pi_{00} as temporary storage to avoid any extra
-  // allocations and multiply normal_dot_gauge_constraint=(n^a C_a) by gamma0
-  // since it always shows up multiplied by gamma0 in the equations. This
-  // reduces the number of multiplications that are needed for the RHS
-  // evaluation.
-  //
-  // WARNING: normal_dot_gauge_constraint is rescaled by gamma0!
-  get(*normal_dot_gauge_constraint) *= get(gamma0);
-
-  // Use dt_pi_{00} as temporary storage.
-  get<0, 0>(*dt_pi) = -get(gamma0) * get(*lapse);
-  for (size_t i = 1; i < Dim + 1; ++i) {
-    dt_pi->get(0, i) =
-        get<0, 0>(*dt_pi) * gauge_constraint->get(i) -
-        get(*normal_dot_gauge_constraint) * spacetime_metric.get(0, i);
-  }
-  get<0, 0>(*dt_pi) =
-      2.0 * get<0, 0>(*dt_pi) * get<0>(*gauge_constraint) -
-      get(*normal_dot_gauge_constraint) * get<0, 0>(spacetime_metric);
-
-  // Set space-space components
-  for (size_t mu = 1; mu < Dim + 1; ++mu) {
-    for (size_t nu = mu; nu < Dim + 1; ++nu) {
-      dt_pi->get(mu, nu) =
-          -get(*normal_dot_gauge_constraint) * spacetime_metric.get(mu, nu);
+    gr::christoffel_first_kind(make_not_null(&christoffel_first_kind_block),
+                               da_spacetime_metric_block);
+    trace_last_indices(make_not_null(&trace_christoffel_block),
+                       christoffel_first_kind_block,
+                       inverse_spacetime_metric_block);
+    if (not using_harmonic_gauge) {
+      raise_or_lower_first_index(make_not_null(&christoffel_second_kind_block),
+                                 christoffel_first_kind_block,
+                                 inverse_spacetime_metric_block);
     }
-  }
-
-  // Add additional pieces to dt_pi that aren't just n_a*(stuff)
-  for (size_t mu = 0; mu < Dim + 1; ++mu) {
-    for (size_t nu = mu; nu < Dim + 1; ++nu) {
-      dt_pi->get(mu, nu) -= get(*half_pi_two_normals) * pi.get(mu, nu);
 
-      if (not using_harmonic_gauge) {
-        dt_pi->get(mu, nu) -= spacetime_deriv_gauge_function->get(mu, nu) +
-                              spacetime_deriv_gauge_function->get(nu, mu);
+    get(gamma1gamma2_block) = get(gamma1_block) * get(gamma2_block);
+    const DataVector& gamma12 = get(gamma1gamma2_block);
+
+    for (size_t m = 0; m < Dim; ++m) {
+      for (size_t mu = 0; mu < Dim + 1; ++mu) {
+        for (size_t nu = mu; nu < Dim + 1; ++nu) {
+          phi_1_up_block.get(m, mu, nu) =
+              inverse_spatial_metric_block.get(m, 0) * phi_block.get(0, mu, nu);
+          for (size_t n = 1; n < Dim; ++n) {
+            phi_1_up_block.get(m, mu, nu) +=
+                inverse_spatial_metric_block.get(m, n) *
+                phi_block.get(n, mu, nu);
+          }
+        }
       }
-      for (size_t delta = 0; delta < Dim + 1; ++delta) {
-        dt_pi->get(mu, nu) -= 2 * pi.get(mu, delta) * pi_2_up->get(nu, delta);
-        if (not using_harmonic_gauge) {
-          dt_pi->get(mu, nu) += 2 *
-                                christoffel_second_kind->get(delta, mu, nu) *
-                                gauge_function->get(delta);
+    }
+
+    for (size_t m = 0; m < Dim; ++m) {
+      for (size_t nu = 0; nu < Dim + 1; ++nu) {
+        for (size_t alpha = 0; alpha < Dim + 1; ++alpha) {
+          phi_3_up_block.get(m, nu, alpha) =
+              inverse_spacetime_metric_block.get(alpha, 0) *
+              phi_block.get(m, nu, 0);
+          for (size_t beta = 1; beta < Dim + 1; ++beta) {
+            phi_3_up_block.get(m, nu, alpha) +=
+                inverse_spacetime_metric_block.get(alpha, beta) *
+                phi_block.get(m, nu, beta);
+          }
         }
-        for (size_t n = 0; n < Dim; ++n) {
-          dt_pi->get(mu, nu) +=
-              2 * phi_1_up->get(n, mu, delta) * phi_3_up->get(n, nu, delta);
+      }
+    }
+
+    for (size_t nu = 0; nu < Dim + 1; ++nu) {
+      for (size_t alpha = 0; alpha < Dim + 1; ++alpha) {
+        pi_2_up_block.get(nu, alpha) =
+            inverse_spacetime_metric_block.get(alpha, 0) * pi_block.get(nu, 0);
+        for (size_t beta = 1; beta < Dim + 1; ++beta) {
+          pi_2_up_block.get(nu, alpha) +=
+              inverse_spacetime_metric_block.get(alpha, beta) *
+              pi_block.get(nu, beta);
         }
+      }
+    }
 
+    for (size_t mu = 0; mu < Dim + 1; ++mu) {
+      for (size_t nu = 0; nu < Dim + 1; ++nu) {
         for (size_t alpha = 0; alpha < Dim + 1; ++alpha) {
-          dt_pi->get(mu, nu) -=
-              2. * christoffel_first_kind_3_up->get(mu, alpha, delta) *
-              christoffel_first_kind_3_up->get(nu, delta, alpha);
+          christoffel_first_kind_3_up_block.get(mu, nu, alpha) =
+              inverse_spacetime_metric_block.get(alpha, 0) *
+              christoffel_first_kind_block.get(mu, nu, 0);
+          for (size_t beta = 1; beta < Dim + 1; ++beta) {
+            christoffel_first_kind_3_up_block.get(mu, nu, alpha) +=
+                inverse_spacetime_metric_block.get(alpha, beta) *
+                christoffel_first_kind_block.get(mu, nu, beta);
+          }
         }
       }
+    }
 
-      for (size_t m = 0; m < Dim; ++m) {
-        dt_pi->get(mu, nu) -=
-            pi_one_normal->get(m + 1) * phi_1_up->get(m, mu, nu);
+    for (size_t n = 0; n < Dim; ++n) {
+      for (size_t mu = 0; mu < Dim + 1; ++mu) {
+        for (size_t nu = mu; nu < Dim + 1; ++nu) {
+          three_index_constraint_block.get(n, mu, nu) =
+              d_spacetime_metric_block.get(n, mu, nu) -
+              phi_block.get(n, mu, nu);
+        }
+      }
+    }
 
-        for (size_t n = 0; n < Dim; ++n) {
-          dt_pi->get(mu, nu) -=
-              inverse_spatial_metric->get(m, n) * d_phi.get(m, n, mu, nu);
+    get(gamma1_plus_1_block) = 1.0 + get(gamma1_block);
+    const DataVector& gamma1p1 = get(gamma1_plus_1_block);
+
+    for (size_t mu = 0; mu < Dim + 1; ++mu) {
+      gauge_constraint_block.get(mu) = trace_christoffel_block.get(mu);
+      for (size_t nu = mu; nu < Dim + 1; ++nu) {
+        shift_dot_three_index_constraint_block.get(mu, nu) =
+            get<0>(shift_block) * three_index_constraint_block.get(0, mu, nu);
+        if (mesh_velocity.has_value()) {
+          mesh_velocity_dot_three_index_constraint_block.get(mu, nu) =
+              get<0>(mesh_velocity_block) *
+              three_index_constraint_block.get(0, mu, nu);
+        }
+        for (size_t m = 1; m < Dim; ++m) {
+          shift_dot_three_index_constraint_block.get(mu, nu) +=
+              shift_block.get(m) * three_index_constraint_block.get(m, mu, nu);
+          if (mesh_velocity.has_value()) {
+            mesh_velocity_dot_three_index_constraint_block.get(mu, nu) +=
+                mesh_velocity_block.get(m) *
+                three_index_constraint_block.get(m, mu, nu);
+          }
         }
       }
+    }
 
-      dt_pi->get(mu, nu) *= get(*lapse);
+    if (not using_harmonic_gauge) {
+      for (size_t nu = 0; nu < Dim + 1; ++nu) {
+        gauge_constraint_block.get(nu) += gauge_function_block.get(nu);
+      }
+    }
+
+    get(normal_dot_gauge_constraint_block) =
+        get<0>(normal_spacetime_vector_block) * get<0>(gauge_constraint_block);
+    for (size_t mu = 1; mu < Dim + 1; ++mu) {
+      get(normal_dot_gauge_constraint_block) +=
+          normal_spacetime_vector_block.get(mu) *
+          gauge_constraint_block.get(mu);
+    }
 
-      dt_pi->get(mu, nu) +=
-          gamma12 * shift_dot_three_index_constraint->get(mu, nu);
-      if (mesh_velocity.has_value()) {
-        dt_pi->get(mu, nu) +=
-            gamma12 * mesh_velocity_dot_three_index_constraint->get(mu, nu);
+    // Here are the actual equations
+
+    // Equation for dt_spacetime_metric
+    for (size_t mu = 0; mu < Dim + 1; ++mu) {
+      for (size_t nu = mu; nu < Dim + 1; ++nu) {
+        dt_spacetime_metric_block.get(mu, nu) +=
+            gamma1p1 * shift_dot_three_index_constraint_block.get(mu, nu);
+        if (mesh_velocity.has_value()) {
+          dt_spacetime_metric_block.get(mu, nu) +=
+              get(gamma1_block) *
+              mesh_velocity_dot_three_index_constraint_block.get(mu, nu);
+        }
       }
+    }
 
-      for (size_t m = 0; m < Dim; ++m) {
-        // DualFrame term
-        dt_pi->get(mu, nu) += shift->get(m) * d_pi.get(m, mu, nu);
+    // Equation for dt_pi
+
+    // We first compute the n_a contributions but only for a=0 since n_i=0
+    // identically. We also use dt_Pi_{00} as temporary storage to avoid any
+    // extra allocations and multiply normal_dot_gauge_constraint=(n^a C_a) by
+    // gamma0 since it always shows up multiplied by gamma0 in the equations.
+    // This reduces the number of multiplications that are needed for the RHS
+    // evaluation.
+    //
+    // WARNING: normal_dot_gauge_constraint is rescaled by gamma0!
+    get(normal_dot_gauge_constraint_block) *= get(gamma0_block);
+
+    // Use dt_pi_{00} as temporary storage.
+    get<0, 0>(dt_pi_block) = -get(gamma0_block) * get(lapse_block);
+    for (size_t i = 1; i < Dim + 1; ++i) {
+      dt_pi_block.get(0, i) =
+          get<0, 0>(dt_pi_block) * gauge_constraint_block.get(i) -
+          get(normal_dot_gauge_constraint_block) *
+              spacetime_metric_block.get(0, i);
+    }
+    get<0, 0>(dt_pi_block) =
+        2.0 * get<0, 0>(dt_pi_block) * get<0>(gauge_constraint_block) -
+        get(normal_dot_gauge_constraint_block) *
+            get<0, 0>(spacetime_metric_block);
+
+    // Set space-space components
+    for (size_t mu = 1; mu < Dim + 1; ++mu) {
+      for (size_t nu = mu; nu < Dim + 1; ++nu) {
+        dt_pi_block.get(mu, nu) = -get(normal_dot_gauge_constraint_block) *
+                                  spacetime_metric_block.get(mu, nu);
       }
     }
-  }
 
-  // Equation for dt_phi
-  for (size_t i = 0; i < Dim; ++i) {
+    // Add additional pieces to dt_pi that aren't just n_a*(stuff)
     for (size_t mu = 0; mu < Dim + 1; ++mu) {
       for (size_t nu = mu; nu < Dim + 1; ++nu) {
-        dt_phi->get(i, mu, nu) =
-            pi.get(mu, nu) * half_phi_two_normals->get(i) -
-            d_pi.get(i, mu, nu) +
-            get(gamma2) * three_index_constraint->get(i, mu, nu);
-        for (size_t n = 0; n < Dim; ++n) {
-          dt_phi->get(i, mu, nu) +=
-              phi_one_normal->get(i, n + 1) * phi_1_up->get(n, mu, nu);
+        dt_pi_block.get(mu, nu) -=
+            get(half_pi_two_normals_block) * pi_block.get(mu, nu);
+
+        if (not using_harmonic_gauge) {
+          dt_pi_block.get(mu, nu) -=
+              spacetime_deriv_gauge_function_block.get(mu, nu) +
+              spacetime_deriv_gauge_function_block.get(nu, mu);
+        }
+        for (size_t delta = 0; delta < Dim + 1; ++delta) {
+          dt_pi_block.get(mu, nu) -=
+              2 * pi_block.get(mu, delta) * pi_2_up_block.get(nu, delta);
+          if (not using_harmonic_gauge) {
+            dt_pi_block.get(mu, nu) +=
+                2 * christoffel_second_kind_block.get(delta, mu, nu) *
+                gauge_function_block.get(delta);
+          }
+          for (size_t n = 0; n < Dim; ++n) {
+            dt_pi_block.get(mu, nu) += 2 * phi_1_up_block.get(n, mu, delta) *
+                                       phi_3_up_block.get(n, nu, delta);
+          }
+
+          for (size_t alpha = 0; alpha < Dim + 1; ++alpha) {
+            dt_pi_block.get(mu, nu) -=
+                2. * christoffel_first_kind_3_up_block.get(mu, alpha, delta) *
+                christoffel_first_kind_3_up_block.get(nu, delta, alpha);
+          }
+        }
+
+        for (size_t m = 0; m < Dim; ++m) {
+          dt_pi_block.get(mu, nu) -=
+              pi_one_normal_block.get(m + 1) * phi_1_up_block.get(m, mu, nu);
+
+          for (size_t n = 0; n < Dim; ++n) {
+            dt_pi_block.get(mu, nu) -= inverse_spatial_metric_block.get(m, n) *
+                                       d_phi_block.get(m, n, mu, nu);
+          }
+        }
+
+        dt_pi_block.get(mu, nu) *= get(lapse_block);
+
+        dt_pi_block.get(mu, nu) +=
+            gamma12 * shift_dot_three_index_constraint_block.get(mu, nu);
+        if (mesh_velocity.has_value()) {
+          dt_pi_block.get(mu, nu) +=
+              gamma12 *
+              mesh_velocity_dot_three_index_constraint_block.get(mu, nu);
         }
 
-        dt_phi->get(i, mu, nu) *= get(*lapse);
         for (size_t m = 0; m < Dim; ++m) {
-          dt_phi->get(i, mu, nu) += shift->get(m) * d_phi.get(m, i, mu, nu);
+          // DualFrame term
+          dt_pi_block.get(mu, nu) +=
+              shift_block.get(m) * d_pi_block.get(m, mu, nu);
+        }
+      }
+    }
+
+    // Equation for dt_phi
+    for (size_t i = 0; i < Dim; ++i) {
+      for (size_t mu = 0; mu < Dim + 1; ++mu) {
+        for (size_t nu = mu; nu < Dim + 1; ++nu) {
+          dt_phi_block.get(i, mu, nu) =
+              pi_block.get(mu, nu) * half_phi_two_normals_block.get(i) -
+              d_pi_block.get(i, mu, nu) +
+              get(gamma2_block) * three_index_constraint_block.get(i, mu, nu);
+          for (size_t n = 0; n < Dim; ++n) {
+            dt_phi_block.get(i, mu, nu) +=
+                phi_one_normal_block.get(i, n + 1) *
+                phi_1_up_block.get(n, mu, nu);
+          }
+
+          dt_phi_block.get(i, mu, nu) *= get(lapse_block);
+          for (size_t m = 0; m < Dim; ++m) {
+            dt_phi_block.get(i, mu, nu) +=
+                shift_block.get(m) * d_phi_block.get(m, i, mu, nu);
+          }
         }
       }
     }
@@ -98,6 +98,11 @@ namespace gh {
  * Mesh-velocity corrections that are applicable to all systems are made in
  * `evolution::dg::Actions::detail::volume_terms()`.
  *
+ * \note The temporaries that are not needed by the gauge source functions are
+ * computed together with the evolution equations in blocks of a few dozen
+ * grid points, so that they are still in cache when the equations use them.
+ * All temporaries are still returned for every grid point.
+ *
  * \warning When using harmonic gauge,
  * gr::Tags::SqrtDetSpatialMetric<DataVector> and
  * gr::Tags::SpacetimeChristoffelSecondKind<Dim, Frame::Inertial, DataVector>
@@ -92,6 +92,10 @@ using tags_list_for_reconstruct = tmpl::list<
  * The reason the `PrimTagsForReconstruction` can be specified separately is
  * because some variables might need separate reconstruction methods from
  * others, e.g. to guarantee the reconstructed solution is positive.
+ *
+ * All the `PrimTagsForReconstruction` are reconstructed together with a
+ * single call to `reconstruct`, so they must be stored contiguously and in the
+ * same order in the `neighbor_data`.
  */
 template <typename PrimTagsForReconstruction, typename PrimsTagsVolume,
           size_t ThermodynamicDim, typename F, typename PrimsTagsSentByNeighbor>
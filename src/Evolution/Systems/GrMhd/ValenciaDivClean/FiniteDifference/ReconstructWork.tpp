@@ -33,6 +33,17 @@
 #include "Utilities/Gsl.hpp"
 
 namespace grmhd::ValenciaDivClean::fd {
+namespace detail {
+// Whether the `SubTags` appear in `Tags` one after the other and in the same
+// order, so that they are stored contiguously in a `Variables<Tags>`.
+template <typename SubTags, typename Tags, size_t... Is>
+constexpr bool is_contiguous_sublist(std::index_sequence<Is...> /*meta*/) {
+  return ((tmpl::index_of<Tags, tmpl::at_c<SubTags, Is>>::value ==
+           tmpl::index_of<Tags, tmpl::front<SubTags>>::value + Is) and
+          ...);
+}
+}  // namespace detail
+
 template <typename TagsList, size_t ThermodynamicDim>
 void compute_conservatives_for_reconstruction(
     const gsl::not_null<Variables<TagsList>*> vars_on_face,
@@ -144,88 +155,120 @@ void reconstruct_prims_work(
       subcell_mesh.extents().slice_away(0).product();
   const size_t neighbor_num_pts =
       ghost_zone_size * subcell_mesh.extents().slice_away(0).product();
-  tmpl::for_each<PrimTagsForReconstruction>([&element, &neighbor_data,
-                                             neighbor_num_pts, &reconstruct,
-                                             reconstructed_num_pts,
-                                             volume_num_pts, &volume_prims,
-                                             &vars_on_lower_face,
-                                             &vars_on_upper_face,
-                                             &subcell_mesh](auto tag_v) {
-    using tag = tmpl::type_from<decltype(tag_v)>;
-    const typename tag::type* volume_tensor_ptr = nullptr;
-    Variables<tmpl::list<
-        hydro::Tags::LorentzFactorTimesSpatialVelocity<DataVector, 3>>>
-        lorentz_factor_times_v_I{};
-    if constexpr (std::is_same_v<tag,
-                                 hydro::Tags::LorentzFactorTimesSpatialVelocity<
-                                     DataVector, 3>>) {
-      // we need to handle the Wv^i reconstruction separately since we need to
-      // first compute Wv^i in the volume (it's not one of our primitives from
-      // the recovery). The components need to be stored contiguously, which is
-      // why we have the Variables `lorentz_factor_times_v_I`
-      const auto& spatial_velocity =
-          get<hydro::Tags::SpatialVelocity<DataVector, 3>>(volume_prims);
-      const auto& lorentz_factor =
-          get<hydro::Tags::LorentzFactor<DataVector>>(volume_prims);
-      lorentz_factor_times_v_I.initialize(get(lorentz_factor).size());
-      auto& volume_tensor =
-          get<hydro::Tags::LorentzFactorTimesSpatialVelocity<DataVector, 3>>(
-              lorentz_factor_times_v_I) = spatial_velocity;
-      for (size_t i = 0; i < 3; ++i) {
-        volume_tensor.get(i) *= get(lorentz_factor);
-      }
-      volume_tensor_ptr = &volume_tensor;
-    } else {
-      volume_tensor_ptr = &get<tag>(volume_prims);
-    }
+  static_assert(
+      detail::is_contiguous_sublist<PrimTagsForReconstruction,
+                                    PrimsTagsSentByNeighbor>(
+          std::make_index_sequence<
+              tmpl::size<PrimTagsForReconstruction>::value>{}),
+      "The PrimTagsForReconstruction must be stored contiguously and in the "
+      "same order in the neighbor data so that they can be reconstructed "
+      "together.");
+  constexpr size_t number_of_variables =
+      Variables<PrimTagsForReconstruction>::number_of_independent_components;
+  // The gathered volume primitives and the reconstructed face values share a
+  // scratch buffer that is kept between calls, since the reconstruction is
+  // done for every element on every step and the sizes rarely change.
+  thread_local DataVector scratch_buffer{};
+  const size_t scratch_size =
+      number_of_variables * (volume_num_pts + 6 * reconstructed_num_pts);
+  if (scratch_buffer.size() < scratch_size) {
+    scratch_buffer.destructive_resize(scratch_size);
+  }
+
+  // All the primitives are reconstructed together in a single sweep over each
+  // dimension, so we gather them into one buffer in the volume. The neighbor
+  // data already stores them contiguously.
+  Variables<PrimTagsForReconstruction> volume_vars_to_reconstruct{
+      scratch_buffer.data(), number_of_variables * volume_num_pts};
+  tmpl::for_each<PrimTagsForReconstruction>(
+      [&volume_prims, &volume_vars_to_reconstruct](auto tag_v) {
+        using tag = tmpl::type_from<decltype(tag_v)>;
+        auto& volume_tensor = get<tag>(volume_vars_to_reconstruct);
+        if constexpr (std::is_same_v<
+                          tag, hydro::Tags::LorentzFactorTimesSpatialVelocity<
+                                   DataVector, 3>>) {
+          // Wv^i isn't one of our primitives from the recovery, so we compute
+          // it in the volume
+          const auto& spatial_velocity =
+              get<hydro::Tags::SpatialVelocity<DataVector, 3>>(volume_prims);
+          const auto& lorentz_factor =
+              get<hydro::Tags::LorentzFactor<DataVector>>(volume_prims);
+          for (size_t i = 0; i < 3; ++i) {
+            volume_tensor.get(i) =
+                get(lorentz_factor) * spatial_velocity.get(i);
+          }
+        } else {
+          volume_tensor = get<tag>(volume_prims);
+        }
+      });
+  const gsl::span<const double> volume_vars = gsl::make_span(
+      volume_vars_to_reconstruct.data(), volume_vars_to_reconstruct.size());
 
-    const size_t number_of_variables = volume_tensor_ptr->size();
-    const gsl::span<const double> volume_vars = gsl::make_span(
-        (*volume_tensor_ptr)[0].data(), number_of_variables * volume_num_pts);
-    std::array<gsl::span<double>, 3> upper_face_vars{};
-    std::array<gsl::span<double>, 3> lower_face_vars{};
-    for (size_t i = 0; i < 3; ++i) {
-      gsl::at(upper_face_vars, i) =
-          gsl::make_span(get<tag>(gsl::at(*vars_on_upper_face, i))[0].data(),
-                         number_of_variables * reconstructed_num_pts);
-      gsl::at(lower_face_vars, i) =
-          gsl::make_span(get<tag>(gsl::at(*vars_on_lower_face, i))[0].data(),
-                         number_of_variables * reconstructed_num_pts);
+  DirectionMap<3, gsl::span<const double>> ghost_cell_vars{};
+  for (const auto& direction : Direction<3>::all_directions()) {
+    DirectionalId<3> neighbor_id{direction,
+                                 ElementId<3>::external_boundary_id()};
+    if (element.neighbors().contains(direction)) {
+      const auto& neighbors_in_direction = element.neighbors().at(direction);
+      ASSERT(neighbors_in_direction.size() == 1,
+             "Currently only support one neighbor in each direction, but got "
+                 << neighbors_in_direction.size() << " in direction "
+                 << direction);
+      neighbor_id =
+          DirectionalId<3>{direction, *neighbors_in_direction.begin()};
+    } else {
+      // retrieve boundary ghost data from neighbor_data
+      ASSERT(
+          element.external_boundaries().count(direction) == 1,
+          "Element has neither neighbor nor external boundary to direction : "
+              << direction);
     }
+    ghost_cell_vars[direction] = gsl::make_span(
+        get<tmpl::front<PrimTagsForReconstruction>>(neighbor_data.at(
+            neighbor_id))[0]
+            .data(),
+        number_of_variables * neighbor_num_pts);
+  }
 
-    DirectionMap<3, gsl::span<const double>> ghost_cell_vars{};
+  // The reconstructed primitives are scattered into the face variables
+  // afterwards, since those store them together with many other quantities.
+  double* const face_buffer =
+      scratch_buffer.data() + number_of_variables * volume_num_pts;
+  std::array<gsl::span<double>, 3> upper_face_vars{};
+  std::array<gsl::span<double>, 3> lower_face_vars{};
+  for (size_t i = 0; i < 3; ++i) {
+    gsl::at(upper_face_vars, i) = gsl::make_span(
+        face_buffer + 2 * i * number_of_variables * reconstructed_num_pts,
+        number_of_variables * reconstructed_num_pts);
+    gsl::at(lower_face_vars, i) = gsl::make_span(
+        face_buffer + (2 * i + 1) * number_of_variables * reconstructed_num_pts,
+        number_of_variables * reconstructed_num_pts);
+  }
 
-    for (const auto& direction : Direction<3>::all_directions()) {
-      if (element.neighbors().contains(direction)) {
-        const auto& neighbors_in_direction = element.neighbors().at(direction);
-        ASSERT(neighbors_in_direction.size() == 1,
-               "Currently only support one neighbor in each direction, but "
-               "got "
-                   << neighbors_in_direction.size() << " in direction "
-                   << direction);
-        ghost_cell_vars[direction] =
-            gsl::make_span(get<tag>(neighbor_data.at(DirectionalId<3>{
-                               direction, *neighbors_in_direction.begin()}))[0]
-                               .data(),
-                           number_of_variables * neighbor_num_pts);
-      } else {
-        // retrieve boundary ghost data from neighbor_data
-        ASSERT(
-            element.external_boundaries().count(direction) == 1,
-            "Element has neither neighbor nor external boundary to direction : "
-                << direction);
-        ghost_cell_vars[direction] = gsl::make_span(
-            get<tag>(neighbor_data.at(DirectionalId<3>{
-                direction, ElementId<3>::external_boundary_id()}))[0]
-                .data(),
-            number_of_variables * neighbor_num_pts);
-      }
-    }
+  reconstruct(make_not_null(&upper_face_vars), make_not_null(&lower_face_vars),
+              volume_vars, ghost_cell_vars, subcell_mesh.extents(),
+              number_of_variables);
 
-    reconstruct(make_not_null(&upper_face_vars),
-                make_not_null(&lower_face_vars), volume_vars, ghost_cell_vars,
-                subcell_mesh.extents(), number_of_variables);
-  });
+  for (size_t i = 0; i < 3; ++i) {
+    const double* upper_face_data = gsl::at(upper_face_vars, i).data();
+    const double* lower_face_data = gsl::at(lower_face_vars, i).data();
+    tmpl::for_each<PrimTagsForReconstruction>(
+        [i, &lower_face_data, reconstructed_num_pts, &upper_face_data,
+         &vars_on_lower_face, &vars_on_upper_face](auto tag_v) {
+          using tag = tmpl::type_from<decltype(tag_v)>;
+          auto& upper_tensor = get<tag>(gsl::at(*vars_on_upper_face, i));
+          auto& lower_tensor = get<tag>(gsl::at(*vars_on_lower_face, i));
+          for (size_t component = 0; component < upper_tensor.size();
+               ++component) {
+            std::copy(upper_face_data, upper_face_data + reconstructed_num_pts,
+                      upper_tensor[component].data());
+            std::copy(lower_face_data, lower_face_data + reconstructed_num_pts,
+                      lower_tensor[component].data());
+            upper_face_data += reconstructed_num_pts;
+            lower_face_data += reconstructed_num_pts;
+          }
+        });
+  }
 
   for (size_t i = 0; compute_conservatives and i < 3; ++i) {
     compute_conservatives_for_reconstruction(
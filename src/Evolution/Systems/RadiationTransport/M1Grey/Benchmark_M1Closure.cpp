@@ -0,0 +1,84 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wredundant-decls"
+#include <benchmark/benchmark.h>
+#pragma GCC diagnostic pop
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Evolution/Systems/RadiationTransport/M1Grey/M1Closure.hpp"
+#include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace {
+// In this anonymous namespace is a microbenchmark of the M1 closure in the
+// regime where the closure equation must be solved numerically at every point,
+// using either SIMD batches of points or one point at a time in the root find.
+// The benchmark argument is the number of grid points, and the rate of points
+// processed is reported.
+
+// clang-tidy: don't pass be non-const reference
+template <bool UseSimdRootFind>
+void bench_m1_closure(benchmark::State& state) {  // NOLINT
+  const auto number_of_points = static_cast<size_t>(state.range(0));
+  const DataVector used_for_size(number_of_points);
+
+  tnsr::I<DataVector, 3, Frame::Inertial> fluid_velocity(used_for_size);
+  tnsr::ii<DataVector, 3, Frame::Inertial> spatial_metric(used_for_size, 0.);
+  tnsr::II<DataVector, 3, Frame::Inertial> inv_spatial_metric(used_for_size,
+                                                              0.);
+  Scalar<DataVector> energy_density(used_for_size);
+  tnsr::i<DataVector, 3, Frame::Inertial> momentum_density(used_for_size);
+  for (size_t i = 0; i < 3; ++i) {
+    fluid_velocity.get(i) = 0.1 * static_cast<double>(i + 1);
+    spatial_metric.get(i, i) = 1.;
+    inv_spatial_metric.get(i, i) = 1.;
+  }
+  const Scalar<DataVector> fluid_lorentz_factor{
+      1. / sqrt(1. - square(fluid_velocity.get(0)) -
+                square(fluid_velocity.get(1)) -
+                square(fluid_velocity.get(2)))};
+  // Vary the moments between points so that the closure factors differ
+  for (size_t s = 0; s < number_of_points; ++s) {
+    const double scale = 0.2 + 0.6 * static_cast<double>(s) /
+                                   static_cast<double>(number_of_points);
+    get(energy_density)[s] = 1.;
+    momentum_density.get(0)[s] = 0.6 * scale;
+    momentum_density.get(1)[s] = -0.3 * scale;
+    momentum_density.get(2)[s] = 0.5 * scale;
+  }
+
+  Scalar<DataVector> closure_factor(used_for_size);
+  tnsr::II<DataVector, 3, Frame::Inertial> pressure_tensor(used_for_size);
+  Scalar<DataVector> comoving_energy_density(used_for_size);
+  Scalar<DataVector> comoving_momentum_density_normal(used_for_size);
+  tnsr::i<DataVector, 3, Frame::Inertial> comoving_momentum_density_spatial(
+      used_for_size);
+
+  while (state.KeepRunning()) {
+    // Without a warm start, the root find brackets the full allowed domain.
+    get(closure_factor) = -1.;
+    RadiationTransport::M1Grey::detail::compute_closure_impl(
+        make_not_null(&closure_factor), make_not_null(&pressure_tensor),
+        make_not_null(&comoving_energy_density),
+        make_not_null(&comoving_momentum_density_normal),
+        make_not_null(&comoving_momentum_density_spatial), energy_density,
+        momentum_density, fluid_velocity, fluid_lorentz_factor, spatial_metric,
+        inv_spatial_metric, UseSimdRootFind);
+    benchmark::DoNotOptimize(get(closure_factor).data());
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(number_of_points));
+}
+// NOLINTNEXTLINE
+BENCHMARK_TEMPLATE(bench_m1_closure, true)->RangeMultiplier(4)->Range(64, 4096);
+// NOLINTNEXTLINE
+BENCHMARK_TEMPLATE(bench_m1_closure, false)
+    ->RangeMultiplier(4)
+    ->Range(64, 4096);
+}  // namespace
@@ -7,7 +7,9 @@
 #include <array>
 #include <cmath>
 #include <cstddef>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "DataStructures/DataBox/Tag.hpp"
 #include "DataStructures/DataVector.hpp"
@@ -19,6 +21,7 @@
 #include "PointwiseFunctions/Hydro/Tags.hpp"
 #include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/Simd/Simd.hpp"
 #include "Utilities/TMPL.hpp"
 
 // IWYU pragma: no_forward_declare Tensor
@@ -31,11 +34,172 @@ struct MomentumSquared : db::SimpleTag {
   using type = Scalar<DataVector>;
 };
 
+// Coefficients of the closure equation at the points where it is solved
+// numerically. See `closure_residual`.
+struct InertialEnergy : db::SimpleTag {
+  using type = Scalar<DataVector>;
+};
+struct J0 : db::SimpleTag {
+  using type = Scalar<DataVector>;
+};
+struct JThin : db::SimpleTag {
+  using type = Scalar<DataVector>;
+};
+struct JThick : db::SimpleTag {
+  using type = Scalar<DataVector>;
+};
+struct HSqr0 : db::SimpleTag {
+  using type = Scalar<DataVector>;
+};
+struct HSqrThin : db::SimpleTag {
+  using type = Scalar<DataVector>;
+};
+struct HSqrThick : db::SimpleTag {
+  using type = Scalar<DataVector>;
+};
+struct HSqrThinThin : db::SimpleTag {
+  using type = Scalar<DataVector>;
+};
+struct HSqrThickThick : db::SimpleTag {
+  using type = Scalar<DataVector>;
+};
+struct HSqrThinThick : db::SimpleTag {
+  using type = Scalar<DataVector>;
+};
+using ResidualCoefficients =
+    Variables<tmpl::list<InertialEnergy, J0, JThin, JThick, HSqr0, HSqrThin,
+                         HSqrThick, HSqrThinThin, HSqrThickThick,
+                         HSqrThinThick>>;
+
 // Minerbo (maximum entropy) closure for the M1 scheme
-double minerbo_closure_function(const double zeta) {
+template <typename T>
+T minerbo_closure_function(const T& zeta) {
   return 1.0 / 3.0 +
          square(zeta) * (0.4 - 2.0 / 15.0 * zeta + 0.4 * square(zeta));
 }
+
+// Decomposition of the fluid-frame moments at a single point with
+// non-negligible fluid velocity.
+//
+// The fluid-frame energy density is
+// J = J0 + d_thin * JThin + d_thick * JThick
+// with d_thin, d_thick=1-d_thin coefficients
+// obtained from the M1 closure.
+//
+// The fluid-frame momentum density is
+// H_a = -( h0T + d_thick hThickT + d_thin hThinT) t_a
+//  - ( h0V + d_thick hThickV + d_thin hThinV) v_a
+//  - ( h0F + d_thick hThickF + d_thin hThinF) F_a
+// with t_a the unit normal, v_a the 3-velocity, and F_a the
+// inertial frame momentum density. This is a decomposition of
+// convenience, which is not unique: F_a and v_a are not
+// orthogonal vectors, but both are normal to t_a.
+//
+// H^2 = H^a H_a is then
+// H^2 = h_sqr_0 + h_sqr_thin * d_thin + h_sqr_thick*d_thick
+// + h_sqr_thin_thin * d_thin^2 + h_sqr_thick_thick * d_thick^2
+// + h_sqr_thin_thick * d_thin * d_thick;
+struct ClosureDecomposition {
+  double j_0;
+  double j_thin;
+  double j_thick;
+  double h_0_t;
+  double h_0_v;
+  double h_0_f;
+  double h_thin_t;
+  double h_thin_v;
+  double h_thin_f;
+  double h_thick_t;
+  double h_thick_v;
+  double h_thick_f;
+  double h_sqr_0;
+  double h_sqr_thin;
+  double h_sqr_thick;
+  double h_sqr_thin_thick;
+  double h_sqr_thick_thick;
+  double h_sqr_thin_thin;
+};
+
+ClosureDecomposition closure_decomposition(const double e_pt,
+                                           const double s_sqr_pt,
+                                           const double v_sqr_pt,
+                                           const double w_sqr_pt,
+                                           const double w_pt,
+                                           const double v_dot_f_pt) {
+  const double j_0 = w_sqr_pt * (e_pt - 2. * v_dot_f_pt);
+  const double j_thin = w_sqr_pt * e_pt * square(v_dot_f_pt) / s_sqr_pt;
+  const double j_thick =
+      (w_sqr_pt - 1.) / (1. + 2. * w_sqr_pt) *
+      (4. * w_sqr_pt * v_dot_f_pt + e_pt * (3. - 2. * w_sqr_pt));
+  const double h_0_t = w_pt * (j_0 + v_dot_f_pt - e_pt);
+  const double h_0_v = w_pt * j_0;
+  const double h_0_f = -w_pt;
+  const double h_thin_t = w_pt * j_thin;
+  const double h_thin_v = h_thin_t;
+  const double h_thin_f = w_pt * e_pt * v_dot_f_pt / s_sqr_pt;
+  const double h_thick_t = w_pt * j_thick;
+  const double h_thick_v =
+      h_thick_t +
+      w_pt / (2. * w_sqr_pt + 1.) *
+          ((3. - 2. * w_sqr_pt) * e_pt + (2. * w_sqr_pt - 1.) * v_dot_f_pt);
+  const double h_thick_f = w_pt * v_sqr_pt;
+  return {
+      j_0,
+      j_thin,
+      j_thick,
+      h_0_t,
+      h_0_v,
+      h_0_f,
+      h_thin_t,
+      h_thin_v,
+      h_thin_f,
+      h_thick_t,
+      h_thick_v,
+      h_thick_f,
+      -square(h_0_t) + square(h_0_v) * v_sqr_pt + square(h_0_f) * s_sqr_pt +
+          2. * h_0_v * h_0_f * v_dot_f_pt,
+      2. * (h_0_v * h_thin_v * v_sqr_pt + h_0_f * h_thin_f * s_sqr_pt +
+            h_0_v * h_thin_f * v_dot_f_pt + h_0_f * h_thin_v * v_dot_f_pt -
+            h_0_t * h_thin_t),
+      2. * (h_0_v * h_thick_v * v_sqr_pt + h_0_f * h_thick_f * s_sqr_pt +
+            h_0_v * h_thick_f * v_dot_f_pt + h_0_f * h_thick_v * v_dot_f_pt -
+            h_0_t * h_thick_t),
+      2. * (h_thin_v * h_thick_v * v_sqr_pt + h_thin_f * h_thick_f * s_sqr_pt +
+            h_thin_v * h_thick_f * v_dot_f_pt +
+            h_thin_f * h_thick_v * v_dot_f_pt - h_thin_t * h_thick_t),
+      square(h_thick_v) * v_sqr_pt + square(h_thick_f) * s_sqr_pt +
+          2. * h_thick_v * h_thick_f * v_dot_f_pt - square(h_thick_t),
+      square(h_thin_v) * v_sqr_pt + square(h_thin_f) * s_sqr_pt +
+          2. * h_thin_v * h_thin_f * v_dot_f_pt - square(h_thin_t)};
+}
+
+// The closure equation (zeta^2 J^2 - H^a H_a) / E^2 at the point with index
+// `index` of `coefficients`. `T` is either `double` or a SIMD batch, in which
+// case consecutive points starting at `index` are evaluated together.
+template <typename T>
+T closure_residual(const T& zeta, const ResidualCoefficients& coefficients,
+                   const size_t index) {
+  const auto load = [&coefficients, &index](auto tag) -> T {
+    const DataVector& data = get(get<decltype(tag)>(coefficients));
+    if constexpr (std::is_same_v<T, double>) {
+      return data[index];
+    } else {
+      return simd::load_unaligned(&data[index]);
+    }
+  };
+  const T chi = minerbo_closure_function(zeta);
+  const T d_thin = 1.5 * chi - 0.5;
+  const T d_thick = 1. - d_thin;
+
+  const T e_fluid = load(J0{}) + load(JThin{}) * d_thin +
+                    load(JThick{}) * d_thick;
+  const T h_sqr = load(HSqr0{}) + load(HSqrThick{}) * d_thick +
+                  load(HSqrThin{}) * d_thin +
+                  load(HSqrThinThin{}) * square(d_thin) +
+                  load(HSqrThickThick{}) * square(d_thick) +
+                  load(HSqrThinThick{}) * d_thin * d_thick;
+  return (square(e_fluid * zeta) - h_sqr) / square(load(InertialEnergy{}));
+}
 }  // namespace
 
 namespace RadiationTransport::M1Grey::detail {
@@ -53,7 +217,8 @@ void compute_closure_impl(
     const tnsr::I<DataVector, 3, Frame::Inertial>& fluid_velocity,
     const Scalar<DataVector>& fluid_lorentz_factor,
     const tnsr::ii<DataVector, 3, Frame::Inertial>& spatial_metric,
-    const tnsr::II<DataVector, 3, Frame::Inertial>& inv_spatial_metric) {
+    const tnsr::II<DataVector, 3, Frame::Inertial>& inv_spatial_metric,
+    const bool use_simd_root_find) {
   // Small number used to avoid divisions by zero
   static constexpr double avoid_divisions_by_zero = 1.e-150;
   // Below small_velocity, we use the v=0 closure,
@@ -63,11 +228,17 @@ void compute_closure_impl(
   constexpr size_t spatial_dim = 3;
   // Tolerance used in the rootfinding used to find the closure factor
   constexpr double root_find_tolerance = 1.e-6;
+  // Lower bound of the closure factor in the root find
+  constexpr double minimum_closure_factor = 1.e-15;
+  // Half-width of the bracket around the closure factor from the previous
+  // call that is tried before the full interval
+  constexpr double warm_start_half_width = 0.05;
+  const size_t number_of_points = get(energy_density).size();
   Variables<
       tmpl::list<hydro::Tags::LorentzFactorSquared<DataVector>, MomentumSquared,
                  MomentumUp, hydro::Tags::SpatialVelocityOneForm<DataVector, 3>,
                  hydro::Tags::SpatialVelocitySquared<DataVector>>>
-      temp_closure_tensors(get(energy_density).size());
+      temp_closure_tensors(number_of_points);
 
   // The main calculation needed for the M1 closure is to find the
   // roots of J^2 zeta^2 = H^a H_a, with J the fluid-frame energy density
@@ -93,14 +264,28 @@ void compute_closure_impl(
       temp_closure_tensors);
   raise_or_lower_index(make_not_null(&v_m), fluid_velocity, spatial_metric);
 
-  // Allocate memory for H^i
-  tnsr::I<double, 3, Frame::Inertial> H_M(0.);
-  // Loop over points
-  for (size_t s = 0; s < get(v_sqr).size(); ++s) {
+  const auto s_sqr_at = [&s_sqr](const size_t s) {
+    return std::max(get(s_sqr)[s], avoid_divisions_by_zero);
+  };
+  const auto v_dot_f_at = [&fluid_velocity, &momentum_density](const size_t s) {
+    double v_dot_f_pt = 0.;
+    for (size_t m = 0; m < spatial_dim; m++) {
+      v_dot_f_pt += fluid_velocity.get(m)[s] * momentum_density.get(m)[s];
+    }
+    return v_dot_f_pt;
+  };
+
+  // First pass over the points: apply the v=0 closure where the fluid
+  // velocity is small, and set up the closure equation elsewhere. Points where
+  // the closure factor is at an edge of the allowed domain are resolved here
+  // to avoid failures in the root find, and the rest are collected so that
+  // the closure equation can be solved for all of them together.
+  ResidualCoefficients residual_coefficients(number_of_points);
+  std::vector<size_t> root_find_points{};
+  for (size_t s = 0; s < number_of_points; ++s) {
     const double& v_sqr_pt = get(v_sqr)[s];
-    const double& w_sqr_pt = get(w_sqr)[s];
     const double& e_pt = get(energy_density)[s];
-    const double& s_sqr_pt = std::max(get(s_sqr)[s], avoid_divisions_by_zero);
+    const double s_sqr_pt = s_sqr_at(s);
     // Ignore complicated closure calculations
     // if the fluid velocity is very small
     if (v_sqr_pt < small_velocity) {
@@ -125,144 +310,152 @@ void compute_closure_impl(
                   momentum_density.get(j)[s];
         }
       }
+      continue;
     }
+
     // If the fluid velocity cannot be ignored, we need to
     // go through a more expensive closure calculation
-    else {
-      // Compute useful intermediate quantities from v^i, F_i
-      double v_dot_f_pt = 0.;
-      for (size_t m = 0; m < spatial_dim; m++) {
-        v_dot_f_pt += fluid_velocity.get(m)[s] * momentum_density.get(m)[s];
+    const ClosureDecomposition decomposition =
+        closure_decomposition(e_pt, s_sqr_pt, v_sqr_pt, get(w_sqr)[s],
+                              get(fluid_lorentz_factor)[s], v_dot_f_at(s));
+    // The coefficients are stored in the next unused slot, which is only
+    // claimed if the point needs a root find.
+    const size_t slot = root_find_points.size();
+    get(get<InertialEnergy>(residual_coefficients))[slot] = e_pt;
+    get(get<J0>(residual_coefficients))[slot] = decomposition.j_0;
+    get(get<JThin>(residual_coefficients))[slot] = decomposition.j_thin;
+    get(get<JThick>(residual_coefficients))[slot] = decomposition.j_thick;
+    get(get<HSqr0>(residual_coefficients))[slot] = decomposition.h_sqr_0;
+    get(get<HSqrThin>(residual_coefficients))[slot] = decomposition.h_sqr_thin;
+    get(get<HSqrThick>(residual_coefficients))[slot] =
+        decomposition.h_sqr_thick;
+    get(get<HSqrThinThin>(residual_coefficients))[slot] =
+        decomposition.h_sqr_thin_thin;
+    get(get<HSqrThickThick>(residual_coefficients))[slot] =
+        decomposition.h_sqr_thick_thick;
+    get(get<HSqrThinThick>(residual_coefficients))[slot] =
+        decomposition.h_sqr_thin_thick;
+    // To avoid failures in the root find at the boundary of
+    // the allowed domain for zeta, test the edge values first.
+    if (fabs(closure_residual(0., residual_coefficients, slot)) <
+        root_find_tolerance) {
+      get(*closure_factor)[s] = 0.;
+    } else if (fabs(closure_residual(1., residual_coefficients, slot)) <
+               root_find_tolerance) {
+      get(*closure_factor)[s] = 1.;
+    } else {
+      root_find_points.push_back(s);
+    }
+  }
+
+  // Solve the closure equation at all remaining points. The closure factor
+  // changes little between calls, so the root is first bracketed around the
+  // previous value, which is passed in through `closure_factor`.
+  const size_t number_of_root_finds = root_find_points.size();
+  if (number_of_root_finds > 0) {
+    DataVector lower_bound(number_of_root_finds);
+    DataVector upper_bound(number_of_root_finds);
+    DataVector residual_at_lower_bound(number_of_root_finds);
+    DataVector residual_at_upper_bound(number_of_root_finds);
+    for (size_t slot = 0; slot < number_of_root_finds; ++slot) {
+      const double previous_zeta = get(*closure_factor)[root_find_points[slot]];
+      if (previous_zeta >= 0. and previous_zeta <= 1.) {
+        lower_bound[slot] = std::max(previous_zeta - warm_start_half_width,
+                                     minimum_closure_factor);
+        upper_bound[slot] = std::min(previous_zeta + warm_start_half_width, 1.);
+        residual_at_lower_bound[slot] =
+            closure_residual(lower_bound[slot], residual_coefficients, slot);
+        residual_at_upper_bound[slot] =
+            closure_residual(upper_bound[slot], residual_coefficients, slot);
+        if (residual_at_lower_bound[slot] * residual_at_upper_bound[slot] <=
+            0.) {
+          continue;
+        }
       }
-      // Decomposition of the fluid-frame energy density:
-      // J = J0 + d_thin * JThin + d_thick * JThick
-      // with d_thin, d_thick=1-d_thin coefficients
-      // obtained from the M1 closure.
-      const double j_0 = w_sqr_pt * (e_pt - 2. * v_dot_f_pt);
-      const double j_thin = w_sqr_pt * e_pt * square(v_dot_f_pt) / s_sqr_pt;
-      const double j_thick =
-          (w_sqr_pt - 1.) / (1. + 2. * w_sqr_pt) *
-          (4. * w_sqr_pt * v_dot_f_pt + e_pt * (3. - 2. * w_sqr_pt));
-      // Decomposition of the fluid-frame momentum density:
-      // H_a = -( h0T + d_thick hThickT + d_thin hThinT) t_a
-      //  - ( h0V + d_thick hThickV + d_thin hThinV) v_a
-      //  - ( h0F + d_thick hThickF + d_thin hThinF) F_a
-      // with t_a the unit normal, v_a the 3-velocity, and F_a the
-      // inertial frame momentum density. This is a decomposition of
-      // convenience, which is not unique: F_a and v_a are not
-      // orthogonal vectors, but both are normal to t_a.
-      const double& w_pt = get(fluid_lorentz_factor)[s];
-      const double h_0_t = w_pt * (j_0 + v_dot_f_pt - e_pt);
-      const double h_0_v = w_pt * j_0;
-      const double h_0_f = -w_pt;
-      const double h_thin_t = w_pt * j_thin;
-      const double h_thin_v = h_thin_t;
-      const double h_thin_f = w_pt * e_pt * v_dot_f_pt / s_sqr_pt;
-      const double h_thick_t = w_pt * j_thick;
-      const double h_thick_v =
-          h_thick_t +
-          w_pt / (2. * w_sqr_pt + 1.) *
-              ((3. - 2. * w_sqr_pt) * e_pt + (2. * w_sqr_pt - 1.) * v_dot_f_pt);
-      const double h_thick_f = w_pt * v_sqr_pt;
-      // Quantities needed for the computation of H^2 = H^a H_a,
-      // independent of zeta. We write:
-      // H^2 = h_sqr_0 + h_sqr_thin * d_thin + h_sqr_thick*d_thick
-      // + h_sqr_thin_thin * d_thin^2 + h_sqr_thick_thick * d_thick^2
-      // + h_sqr_thin_thick * d_thin * d_thick;
-      const double h_sqr_0 = -square(h_0_t) + square(h_0_v) * v_sqr_pt +
-                             square(h_0_f) * s_sqr_pt +
-                             2. * h_0_v * h_0_f * v_dot_f_pt;
-      const double h_sqr_thin =
-          2. * (h_0_v * h_thin_v * v_sqr_pt + h_0_f * h_thin_f * s_sqr_pt +
-                h_0_v * h_thin_f * v_dot_f_pt + h_0_f * h_thin_v * v_dot_f_pt -
-                h_0_t * h_thin_t);
-      const double h_sqr_thick =
-          2. * (h_0_v * h_thick_v * v_sqr_pt + h_0_f * h_thick_f * s_sqr_pt +
-                h_0_v * h_thick_f * v_dot_f_pt +
-                h_0_f * h_thick_v * v_dot_f_pt - h_0_t * h_thick_t);
-      const double h_sqr_thin_thick =
-          2. *
-          (h_thin_v * h_thick_v * v_sqr_pt + h_thin_f * h_thick_f * s_sqr_pt +
-           h_thin_v * h_thick_f * v_dot_f_pt +
-           h_thin_f * h_thick_v * v_dot_f_pt - h_thin_t * h_thick_t);
-      const double h_sqr_thick_thick =
-          square(h_thick_v) * v_sqr_pt + square(h_thick_f) * s_sqr_pt +
-          2. * h_thick_v * h_thick_f * v_dot_f_pt - square(h_thick_t);
-      const double h_sqr_thin_thin =
-          square(h_thin_v) * v_sqr_pt + square(h_thin_f) * s_sqr_pt +
-          2. * h_thin_v * h_thin_f * v_dot_f_pt - square(h_thin_t);
+      lower_bound[slot] = minimum_closure_factor;
+      upper_bound[slot] = 1.;
+      residual_at_lower_bound[slot] =
+          closure_residual(minimum_closure_factor, residual_coefficients, slot);
+      residual_at_upper_bound[slot] =
+          closure_residual(1., residual_coefficients, slot);
+    }
 
-      // Root finding function
-      const auto zeta_j_sqr_minus_h_sqr =
-          [&e_pt, &j_0, &j_thin, &j_thick, &h_sqr_0, &h_sqr_thick, &h_sqr_thin,
-           &h_sqr_thin_thin, &h_sqr_thick_thick,
-           &h_sqr_thin_thick](const double local_zeta) {
-            const double chi = minerbo_closure_function(local_zeta);
-            const double d_thin = 1.5 * chi - 0.5;
-            const double d_thick = 1. - d_thin;
+    const auto residual = [&residual_coefficients](const auto zeta,
+                                                   const size_t slot) {
+      return closure_residual(zeta, residual_coefficients, slot);
+    };
+    const DataVector roots =
+        use_simd_root_find
+            ? RootFinder::toms748<true>(
+                  residual, lower_bound, upper_bound, residual_at_lower_bound,
+                  residual_at_upper_bound, root_find_tolerance, 1.0e-15)
+            : RootFinder::toms748<false>(
+                  residual, lower_bound, upper_bound, residual_at_lower_bound,
+                  residual_at_upper_bound, root_find_tolerance, 1.0e-15);
+    for (size_t slot = 0; slot < number_of_root_finds; ++slot) {
+      get(*closure_factor)[root_find_points[slot]] = roots[slot];
+    }
+  }
 
-            const double e_fluid = j_0 + j_thin * d_thin + j_thick * d_thick;
-            const double h_sqr = h_sqr_0 + h_sqr_thick * d_thick +
-                                 h_sqr_thin * d_thin +
-                                 h_sqr_thin_thin * square(d_thin) +
-                                 h_sqr_thick_thick * square(d_thick) +
-                                 h_sqr_thin_thick * d_thin * d_thick;
-            return (square(e_fluid * local_zeta) - h_sqr) / square(e_pt);
-          };
-      // To avoid failures in the root find at the boundary of
-      // the allowed domain for zeta, test the edge values first.
-      if (fabs(zeta_j_sqr_minus_h_sqr(0.)) < root_find_tolerance) {
-        get(*closure_factor)[s] = 0.;
-      } else if (fabs(zeta_j_sqr_minus_h_sqr(1.)) < root_find_tolerance) {
-        get(*closure_factor)[s] = 1.;
-      } else {
-        ERROR(
-            "This function is broken and effectively untested.  It will be "
-            "fixed later.");
-        get(*closure_factor)[s] = RootFinder::toms748(
-            zeta_j_sqr_minus_h_sqr, 1.e-15, 1., root_find_tolerance, 1.0e-15);
-      }
-      const double& zeta = get(*closure_factor)[s];
+  // Second pass: assemble the output quantities at the points with
+  // non-negligible fluid velocity.
+  tnsr::I<double, 3, Frame::Inertial> H_M(0.);
+  for (size_t s = 0; s < number_of_points; ++s) {
+    const double& v_sqr_pt = get(v_sqr)[s];
+    if (v_sqr_pt < small_velocity) {
+      continue;
+    }
+    const double& w_sqr_pt = get(w_sqr)[s];
+    const double& w_pt = get(fluid_lorentz_factor)[s];
+    const double& e_pt = get(energy_density)[s];
+    const double s_sqr_pt = s_sqr_at(s);
+    const double v_dot_f_pt = v_dot_f_at(s);
+    const ClosureDecomposition decomposition = closure_decomposition(
+        e_pt, s_sqr_pt, v_sqr_pt, w_sqr_pt, w_pt, v_dot_f_pt);
+    const double& zeta = get(*closure_factor)[s];
 
-      // Assemble output quantities:
-      const double chi = minerbo_closure_function(zeta);
-      const double d_thin = 1.5 * chi - 0.5;
-      const double d_thick = 1. - d_thin;
-      get(*comoving_energy_density)[s] =
-          j_0 + j_thin * d_thin + j_thick * d_thick;
-      get(*comoving_momentum_density_normal)[s] =
-          h_0_t + h_thin_t * d_thin + h_thick_t * d_thick;
-      for (size_t i = 0; i < spatial_dim; i++) {
-        comoving_momentum_density_spatial->get(i) =
-            -(h_0_v + h_thin_v * d_thin + h_thick_v * d_thick) * v_m.get(i)[s] -
-            (h_0_f + h_thin_f * d_thin + h_thick_f * d_thick) *
-                momentum_density.get(i)[s];
-        for (size_t j = i; j < spatial_dim; j++) {
-          // Optically thin part of pressure tensor
-          pressure_tensor->get(i, j) = d_thin * e_pt *
-                                       momentum_density.get(i)[s] *
-                                       momentum_density.get(j)[s] / s_sqr_pt;
-        }
+    const double chi = minerbo_closure_function(zeta);
+    const double d_thin = 1.5 * chi - 0.5;
+    const double d_thick = 1. - d_thin;
+    get(*comoving_energy_density)[s] = decomposition.j_0 +
+                                       decomposition.j_thin * d_thin +
+                                       decomposition.j_thick * d_thick;
+    get(*comoving_momentum_density_normal)[s] =
+        decomposition.h_0_t + decomposition.h_thin_t * d_thin +
+        decomposition.h_thick_t * d_thick;
+    for (size_t i = 0; i < spatial_dim; i++) {
+      comoving_momentum_density_spatial->get(i)[s] =
+          -(decomposition.h_0_v + decomposition.h_thin_v * d_thin +
+            decomposition.h_thick_v * d_thick) *
+              v_m.get(i)[s] -
+          (decomposition.h_0_f + decomposition.h_thin_f * d_thin +
+           decomposition.h_thick_f * d_thick) *
+              momentum_density.get(i)[s];
+      for (size_t j = i; j < spatial_dim; j++) {
+        // Optically thin part of pressure tensor
+        pressure_tensor->get(i, j)[s] = d_thin * e_pt *
+                                        momentum_density.get(i)[s] *
+                                        momentum_density.get(j)[s] / s_sqr_pt;
       }
-      // Optically thick limit
-      for (size_t i = 0; i < spatial_dim; i++) {
-        H_M.get(i) =
-            s_M.get(i)[s] / w_pt +
-            fluid_velocity.get(i)[s] * w_pt / (2. * w_sqr_pt + 1.) *
-                ((4. * w_sqr_pt + 1.) * v_dot_f_pt - 4. * w_sqr_pt * e_pt);
-      }
-      const double J_over_3 =
-          1. / (2. * w_sqr_pt + 1.) *
-          ((2. * w_sqr_pt - 1.) * e_pt - 2. * w_sqr_pt * v_dot_f_pt);
-      for (size_t i = 0; i < spatial_dim; i++) {
-        for (size_t j = i; j < spatial_dim; j++) {
-          pressure_tensor->get(i, j) +=
-              d_thick * (J_over_3 * (4. * w_sqr_pt * fluid_velocity.get(i)[s] *
-                                         fluid_velocity.get(j)[s] +
-                                     inv_spatial_metric.get(i, j)[s]) +
-                         w_pt * (H_M.get(i) * fluid_velocity.get(j)[s] +
-                                 H_M.get(j) * fluid_velocity.get(i)[s]));
-        }
+    }
+    // Optically thick limit
+    for (size_t i = 0; i < spatial_dim; i++) {
+      H_M.get(i) =
+          s_M.get(i)[s] / w_pt +
+          fluid_velocity.get(i)[s] * w_pt / (2. * w_sqr_pt + 1.) *
+              ((4. * w_sqr_pt + 1.) * v_dot_f_pt - 4. * w_sqr_pt * e_pt);
+    }
+    const double J_over_3 =
+        1. / (2. * w_sqr_pt + 1.) *
+        ((2. * w_sqr_pt - 1.) * e_pt - 2. * w_sqr_pt * v_dot_f_pt);
+    for (size_t i = 0; i < spatial_dim; i++) {
+      for (size_t j = i; j < spatial_dim; j++) {
+        pressure_tensor->get(i, j)[s] +=
+            d_thick * (J_over_3 * (4. * w_sqr_pt * fluid_velocity.get(i)[s] *
+                                       fluid_velocity.get(j)[s] +
+                                   inv_spatial_metric.get(i, j)[s]) +
+                       w_pt * (H_M.get(i) * fluid_velocity.get(j)[s] +
+                               H_M.get(j) * fluid_velocity.get(i)[s]));
       }
     }
   }
@@ -23,7 +23,9 @@ namespace RadiationTransport {
 namespace M1Grey {
 
 // Implementation of the M1 closure for an
-// individual species
+// individual species. The closure equation is solved for all points that need
+// a root find at once, using SIMD batches of points if `use_simd_root_find`
+// is true and one point at a time otherwise.
 namespace detail {
 void compute_closure_impl(
     gsl::not_null<Scalar<DataVector>*> closure_factor,
@@ -37,7 +39,8 @@ void compute_closure_impl(
     const tnsr::I<DataVector, 3, Frame::Inertial>& fluid_velocity,
     const Scalar<DataVector>& fluid_lorentz_factor,
     const tnsr::ii<DataVector, 3, Frame::Inertial>& spatial_metric,
-    const tnsr::II<DataVector, 3, Frame::Inertial>& inv_spatial_metric);
+    const tnsr::II<DataVector, 3, Frame::Inertial>& inv_spatial_metric,
+    bool use_simd_root_find = true);
 }  // namespace detail
 
 template <typename NeutrinoSpeciesList>
@@ -100,9 +103,12 @@ struct ComputeM1Closure;
  * \f}
  * for a given \f$\xi\f$ only requires recomputing \f$d_{\rm thin,thick}\f$
  * and their derivatives with respect to \f$\xi\f$.
- * We perform the root-finding using a Newton-Raphson algorithm, with the
- * accuracy set by the variable root_find_number_of_digits (6 significant digits
- * at the moment).
+ * We perform the root-finding using the TOMS748 algorithm, with an absolute
+ * accuracy of \f$10^{-6}\f$ in \f$\xi\f$. The points that need a root find
+ * are collected first and solved together, several points at a time on SIMD
+ * lanes. The root is first bracketed in a small interval around the value of
+ * \f$\xi\f$ passed in through the closure factor, i.e. the value from the
+ * previous call, and only in \f$[0, 1]\f$ if that fails.
  *
  * The function returns the closure factors \f$\xi\f$ (to be used as initial
  * guess for this function at the next step), the pressure tensor \f$P_{ij}\f$,
@@ -0,0 +1,131 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wredundant-decls"
+#include <benchmark/benchmark.h>
+#pragma GCC diagnostic pop
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Index.hpp"
+#include "Domain/Structure/Direction.hpp"
+#include "Domain/Structure/DirectionMap.hpp"
+#include "NumericalAlgorithms/FiniteDifference/MonotonicityPreserving5.hpp"
+#include "NumericalAlgorithms/FiniteDifference/MonotonisedCentral.hpp"
+#include "NumericalAlgorithms/FiniteDifference/PositivityPreservingAdaptiveOrder.hpp"
+#include "NumericalAlgorithms/FiniteDifference/Wcns5z.hpp"
+#include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace {
+// In this anonymous namespace is a microbenchmark of the finite-difference
+// reconstruction of a set of variables on a 3d subcell mesh, as done for the
+// primitive variables of a GRMHD evolution. The benchmark argument is the
+// number of cells in each dimension, and the rate of reconstructed values
+// (cells times variables) is reported.
+
+struct BenchWcns5z {
+  static constexpr size_t ghost_zone_size = 3;
+  static void apply(
+      const gsl::not_null<std::array<gsl::span<double>, 3>*> upper,
+      const gsl::not_null<std::array<gsl::span<double>, 3>*> lower,
+      const gsl::span<const double>& volume_vars,
+      const DirectionMap<3, gsl::span<const double>>& ghost_cell_vars,
+      const Index<3>& volume_extents, const size_t number_of_variables) {
+    fd::reconstruction::wcns5z<2, void>(upper, lower, volume_vars,
+                                        ghost_cell_vars, volume_extents,
+                                        number_of_variables, 2.0e-16, 0);
+  }
+};
+
+struct BenchMonotonicityPreserving5 {
+  static constexpr size_t ghost_zone_size = 3;
+  static void apply(
+      const gsl::not_null<std::array<gsl::span<double>, 3>*> upper,
+      const gsl::not_null<std::array<gsl::span<double>, 3>*> lower,
+      const gsl::span<const double>& volume_vars,
+      const DirectionMap<3, gsl::span<const double>>& ghost_cell_vars,
+      const Index<3>& volume_extents, const size_t number_of_variables) {
+    fd::reconstruction::monotonicity_preserving_5(
+        upper, lower, volume_vars, ghost_cell_vars, volume_extents,
+        number_of_variables, 4.0, 1.0e-10);
+  }
+};
+
+struct BenchPositivityPreservingAdaptiveOrder {
+  static constexpr size_t ghost_zone_size = 5;
+  static void apply(
+      const gsl::not_null<std::array<gsl::span<double>, 3>*> upper,
+      const gsl::not_null<std::array<gsl::span<double>, 3>*> lower,
+      const gsl::span<const double>& volume_vars,
+      const DirectionMap<3, gsl::span<const double>>& ghost_cell_vars,
+      const Index<3>& volume_extents, const size_t number_of_variables) {
+    fd::reconstruction::positivity_preserving_adaptive_order<
+        fd::reconstruction::detail::MonotonisedCentralReconstructor, true,
+        true, true>(upper, lower, volume_vars, ghost_cell_vars, volume_extents,
+                    number_of_variables, pow(4.0, 4.0), pow(6.0, 4.0),
+                    pow(8.0, 4.0));
+  }
+};
+
+// clang-tidy: don't pass be non-const reference
+template <typename Scheme>
+void bench_fd_reconstruction(benchmark::State& state) {  // NOLINT
+  const auto cells_1d = static_cast<size_t>(state.range(0));
+  const size_t number_of_variables = 8;
+  const Index<3> volume_extents{cells_1d};
+  const size_t number_of_cells = volume_extents.product();
+  const size_t ghost_size =
+      Scheme::ghost_zone_size * square(cells_1d) * number_of_variables;
+  const size_t face_size =
+      (cells_1d + 1) * square(cells_1d) * number_of_variables;
+
+  // Smooth, positive data so that the high-order stencils are used
+  DataVector volume_vars(number_of_cells * number_of_variables);
+  for (size_t i = 0; i < volume_vars.size(); ++i) {
+    volume_vars[i] =
+        2.0 + sin(0.1 * static_cast<double>(i % number_of_cells) +
+                  0.3 * static_cast<double>(i / number_of_cells));
+  }
+  DataVector ghost_data(2 * 3 * ghost_size, 2.0);
+  DirectionMap<3, gsl::span<const double>> ghost_cell_vars{};
+  size_t ghost_offset = 0;
+  for (const auto& direction : Direction<3>::all_directions()) {
+    ghost_cell_vars[direction] =
+        gsl::make_span(ghost_data.data() + ghost_offset, ghost_size);
+    ghost_offset += ghost_size;
+  }
+  DataVector face_data(2 * 3 * face_size);
+  std::array<gsl::span<double>, 3> upper{};
+  std::array<gsl::span<double>, 3> lower{};
+  for (size_t d = 0; d < 3; ++d) {
+    gsl::at(upper, d) =
+        gsl::make_span(face_data.data() + 2 * d * face_size, face_size);
+    gsl::at(lower, d) =
+        gsl::make_span(face_data.data() + (2 * d + 1) * face_size, face_size);
+  }
+
+  while (state.KeepRunning()) {
+    Scheme::apply(make_not_null(&upper), make_not_null(&lower),
+                  gsl::make_span(volume_vars.data(), volume_vars.size()),
+                  ghost_cell_vars, volume_extents, number_of_variables);
+    benchmark::DoNotOptimize(face_data.data());
+  }
+  state.SetItemsProcessed(
+      state.iterations() *
+      static_cast<int64_t>(number_of_cells * number_of_variables));
+}
+// NOLINTNEXTLINE
+BENCHMARK_TEMPLATE(bench_fd_reconstruction, BenchWcns5z)->DenseRange(8, 16, 4);
+// NOLINTNEXTLINE
+BENCHMARK_TEMPLATE(bench_fd_reconstruction, BenchMonotonicityPreserving5)
+    ->DenseRange(8, 16, 4);
+// NOLINTNEXTLINE
+BENCHMARK_TEMPLATE(bench_fd_reconstruction,
+                   BenchPositivityPreservingAdaptiveOrder)
+    ->DenseRange(8, 16, 4);
+}  // namespace
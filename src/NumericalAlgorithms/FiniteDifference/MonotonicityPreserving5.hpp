@@ -6,6 +6,7 @@
 #include <array>
 #include <cmath>
 #include <cstddef>
+#include <optional>
 
 #include "NumericalAlgorithms/FiniteDifference/Reconstruct.hpp"
 #include "NumericalAlgorithms/FiniteDifference/Unlimited.hpp"
@@ -14,6 +15,7 @@
 #include "Utilities/ForceInline.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/Math.hpp"
+#include "Utilities/Simd/Simd.hpp"
 
 /// \cond
 class DataVector;
@@ -102,6 +104,33 @@ struct MonotonicityPreserving5Reconstructor {
     return result;
   }
 
+  template <typename T>
+  SPECTRE_ALWAYS_INLINE static std::optional<std::array<T, 2>> batch_pointwise(
+      const double* const q_ptr, const int stride, const double alpha,
+      const double epsilon) {
+    const BatchStencil<T> q{q_ptr};
+    // same as `minmod2` in `pointwise`, written without the sign function
+    const auto minmod2 = [](const T& x, const T& y) {
+      return simd::select(
+          x > 0.0 and y > 0.0, simd::min(x, y),
+          simd::select(x < 0.0 and y < 0.0, simd::max(x, y), T(0.0)));
+    };
+
+    const auto result = UnlimitedReconstructor<4>::pointwise_impl(q, stride);
+    const T q_0 = q[0];
+    const T q_plus = q[stride];
+    const T q_minus = q[-stride];
+    const T q_mp_plus = q_0 + minmod2(q_plus - q_0, alpha * (q_0 - q_minus));
+    const T q_mp_minus = q_0 + minmod2(q_minus - q_0, alpha * (q_0 - q_plus));
+
+    // the limiter is applied cell by cell
+    if (simd::any(((result[1] - q_0) * (result[1] - q_mp_plus) > epsilon) or
+                  ((result[0] - q_0) * (result[0] - q_mp_minus) > epsilon))) {
+      return std::nullopt;
+    }
+    return result;
+  }
+
   SPECTRE_ALWAYS_INLINE static constexpr size_t stencil_width() { return 5; }
 };
 }  // namespace detail
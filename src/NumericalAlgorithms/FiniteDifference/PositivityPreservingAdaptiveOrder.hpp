@@ -17,6 +17,7 @@
 #include "Utilities/ForceInline.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/Math.hpp"
+#include "Utilities/Simd/Simd.hpp"
 #include "Utilities/TMPL.hpp"
 
 /// \cond
@@ -49,65 +50,7 @@ struct PositivityPreservingAdaptiveOrderReconstructor {
 
       if (not PositivityPreserving or LIKELY(get<0>(order_9_result) > 0.0 and
                                              get<1>(order_9_result) > 0.0)) {
-        const double order_9_norm_of_top_modal_coefficient = square(
-            -1.593380762005595 * u[stride] +
-            0.7966903810027975 * u[2 * stride] -
-            0.22762582314365648 * u[3 * stride] +
-            0.02845322789295706 * u[4 * stride] -
-            1.593380762005595 * u[-stride] +
-            0.7966903810027975 * u[-2 * stride] -
-            0.22762582314365648 * u[-3 * stride] +
-            0.02845322789295706 * u[-4 * stride] + 1.991725952506994 * u[0]);
-
-        const double order_9_norm_of_polynomial =
-            u[stride] * (25.393963433621668 * u[stride] -
-                         31.738453392103736 * u[2 * stride] +
-                         14.315575523531798 * u[3 * stride] -
-                         5.422933317103013 * u[4 * stride] +
-                         45.309550145164756 * u[-stride] -
-                         25.682667845756164 * u[-2 * stride] +
-                         10.394184200706238 * u[-3 * stride] -
-                         3.5773996341558414 * u[-4 * stride] -
-                         56.63693768145594 * u[0]) +
-            u[2 * stride] * (10.664627625179254 * u[2 * stride] -
-                             9.781510753231265 * u[3 * stride] +
-                             3.783820939683476 * u[4 * stride] -
-                             25.682667845756164 * u[-stride] +
-                             13.59830711617153 * u[-2 * stride] -
-                             5.064486634342602 * u[-3 * stride] +
-                             1.5850428636128617 * u[-4 * stride] +
-                             33.99576779042882 * u[0]) +
-            u[3 * stride] * (2.5801312593878514 * u[3 * stride] -
-                             1.812843724346584 * u[4 * stride] +
-                             10.394184200706238 * u[-stride] -
-                             5.064486634342602 * u[-2 * stride] +
-                             1.6716163773782988 * u[-3 * stride] -
-                             0.4380794296257583 * u[-4 * stride] -
-                             14.626643302060115 * u[0]) +
-            u[4 * stride] * (0.5249097623867759 * u[4 * stride] -
-                             3.5773996341558414 * u[-stride] +
-                             1.5850428636128617 * u[-2 * stride] -
-                             0.4380794296257583 * u[-3 * stride] +
-                             0.07624062080823268 * u[-4 * stride] +
-                             5.336843456576288 * u[0]) +
-            u[-stride] * (25.393963433621668 * u[-stride] -
-                          31.738453392103736 * u[-2 * stride] +
-                          14.315575523531798 * u[-3 * stride] -
-                          5.422933317103013 * u[-4 * stride] -
-                          56.63693768145594 * u[0]) +
-            u[-2 * stride] * (10.664627625179254 * u[-2 * stride] -
-                              9.781510753231265 * u[-3 * stride] +
-                              3.783820939683476 * u[-4 * stride] +
-                              33.99576779042882 * u[0]) +
-            u[-3 * stride] * (2.5801312593878514 * u[-3 * stride] -
-                              1.812843724346584 * u[-4 * stride] -
-                              14.626643302060115 * u[0]) +
-            u[-4 * stride] * (0.5249097623867759 * u[-4 * stride] +
-                              5.336843456576288 * u[0]) +
-            33.758463458609164 * square(u[0]);
-        if (square(eight_to_the_alpha_9) *
-                order_9_norm_of_top_modal_coefficient <=
-            order_9_norm_of_polynomial) {
+        if (order_9_is_smooth(u, stride, eight_to_the_alpha_9)) {
           return order_9_result;
         }
       }
@@ -120,47 +63,7 @@ struct PositivityPreservingAdaptiveOrderReconstructor {
 
       if (not PositivityPreserving or LIKELY(get<0>(order_7_result) > 0.0 and
                                              get<1>(order_7_result) > 0.0)) {
-        const double order_7_norm_of_top_modal_coefficient =
-            square(0.06936287633138594 * u[-3 * stride] -
-                   0.4161772579883155 * u[-2 * stride] +
-                   1.040443144970789 * u[-stride] -  //
-                   1.3872575266277185 * u[0] +       //
-                   1.040443144970789 * u[stride] -
-                   0.4161772579883155 * u[2 * stride] +  //
-                   0.06936287633138594 * u[3 * stride]);
-
-        const double order_7_norm_of_polynomial =
-            u[stride] * (3.93094886671763 * u[stride] -
-                         4.4887583031366605 * u[2 * stride] +
-                         2.126671427664419 * u[3 * stride] +
-                         6.081742742499426 * u[-stride] -
-                         3.1180508323787337 * u[-2 * stride] +
-                         1.2660604719155235 * u[-3 * stride] -
-                         8.108990323332568 * u[0]) +
-            u[2 * stride] * (1.7504056695205172 * u[2 * stride] -
-                             1.402086588589091 * u[3 * stride] -
-                             3.1180508323787337 * u[-stride] +
-                             1.384291080027286 * u[-2 * stride] -
-                             0.46498946172145633 * u[-3 * stride] +
-                             4.614303600090953 * u[0]) +
-            u[3 * stride] * (0.5786954880513824 * u[3 * stride] +
-                             1.2660604719155235 * u[-stride] -
-                             0.46498946172145633 * u[-2 * stride] +
-                             0.10352871936656591 * u[-3 * stride] -
-                             2.0705743873313183 * u[0]) +
-            u[-stride] * (3.93094886671763 * u[-stride] -
-                          4.4887583031366605 * u[-2 * stride] +
-                          2.126671427664419 * u[-3 * stride] -
-                          8.108990323332568 * u[0]) +
-            u[-2 * stride] * (1.7504056695205172 * u[-2 * stride] -
-                              1.402086588589091 * u[-3 * stride] +
-                              4.614303600090953 * u[0]) +
-            u[-3 * stride] * (0.5786954880513824 * u[-3 * stride] -
-                              2.0705743873313183 * u[0]) +
-            5.203166203165525 * square(u[0]);
-        if (square(six_to_the_alpha_7) *
-                order_7_norm_of_top_modal_coefficient <=
-            order_7_norm_of_polynomial) {
+        if (order_7_is_smooth(u, stride, six_to_the_alpha_7)) {
           return order_7_result;
         }
       }
@@ -171,42 +74,7 @@ struct PositivityPreservingAdaptiveOrderReconstructor {
     if (not PositivityPreserving or
         LIKELY(get<0>(order_5_result) > 0.0 and get<1>(order_5_result) > 0.0)) {
       // The Persson sensor is 4^alpha L2(\hat{u}) <= L2(u)
-      const double order_5_norm_of_top_modal_coefficient =
-          0.2222222222222222 * square(-1.4880952380952381 * u[stride] +
-                                      0.37202380952380953 * u[2 * stride] -
-                                      1.4880952380952381 * u[-stride] +
-                                      0.37202380952380953 * u[-2 * stride] +
-                                      2.232142857142857 * u[0]);
-
-      // Potential optimization: Simple approximation to the integral since we
-      // only really need about 1 digit of accuracy. This does eliminate aliases
-      // and so, while reducing the number of FLOPs, might not be accurate
-      // enough in the cases we're interested in.
-      //
-      // const double order_5_norm_of_polynomial =
-      //     1.1935763888888888 * square(u[-2 * stride]) +
-      //     0.4340277777777778 * square(u[-stride]) +
-      //     1.7447916666666667 * square(u[0]) +
-      //     0.4340277777777778 * square(u[stride]) +
-      //     1.1935763888888888 * square(u[2 * stride]);
-      const double order_5_norm_of_polynomial =
-          (u[stride] * (1.179711612654321 * u[stride] -
-                        0.963946414792769 * u[2 * stride] +
-                        1.0904086750440918 * u[-stride] -
-                        0.5030502507716049 * u[-2 * stride] -
-                        1.6356130125661377 * u[0]) +
-           u[2 * stride] *
-               (0.6699388830329586 * u[2 * stride] -
-                0.5030502507716049 * u[-stride] +
-                0.154568572944224 * u[-2 * stride] + 0.927411437665344 * u[0]) +
-           u[-stride] * (1.179711612654321 * u[-stride] -
-                         0.963946414792769 * u[-2 * stride] -
-                         1.6356130125661377 * u[0]) +
-           u[-2 * stride] * (0.6699388830329586 * u[-2 * stride] +
-                             0.927411437665344 * u[0]) +
-           1.4061182415674602 * square(u[0]));
-      if (square(four_to_the_alpha_5) * order_5_norm_of_top_modal_coefficient <=
-          order_5_norm_of_polynomial) {
+      if (order_5_is_smooth(u, stride, four_to_the_alpha_5)) {
         return order_5_result;
       }
     }
@@ -221,9 +89,199 @@ struct PositivityPreservingAdaptiveOrderReconstructor {
     return {u[0], u[0], 1};
   }
 
+  template <typename T>
+  SPECTRE_ALWAYS_INLINE static std::optional<std::array<T, 2>> batch_pointwise(
+      const double* const u, const int stride, const double four_to_the_alpha_5,
+      [[maybe_unused]] const double six_to_the_alpha_7,
+      [[maybe_unused]] const double eight_to_the_alpha_9) {
+    // Only the highest order is tried for the whole batch. If any of the cells
+    // needs a lower order they are all reconstructed with `pointwise`.
+    const BatchStencil<T> stencil{u};
+    const auto is_accepted = [](const std::array<T, 2>& result,
+                                const auto& is_smooth) {
+      if constexpr (PositivityPreserving) {
+        return simd::all(result[0] > 0.0 and result[1] > 0.0 and is_smooth);
+      } else {
+        return simd::all(is_smooth);
+      }
+    };
+    std::array<T, 2> result{};
+    bool accepted = false;
+    if constexpr (Use9thOrder) {
+      result = UnlimitedReconstructor<8>::pointwise_impl(stencil, stride);
+      accepted = is_accepted(
+          result, order_9_is_smooth(stencil, stride, eight_to_the_alpha_9));
+    } else if constexpr (Use7thOrder) {
+      result = UnlimitedReconstructor<6>::pointwise_impl(stencil, stride);
+      accepted = is_accepted(
+          result, order_7_is_smooth(stencil, stride, six_to_the_alpha_7));
+    } else {
+      result = UnlimitedReconstructor<4>::pointwise_impl(stencil, stride);
+      accepted = is_accepted(
+          result, order_5_is_smooth(stencil, stride, four_to_the_alpha_5));
+    }
+    if (accepted) {
+      return result;
+    }
+    return std::nullopt;
+  }
+
   SPECTRE_ALWAYS_INLINE static constexpr size_t stencil_width() {
     return Use9thOrder ? 9 : (Use7thOrder ? 7 : 5);
   }
+
+ private:
+  template <typename Stencil>
+  SPECTRE_ALWAYS_INLINE static auto order_9_is_smooth(
+      const Stencil& u, const int stride, const double eight_to_the_alpha_9) {
+    const auto order_9_norm_of_top_modal_coefficient = square(
+        -1.593380762005595 * u[stride] +
+        0.7966903810027975 * u[2 * stride] -
+        0.22762582314365648 * u[3 * stride] +
+        0.02845322789295706 * u[4 * stride] -
+        1.593380762005595 * u[-stride] +
+        0.7966903810027975 * u[-2 * stride] -
+        0.22762582314365648 * u[-3 * stride] +
+        0.02845322789295706 * u[-4 * stride] + 1.991725952506994 * u[0]);
+
+    const auto order_9_norm_of_polynomial =
+        u[stride] * (25.393963433621668 * u[stride] -
+                     31.738453392103736 * u[2 * stride] +
+                     14.315575523531798 * u[3 * stride] -
+                     5.422933317103013 * u[4 * stride] +
+                     45.309550145164756 * u[-stride] -
+                     25.682667845756164 * u[-2 * stride] +
+                     10.394184200706238 * u[-3 * stride] -
+                     3.5773996341558414 * u[-4 * stride] -
+                     56.63693768145594 * u[0]) +
+        u[2 * stride] * (10.664627625179254 * u[2 * stride] -
+                         9.781510753231265 * u[3 * stride] +
+                         3.783820939683476 * u[4 * stride] -
+                         25.682667845756164 * u[-stride] +
+                         13.59830711617153 * u[-2 * stride] -
+                         5.064486634342602 * u[-3 * stride] +
+                         1.5850428636128617 * u[-4 * stride] +
+                         33.99576779042882 * u[0]) +
+        u[3 * stride] * (2.5801312593878514 * u[3 * stride] -
+                         1.812843724346584 * u[4 * stride] +
+                         10.394184200706238 * u[-stride] -
+                         5.064486634342602 * u[-2 * stride] +
+                         1.6716163773782988 * u[-3 * stride] -
+                         0.4380794296257583 * u[-4 * stride] -
+                         14.626643302060115 * u[0]) +
+        u[4 * stride] * (0.5249097623867759 * u[4 * stride] -
+                         3.5773996341558414 * u[-stride] +
+                         1.5850428636128617 * u[-2 * stride] -
+                         0.4380794296257583 * u[-3 * stride] +
+                         0.07624062080823268 * u[-4 * stride] +
+                         5.336843456576288 * u[0]) +
+        u[-stride] * (25.393963433621668 * u[-stride] -
+                      31.738453392103736 * u[-2 * stride] +
+                      14.315575523531798 * u[-3 * stride] -
+                      5.422933317103013 * u[-4 * stride] -
+                      56.63693768145594 * u[0]) +
+        u[-2 * stride] * (10.664627625179254 * u[-2 * stride] -
+                          9.781510753231265 * u[-3 * stride] +
+                          3.783820939683476 * u[-4 * stride] +
+                          33.99576779042882 * u[0]) +
+        u[-3 * stride] * (2.5801312593878514 * u[-3 * stride] -
+                          1.812843724346584 * u[-4 * stride] -
+                          14.626643302060115 * u[0]) +
+        u[-4 * stride] * (0.5249097623867759 * u[-4 * stride] +
+                          5.336843456576288 * u[0]) +
+        33.758463458609164 * square(u[0]);
+    return square(eight_to_the_alpha_9) *
+               order_9_norm_of_top_modal_coefficient <=
+           order_9_norm_of_polynomial;
+  }
+
+  template <typename Stencil>
+  SPECTRE_ALWAYS_INLINE static auto order_7_is_smooth(
+      const Stencil& u, const int stride, const double six_to_the_alpha_7) {
+    const auto order_7_norm_of_top_modal_coefficient =
+        square(0.06936287633138594 * u[-3 * stride] -
+               0.4161772579883155 * u[-2 * stride] +
+               1.040443144970789 * u[-stride] -  //
+               1.3872575266277185 * u[0] +       //
+               1.040443144970789 * u[stride] -
+               0.4161772579883155 * u[2 * stride] +  //
+               0.06936287633138594 * u[3 * stride]);
+
+    const auto order_7_norm_of_polynomial =
+        u[stride] * (3.93094886671763 * u[stride] -
+                     4.4887583031366605 * u[2 * stride] +
+                     2.126671427664419 * u[3 * stride] +
+                     6.081742742499426 * u[-stride] -
+                     3.1180508323787337 * u[-2 * stride] +
+                     1.2660604719155235 * u[-3 * stride] -
+                     8.108990323332568 * u[0]) +
+        u[2 * stride] * (1.7504056695205172 * u[2 * stride] -
+                         1.402086588589091 * u[3 * stride] -
+                         3.1180508323787337 * u[-stride] +
+                         1.384291080027286 * u[-2 * stride] -
+                         0.46498946172145633 * u[-3 * stride] +
+                         4.614303600090953 * u[0]) +
+        u[3 * stride] * (0.5786954880513824 * u[3 * stride] +
+                         1.2660604719155235 * u[-stride] -
+                         0.46498946172145633 * u[-2 * stride] +
+                         0.10352871936656591 * u[-3 * stride] -
+                         2.0705743873313183 * u[0]) +
+        u[-stride] * (3.93094886671763 * u[-stride] -
+                      4.4887583031366605 * u[-2 * stride] +
+                      2.126671427664419 * u[-3 * stride] -
+                      8.108990323332568 * u[0]) +
+        u[-2 * stride] * (1.7504056695205172 * u[-2 * stride] -
+                          1.402086588589091 * u[-3 * stride] +
+                          4.614303600090953 * u[0]) +
+        u[-3 * stride] * (0.5786954880513824 * u[-3 * stride] -
+                          2.0705743873313183 * u[0]) +
+        5.203166203165525 * square(u[0]);
+    return square(six_to_the_alpha_7) *
+               order_7_norm_of_top_modal_coefficient <=
+           order_7_norm_of_polynomial;
+  }
+
+  template <typename Stencil>
+  SPECTRE_ALWAYS_INLINE static auto order_5_is_smooth(
+      const Stencil& u, const int stride, const double four_to_the_alpha_5) {
+    const auto order_5_norm_of_top_modal_coefficient =
+        0.2222222222222222 * square(-1.4880952380952381 * u[stride] +
+                                    0.37202380952380953 * u[2 * stride] -
+                                    1.4880952380952381 * u[-stride] +
+                                    0.37202380952380953 * u[-2 * stride] +
+                                    2.232142857142857 * u[0]);
+
+    // Potential optimization: Simple approximation to the integral since we
+    // only really need about 1 digit of accuracy. This does eliminate aliases
+    // and so, while reducing the number of FLOPs, might not be accurate
+    // enough in the cases we're interested in.
+    //
+    // const double order_5_norm_of_polynomial =
+    //     1.1935763888888888 * square(u[-2 * stride]) +
+    //     0.4340277777777778 * square(u[-stride]) +
+    //     1.7447916666666667 * square(u[0]) +
+    //     0.4340277777777778 * square(u[stride]) +
+    //     1.1935763888888888 * square(u[2 * stride]);
+    const auto order_5_norm_of_polynomial =
+        (u[stride] * (1.179711612654321 * u[stride] -
+                      0.963946414792769 * u[2 * stride] +
+                      1.0904086750440918 * u[-stride] -
+                      0.5030502507716049 * u[-2 * stride] -
+                      1.6356130125661377 * u[0]) +
+         u[2 * stride] *
+             (0.6699388830329586 * u[2 * stride] -
+              0.5030502507716049 * u[-stride] +
+              0.154568572944224 * u[-2 * stride] + 0.927411437665344 * u[0]) +
+         u[-stride] * (1.179711612654321 * u[-stride] -
+                       0.963946414792769 * u[-2 * stride] -
+                       1.6356130125661377 * u[0]) +
+         u[-2 * stride] * (0.6699388830329586 * u[-2 * stride] +
+                           0.927411437665344 * u[0]) +
+         1.4061182415674602 * square(u[0]));
+    return square(four_to_the_alpha_5) *
+               order_5_norm_of_top_modal_coefficient <=
+           order_5_norm_of_polynomial;
+  }
 };
 }  // namespace detail
 
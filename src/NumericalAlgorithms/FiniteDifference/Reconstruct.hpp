@@ -5,10 +5,13 @@
 
 #include <array>
 #include <cstddef>
+#include <type_traits>
 #include <utility>  // for std::pair
 
 #include "Domain/Structure/Side.hpp"
+#include "Utilities/ForceInline.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/Simd/Simd.hpp"
 
 /// \cond
 class DataVector;
@@ -68,6 +71,23 @@ namespace fd {
  *   \f$u_{i-1}\f$ is at `u[-stride]`. The returned values are the
  *   reconstructed solution on the lower and upper side of the cell.
  *
+ * `Reconstructor` classes may additionally define a
+ * \code
+ *    template <typename T>
+ *    SPECTRE_ALWAYS_INLINE static std::optional<std::array<T, 2>>
+ *    batch_pointwise(const double* const u, const int stride)
+ * \endcode
+ * function, again optionally taking the additional arguments, that
+ * reconstructs the `simd::size<T>()` consecutive cells starting at `u[0]` at
+ * once. It returns `std::nullopt` if any of the cells must instead be
+ * reconstructed one at a time with `pointwise`, e.g. because a limiter is
+ * active. When built with SIMD support, `reconstruct` uses this function for
+ * the cells away from the element boundaries. The stencils are most easily
+ * shared between the two functions by writing them in terms of a
+ * `fd::reconstruction::detail::BatchStencil`. The batched and pointwise
+ * results agree to roundoff but need not be bitwise identical, since the
+ * compiler may contract the operations into FMAs differently.
+ *
  * \note Currently the stride is always one because we transpose the data before
  * reconstruction. However, it may be faster to have a non-unit stride without
  * the transpose. We have the `stride` parameter in the reconstruction schemes
@@ -93,6 +113,41 @@ namespace fd {
  */
 namespace reconstruction {
 namespace detail {
+/// Indexes the stencils of `simd::size<T>()` consecutive cells at once, so that
+/// `BatchStencil<T>{u}[offset]` is the `T` analog of `u[offset]`.
+template <typename T>
+struct BatchStencil {
+  const double* u;
+
+  SPECTRE_ALWAYS_INLINE T operator[](const int offset) const {
+    return simd::load_unaligned(u + offset);
+  }
+};
+
+/// The type of the values of the stencil `Stencil`, which is either a
+/// `const double*` or a `BatchStencil`.
+template <typename Stencil>
+struct stencil_value {
+  using type = double;
+};
+
+template <typename T>
+struct stencil_value<BatchStencil<T>> {
+  using type = T;
+};
+
+template <typename Stencil>
+using stencil_value_t = typename stencil_value<Stencil>::type;
+
+template <typename Reconstructor, typename = std::void_t<>>
+struct has_batch_pointwise : std::false_type {};
+
+template <typename Reconstructor>
+struct has_batch_pointwise<
+    Reconstructor,
+    std::void_t<decltype(&Reconstructor::template batch_pointwise<double>)>>
+    : std::true_type {};
+
 template <typename Reconstructor, size_t Dim, typename... ArgsForReconstructor>
 void reconstruct(
     gsl::not_null<std::array<gsl::span<double>, Dim>*>
@@ -6,6 +6,7 @@
 #include "NumericalAlgorithms/FiniteDifference/Reconstruct.hpp"
 
 #include <cstddef>
+#include <optional>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Index.hpp"
@@ -16,9 +17,15 @@
 #include "Domain/Structure/Side.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/Simd/Simd.hpp"
+#include "Utilities/System/ThreadPool.hpp"
 
 namespace fd::reconstruction {
 namespace detail {
+// Number of reconstructed cells below which the stripes are reconstructed
+// serially.
+constexpr size_t minimum_size_for_threading = 16384;
+
 template <size_t Index, size_t DimToReplace, size_t... Is,
           size_t Dim = sizeof...(Is)>
 auto generate_index_for_u_to_reconstruct_impl(
@@ -103,7 +110,6 @@ void reconstruct_impl(
       volume_extents.slice_away(0).product();
   const size_t number_of_stripes =
       number_of_stripes_per_variable * number_of_variables;
-  [[maybe_unused]] size_t recons_order_slice_offset = 0;
   if constexpr (ReturnReconstructionOrder) {
     ASSERT(reconstruction_order->size() ==
                (number_of_stripes_per_variable * (volume_extents[0] + 2)),
@@ -113,153 +119,197 @@ void reconstruct_impl(
                << reconstruction_order->size());
   }
 
-  std::array<double, stencil_width> q{};
-  for (size_t slice = 0; slice < number_of_stripes; ++slice) {
-    const size_t vars_slice_offset = slice * volume_extents[0];
-    const size_t vars_neighbor_slice_offset =
-        slice * ghost_pts_in_neighbor_data;
-    const size_t recons_slice_offset = (volume_extents[0] + 1) * slice;
-    // We use volume_extents + 2 because we need the order of the left and
-    // right cells for adjusting the correction at the interface. This means
-    // we include one neighbor on the upper and lower side.
-    recons_order_slice_offset =
-        slice % number_of_stripes_per_variable == 0
-            ? 0
-            : (recons_order_slice_offset + volume_extents[0] + 2);
-    [[maybe_unused]] size_t recons_order_index = 0;
-    const auto set_recons_order = [&reconstruction_order, &recons_order_index,
-                                   recons_order_slice_offset](
-                                      const auto& upper_lower_and_order) {
-      if constexpr (ReturnReconstructionOrder and
-                    std::tuple_size<
-                        std::decay_t<decltype(upper_lower_and_order)>>::value >
-                        2) {
-        (*reconstruction_order)[recons_order_slice_offset +
-                                recons_order_index] =
-            min(static_cast<std::uint8_t>(get<2>(upper_lower_and_order)),
-                (*reconstruction_order)[recons_order_slice_offset +
-                                        recons_order_index]);
-        ++recons_order_index;
-      }
-    };
-
-    // Deal with lower ghost data.
-    //
-    // There's one extra reconstruction for the upper face of the neighbor
-    for (size_t j = 0; j < ghost_pts_in_neighbor_data; ++j) {
-      q[j] = lower_ghost_data[vars_neighbor_slice_offset + j];
-    }
-    for (size_t j = ghost_pts_in_neighbor_data, k = 0; j < stencil_width;
-         ++j, ++k) {
-      gsl::at(q, j) = volume_vars[vars_slice_offset + k];
-    }
-    {
-      const auto upper_lower_and_order = Reconstructor::pointwise(
-          q.data() + ghost_zone_for_stencil, 1, args_for_reconstructor...);
-      (*recons_lower)[recons_slice_offset] = get<1>(upper_lower_and_order);
-      set_recons_order(upper_lower_and_order);
-    }
-
-    for (size_t i = 0; i < ghost_zone_for_stencil; ++i) {
-      // offset comes from accounting for the 1 extra point in our ghost
-      // cells plus how far away from the boundary we are reconstructing.
-      for (size_t j = 0, offset = vars_neighbor_slice_offset +
-                                  ghost_pts_in_neighbor_data -
-                                  (ghost_zone_for_stencil - i);
-           j < ghost_zone_for_stencil - i; ++j) {
-        q[j] = lower_ghost_data[offset + j];
+  const auto reconstruct_stripes = [&](const size_t first_slice,
+                                       const size_t last_slice) {
+    std::array<double, stencil_width> q{};
+    for (size_t slice = first_slice; slice < last_slice; ++slice) {
+      const size_t vars_slice_offset = slice * volume_extents[0];
+      const size_t vars_neighbor_slice_offset =
+          slice * ghost_pts_in_neighbor_data;
+      const size_t recons_slice_offset = (volume_extents[0] + 1) * slice;
+      // We use volume_extents + 2 because we need the order of the left and
+      // right cells for adjusting the correction at the interface. This means
+      // we include one neighbor on the upper and lower side.
+      [[maybe_unused]] const size_t recons_order_slice_offset =
+          (slice % number_of_stripes_per_variable) * (volume_extents[0] + 2);
+      [[maybe_unused]] size_t recons_order_index = 0;
+      const auto set_recons_order =
+          [&reconstruction_order, &recons_order_index,
+           recons_order_slice_offset](const auto& upper_lower_and_order) {
+            if constexpr (ReturnReconstructionOrder and
+                          std::tuple_size<std::decay_t<
+                                  decltype(upper_lower_and_order)>>::value >
+                              2) {
+              (*reconstruction_order)[recons_order_slice_offset +
+                                      recons_order_index] =
+                  min(static_cast<std::uint8_t>(get<2>(upper_lower_and_order)),
+                      (*reconstruction_order)[recons_order_slice_offset +
+                                              recons_order_index]);
+              ++recons_order_index;
+            }
+          };
+
+      // Deal with lower ghost data.
+      //
+      // There's one extra reconstruction for the upper face of the neighbor
+      for (size_t j = 0; j < ghost_pts_in_neighbor_data; ++j) {
+        q[j] = lower_ghost_data[vars_neighbor_slice_offset + j];
       }
-      for (size_t j = ghost_zone_for_stencil - i, k = 0; j < stencil_width;
+      for (size_t j = ghost_pts_in_neighbor_data, k = 0; j < stencil_width;
            ++j, ++k) {
         gsl::at(q, j) = volume_vars[vars_slice_offset + k];
       }
-      const auto upper_lower_and_order = Reconstructor::pointwise(
-          q.data() + ghost_zone_for_stencil, 1, args_for_reconstructor...);
-      (*recons_upper)[recons_slice_offset + i] = get<0>(upper_lower_and_order);
-      (*recons_lower)[recons_slice_offset + 1 + i] =
-          get<1>(upper_lower_and_order);
-      set_recons_order(upper_lower_and_order);
-    }
+      {
+        const auto upper_lower_and_order = Reconstructor::pointwise(
+            q.data() + ghost_zone_for_stencil, 1, args_for_reconstructor...);
+        (*recons_lower)[recons_slice_offset] = get<1>(upper_lower_and_order);
+        set_recons_order(upper_lower_and_order);
+      }
+
+      for (size_t i = 0; i < ghost_zone_for_stencil; ++i) {
+        // offset comes from accounting for the 1 extra point in our ghost
+        // cells plus how far away from the boundary we are reconstructing.
+        for (size_t j = 0, offset = vars_neighbor_slice_offset +
+                                    ghost_pts_in_neighbor_data -
+                                    (ghost_zone_for_stencil - i);
+             j < ghost_zone_for_stencil - i; ++j) {
+          q[j] = lower_ghost_data[offset + j];
+        }
+        for (size_t j = ghost_zone_for_stencil - i, k = 0; j < stencil_width;
+             ++j, ++k) {
+          gsl::at(q, j) = volume_vars[vars_slice_offset + k];
+        }
+        const auto upper_lower_and_order = Reconstructor::pointwise(
+            q.data() + ghost_zone_for_stencil, 1, args_for_reconstructor...);
+        (*recons_upper)[recons_slice_offset + i] =
+            get<0>(upper_lower_and_order);
+        (*recons_lower)[recons_slice_offset + 1 + i] =
+            get<1>(upper_lower_and_order);
+        set_recons_order(upper_lower_and_order);
+      }
 
-    // Reconstruct in the bulk
-    const size_t slice_end = volume_extents[0] - ghost_zone_for_stencil;
-    for (size_t vars_index = vars_slice_offset + ghost_zone_for_stencil,
-                i = ghost_zone_for_stencil;
-         i < slice_end; ++vars_index, ++i) {
+      // Reconstruct in the bulk
+      //
       // Note: we keep the `stride` here because we may want to
       // experiment/support non-unit strides in the bulk in the future. For
       // cells where the reconstruction needs boundary data we copy into a
       // `std::array` buffer, which means we always have unit stride.
       constexpr int stride = 1;
-      const auto upper_lower_and_order = Reconstructor::pointwise(
-          &volume_vars[vars_index], stride, args_for_reconstructor...);
-      (*recons_upper)[recons_slice_offset + i] = get<0>(upper_lower_and_order);
-      (*recons_lower)[recons_slice_offset + 1 + i] =
-          get<1>(upper_lower_and_order);
-      set_recons_order(upper_lower_and_order);
-    }
+      const size_t slice_end = volume_extents[0] - ghost_zone_for_stencil;
+      const auto reconstruct_bulk_cell = [&](const size_t i) {
+        const auto upper_lower_and_order = Reconstructor::pointwise(
+            &volume_vars[vars_slice_offset + i], stride,
+            args_for_reconstructor...);
+        (*recons_upper)[recons_slice_offset + i] =
+            get<0>(upper_lower_and_order);
+        (*recons_lower)[recons_slice_offset + 1 + i] =
+            get<1>(upper_lower_and_order);
+        set_recons_order(upper_lower_and_order);
+      };
+      size_t i = ghost_zone_for_stencil;
+  #ifdef SPECTRE_USE_XSIMD
+      // The reconstruction order is tracked cell by cell, so batches are only
+      // used when it isn't requested.
+      if constexpr (not ReturnReconstructionOrder and
+                    has_batch_pointwise<Reconstructor>::value) {
+        using Batch = simd::batch<double>;
+        constexpr size_t batch_size = simd::size<Batch>();
+        for (; i + batch_size <= slice_end; i += batch_size) {
+          const auto upper_and_lower =
+              Reconstructor::template batch_pointwise<Batch>(
+                  &volume_vars[vars_slice_offset + i], stride,
+                  args_for_reconstructor...);
+          if (LIKELY(upper_and_lower.has_value())) {
+            simd::store_unaligned(&(*recons_upper)[recons_slice_offset + i],
+                                  get<0>(*upper_and_lower));
+            simd::store_unaligned(&(*recons_lower)[recons_slice_offset + 1 + i],
+                                  get<1>(*upper_and_lower));
+          } else {
+            for (size_t j = i; j < i + batch_size; ++j) {
+              reconstruct_bulk_cell(j);
+            }
+          }
+        }
+      }
+  #endif  // SPECTRE_USE_XSIMD
+      for (; i < slice_end; ++i) {
+        reconstruct_bulk_cell(i);
+      }
 
-    // Reconstruct using upper neighbor data
-    for (size_t i = 0; i < ghost_zone_for_stencil; ++i) {
-      // offset comes from accounting for the 1 extra point in our ghost
-      // cells plus how far away from the boundary we are reconstructing.
-      //
-      // Note:
-      // - q has size stencil_width
-      // - we need to copy over (stencil_width - 1 - i) from the volume
-      // - we need to copy (i + 1) from the neighbor
-      //
-      // Here is an example of a case with stencil_width 5:
-      //
-      //  Interior points| Neighbor points
-      // x x x x x x x x | o o o
-      //             ^
-      //         c c c c | c
-      //  c = points used for reconstruction
-
-      ASSERT(
-          volume_extents[0] >= stencil_width - 1,
-          " Subcell volume extent (current value: "
-              << volume_extents[0]
-              << ") must be not smaller than the stencil width (current value: "
-              << stencil_width << ") minus 1");
-
-      size_t j = 0;
-      for (size_t k =
-               vars_slice_offset + volume_extents[0] - (stencil_width - 1 - i);
-           j < stencil_width - 1 - i; ++j, ++k) {
-        gsl::at(q, j) = volume_vars[k];
+      // Reconstruct using upper neighbor data
+      for (size_t i = 0; i < ghost_zone_for_stencil; ++i) {
+        // offset comes from accounting for the 1 extra point in our ghost
+        // cells plus how far away from the boundary we are reconstructing.
+        //
+        // Note:
+        // - q has size stencil_width
+        // - we need to copy over (stencil_width - 1 - i) from the volume
+        // - we need to copy (i + 1) from the neighbor
+        //
+        // Here is an example of a case with stencil_width 5:
+        //
+        //  Interior points| Neighbor points
+        // x x x x x x x x | o o o
+        //             ^
+        //         c c c c | c
+        //  c = points used for reconstruction
+
+        ASSERT(
+            volume_extents[0] >= stencil_width - 1,
+            " Subcell volume extent (current value: "
+                << volume_extents[0]
+                << ") must be not smaller than the stencil width (current "
+                   "value: "
+                << stencil_width << ") minus 1");
+
+        size_t j = 0;
+        for (size_t k = vars_slice_offset + volume_extents[0] -
+                        (stencil_width - 1 - i);
+             j < stencil_width - 1 - i; ++j, ++k) {
+          gsl::at(q, j) = volume_vars[k];
+        }
+        for (size_t k = 0; j < stencil_width; ++j, ++k) {
+          gsl::at(q, j) = upper_ghost_data[vars_neighbor_slice_offset + k];
+        }
+
+        const auto upper_lower_and_order = Reconstructor::pointwise(
+            q.data() + ghost_zone_for_stencil, 1, args_for_reconstructor...);
+        (*recons_upper)[recons_slice_offset + slice_end + i] =
+            get<0>(upper_lower_and_order);
+        (*recons_lower)[recons_slice_offset + slice_end + i + 1] =
+            get<1>(upper_lower_and_order);
+        set_recons_order(upper_lower_and_order);
+      }
+
+      // Reconstruct the upper side of the last face, this is what the
+      // neighbor would've reconstructed.
+      for (size_t j = 0; j < ghost_zone_for_stencil; ++j) {
+        gsl::at(q, j) = volume_vars[vars_slice_offset + volume_extents[0] -
+                                    ghost_zone_for_stencil + j];
       }
-      for (size_t k = 0; j < stencil_width; ++j, ++k) {
+      for (size_t j = ghost_zone_for_stencil, k = 0; j < stencil_width;
+           ++j, ++k) {
         gsl::at(q, j) = upper_ghost_data[vars_neighbor_slice_offset + k];
       }
-
       const auto upper_lower_and_order = Reconstructor::pointwise(
           q.data() + ghost_zone_for_stencil, 1, args_for_reconstructor...);
-      (*recons_upper)[recons_slice_offset + slice_end + i] =
+      (*recons_upper)[recons_slice_offset + volume_extents[0]] =
           get<0>(upper_lower_and_order);
-      (*recons_lower)[recons_slice_offset + slice_end + i + 1] =
-          get<1>(upper_lower_and_order);
       set_recons_order(upper_lower_and_order);
-    }
 
-    // Reconstruct the upper side of the last face, this is what the
-    // neighbor would've reconstructed.
-    for (size_t j = 0; j < ghost_zone_for_stencil; ++j) {
-      gsl::at(q, j) = volume_vars[vars_slice_offset + volume_extents[0] -
-                                  ghost_zone_for_stencil + j];
-    }
-    for (size_t j = ghost_zone_for_stencil, k = 0; j < stencil_width;
-         ++j, ++k) {
-      gsl::at(q, j) = upper_ghost_data[vars_neighbor_slice_offset + k];
-    }
-    const auto upper_lower_and_order = Reconstructor::pointwise(
-        q.data() + ghost_zone_for_stencil, 1, args_for_reconstructor...);
-    (*recons_upper)[recons_slice_offset + volume_extents[0]] =
-        get<0>(upper_lower_and_order);
-    set_recons_order(upper_lower_and_order);
+    }  // for slices
+  };
 
-  }  // for slices
+  // Each stripe writes to its own part of the reconstructed data. The
+  // reconstruction order is shared between the variables, so it is only split
+  // among threads when it isn't requested.
+  auto& thread_pool = sys::node_thread_pool();
+  if (not ReturnReconstructionOrder and thread_pool.number_of_threads() > 1 and
+      number_of_stripes * volume_extents[0] >= minimum_size_for_threading) {
+    thread_pool.parallel_for(number_of_stripes, reconstruct_stripes);
+  } else {
+    reconstruct_stripes(0, number_of_stripes);
+  }
 }
 
 template <bool ReturnReconstructionOrder, typename Reconstructor, size_t Dim,
@@ -5,6 +5,7 @@
 
 #include <array>
 #include <cstddef>
+#include <optional>
 
 #include "NumericalAlgorithms/FiniteDifference/Reconstruct.hpp"
 #include "Utilities/ForceInline.hpp"
@@ -24,6 +25,18 @@ struct UnlimitedReconstructor {
   static_assert(Degree == 2 or Degree == 4 or Degree == 6 or Degree == 8);
   SPECTRE_ALWAYS_INLINE static std::array<double, 2> pointwise(
       const double* const q, const int stride) {
+    return pointwise_impl(q, stride);
+  }
+
+  template <typename T>
+  SPECTRE_ALWAYS_INLINE static std::optional<std::array<T, 2>> batch_pointwise(
+      const double* const q, const int stride) {
+    return pointwise_impl(BatchStencil<T>{q}, stride);
+  }
+
+  template <typename Stencil>
+  SPECTRE_ALWAYS_INLINE static std::array<stencil_value_t<Stencil>, 2>
+  pointwise_impl(const Stencil& q, const int stride) {
     if constexpr (Degree == 2) {
       // quadratic polynomial
       return {{0.375 * q[-stride] + 0.75 * q[0] - 0.125 * q[stride],
@@ -6,6 +6,7 @@
 #include <array>
 #include <cmath>
 #include <cstddef>
+#include <optional>
 #include <tuple>
 
 #include "NumericalAlgorithms/FiniteDifference/FallbackReconstructorType.hpp"
@@ -14,6 +15,7 @@
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/ForceInline.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/Simd/Simd.hpp"
 
 /// \cond
 class DataVector;
@@ -30,8 +32,9 @@ namespace detail {
 // pointwise reconstruction routine for the original Wcns5z scheme
 template <size_t NonlinearWeightExponent>
 struct Wcns5zWork {
-  SPECTRE_ALWAYS_INLINE static std::array<double, 2> pointwise(
-      const double* const q, const int stride, const double epsilon) {
+  template <typename Stencil>
+  SPECTRE_ALWAYS_INLINE static std::array<stencil_value_t<Stencil>, 2>
+  pointwise(const Stencil& q, const int stride, const double epsilon) {
     ASSERT(epsilon > 0.0,
            "epsilon must be greater than zero but is " << epsilon);
 
@@ -45,7 +48,7 @@ struct Wcns5zWork {
         1.0833333333333333 * square(q[2 * stride] - 2.0 * q[stride] + q[0]) +
             0.25 * square(q[2 * stride] - 4.0 * q[stride] + 3.0 * q[0])};
 
-    const double tau5{abs(beta[2] - beta[0])};
+    const stencil_value_t<Stencil> tau5{abs(beta[2] - beta[0])};
 
     const std::array epsilon_k{
         epsilon * (1.0 + abs(q[0]) + abs(q[-stride]) + abs(q[-2 * stride])),
@@ -65,9 +68,9 @@ struct Wcns5zWork {
                                  5.0 * nw_buffer[2]};
     const std::array alpha_lower{nw_buffer[2], 10.0 * nw_buffer[1],
                                  5.0 * nw_buffer[0]};
-    const double alpha_norm_upper =
+    const auto alpha_norm_upper =
         alpha_upper[0] + alpha_upper[1] + alpha_upper[2];
-    const double alpha_norm_lower =
+    const auto alpha_norm_lower =
         alpha_lower[0] + alpha_lower[1] + alpha_lower[2];
 
     // reconstruction stencils
@@ -118,6 +121,28 @@ struct Wcns5zReconstructor {
     }
   }
 
+  template <typename T>
+  SPECTRE_ALWAYS_INLINE static std::optional<std::array<T, 2>> batch_pointwise(
+      const double* const q, const int stride, const double epsilon,
+      const size_t max_number_of_extrema) {
+    const BatchStencil<T> stencil{q};
+    T n_extrema(0.0);
+    for (int i = -1; i < 2; ++i) {
+      const T center = stencil[i * stride];
+      const T left = stencil[(i - 1) * stride];
+      const T right = stencil[(i + 1) * stride];
+      n_extrema += simd::select((center > left and center > right) or
+                                    (center < left and center < right),
+                                T(1.0), T(0.0));
+    }
+    // the fallback reconstruction is done cell by cell
+    if (simd::any(n_extrema > static_cast<double>(max_number_of_extrema))) {
+      return std::nullopt;
+    }
+    return Wcns5zWork<NonlinearWeightExponent>::pointwise(stencil, stride,
+                                                          epsilon);
+  }
+
   SPECTRE_ALWAYS_INLINE static constexpr size_t stencil_width() { return 5; }
 };
 
@@ -128,6 +153,15 @@ struct Wcns5zReconstructor<NonlinearWeightExponent, void> {
       const size_t /*max_number_of_extrema*/) {
     return Wcns5zWork<NonlinearWeightExponent>::pointwise(q, stride, epsilon);
   }
+
+  template <typename T>
+  SPECTRE_ALWAYS_INLINE static std::optional<std::array<T, 2>> batch_pointwise(
+      const double* const q, const int stride, const double epsilon,
+      const size_t /*max_number_of_extrema*/) {
+    return Wcns5zWork<NonlinearWeightExponent>::pointwise(BatchStencil<T>{q},
+                                                          stride, epsilon);
+  }
+
   SPECTRE_ALWAYS_INLINE static constexpr size_t stencil_width() { return 5; }
 };
 
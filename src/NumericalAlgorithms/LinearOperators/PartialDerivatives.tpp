@@ -20,11 +20,16 @@
 #include "Utilities/MakeArray.hpp"
 #include "Utilities/MemoryHelpers.hpp"
 #include "Utilities/StdArrayHelpers.hpp"
+#include "Utilities/System/ThreadPool.hpp"
 
 namespace partial_derivatives_detail {
 template <size_t Dim, typename VariableTags, typename DerivativeTags>
 struct LogicalImpl;
 
+// Number of values of `du` below which the contraction with the inverse
+// Jacobian is done serially.
+constexpr size_t minimum_size_for_threading = 16384;
+
 // This routine has been optimized to perform really well. The following
 // describes what optimizations were made.
 //
@@ -53,6 +58,10 @@ struct LogicalImpl;
 //
 // - We factor out the `logical_deriv_index == 0` case so that we do not need to
 //   zero the memory in `du` before the computation.
+//
+// - For large elements the tensor components are divided among the threads of
+//   `sys::node_thread_pool()`. Each component writes to its own contiguous
+//   block of `du`, so no synchronization is needed.
 template <typename ResultTags, size_t Dim, typename DerivativeFrame>
 void partial_derivatives_impl(
     const gsl::not_null<Variables<ResultTags>*> du,
@@ -60,10 +69,7 @@ void partial_derivatives_impl(
     const size_t number_of_independent_components,
     const InverseJacobian<DataVector, Dim, Frame::ElementLogical,
                           DerivativeFrame>& inverse_jacobian) {
-  double* pdu = du->data();
   const size_t num_grid_points = du->number_of_grid_points();
-  DataVector lhs{};
-  DataVector logical_du{};
 
   std::array<std::array<size_t, Dim>, Dim> indices{};
   for (size_t deriv_index = 0; deriv_index < Dim; ++deriv_index) {
@@ -74,36 +80,58 @@ void partial_derivatives_impl(
     }
   }
 
-  for (size_t component_index = 0;
-       component_index < number_of_independent_components; ++component_index) {
-    for (size_t deriv_index = 0; deriv_index < Dim; ++deriv_index) {
-      lhs.set_data_ref(pdu, num_grid_points);
-      // clang-tidy: const cast is fine since we won't modify the data and we
-      // need it to easily hook into the expression templates.
-      logical_du.set_data_ref(
-          const_cast<double*>(  // NOLINT
-              gsl::at(logical_partial_derivatives_of_u, 0)) +  // NOLINT
-              component_index * num_grid_points,
-          num_grid_points);
-      lhs = (*(inverse_jacobian.begin() + gsl::at(indices[0], deriv_index))) *
-            logical_du;
-      for (size_t logical_deriv_index = 1; logical_deriv_index < Dim;
-           ++logical_deriv_index) {
+  const auto compute_components = [&du, &logical_partial_derivatives_of_u,
+                                   &inverse_jacobian, &num_grid_points,
+                                   &indices](const size_t first_component,
+                                             const size_t last_component) {
+    // clang-tidy: no pointer arithmetic
+    double* pdu =
+        du->data() + first_component * Dim * num_grid_points;  // NOLINT
+    DataVector lhs{};
+    DataVector logical_du{};
+    for (size_t component_index = first_component;
+         component_index < last_component; ++component_index) {
+      for (size_t deriv_index = 0; deriv_index < Dim; ++deriv_index) {
+        lhs.set_data_ref(pdu, num_grid_points);
         // clang-tidy: const cast is fine since we won't modify the data and we
         // need it to easily hook into the expression templates.
-        logical_du.set_data_ref(const_cast<double*>(  // NOLINT
-                                    gsl::at(logical_partial_derivatives_of_u,
-                                            logical_deriv_index)) +  // NOLINT
-                                    component_index * num_grid_points,
-                                num_grid_points);
-        lhs +=
-            (*(inverse_jacobian.begin() +
-               gsl::at(gsl::at(indices, logical_deriv_index), deriv_index))) *
-            logical_du;
+        logical_du.set_data_ref(
+            const_cast<double*>(  // NOLINT
+                gsl::at(logical_partial_derivatives_of_u, 0)) +  // NOLINT
+                component_index * num_grid_points,
+            num_grid_points);
+        lhs = (*(inverse_jacobian.begin() +
+                 gsl::at(indices[0], deriv_index))) *
+              logical_du;
+        for (size_t logical_deriv_index = 1; logical_deriv_index < Dim;
+             ++logical_deriv_index) {
+          // clang-tidy: const cast is fine since we won't modify the data and
+          // we need it to easily hook into the expression templates.
+          logical_du.set_data_ref(
+              const_cast<double*>(  // NOLINT
+                  gsl::at(logical_partial_derivatives_of_u,
+                          logical_deriv_index)) +  // NOLINT
+                  component_index * num_grid_points,
+              num_grid_points);
+          lhs += (*(inverse_jacobian.begin() +
+                    gsl::at(gsl::at(indices, logical_deriv_index),
+                            deriv_index))) *
+                 logical_du;
+        }
+        // clang-tidy: no pointer arithmetic
+        pdu += num_grid_points;  // NOLINT
       }
-      // clang-tidy: no pointer arithmetic
-      pdu += num_grid_points;  // NOLINT
     }
+  };
+
+  auto& thread_pool = sys::node_thread_pool();
+  if (thread_pool.number_of_threads() > 1 and
+      number_of_independent_components * num_grid_points >=
+          minimum_size_for_threading) {
+    thread_pool.parallel_for(number_of_independent_components,
+                             compute_components);
+  } else {
+    compute_components(0, number_of_independent_components);
   }
 }
 }  // namespace partial_derivatives_detail
@@ -21,9 +21,13 @@ namespace PowerMonitors {
 template <size_t Dim>
 void power_monitors(const gsl::not_null<std::array<DataVector, Dim>*> result,
                     const DataVector& u, const Mesh<Dim>& mesh) {
-  // Get modal coefficients
-  const ModalVector modal_coefficients = to_modal_coefficients(u, mesh);
+  power_monitors(result, to_modal_coefficients(u, mesh), mesh);
+}
 
+template <size_t Dim>
+void power_monitors(const gsl::not_null<std::array<DataVector, Dim>*> result,
+                    const ModalVector& modal_coefficients,
+                    const Mesh<Dim>& mesh) {
   double slice_sum = 0.0;
   size_t n_slice = 0;
   size_t n_stripe = 0;
@@ -147,6 +151,10 @@ std::array<double, Dim> absolute_truncation_error(
   template void power_monitors(                                         \
       const gsl::not_null<std::array<DataVector, DIM(data)>*> result,   \
       const DataVector& u, const Mesh<DIM(data)>& mesh);                \
+  template void power_monitors(                                         \
+      const gsl::not_null<std::array<DataVector, DIM(data)>*> result,   \
+      const ModalVector& modal_coefficients,                            \
+      const Mesh<DIM(data)>& mesh);                                     \
   template std::array<double, DIM(data)> relative_truncation_error(     \
       const DataVector& tensor_component, const Mesh<DIM(data)>& mesh); \
   template std::array<double, DIM(data)> absolute_truncation_error(     \
@@ -12,6 +12,7 @@
 
 /// \cond
 class DataVector;
+class ModalVector;
 /// \endcond
 
 /*!
@@ -43,6 +44,13 @@ void power_monitors(gsl::not_null<std::array<DataVector, Dim>*> result,
 template <size_t Dim>
 std::array<DataVector, Dim> power_monitors(const DataVector& u,
                                            const Mesh<Dim>& mesh);
+
+/// Computes the power monitors from the `modal_coefficients` of the variable,
+/// which avoids repeating the transform if they are already available.
+template <size_t Dim>
+void power_monitors(gsl::not_null<std::array<DataVector, Dim>*> result,
+                    const ModalVector& modal_coefficients,
+                    const Mesh<Dim>& mesh);
 /// @}
 
 /// @{
@@ -3,15 +3,22 @@
 
 #include "NumericalAlgorithms/SphericalHarmonics/StrahlkorperFunctions.hpp"
 
+#include <cmath>
+#include <cstddef>
 #include <deque>
+#include <iterator>
+#include <optional>
 #include <utility>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Tensor/TypeAliases.hpp"
 #include "NumericalAlgorithms/FiniteDifference/NonUniform1D.hpp"
+#include "NumericalAlgorithms/Interpolation/LagrangePolynomial.hpp"
 #include "NumericalAlgorithms/Interpolation/LinearLeastSquares.hpp"
 #include "NumericalAlgorithms/SphericalHarmonics/Strahlkorper.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
@@ -501,6 +508,49 @@ void time_deriv_of_strahlkorper(
   time_deriv->coefficients() = std::move(new_coefficients);
 }
 
+template <typename Frame>
+std::optional<double> extrapolate_strahlkorper(
+    const gsl::not_null<Strahlkorper<Frame>*> extrapolated,
+    const std::deque<std::pair<double, Strahlkorper<Frame>>>&
+        previous_strahlkorpers,
+    const double time) {
+  // A NaN time marks the original initial guess, which is not a solution at
+  // any time and so can't be extrapolated from.
+  std::vector<double> times{};
+  for (const auto& [previous_time, strahlkorper] : previous_strahlkorpers) {
+    if (std::isnan(previous_time)) {
+      break;
+    }
+    times.push_back(previous_time);
+  }
+  if (times.size() < 2) {
+    return std::nullopt;
+  }
+
+  const auto extrapolate = [&previous_strahlkorpers, &time, &times](
+                               const gsl::not_null<DataVector*> result,
+                               const size_t number_of_times) {
+    const auto times_end =
+        std::next(times.begin(), static_cast<std::ptrdiff_t>(number_of_times));
+    *result = 0.0;
+    for (size_t j = 0; j < number_of_times; ++j) {
+      *result += lagrange_polynomial(j, time, times.begin(), times_end) *
+                 previous_strahlkorpers[j].second.coefficients();
+    }
+  };
+
+  const size_t number_of_coefficients =
+      previous_strahlkorpers.front().second.coefficients().size();
+  DataVector lower_order{number_of_coefficients};
+  extrapolate(make_not_null(&lower_order), times.size() - 1);
+  DataVector& coefficients = extrapolated->coefficients();
+  ASSERT(coefficients.size() == number_of_coefficients,
+         "Expected " << number_of_coefficients << " coefficients, not "
+                     << coefficients.size());
+  extrapolate(make_not_null(&coefficients), times.size());
+  return max(abs(coefficients - lower_order));
+}
+
 #define FRAME(data) BOOST_PP_TUPLE_ELEM(0, data)
 
 #define INSTANTIATE(_, data)                                                  \
@@ -616,7 +666,11 @@ void time_deriv_of_strahlkorper(
       const std::vector<Strahlkorper<FRAME(data)>>& strahlkorpers);           \
   template void ylm::time_deriv_of_strahlkorper(                              \
       const gsl::not_null<Strahlkorper<FRAME(data)>*>,                        \
-      const std::deque<std::pair<double, Strahlkorper<FRAME(data)>>>&);
+      const std::deque<std::pair<double, Strahlkorper<FRAME(data)>>>&);     \
+  template std::optional<double> ylm::extrapolate_strahlkorper(               \
+      const gsl::not_null<Strahlkorper<FRAME(data)>*>,                        \
+      const std::deque<std::pair<double, Strahlkorper<FRAME(data)>>>&,        \
+      double);
 
 GENERATE_INSTANTIATIONS(INSTANTIATE,
                         (Frame::Distorted, Frame::Grid, Frame::Inertial))
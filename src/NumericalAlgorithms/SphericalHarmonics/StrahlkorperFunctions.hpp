@@ -4,6 +4,7 @@
 #pragma once
 
 #include <deque>
+#include <optional>
 #include <utility>
 
 #include "DataStructures/Tensor/IndexType.hpp"
@@ -397,4 +398,32 @@ void time_deriv_of_strahlkorper(
     gsl::not_null<Strahlkorper<Frame>*> time_deriv,
     const std::deque<std::pair<double, Strahlkorper<Frame>>>&
         previous_strahlkorpers);
+
+/*!
+ * \brief Extrapolate previous Strahlkorpers in time, e.g. to get an initial
+ * guess for a horizon find.
+ *
+ * \details The coefficients of `extrapolated` are set to the Lagrange
+ * polynomial through the coefficients of the leading `previous_strahlkorpers`
+ * whose times are not NaN, evaluated at `time`. If there are fewer than two
+ * such Strahlkorpers, `extrapolated` is left unchanged.
+ *
+ * All Strahlkorpers are assumed to have the same expansion center and
+ * resolution as `extrapolated`.
+ *
+ * \param extrapolated Strahlkorper whose coefficients are set.
+ * \param previous_strahlkorpers All previous Strahlkorpers and the times they
+ * are at. They are expected to have the most recent Strahlkorper in the front
+ * and the Strahlkorper furthest in the past in the back of the deque.
+ * \param time The time to extrapolate to.
+ * \return The maximum difference of the coefficients from the extrapolation
+ * one order lower, which uses all but the oldest Strahlkorper. This estimates
+ * the error of the extrapolation. `std::nullopt` if no extrapolation was done.
+ */
+template <typename Frame>
+std::optional<double> extrapolate_strahlkorper(
+    gsl::not_null<Strahlkorper<Frame>*> extrapolated,
+    const std::deque<std::pair<double, Strahlkorper<Frame>>>&
+        previous_strahlkorpers,
+    double time);
 }  // namespace ylm
@@ -0,0 +1,65 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wredundant-decls"
+#include <benchmark/benchmark.h>
+#pragma GCC diagnostic pop
+#include <complex>
+#include <cstddef>
+
+#include "DataStructures/ComplexDataVector.hpp"
+#include "DataStructures/ComplexModalVector.hpp"
+#include "DataStructures/SpinWeighted.hpp"
+#include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/SwshCollocation.hpp"
+#include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/SwshTransform.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace {
+// In this anonymous namespace is a microbenchmark of the spin-weighted
+// spherical harmonic transforms of a batch of fields, as performed on each
+// hypersurface of a CCE evolution. The benchmark argument is the `l_max` of
+// the transforms.
+
+// clang-tidy: don't pass be non-const reference
+template <Spectral::Swsh::ComplexRepresentation Representation>
+void bench_swsh_transform(benchmark::State& state) {  // NOLINT
+  const auto l_max = static_cast<size_t>(state.range(0));
+  const size_t number_of_radial_points = 10;
+  const size_t number_of_points =
+      Spectral::Swsh::number_of_swsh_collocation_points(l_max) *
+      number_of_radial_points;
+  SpinWeighted<ComplexDataVector, -1> first_collocation{
+      number_of_points, std::complex<double>{1.0, 0.5}};
+  SpinWeighted<ComplexDataVector, -1> second_collocation{
+      number_of_points, std::complex<double>{0.5, 1.0}};
+  SpinWeighted<ComplexDataVector, -1> third_collocation{
+      number_of_points, std::complex<double>{-1.0, 0.5}};
+  SpinWeighted<ComplexModalVector, -1> first_modes{};
+  SpinWeighted<ComplexModalVector, -1> second_modes{};
+  SpinWeighted<ComplexModalVector, -1> third_modes{};
+
+  while (state.KeepRunning()) {
+    Spectral::Swsh::swsh_transform<Representation>(
+        l_max, number_of_radial_points, make_not_null(&first_modes),
+        make_not_null(&second_modes), make_not_null(&third_modes),
+        first_collocation, second_collocation, third_collocation);
+    benchmark::DoNotOptimize(first_modes.data().data());
+    // transforming back to the collocation data keeps the values from
+    // drifting over the iterations
+    Spectral::Swsh::inverse_swsh_transform<Representation>(
+        l_max, number_of_radial_points, make_not_null(&first_collocation),
+        make_not_null(&second_collocation), make_not_null(&third_collocation),
+        first_modes, second_modes, third_modes);
+    benchmark::DoNotOptimize(first_collocation.data().data());
+  }
+}
+// NOLINTNEXTLINE
+BENCHMARK_TEMPLATE(bench_swsh_transform,
+                   Spectral::Swsh::ComplexRepresentation::Interleaved)
+    ->DenseRange(16, 64, 16);
+// NOLINTNEXTLINE
+BENCHMARK_TEMPLATE(bench_swsh_transform,
+                   Spectral::Swsh::ComplexRepresentation::RealsThenImags)
+    ->DenseRange(16, 64, 16);
+}  // namespace
@@ -5,6 +5,8 @@
 
 #include <complex>
 #include <cstddef>
+#include <tuple>
+#include <utility>
 
 #include "DataStructures/ComplexDataVector.hpp"  // IWYU pragma: keep
 #include "DataStructures/ComplexDiagonalModalOperator.hpp"
@@ -21,6 +23,7 @@
 #include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/SwshTransform.hpp"
 #include "Utilities/ForceInline.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/System/ThreadPool.hpp"
 #include "Utilities/TMPL.hpp"
 
 // IWYU pragma: no_forward_declare ComplexDataVector
@@ -175,6 +178,34 @@ struct dispatch_to_transform<
   }
 };
 
+// A non-owning view of the radial shells `[radial_begin, radial_end)` of
+// `vector`, which holds `number_of_radial_points` equally sized shells.
+template <typename VectorType, int Spin>
+SpinWeighted<VectorType, Spin> radial_block_view(
+    const gsl::not_null<SpinWeighted<VectorType, Spin>*> vector,
+    const size_t radial_begin, const size_t radial_end,
+    const size_t number_of_radial_points) {
+  const size_t points_per_shell = vector->size() / number_of_radial_points;
+  SpinWeighted<VectorType, Spin> view;
+  view.set_data_ref(vector->data().data() + radial_begin * points_per_shell,
+                    (radial_end - radial_begin) * points_per_shell);
+  return view;
+}
+
+// A non-owning const view of the radial shells `[radial_begin, radial_end)`
+// of `vector`, which holds `number_of_radial_points` equally sized shells.
+template <typename VectorType, int Spin>
+SpinWeighted<VectorType, Spin> const_radial_block_view(
+    const SpinWeighted<VectorType, Spin>& vector, const size_t radial_begin,
+    const size_t radial_end, const size_t number_of_radial_points) {
+  const size_t points_per_shell = vector.size() / number_of_radial_points;
+  SpinWeighted<VectorType, Spin> view;
+  make_const_view(make_not_null(&std::as_const(view)), vector,
+                  radial_begin * points_per_shell,
+                  (radial_end - radial_begin) * points_per_shell);
+  return view;
+}
+
 // template 'implementation' for the DataBox mutate-compatible interface to
 // spin-weighted derivative evaluation. This impl version is needed to have easy
 // access to the `UniqueDifferentiatedFromTagList` as a parameter pack
@@ -229,6 +260,66 @@ struct AngularDerivativesImpl<tmpl::list<DerivativeTags...>,
       const gsl::not_null<typename DerivativeTags::type::type*>... derivatives,
       const typename UniqueDifferentiatedFromTags::type::type&... inputs,
       const size_t l_max, const size_t number_of_radial_points) {
+    // The transforms of each radial shell are independent, so blocks of shells
+    // are split across the threads of the node.
+    sys::node_thread_pool().parallel_for(
+        number_of_radial_points,
+        [&](const size_t radial_begin, const size_t radial_end) {
+          if (radial_end - radial_begin == number_of_radial_points) {
+            apply_to_radial_block(transform_of_derivatives...,
+                                  transform_of_inputs..., derivatives...,
+                                  inputs..., l_max, number_of_radial_points);
+            return;
+          }
+          auto derivative_transform_views = std::make_tuple(
+              radial_block_view(transform_of_derivatives, radial_begin,
+                                radial_end, number_of_radial_points)...);
+          auto input_transform_views = std::make_tuple(
+              radial_block_view(transform_of_inputs, radial_begin, radial_end,
+                                number_of_radial_points)...);
+          auto derivative_views = std::make_tuple(
+              radial_block_view(derivatives, radial_begin, radial_end,
+                                number_of_radial_points)...);
+          const auto input_views = std::make_tuple(
+              const_radial_block_view(inputs, radial_begin, radial_end,
+                                      number_of_radial_points)...);
+          apply_to_radial_block_views(
+              make_not_null(&derivative_transform_views),
+              make_not_null(&input_transform_views),
+              make_not_null(&derivative_views), input_views, l_max,
+              radial_end - radial_begin,
+              std::make_index_sequence<sizeof...(DerivativeTags)>{},
+              std::make_index_sequence<sizeof...(
+                  UniqueDifferentiatedFromTags)>{});
+        });
+  }
+
+  template <typename DerivativeTransformViews, typename InputTransformViews,
+            typename DerivativeViews, typename InputViews,
+            size_t... DerivativeIs, size_t... InputIs>
+  static void apply_to_radial_block_views(
+      const gsl::not_null<DerivativeTransformViews*> derivative_transform_views,
+      const gsl::not_null<InputTransformViews*> input_transform_views,
+      const gsl::not_null<DerivativeViews*> derivative_views,
+      const InputViews& input_views, const size_t l_max,
+      const size_t number_of_radial_points,
+      std::index_sequence<DerivativeIs...> /*meta*/,
+      std::index_sequence<InputIs...> /*meta*/) {
+    apply_to_radial_block(
+        make_not_null(&std::get<DerivativeIs>(*derivative_transform_views))...,
+        make_not_null(&std::get<InputIs>(*input_transform_views))...,
+        make_not_null(&std::get<DerivativeIs>(*derivative_views))...,
+        std::get<InputIs>(input_views)..., l_max, number_of_radial_points);
+  }
+
+  static void apply_to_radial_block(
+      const gsl::not_null<typename Tags::SwshTransform<
+          DerivativeTags>::type::type*>... transform_of_derivatives,
+      const gsl::not_null<typename Tags::SwshTransform<
+          UniqueDifferentiatedFromTags>::type::type*>... transform_of_inputs,
+      const gsl::not_null<typename DerivativeTags::type::type*>... derivatives,
+      const typename UniqueDifferentiatedFromTags::type::type&... inputs,
+      const size_t l_max, const size_t number_of_radial_points) {
     // perform the forward transform on the minimal set of input nodal
     // quantities to obtain all of the requested derivatives
     using ForwardTransformList =
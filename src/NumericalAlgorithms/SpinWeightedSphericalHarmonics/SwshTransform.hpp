@@ -18,6 +18,7 @@
 #include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/SwshCoefficients.hpp"  // IWYU pragma: keep
 #include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/SwshCollocation.hpp"
 #include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/SwshTags.hpp"
+#include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/SwshTransformPlan.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/TMPL.hpp"
 
@@ -31,61 +32,6 @@ namespace Spectral {
 namespace Swsh {
 
 namespace detail {
-// libsharp has an internal maximum number of transforms that is not in the
-// public interface, so we must hard-code its value here
-static const size_t max_libsharp_transforms = 100;
-
-// appends to a vector of pointers `collocation_data` the set of pointers
-// associated with angular views of the provided collocation data `vector`. The
-// associated views are appended into `collocation_views`. If `positive_spin` is
-// false, this function will conjugate the views, and therefore potentially
-// conjugate (depending on `Representation`) the input data `vectors`. This
-// behavior is chosen to avoid frequent copies of the input data `vector` for
-// optimization. The conjugation must be undone after the call to libsharp
-// transforms using `conjugate_views` to restore the input data to its original
-// state.
-template <ComplexRepresentation Representation>
-void append_libsharp_collocation_pointers(
-    gsl::not_null<std::vector<double*>*> collocation_data,
-    gsl::not_null<std::vector<ComplexDataView<Representation>>*>
-        collocation_views,
-    gsl::not_null<ComplexDataVector*> vector, size_t l_max, bool positive_spin);
-
-// Perform a conjugation on a vector of `ComplexDataView`s if `Spin` < 0. This
-// is used for undoing the conjugation described in the code comment for
-// `append_libsharp_collocation_pointers`
-template <int Spin, ComplexRepresentation Representation>
-SPECTRE_ALWAYS_INLINE void conjugate_views(
-    gsl::not_null<std::vector<ComplexDataView<Representation>>*>
-        collocation_views) {
-  if (Spin < 0) {
-    for (auto& view : *collocation_views) {
-      view.conjugate();
-    }
-  }
-}
-
-// appends to a vector of pointers the set of pointers associated with
-// angular views of the provided coefficient vector. When working with the
-// libsharp coefficient representation, note the intricacies mentioned in
-// the documentation for `TransformJob`.
-void append_libsharp_coefficient_pointers(
-    gsl::not_null<std::vector<std::complex<double>*>*> coefficient_data,
-    gsl::not_null<ComplexModalVector*> vector, size_t l_max);
-
-// perform the actual libsharp execution calls on an input and output set of
-// pointers. This function handles the complication of a limited maximum number
-// of simultaneous transforms, performing multiple execution calls on pointer
-// blocks if necessary.
-template <ComplexRepresentation Representation>
-void execute_libsharp_transform_set(
-    const sharp_jobtype& jobtype, int spin,
-    gsl::not_null<std::vector<std::complex<double>*>*> coefficient_data,
-    gsl::not_null<std::vector<double*>*> collocation_data,
-    gsl::not_null<const CollocationMetadata<Representation>*>
-        collocation_metadata,
-    const sharp_alm_info* alm_info, size_t num_transforms);
-
 // template 'implementation' for the `swsh_transform` function below which
 // performs an arbitrary number of transforms, and places them in the same
 // number of destination modal containers passed by pointer.
@@ -312,16 +258,21 @@ SpinWeighted<ComplexDataVector, Spin> inverse_swsh_transform(
  *    a stride of 2 for 'adjacent' real or imaginary values.
  *  - `ComplexRepresentation::RealsThenImags`: indicates that the real and
  *    imaginary parts of the collocation values will be passed to libsharp as
- *    separate contiguous blocks. At current, this introduces both allocations
- *    and copies.  **optimization note** In the future most of the allocations
- *    can be aggregated to calling code, which would pass in buffers by
- *    `not_null` pointers.
+ *    separate contiguous blocks. This introduces a copy of the data, into a
+ *    buffer that is allocated once for each shape of transform and reused.
  *
  *  For performance-sensitive code, both options should be tested, as each
  *  strategy has trade-offs.
  * - `TagList`: A `tmpl::list` of Tags to be forward transformed. The tags must
  * represent the nodal data.
  *
+ * All of the tags are transformed together in as few libsharp calls as
+ * possible. The libsharp descriptions of the transform set and the arrays of
+ * pointers passed to libsharp are stored in a `detail::TransformPlan` that is
+ * cached for each combination of `l_max`, spin-weight, and number of angular
+ * slices (the number of tags times the number of radial points), so transforms
+ * that are repeated each step do not repeat that setup.
+ *
  * \note The signs obtained from libsharp transformations must be handled
  * carefully. (In particular, it does not use the sign convention you will find
  * in [Wikipedia]
@@ -481,10 +432,8 @@ struct SwshTransform<tmpl::list<TransformTags...>, Representation> {
  *    a stride of 2 for 'adjacent' real or imaginary values.
  *  - `ComplexRepresentation::RealsThenImags`: indicates that the real and
  *    imaginary parts of the collocation values will be passed to libsharp as
- *    separate contiguous blocks. At current, this introduces both allocations
- *    and copies.  **optimization note** In the future most of the allocations
- *    can be aggregated to calling code, which would pass in buffers by
- *    `not_null` pointers.
+ *    separate contiguous blocks. This introduces a copy of the data, into a
+ *    buffer that is allocated once for each shape of transform and reused.
  *
  *  For performance-sensitive code, both options should be tested, as each
  *  strategy has trade-offs.
@@ -556,46 +505,36 @@ void SwshTransform<tmpl::list<TransformTags...>, Representation>::
   EXPAND_PACK_LEFT_TO_RIGHT(coefficients->destructive_resize(
       size_of_libsharp_coefficient_vector(l_max) * number_of_radial_points));
 
-  // assemble a list of pointers into the collocation point data. This is
-  // required because libsharp expects pointers to pointers.
-  std::vector<detail::ComplexDataView<Representation>> pre_transform_views;
-  pre_transform_views.reserve(number_of_radial_points *
-                              sizeof...(TransformTags));
-  std::vector<double*> pre_transform_collocation_data;
-  pre_transform_collocation_data.reserve(2 * number_of_radial_points *
-                                         sizeof...(TransformTags));
+  // the plan holds the arrays of pointers that libsharp expects, so repeated
+  // transforms of the same shape do not allocate
+  auto& plan = detail::cached_transform_plan<Representation>(
+      l_max, spin, number_of_radial_points * sizeof...(TransformTags));
 
+  size_t first_slice = 0;
   // clang-tidy: const-cast, object is temporarily modified and returned to
   // original state
-  EXPAND_PACK_LEFT_TO_RIGHT(detail::append_libsharp_collocation_pointers(
-      make_not_null(&pre_transform_collocation_data),
-      make_not_null(&pre_transform_views),
-      make_not_null(&const_cast<typename TransformTags::type::type&>(  // NOLINT
-                         collocations)
-                         .data()),
-      l_max, spin >= 0));
-
-  std::vector<std::complex<double>*> post_transform_coefficient_data;
-  post_transform_coefficient_data.reserve(2 * number_of_radial_points *
-                                          sizeof...(TransformTags));
-
-  EXPAND_PACK_LEFT_TO_RIGHT(detail::append_libsharp_coefficient_pointers(
-      make_not_null(&post_transform_coefficient_data),
-      make_not_null(&coefficients->data()), l_max));
-
-  const size_t num_transforms =
-      (spin == 0 ? 2 : 1) * number_of_radial_points * sizeof...(TransformTags);
-  const auto* collocation_metadata =
-      &cached_collocation_metadata<Representation>(l_max);
-  const auto* alm_info =
-      cached_coefficients_metadata(l_max).get_sharp_alm_info();
-
-  detail::execute_libsharp_transform_set(
-      SHARP_MAP2ALM, spin, make_not_null(&post_transform_coefficient_data),
-      make_not_null(&pre_transform_collocation_data),
-      make_not_null(collocation_metadata), alm_info, num_transforms);
-
-  detail::conjugate_views<spin>(make_not_null(&pre_transform_views));
+  EXPAND_PACK_LEFT_TO_RIGHT(
+      (plan.prepare_collocation_input(
+           first_slice,
+           make_not_null(&const_cast<  // NOLINT
+                              typename TransformTags::type::type&>(collocations)
+                              .data())),
+       first_slice += number_of_radial_points));
+  first_slice = 0;
+  EXPAND_PACK_LEFT_TO_RIGHT(
+      (plan.set_coefficients(first_slice, make_not_null(&coefficients->data())),
+       first_slice += number_of_radial_points));
+
+  plan.execute(SHARP_MAP2ALM);
+
+  first_slice = 0;
+  EXPAND_PACK_LEFT_TO_RIGHT(
+      (plan.restore_collocation_input(
+           first_slice,
+           make_not_null(&const_cast<  // NOLINT
+                              typename TransformTags::type::type&>(collocations)
+                              .data())),
+       first_slice += number_of_radial_points));
 }
 
 template <typename... TransformTags, ComplexRepresentation Representation>
@@ -608,51 +547,36 @@ void InverseSwshTransform<tmpl::list<TransformTags...>, Representation>::
   EXPAND_PACK_LEFT_TO_RIGHT(collocations->destructive_resize(
       number_of_swsh_collocation_points(l_max) * number_of_radial_points));
 
-  std::vector<std::complex<double>*> pre_transform_coefficient_data;
-  pre_transform_coefficient_data.reserve(2 * number_of_radial_points *
-                                         sizeof...(TransformTags));
-  // clang-tidy: const-cast, object is temporarily modified and returned to
-  // original state
-  EXPAND_PACK_LEFT_TO_RIGHT(detail::append_libsharp_coefficient_pointers(
-      make_not_null(&pre_transform_coefficient_data),
-      make_not_null(&const_cast<typename Tags::SwshTransform<  // NOLINT
-                         TransformTags>::type::type&>(coefficients)
-                         .data()),
-      l_max));
-
-  std::vector<detail::ComplexDataView<Representation>> post_transform_views;
-  post_transform_views.reserve(number_of_radial_points *
-                               sizeof...(TransformTags));
-  std::vector<double*> post_transform_collocation_data;
-  post_transform_collocation_data.reserve(2 * number_of_radial_points *
-                                          sizeof...(TransformTags));
-
-  EXPAND_PACK_LEFT_TO_RIGHT(detail::append_libsharp_collocation_pointers(
-      make_not_null(&post_transform_collocation_data),
-      make_not_null(&post_transform_views),
-      make_not_null(&collocations->data()), l_max, true));
-
-  // libsharp considers two arrays per transform when spin is not zero.
-  const size_t num_transforms =
-      (spin == 0 ? 2 : 1) * number_of_radial_points * sizeof...(TransformTags);
-  const auto* collocation_metadata =
-      &cached_collocation_metadata<Representation>(l_max);
-  const auto* alm_info =
-      cached_coefficients_metadata(l_max).get_sharp_alm_info();
-
-  detail::execute_libsharp_transform_set(
-      SHARP_ALM2MAP, spin, make_not_null(&pre_transform_coefficient_data),
-      make_not_null(&post_transform_collocation_data),
-      make_not_null(collocation_metadata), alm_info, num_transforms);
-
-  detail::conjugate_views<spin>(make_not_null(&post_transform_views));
-
-  // The inverse transformed collocation data has just been placed in the
-  // memory blocks controlled by the `ComplexDataView`s. Finally, that data
-  // must be flushed back to the Variables.
-  for (auto& view : post_transform_views) {
-    view.copy_back_to_source();
-  }
+  auto& plan = detail::cached_transform_plan<Representation>(
+      l_max, spin, number_of_radial_points * sizeof...(TransformTags));
+
+  size_t first_slice = 0;
+  // clang-tidy: const-cast, libsharp takes non-const pointers, but does not
+  // alter the input coefficients
+  EXPAND_PACK_LEFT_TO_RIGHT(
+      (plan.set_coefficients(
+           first_slice,
+           make_not_null(&const_cast<typename Tags::SwshTransform<  // NOLINT
+                              TransformTags>::type::type&>(coefficients)
+                              .data())),
+       first_slice += number_of_radial_points));
+  first_slice = 0;
+  EXPAND_PACK_LEFT_TO_RIGHT(
+      (plan.prepare_collocation_output(first_slice,
+                                       make_not_null(&collocations->data())),
+       first_slice += number_of_radial_points));
+
+  plan.execute(SHARP_ALM2MAP);
+
+  // The inverse transformed collocation data has just been placed either
+  // directly in the destination (`Interleaved`) or in the buffer held by the
+  // plan (`RealsThenImags`). Finally, that data must be brought to its final
+  // form in the destination.
+  first_slice = 0;
+  EXPAND_PACK_LEFT_TO_RIGHT(
+      (plan.finalize_collocation_output(first_slice,
+                                        make_not_null(&collocations->data())),
+       first_slice += number_of_radial_points));
 }
 /// \endcond
 
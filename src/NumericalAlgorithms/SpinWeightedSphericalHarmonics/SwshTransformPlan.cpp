@@ -0,0 +1,261 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/SwshTransformPlan.hpp"
+
+#include <complex>
+#include <cstddef>
+#include <cstdlib>
+#include <map>
+#include <sharp_cxx.h>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/ComplexDataVector.hpp"
+#include "DataStructures/ComplexModalVector.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/SwshCoefficients.hpp"
+#include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/SwshCollocation.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace Spectral::Swsh::detail {
+namespace {
+void assert_slices_in_plan(const size_t first_slice,
+                           const size_t number_of_slices_in_vector,
+                           const size_t number_of_slices_in_plan) {
+  ASSERT(first_slice + number_of_slices_in_vector <= number_of_slices_in_plan,
+         "Attempted to register slices " << first_slice << " to "
+                                         << first_slice +
+                                                number_of_slices_in_vector
+                                         << " with a transform plan of only "
+                                         << number_of_slices_in_plan
+                                         << " slices.");
+}
+}  // namespace
+
+template <ComplexRepresentation Representation>
+TransformPlan<Representation>::TransformPlan(const size_t l_max,
+                                             const int spin,
+                                             const size_t number_of_slices)
+    : l_max_{l_max},
+      spin_{spin},
+      number_of_slices_{number_of_slices},
+      number_of_angular_points_{number_of_swsh_collocation_points(l_max)},
+      number_of_coefficients_{size_of_libsharp_coefficient_vector(l_max)},
+      geom_info_{cached_collocation_metadata<Representation>(l_max)
+                     .get_sharp_geom_info()},
+      alm_info_{cached_coefficients_metadata(l_max).get_sharp_alm_info()},
+      collocation_pointers_(2 * number_of_slices, nullptr),
+      coefficient_pointers_(2 * number_of_slices, nullptr) {
+  // libsharp considers a spin-weighted transform to act on a pair of arrays,
+  // and a spin-0 transform to act on a single array.
+  const size_t number_of_transforms =
+      (spin == 0 ? 2 : 1) * number_of_slices;
+  // Divide the transforms into the fewest blocks permitted by libsharp, with
+  // sizes as even as possible so that no block is left with only a handful of
+  // transforms.
+  const size_t number_of_blocks =
+      (number_of_transforms + max_libsharp_transforms - 1) /
+      max_libsharp_transforms;
+  blocks_.reserve(number_of_blocks);
+  size_t first_transform = 0;
+  for (size_t i = 0; i < number_of_blocks; ++i) {
+    const size_t block_size = number_of_transforms / number_of_blocks +
+                              (i < number_of_transforms % number_of_blocks ? 1
+                                                                           : 0);
+    blocks_.emplace_back(first_transform, block_size);
+    first_transform += block_size;
+  }
+  if constexpr (Representation == ComplexRepresentation::RealsThenImags) {
+    reals_then_imags_buffer_ =
+        DataVector{2 * number_of_slices * number_of_angular_points_};
+  }
+}
+
+template <ComplexRepresentation Representation>
+void TransformPlan<Representation>::prepare_collocation_input(
+    const size_t first_slice,
+    const gsl::not_null<ComplexDataVector*> collocation) {
+  const size_t number_of_slices_in_vector =
+      collocation->size() / number_of_angular_points_;
+  assert_slices_in_plan(first_slice, number_of_slices_in_vector,
+                        number_of_slices_);
+  if constexpr (Representation == ComplexRepresentation::Interleaved) {
+    // alteration needed because libsharp doesn't support negative spins
+    if (spin_ < 0) {
+      *collocation = conj(*collocation);
+    }
+    for (size_t i = 0; i < number_of_slices_in_vector; ++i) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+      double* const slice_data = reinterpret_cast<double*>(
+          // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+          collocation->data() + i * number_of_angular_points_);
+      collocation_pointers_[2 * (first_slice + i)] = slice_data;
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      collocation_pointers_[2 * (first_slice + i) + 1] = slice_data + 1;
+    }
+  } else {
+    // the conjugation for negative spins is performed during the copy, so the
+    // input is never altered
+    const double imag_sign = spin_ < 0 ? -1.0 : 1.0;
+    for (size_t i = 0; i < number_of_slices_in_vector; ++i) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      double* const real_data = reals_then_imags_buffer_.data() +
+                                2 * (first_slice + i) *
+                                    number_of_angular_points_;
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      double* const imag_data = real_data + number_of_angular_points_;
+      for (size_t j = 0; j < number_of_angular_points_; ++j) {
+        const std::complex<double>& value =
+            (*collocation)[i * number_of_angular_points_ + j];
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        real_data[j] = real(value);
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        imag_data[j] = imag_sign * imag(value);
+      }
+      collocation_pointers_[2 * (first_slice + i)] = real_data;
+      collocation_pointers_[2 * (first_slice + i) + 1] = imag_data;
+    }
+  }
+}
+
+template <ComplexRepresentation Representation>
+void TransformPlan<Representation>::restore_collocation_input(
+    const size_t /*first_slice*/,
+    const gsl::not_null<ComplexDataVector*> collocation) {
+  // for `RealsThenImags` the input was copied rather than altered, so there is
+  // nothing to restore
+  if constexpr (Representation == ComplexRepresentation::Interleaved) {
+    if (spin_ < 0) {
+      *collocation = conj(*collocation);
+    }
+  }
+}
+
+template <ComplexRepresentation Representation>
+void TransformPlan<Representation>::prepare_collocation_output(
+    const size_t first_slice,
+    const gsl::not_null<ComplexDataVector*> collocation) {
+  const size_t number_of_slices_in_vector =
+      collocation->size() / number_of_angular_points_;
+  assert_slices_in_plan(first_slice, number_of_slices_in_vector,
+                        number_of_slices_);
+  for (size_t i = 0; i < number_of_slices_in_vector; ++i) {
+    double* real_data = nullptr;
+    double* imag_data = nullptr;
+    if constexpr (Representation == ComplexRepresentation::Interleaved) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+      real_data = reinterpret_cast<double*>(
+          // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+          collocation->data() + i * number_of_angular_points_);
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      imag_data = real_data + 1;
+    } else {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      real_data = reals_then_imags_buffer_.data() +
+                  2 * (first_slice + i) * number_of_angular_points_;
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      imag_data = real_data + number_of_angular_points_;
+    }
+    collocation_pointers_[2 * (first_slice + i)] = real_data;
+    collocation_pointers_[2 * (first_slice + i) + 1] = imag_data;
+  }
+}
+
+template <ComplexRepresentation Representation>
+void TransformPlan<Representation>::finalize_collocation_output(
+    const size_t first_slice,
+    const gsl::not_null<ComplexDataVector*> collocation) {
+  if constexpr (Representation == ComplexRepresentation::Interleaved) {
+    if (spin_ < 0) {
+      *collocation = conj(*collocation);
+    }
+  } else {
+    // the data is flushed back to the source and the conjugation for negative
+    // spins is applied in a single pass
+    const double imag_sign = spin_ < 0 ? -1.0 : 1.0;
+    const size_t number_of_slices_in_vector =
+        collocation->size() / number_of_angular_points_;
+    for (size_t i = 0; i < number_of_slices_in_vector; ++i) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      const double* const real_data = reals_then_imags_buffer_.data() +
+                                      2 * (first_slice + i) *
+                                          number_of_angular_points_;
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      const double* const imag_data = real_data + number_of_angular_points_;
+      for (size_t j = 0; j < number_of_angular_points_; ++j) {
+        (*collocation)[i * number_of_angular_points_ + j] =
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            std::complex<double>{real_data[j], imag_sign * imag_data[j]};
+      }
+    }
+  }
+}
+
+template <ComplexRepresentation Representation>
+void TransformPlan<Representation>::set_coefficients(
+    const size_t first_slice,
+    const gsl::not_null<ComplexModalVector*> coefficients) {
+  const size_t number_of_slices_in_vector =
+      coefficients->size() / number_of_coefficients_;
+  assert_slices_in_plan(first_slice, number_of_slices_in_vector,
+                        number_of_slices_);
+  for (size_t i = 0; i < number_of_slices_in_vector; ++i) {
+    // coefficients associated with the real part
+    coefficient_pointers_[2 * (first_slice + i)] =
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        coefficients->data() + i * number_of_coefficients_;
+    // coefficients associated with the imaginary part
+    coefficient_pointers_[2 * (first_slice + i) + 1] =
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        coefficients->data() + (2 * i + 1) * (number_of_coefficients_ / 2);
+  }
+}
+
+template <ComplexRepresentation Representation>
+void TransformPlan<Representation>::execute(const sharp_jobtype jobtype) {
+  // libsharp considers two arrays per transform when spin is not zero.
+  const size_t number_of_arrays_per_transform = (spin_ == 0 ? 1 : 2);
+  for (const auto& [first_transform, number_of_transforms] : blocks_) {
+    sharp_execute(
+        jobtype, abs(spin_),
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        coefficient_pointers_.data() +
+            number_of_arrays_per_transform * first_transform,
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        collocation_pointers_.data() +
+            number_of_arrays_per_transform * first_transform,
+        geom_info_, alm_info_, static_cast<int>(number_of_transforms),
+        SHARP_DP, nullptr, nullptr);
+  }
+}
+
+template <ComplexRepresentation Representation>
+TransformPlan<Representation>& cached_transform_plan(
+    const size_t l_max, const int spin, const size_t number_of_slices) {
+  // The plans hold scratch space that is written during each transform, so
+  // they cannot be shared between threads.
+  thread_local std::map<std::tuple<size_t, int, size_t>,
+                        TransformPlan<Representation>>
+      plans{};
+  const auto key = std::make_tuple(l_max, spin, number_of_slices);
+  auto plan = plans.find(key);
+  if (plan == plans.end()) {
+    plan = plans
+               .emplace(std::piecewise_construct, std::forward_as_tuple(key),
+                        std::forward_as_tuple(l_max, spin, number_of_slices))
+               .first;
+  }
+  return plan->second;
+}
+
+template class TransformPlan<ComplexRepresentation::Interleaved>;
+template class TransformPlan<ComplexRepresentation::RealsThenImags>;
+
+template TransformPlan<ComplexRepresentation::Interleaved>&
+cached_transform_plan(size_t l_max, int spin, size_t number_of_slices);
+template TransformPlan<ComplexRepresentation::RealsThenImags>&
+cached_transform_plan(size_t l_max, int spin, size_t number_of_slices);
+}  // namespace Spectral::Swsh::detail
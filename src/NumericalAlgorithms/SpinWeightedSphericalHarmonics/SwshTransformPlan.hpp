@@ -0,0 +1,129 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <complex>
+#include <cstddef>
+#include <sharp_cxx.h>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/ComplexDataView.hpp"
+#include "Utilities/Gsl.hpp"
+
+/// \cond
+class ComplexDataVector;
+class ComplexModalVector;
+/// \endcond
+
+namespace Spectral::Swsh::detail {
+// libsharp has an internal maximum number of transforms that is not in the
+// public interface, so we must hard-code its value here
+static const size_t max_libsharp_transforms = 100;
+
+// A reusable description of a set of libsharp transforms of
+// `number_of_slices` angular slices at resolution `l_max` and spin-weight
+// `spin`. A slice is a single angular shell of a single field, so a batch of
+// `N` fields each with `number_of_radial_points` shells has
+// `N * number_of_radial_points` slices.
+//
+// The plan stores everything about the transform set that does not depend on
+// the location of the data: the libsharp geometry and coefficient
+// descriptions, the division of the transforms into blocks that respect
+// `max_libsharp_transforms`, the arrays of pointers that libsharp takes as
+// arguments, and (for `ComplexRepresentation::RealsThenImags`) a single buffer
+// that holds the separated real and imaginary parts of every slice. Repeated
+// transforms of the same shape therefore only fill in the pointers and perform
+// no allocations.
+//
+// A transform with the plan is performed by:
+// - calling `prepare_collocation_input` (forward) or
+//   `prepare_collocation_output` (inverse) for each nodal vector, and
+//   `set_coefficients` for each modal vector, with the index of the first
+//   slice of each vector;
+// - calling `execute`;
+// - calling `restore_collocation_input` (forward) or
+//   `finalize_collocation_output` (inverse) for each nodal vector.
+//
+// Negative spin-weights are transformed by libsharp as the conjugate of the
+// data. For `ComplexRepresentation::Interleaved`, the conjugation is applied in
+// place to the input data and undone by `restore_collocation_input`. For
+// `ComplexRepresentation::RealsThenImags`, it is applied while copying to or
+// from the buffer, so the input data is never altered.
+//
+// Plans hold mutable scratch data, so should be obtained from
+// `cached_transform_plan`, which keeps a separate set of plans for each thread.
+template <ComplexRepresentation Representation>
+class TransformPlan {
+ public:
+  TransformPlan(size_t l_max, int spin, size_t number_of_slices);
+
+  size_t l_max() const { return l_max_; }
+  int spin() const { return spin_; }
+  size_t number_of_slices() const { return number_of_slices_; }
+
+  // The (first transform, number of transforms) of each call to
+  // `sharp_execute` performed by `execute`
+  const std::vector<std::pair<size_t, size_t>>& blocks() const {
+    return blocks_;
+  }
+
+  // Register the nodal data `collocation` to be forward transformed, with its
+  // first angular slice at index `first_slice` of the plan. For negative spin
+  // and `ComplexRepresentation::Interleaved`, `collocation` is conjugated in
+  // place until `restore_collocation_input` is called.
+  void prepare_collocation_input(size_t first_slice,
+                                 gsl::not_null<ComplexDataVector*> collocation);
+
+  // Return the nodal data registered with `prepare_collocation_input` to its
+  // original state.
+  void restore_collocation_input(size_t first_slice,
+                                 gsl::not_null<ComplexDataVector*> collocation);
+
+  // Register the nodal data `collocation` to receive the result of an inverse
+  // transform, with its first angular slice at index `first_slice` of the plan.
+  // `collocation` must already be the correct size.
+  void prepare_collocation_output(
+      size_t first_slice, gsl::not_null<ComplexDataVector*> collocation);
+
+  // Place the result of the inverse transform in `collocation`, which must
+  // have been registered with `prepare_collocation_output`.
+  void finalize_collocation_output(
+      size_t first_slice, gsl::not_null<ComplexDataVector*> collocation);
+
+  // Register the libsharp-compatible modal data `coefficients` with its first
+  // angular slice at index `first_slice` of the plan. When working with the
+  // libsharp coefficient representation, note the intricacies mentioned in the
+  // documentation for `SwshTransform`.
+  void set_coefficients(size_t first_slice,
+                        gsl::not_null<ComplexModalVector*> coefficients);
+
+  // Perform the libsharp transforms of type `jobtype` (`SHARP_MAP2ALM` or
+  // `SHARP_ALM2MAP`) on all of the registered data.
+  void execute(sharp_jobtype jobtype);
+
+ private:
+  size_t l_max_;
+  int spin_;
+  size_t number_of_slices_;
+  size_t number_of_angular_points_;
+  size_t number_of_coefficients_;
+  const sharp_geom_info* geom_info_;
+  const sharp_alm_info* alm_info_;
+  std::vector<std::pair<size_t, size_t>> blocks_;
+  std::vector<double*> collocation_pointers_;
+  std::vector<std::complex<double>*> coefficient_pointers_;
+  // unused in the case of `Interleaved` representation
+  DataVector reals_then_imags_buffer_;
+};
+
+// Retrieve the `TransformPlan` for the provided shape of transform set,
+// constructing it on the first request. Plans are cached separately for each
+// thread, so the returned reference is valid for the lifetime of the calling
+// thread and may only be used on that thread.
+template <ComplexRepresentation Representation>
+TransformPlan<Representation>& cached_transform_plan(size_t l_max, int spin,
+                                                     size_t number_of_slices);
+}  // namespace Spectral::Swsh::detail
@@ -162,6 +162,13 @@ struct has_suggested<
     S, std::void_t<decltype(std::declval<S>().suggested_value())>>
     : std::true_type {};
 
+template <typename S, typename = std::void_t<>>
+struct has_default : std::false_type {};
+template <typename S>
+struct has_default<S,
+                   std::void_t<decltype(std::declval<S>().default_value())>>
+    : std::true_type {};
+
 template <typename S, typename = std::void_t<>>
 struct has_lower_bound : std::false_type {};
 template <typename S>
@@ -196,6 +203,10 @@ std::string print_tag(const std::string& indent) {
   std::ostringstream ss;
   ss << indent << pretty_type::name<Tag>() << ":" << new_line
      << "type=" << yaml_type<typename Tag::type>::value();
+  if constexpr (has_default<Tag>::value) {
+    ss << new_line << "default="
+       << (MakeString{} << std::boolalpha << Tag::default_value());
+  }
   if constexpr (has_suggested<Tag>::value) {
     if constexpr (tt::is_a_v<std::unique_ptr, typename Tag::type>) {
       call_with_dynamic_type<
@@ -540,6 +540,14 @@ struct get_impl<Tag, Metavariables, Tag> {
     const std::string label = pretty_type::name<Tag>();
 
     const auto supplied_option = opts.parsed_options_.find(label);
+    if constexpr (Options_detail::has_default<Tag>::value) {
+      static_assert(
+          std::is_same_v<decltype(Tag::default_value()), typename Tag::type>,
+          "Default value is not of the same type as the option.");
+      if (supplied_option == opts.parsed_options_.end()) {
+        return Tag::default_value();
+      }
+    }
     ASSERT(supplied_option != opts.parsed_options_.end(),
            "Requested option from alternative that was not supplied.");
     Option option(supplied_option->second, opts.context_);
@@ -798,6 +806,17 @@ void Parser<OptionList, Group>::parse(const YAML::Node& node) {
     valid_names.erase(name_it);
   }
 
+  // Options with a default value may be omitted.
+  tmpl::for_each<all_possible_options>([&valid_names](auto tag_v) {
+    using tag = tmpl::type_from<decltype(tag_v)>;
+    if constexpr (Options_detail::has_default<tag>::value) {
+      const auto name_it = alg::find(valid_names, pretty_type::name<tag>());
+      if (name_it != valid_names.end()) {
+        valid_names.erase(name_it);
+      }
+    }
+  });
+
   parse_detail::check_for_missing_option(valid_names, context_,
                                          parsing_help_message);
 
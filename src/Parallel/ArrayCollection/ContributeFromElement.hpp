@@ -0,0 +1,59 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Parallel/ArrayCollection/ElementReductionCombiner.hpp"
+#include "Parallel/NodeLock.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace Parallel::Actions {
+/*!
+ * \brief Contribute the reduction data of the element `element_id` to a
+ * reduction over the `DgElementCollection`. This is always invoked on the
+ * local component via `Parallel::local_synchronous_action`.
+ *
+ * The contributions of the elements on the node are combined with a
+ * `Parallel::ElementReductionCombiner`, and `contribute` is called with the
+ * combined data once every element on the node has contributed. `contribute`
+ * must contribute the data from the nodegroup's branch on this node, e.g.
+ * through `Parallel::local_branch`. Every call site must pass its own type of
+ * `contribute` (a lambda does), since the contributions are combined
+ * separately for each type of `contribute` and `ReductionData`.
+ *
+ * The pending contributions are stored per process (i.e. per node) and are not
+ * checkpointed, which is fine since a checkpoint is only written once all
+ * reductions have completed. Every node must have at least one element for the
+ * reduction to complete.
+ */
+struct ContributeFromElement {
+  using return_type = void;
+
+  template <typename ParallelComponent, typename DbTagList, size_t Dim,
+            typename ReductionData, typename Contribute>
+  static return_type apply(db::DataBox<DbTagList>& box,
+                           const gsl::not_null<Parallel::NodeLock*> node_lock,
+                           const ElementId<Dim>& element_id,
+                           ReductionData reduction_data,
+                           Contribute&& contribute) {
+    static ElementReductionCombiner<Dim, ReductionData> combiner{};
+    std::lock_guard node_guard(*node_lock);
+    const size_t number_of_elements =
+        db::get<typename ParallelComponent::element_collection_tag>(box).size();
+    std::optional<ReductionData> combined_data =
+        combiner.add(element_id, std::move(reduction_data), number_of_elements);
+    if (combined_data.has_value()) {
+      // Contributing under the lock keeps the reductions in order.
+      std::forward<Contribute>(contribute)(std::move(*combined_data));
+    }
+  }
+};
+}  // namespace Parallel::Actions
@@ -0,0 +1,187 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <unordered_set>
+#include <utility>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "Domain/CreateInitialElement.hpp"
+#include "Domain/Creators/Tags/Domain.hpp"
+#include "Domain/Creators/Tags/InitialExtents.hpp"
+#include "Domain/Creators/Tags/InitialRefinementLevels.hpp"
+#include "Domain/ElementDistribution.hpp"
+#include "Domain/Structure/Element.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Tags/ElementDistribution.hpp"
+#include "Evolution/DiscontinuousGalerkin/Initialization/QuadratureTag.hpp"
+#include "Parallel/AlgorithmExecution.hpp"
+#include "Parallel/ArrayCollection/SpawnInitializeElementsInCollection.hpp"
+#include "Parallel/ArrayCollection/ElementScheduler.hpp"
+#include "Parallel/ArrayCollection/Tags/ElementLocations.hpp"
+#include "Parallel/ArrayCollection/Tags/ElementScheduler.hpp"
+#include "Parallel/ArrayCollection/Tags/NumberOfElementsTerminated.hpp"
+#include "Parallel/CreateElementsUsingDistribution.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Info.hpp"
+#include "Parallel/Reduction.hpp"
+#include "Utilities/Functional.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
+
+namespace Parallel::Actions {
+/*!
+ * \brief Creates the `DgElementArrayMember`s that live on this node of the
+ * `DgElementCollection`.
+ *
+ * Every node computes the same distribution of the elements over the
+ * processors as `DgElementArray` does (see
+ * `Parallel::create_elements_using_distribution()`), records the node of every
+ * element in `Parallel::Tags::ElementLocations`, and constructs the elements
+ * that were assigned to one of its processors. The elements with a neighbor on
+ * another node are passed to the node's `Parallel::ElementScheduler` so that
+ * they are run first. This action must be followed by
+ * `Parallel::Actions::ContributeToSpawnInitializeElements`.
+ *
+ * Uses:
+ * - GlobalCache:
+ *   * `domain::Tags::Domain<Dim>`
+ *   * `domain::Tags::ElementDistribution`
+ *
+ * DataBox:
+ * - Adds:
+ *   * `ParallelComponent::element_collection_tag`
+ *   * `Parallel::Tags::ElementLocations<Dim>`
+ *   * `Parallel::Tags::NumberOfElementsTerminated`
+ *   * `Parallel::Tags::ElementScheduler<Dim>`
+ */
+template <size_t Dim, typename ElementCollectionTag>
+struct CreateElementCollection {
+  using simple_tags =
+      tmpl::list<ElementCollectionTag, Parallel::Tags::ElementLocations<Dim>,
+                 Parallel::Tags::NumberOfElementsTerminated,
+                 Parallel::Tags::ElementScheduler<Dim>>;
+  using compute_tags = tmpl::list<>;
+  using const_global_cache_tags =
+      tmpl::list<domain::Tags::Domain<Dim>, domain::Tags::ElementDistribution>;
+
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent>
+  static Parallel::iterable_action_return_t apply(
+      db::DataBox<DbTagsList>& box,
+      const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+      Parallel::GlobalCache<Metavariables>& cache,
+      const ArrayIndex& /*array_index*/, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) {
+    using simple_tags_from_options =
+        typename ParallelComponent::simple_tags_from_options;
+    const auto& domain = Parallel::get<domain::Tags::Domain<Dim>>(cache);
+    const auto& initial_refinement_levels =
+        db::get<domain::Tags::InitialRefinementLevels<Dim>>(box);
+    const auto& initial_extents =
+        db::get<domain::Tags::InitialExtents<Dim>>(box);
+    const auto& quadrature = db::get<evolution::dg::Tags::Quadrature>(box);
+    const std::optional<domain::ElementWeight>& element_weight =
+        Parallel::get<domain::Tags::ElementDistribution>(cache);
+    const std::unordered_set<size_t>& procs_to_ignore =
+        cache.get_resource_info().procs_to_ignore();
+
+    const size_t my_node = Parallel::my_node<size_t>(cache);
+    const size_t number_of_procs = Parallel::number_of_procs<size_t>(cache);
+    const size_t number_of_nodes = Parallel::number_of_nodes<size_t>(cache);
+    const size_t num_of_procs_to_use = number_of_procs - procs_to_ignore.size();
+
+    // The initialization items of the elements are the options that were
+    // passed to the nodegroup.
+    const tuples::tagged_tuple_from_typelist<simple_tags_from_options>
+        initialization_items = db::copy_items<simple_tags_from_options>(box);
+    const auto global_cache_proxy = cache.get_this_proxy();
+
+    db::mutate<ElementCollectionTag, Parallel::Tags::ElementLocations<Dim>,
+               Parallel::Tags::NumberOfElementsTerminated,
+               Parallel::Tags::ElementScheduler<Dim>>(
+        [&](const auto element_collection_ptr,
+            const gsl::not_null<std::unordered_map<ElementId<Dim>, size_t>*>
+                element_locations,
+            const gsl::not_null<size_t*> number_of_elements_terminated,
+            const gsl::not_null<Parallel::ElementScheduler<Dim>*> scheduler) {
+          Parallel::create_elements_using_distribution(
+              [&element_collection_ptr, &element_locations,
+               &global_cache_proxy, &initialization_items, my_node](
+                  const ElementId<Dim>& element_id, const size_t target_proc,
+                  const size_t target_node) {
+                (*element_locations)[element_id] = target_node;
+                if (target_node == my_node) {
+                  auto [it, inserted] = element_collection_ptr->emplace(
+                      std::piecewise_construct,
+                      std::forward_as_tuple(element_id),
+                      std::forward_as_tuple(global_cache_proxy,
+                                            initialization_items, element_id));
+                  (void)inserted;
+                  it->second.set_core(target_proc);
+                }
+              },
+              element_weight, domain.blocks(), initial_extents,
+              initial_refinement_levels, quadrature, procs_to_ignore,
+              number_of_procs, number_of_nodes, num_of_procs_to_use, cache,
+              my_node == 0);
+          // Elements are constructed in the terminated state.
+          *number_of_elements_terminated = element_collection_ptr->size();
+
+          std::unordered_set<ElementId<Dim>> elements_on_node_boundary{};
+          for (const auto& [element_id, element] : *element_collection_ptr) {
+            (void)element;
+            const Element<Dim> dg_element =
+                domain::Initialization::create_initial_element(
+                    element_id, domain.blocks()[element_id.block_id()],
+                    initial_refinement_levels);
+            for (const auto& [direction, neighbors] : dg_element.neighbors()) {
+              (void)direction;
+              for (const auto& neighbor_id : neighbors.ids()) {
+                if (element_locations->at(neighbor_id) != my_node) {
+                  elements_on_node_boundary.insert(element_id);
+                }
+              }
+            }
+          }
+          scheduler->set_elements_on_node_boundary(
+              std::move(elements_on_node_boundary));
+        },
+        make_not_null(&box));
+    return {Parallel::AlgorithmExecution::Continue, std::nullopt};
+  }
+};
+
+/*!
+ * \brief Contributes to a reduction over the nodes of the
+ * `DgElementCollection` that calls
+ * `Parallel::Actions::SpawnInitializeElementsInCollection` once every node has
+ * created its elements with `Parallel::Actions::CreateElementCollection`.
+ *
+ * The nodegroup's algorithm is paused, since the elements run their own
+ * action lists from here on.
+ */
+struct ContributeToSpawnInitializeElements {
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent>
+  static Parallel::iterable_action_return_t apply(
+      db::DataBox<DbTagsList>& /*box*/,
+      const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+      Parallel::GlobalCache<Metavariables>& cache,
+      const ArrayIndex& /*array_index*/, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) {
+    auto my_proxy = Parallel::get_parallel_component<ParallelComponent>(cache);
+    Parallel::contribute_to_reduction<SpawnInitializeElementsInCollection>(
+        Parallel::ReductionData<
+            Parallel::ReductionDatum<double, funcl::AssertEqual<>>>{0.0},
+        my_proxy[Parallel::my_node<size_t>(cache)], my_proxy);
+    return {Parallel::AlgorithmExecution::Pause, std::nullopt};
+  }
+};
+}  // namespace Parallel::Actions
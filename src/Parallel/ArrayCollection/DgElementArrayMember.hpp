@@ -129,6 +129,15 @@ class DgElementArrayMember<Dim, Metavariables,
   /// Start evaluating the algorithm until it is stopped by an action.
   void perform_algorithm() override;
 
+  /// Call the simple action `Action` on the element. The caller must hold the
+  /// `element_lock()`.
+  template <typename Action, typename... Args>
+  void simple_action(Args&&... args) {
+    Action::template apply<ParallelComponent>(
+        box_, *Parallel::local_branch(global_cache_proxy_), this->element_id_,
+        std::forward<Args>(args)...);
+  }
+
   template <typename ThisAction, typename PhaseIndex, typename DataBoxIndex>
   bool invoke_iterable_action();
 
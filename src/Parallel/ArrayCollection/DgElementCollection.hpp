@@ -0,0 +1,108 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+
+#include "Parallel/Algorithms/AlgorithmNodegroup.hpp"
+#include "Parallel/ArrayCollection/CreateElementCollection.hpp"
+#include "Parallel/ArrayCollection/DgElementArrayMember.hpp"
+#include "Parallel/ArrayCollection/Tags/ElementCollection.hpp"
+#include "Parallel/ArrayCollection/TransformPdalForNodegroup.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Local.hpp"
+#include "Parallel/ParallelComponentHelpers.hpp"
+#include "Parallel/Phase.hpp"
+#include "Parallel/PhaseDependentActionList.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace Parallel {
+/*!
+ * \brief A nodegroup parallel component that holds the DG elements of the
+ * computational domain that were assigned to its node.
+ *
+ * This is a drop-in replacement for `DgElementArray` that runs the same
+ * `PhaseDepActionList` on each element. Instead of being a Charm++ array
+ * element, each element is a `Parallel::DgElementArrayMember` stored in the
+ * `element_collection_tag` of the nodegroup's DataBox. The elements are
+ * distributed over the nodes in the same way as `DgElementArray` distributes
+ * them over the processors (see `Parallel::Actions::CreateElementCollection`),
+ * and any processor on the node can execute any of the node's elements.
+ *
+ * Elements on the same node send boundary data to each other with
+ * `Parallel::Actions::SendDataToElement`, which inserts the data directly into
+ * the receiving element's inbox (lock-free for
+ * `evolution::dg::AtomicInboxBoundaryData`) and only sends a Charm++ message to
+ * wake up the receiver. Actions that send data to neighbors should check
+ * `Parallel::is_dg_element_collection_v<ParallelComponent>` to choose between
+ * `SendDataToElement` and `Parallel::receive_data`.
+ *
+ * Charm++ takes exactly one contribution to a reduction from each branch of the
+ * nodegroup. Reductions over the elements, e.g. in
+ * `Parallel::contribute_to_phase_change_reduction` and
+ * `Events::ChangeSlabSize`, therefore combine the contributions of the
+ * elements on each node with `Parallel::Actions::ContributeFromElement` first.
+ * A reduction whose result is sent back to the elements can target
+ * `Parallel::Actions::SimpleActionOnElements`.
+ *
+ * Executables choose the component at compile time, e.g.
+ *
+ * \code
+ * static constexpr bool use_dg_element_collection = true;
+ * using dg_element_array = tmpl::conditional_t<
+ *     use_dg_element_collection,
+ *     Parallel::DgElementCollection<volume_dim, EvolutionMetavars,
+ *                                   dg_element_array_pdal>,
+ *     DgElementArray<EvolutionMetavars, dg_element_array_pdal>>;
+ * \endcode
+ *
+ * The Burgers executable is built both ways, as `EvolveBurgers` and
+ * `EvolveBurgersElementCollection`.
+ */
+template <size_t Dim, class Metavariables, class PhaseDepActionList>
+struct DgElementCollection {
+  static constexpr size_t volume_dim = Dim;
+
+  using chare_type = Parallel::Algorithms::Nodegroup;
+  using metavariables = Metavariables;
+  /// The phase-dependent action list run on each element
+  using element_phase_dependent_action_list = PhaseDepActionList;
+
+  using simple_tags_from_options = Parallel::get_simple_tags_from_options<
+      Parallel::get_initialization_actions_list<PhaseDepActionList>>;
+
+  using element_collection_tag =
+      Tags::ElementCollection<Dim, Metavariables, PhaseDepActionList,
+                              simple_tags_from_options>;
+
+  using phase_dependent_action_list = tmpl::push_front<
+      TransformPhaseDependentActionListForNodegroup<PhaseDepActionList>,
+      Parallel::PhaseActions<
+          Parallel::Phase::Initialization,
+          tmpl::list<Actions::CreateElementCollection<
+                         Dim, element_collection_tag>,
+                     Actions::ContributeToSpawnInitializeElements>>>;
+
+  // The actions of the elements are not in `phase_dependent_action_list`, so
+  // the global cache tags they need are added here.
+  using const_global_cache_tags =
+      Parallel::get_const_global_cache_tags_from_actions<tmpl::flatten<
+          tmpl::transform<PhaseDepActionList,
+                          get_action_list_from_phase_dep_action_list<
+                              tmpl::_1>>>>;
+  using mutable_global_cache_tags =
+      Parallel::get_mutable_global_cache_tags_from_actions<tmpl::flatten<
+          tmpl::transform<PhaseDepActionList,
+                          get_action_list_from_phase_dep_action_list<
+                              tmpl::_1>>>>;
+
+  static void execute_next_phase(
+      const Parallel::Phase next_phase,
+      Parallel::CProxy_GlobalCache<Metavariables>& global_cache) {
+    auto& local_cache = *Parallel::local_branch(global_cache);
+    Parallel::get_parallel_component<DgElementCollection>(local_cache)
+        .start_phase(next_phase);
+  }
+};
+}  // namespace Parallel
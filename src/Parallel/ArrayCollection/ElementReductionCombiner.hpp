@@ -0,0 +1,86 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+
+#include "Domain/Structure/ElementId.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+
+namespace Parallel {
+/*!
+ * \brief Combines the contributions of the elements of a
+ * `DgElementCollection` on one node to a sequence of reductions.
+ *
+ * \details Charm++ requires exactly one contribution to a reduction from each
+ * branch of a nodegroup, while each element on the node contributes once. The
+ * \f$k\f$-th contribution of every element is part of the \f$k\f$-th reduction,
+ * just as for the elements of a `DgElementArray`. `add()` combines it with the
+ * contributions of the other elements to that reduction using
+ * `ReductionData::combine`, and returns the combined data once all elements on
+ * the node have contributed. The node must then contribute the combined data.
+ *
+ * Since each element contributes to the reductions in order, reductions
+ * complete in order too, so the node contributes in the same order on every
+ * node. Once no reduction is pending every element has contributed the same
+ * number of times, so elements that are created or removed (e.g. by AMR) while
+ * no reduction is pending are handled correctly.
+ *
+ * This class is not thread-safe.
+ */
+template <size_t Dim, typename ReductionData>
+class ElementReductionCombiner {
+ public:
+  /// Add the contribution of `element_id` to its next reduction. Returns the
+  /// combined data of the reduction if all `number_of_elements` elements on the
+  /// node have now contributed to it.
+  std::optional<ReductionData> add(const ElementId<Dim>& element_id,
+                                   ReductionData reduction_data,
+                                   const size_t number_of_elements) {
+    // Elements that have not contributed while reductions were pending start
+    // at the first pending reduction.
+    const size_t reduction =
+        number_of_contributions_.try_emplace(element_id, first_reduction_)
+            .first->second++;
+    const size_t slot = reduction - first_reduction_;
+    ASSERT(slot <= pending_.size(),
+           "Element " << element_id << " skipped a reduction.");
+    if (slot == pending_.size()) {
+      pending_.emplace_back(std::move(reduction_data), 1);
+    } else {
+      pending_[slot].first.combine(std::move(reduction_data));
+      ++pending_[slot].second;
+    }
+    ASSERT(pending_[slot].second <= number_of_elements,
+           "More elements contributed to a reduction than there are on the "
+           "node.");
+    if (pending_.front().second < number_of_elements) {
+      return std::nullopt;
+    }
+    std::optional<ReductionData> result{std::move(pending_.front().first)};
+    pending_.pop_front();
+    ++first_reduction_;
+    if (pending_.empty()) {
+      number_of_contributions_.clear();
+      first_reduction_ = 0;
+    }
+    return result;
+  }
+
+  /// The number of reductions that some but not all elements contributed to.
+  size_t number_of_pending_reductions() const { return pending_.size(); }
+
+ private:
+  // The index of the reduction in the front of `pending_`.
+  size_t first_reduction_{0};
+  // The combined data and the number of contributions of each reduction that
+  // is not complete yet.
+  std::deque<std::pair<ReductionData, size_t>> pending_{};
+  std::unordered_map<ElementId<Dim>, size_t> number_of_contributions_{};
+};
+}  // namespace Parallel
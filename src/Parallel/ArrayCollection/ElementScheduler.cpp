@@ -0,0 +1,117 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Parallel/ArrayCollection/ElementScheduler.hpp"
+
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <pup.h>
+#include <pup_stl.h>
+#include <unordered_set>
+#include <utility>
+
+#include "Domain/Structure/ElementId.hpp"
+#include "Parallel/NodeLock.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+
+namespace Parallel {
+template <size_t Dim>
+void ElementScheduler<Dim>::set_elements_on_node_boundary(
+    std::unordered_set<ElementId<Dim>> elements_on_node_boundary) {
+  const std::lock_guard lock(lock_);
+  elements_on_node_boundary_ = std::move(elements_on_node_boundary);
+}
+
+template <size_t Dim>
+void ElementScheduler<Dim>::push(const ElementId<Dim>& element_id,
+                                 const double time) {
+  const std::lock_guard lock(lock_);
+  const bool not_on_node_boundary =
+      elements_on_node_boundary_.count(element_id) == 0;
+  const auto queued_time = queued_times_.find(element_id);
+  if (queued_time != queued_times_.end()) {
+    if (queued_time->second <= time) {
+      return;
+    }
+    queue_.erase(Entry{queued_time->second, not_on_node_boundary, element_id});
+    queued_time->second = time;
+  } else {
+    queued_times_.emplace(element_id, time);
+  }
+  queue_.emplace(time, not_on_node_boundary, element_id);
+}
+
+template <size_t Dim>
+std::optional<ElementId<Dim>> ElementScheduler<Dim>::pop() {
+  const std::lock_guard lock(lock_);
+  for (auto it = queue_.begin(); it != queue_.end(); ++it) {
+    const ElementId<Dim> element_id = std::get<2>(*it);
+    if (running_elements_.count(element_id) == 1) {
+      continue;
+    }
+    queue_.erase(it);
+    queued_times_.erase(element_id);
+    running_elements_.insert(element_id);
+    return element_id;
+  }
+  return std::nullopt;
+}
+
+template <size_t Dim>
+bool ElementScheduler<Dim>::set_running(const ElementId<Dim>& element_id) {
+  const std::lock_guard lock(lock_);
+  if (running_elements_.insert(element_id).second) {
+    return true;
+  }
+  ASSERT(phase_start_pending_.count(element_id) == 0,
+         "Element " << element_id
+                    << " is already waiting to start the next phase.");
+  phase_start_pending_.insert(element_id);
+  return false;
+}
+
+template <size_t Dim>
+typename ElementScheduler<Dim>::NextRun ElementScheduler<Dim>::finished_running(
+    const ElementId<Dim>& element_id) {
+  const std::lock_guard lock(lock_);
+  ASSERT(running_elements_.count(element_id) == 1,
+         "Element " << element_id << " is not running.");
+  if (phase_start_pending_.erase(element_id) == 1) {
+    // The element stays marked as running for the phase start.
+    return NextRun::StartPhase;
+  }
+  running_elements_.erase(element_id);
+  return queued_times_.count(element_id) == 1 ? NextRun::PerformAlgorithm
+                                              : NextRun::None;
+}
+
+template <size_t Dim>
+size_t ElementScheduler<Dim>::size() const {
+  const std::lock_guard lock(lock_);
+  return queue_.size();
+}
+
+template <size_t Dim>
+void ElementScheduler<Dim>::pup(PUP::er& p) {
+  // Queued elements are restarted by the phase change that follows a
+  // checkpoint, so only the node boundary is serialized.
+  p | elements_on_node_boundary_;
+  if (p.isUnpacking()) {
+    queue_.clear();
+    queued_times_.clear();
+    running_elements_.clear();
+    phase_start_pending_.clear();
+  }
+}
+
+#define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
+
+#define INSTANTIATION(r, data) template class ElementScheduler<DIM(data)>;
+
+GENERATE_INSTANTIATIONS(INSTANTIATION, (1, 2, 3))
+
+#undef INSTANTIATION
+#undef DIM
+}  // namespace Parallel
@@ -0,0 +1,123 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <set>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "Domain/Structure/ElementId.hpp"
+#include "Parallel/NodeLock.hpp"
+
+/// \cond
+namespace PUP {
+class er;
+}  // namespace PUP
+/// \endcond
+
+namespace Parallel {
+/*!
+ * \brief The queue of elements of a `DgElementCollection` that have received
+ * data and are ready to run on the node.
+ *
+ * \details Every entry method that executes an element of the collection takes
+ * the most urgent element from this queue rather than the element the message
+ * was addressed to. Since the entry methods of a nodegroup run on whichever
+ * processor of the node is idle, this lets idle processors pick up (steal)
+ * work that was queued by any other processor on the node, and makes the
+ * elements that hold back the rest of the simulation run first.
+ *
+ * Elements are ordered by:
+ * 1. The time they are at, earliest first. With local time stepping this is
+ *    the element that its neighbors are waiting on.
+ * 2. Whether they have a neighbor on another node, those first, so that data
+ *    that has to cross the network is sent as early as possible.
+ * 3. Their `ElementId`, so the order is deterministic.
+ *
+ * An element is queued at most once. Queuing an element that is already
+ * queued moves it to its new time if that is earlier.
+ *
+ * An element that is popped is marked as running until `finished_running()` is
+ * called. `pop()` skips running elements, so a processor never waits on an
+ * element that runs on another processor. Instead, an element that receives
+ * data while it runs stays queued, and `finished_running()` tells the caller to
+ * run it again. Likewise, a phase change that reaches an element while it runs
+ * is deferred until the element is done, and `finished_running()` tells the
+ * caller to start the phase.
+ *
+ * The member functions are thread-safe. They all take the same
+ * `Parallel::NodeLock`, but only hold it for a few operations on small
+ * containers and never while an element runs. Each step of an element does a
+ * fixed number of these calls, and `pop()` skips at most one entry per running
+ * element, i.e. per processor on the node. The lock is therefore short-lived
+ * compared to the work done by the elements.
+ */
+template <size_t Dim>
+class ElementScheduler {
+ public:
+  ElementScheduler() = default;
+  ElementScheduler(const ElementScheduler&) = delete;
+  ElementScheduler& operator=(const ElementScheduler&) = delete;
+  ElementScheduler(ElementScheduler&&) = default;
+  ElementScheduler& operator=(ElementScheduler&&) = default;
+  ~ElementScheduler() = default;
+
+  /// Set the elements that have a neighbor on another node.
+  void set_elements_on_node_boundary(
+      std::unordered_set<ElementId<Dim>> elements_on_node_boundary);
+
+  /// Queue `element_id` at time `time`. The time is a number that increases
+  /// as the element progresses, e.g. the substep time (negated when time runs
+  /// backwards).
+  void push(const ElementId<Dim>& element_id, double time);
+
+  /// Remove and return the most urgent element that is not running, and mark
+  /// it as running. Returns `std::nullopt` if all queued elements are running.
+  std::optional<ElementId<Dim>> pop();
+
+  /// Mark `element_id` as running without taking it from the queue, when the
+  /// element is started by a phase change. Returns `false` if the element is
+  /// already running, in which case the phase is started once it is done (see
+  /// `finished_running()`) and the caller must not run it.
+  [[nodiscard]] bool set_running(const ElementId<Dim>& element_id);
+
+  /// What the caller of `finished_running()` must do with the element.
+  enum class NextRun {
+    /// Nothing, the element is no longer running.
+    None,
+    /// The element was queued while it was running. It is no longer running
+    /// and the caller must make sure that it is run again.
+    PerformAlgorithm,
+    /// A phase change reached the element while it was running. The element
+    /// is still marked as running and the caller must start the phase on it.
+    StartPhase
+  };
+
+  /// Mark `element_id` as done running, and return what the caller must do
+  /// with it next.
+  NextRun finished_running(const ElementId<Dim>& element_id);
+
+  /// The number of queued elements, including those that are running.
+  size_t size() const;
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p);
+
+ private:
+  using Entry = std::tuple<double, bool, ElementId<Dim>>;
+
+  mutable Parallel::NodeLock lock_{};
+  std::unordered_set<ElementId<Dim>> elements_on_node_boundary_{};
+  // Ordered so that the first entry is the most urgent. The boolean is `true`
+  // for elements that are _not_ on the node boundary.
+  std::set<Entry> queue_{};
+  std::unordered_map<ElementId<Dim>, double> queued_times_{};
+  std::unordered_set<ElementId<Dim>> running_elements_{};
+  // Running elements that must start the phase once they are done.
+  std::unordered_set<ElementId<Dim>> phase_start_pending_{};
+};
+}  // namespace Parallel
@@ -9,7 +9,7 @@
 /// \cond
 namespace Parallel {
 template <size_t Dim, typename Metavariables, typename PhaseDepActionList>
-class DgElementCollection;
+struct DgElementCollection;
 }  // namespace Parallel
 /// \endcond
 
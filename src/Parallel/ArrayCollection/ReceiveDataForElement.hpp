@@ -5,9 +5,13 @@
 
 #include <cstddef>
 #include <mutex>
+#include <optional>
+#include <type_traits>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "Domain/Structure/ElementId.hpp"
+#include "Parallel/ArrayCollection/ElementScheduler.hpp"
+#include "Parallel/ArrayCollection/Tags/ElementScheduler.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Invoke.hpp"
 #include "Parallel/Local.hpp"
@@ -17,12 +21,39 @@
 #include "Utilities/Gsl.hpp"
 #include "Utilities/TaggedTuple.hpp"
 
+/// \cond
+class TimeStepId;
+/// \endcond
+
+namespace Parallel::detail {
+// The time used to order the elements in the `Parallel::ElementScheduler`.
+// Temporal ids other than `TimeStepId` do not order the elements.
+template <typename TemporalId>
+double scheduling_time(const TemporalId& temporal_id) {
+  if constexpr (std::is_same_v<TemporalId, TimeStepId>) {
+    return temporal_id.time_runs_forward() ? temporal_id.substep_time()
+                                           : -temporal_id.substep_time();
+  } else {
+    (void)temporal_id;
+    return 0.0;
+  }
+}
+}  // namespace Parallel::detail
+
 namespace Parallel::Actions {
 /// \brief Receive data for a specific element on the nodegroup.
 ///
 /// If `StartPhase` is `true` then `start_phase(phase)` is called on the
-/// `element_to_execute_on`, otherwise `perform_algorithm()` is called on the
-/// `element_to_execute_on`.
+/// `element_to_execute_on`. If the element is running on another processor,
+/// that processor starts the phase once the element is done. Otherwise the
+/// data for `element_to_execute_on` has been queued in the
+/// `Parallel::ElementScheduler` of the node, and `perform_algorithm()` is
+/// called on the most urgent element in the queue that is not already running
+/// on another processor, which need not be `element_to_execute_on`. Each
+/// message runs at most one element. Every queued element either has a message
+/// on its way or is running, and an element that was queued while it was
+/// running sends itself a new message when it is done, so no element is left
+/// waiting in the queue.
 template <bool StartPhase = false>
 struct ReceiveDataForElement {
   /// \brief Entry method called when receiving data from another node.
@@ -46,12 +77,16 @@ struct ReceiveDataForElement {
         make_not_null(&box));
     // Note: We'll be able to do a counter-based check here too once that
     // works for LTS in `SendDataToElement`
+    const double time = detail::scheduling_time(instance);
     ReceiveTag::insert_into_inbox(
         make_not_null(&tuples::get<ReceiveTag>(
             element_collection.at(element_to_execute_on).inboxes())),
         instance, std::move(receive_data));
+    db::get_mutable_reference<Parallel::Tags::ElementScheduler<Dim>>(
+        make_not_null(&box))
+        .push(element_to_execute_on, time);
 
-    apply_impl<ParallelComponent>(cache, element_to_execute_on,
+    apply_impl<ParallelComponent>(box, cache, element_to_execute_on,
                                   make_not_null(&element_collection));
   }
 
@@ -68,36 +103,70 @@ struct ReceiveDataForElement {
     auto& element_collection = db::get_mutable_reference<
         typename ParallelComponent::element_collection_tag>(
         make_not_null(&box));
-    apply_impl<ParallelComponent>(cache, element_to_execute_on,
+    apply_impl<ParallelComponent>(box, cache, element_to_execute_on,
                                   make_not_null(&element_collection));
   }
 
  private:
-  template <typename ParallelComponent, typename Metavariables,
-            typename ElementCollection, size_t Dim>
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, typename ElementCollection, size_t Dim>
   static void apply_impl(
+      db::DataBox<DbTagsList>& box,
       Parallel::GlobalCache<Metavariables>& cache,
       const ElementId<Dim>& element_to_execute_on,
       const gsl::not_null<ElementCollection*> element_collection) {
     const size_t my_node = Parallel::my_node<size_t>(cache);
     auto& my_proxy = Parallel::get_parallel_component<ParallelComponent>(cache);
 
+    auto& scheduler =
+        db::get_mutable_reference<Parallel::Tags::ElementScheduler<Dim>>(
+            make_not_null(&box));
+    std::optional<ElementId<Dim>> element_to_run{};
     if constexpr (StartPhase) {
-      const Phase current_phase =
-          Parallel::local_branch(
-              Parallel::get_parallel_component<ParallelComponent>(cache))
-              ->phase();
-      auto& element = element_collection->at(element_to_execute_on);
-      const std::lock_guard element_lock(element.element_lock());
-      element.start_phase(current_phase);
+      if (not scheduler.set_running(element_to_execute_on)) {
+        // The element is running on another processor, which starts the
+        // phase once it is done.
+        return;
+      }
+      element_to_run = element_to_execute_on;
     } else {
-      auto& element = element_collection->at(element_to_execute_on);
-      std::unique_lock element_lock(element.element_lock(), std::defer_lock);
-      if (element_lock.try_lock()) {
-        element.perform_algorithm();
-      } else {
-        Parallel::threaded_action<Parallel::Actions::ReceiveDataForElement<>>(
-            my_proxy[my_node], element_to_execute_on);
+      (void)element_to_execute_on;
+      element_to_run = scheduler.pop();
+      if (not element_to_run.has_value()) {
+        // All queued elements are running and will be run again when they
+        // are done.
+        return;
+      }
+    }
+
+    auto& element = element_collection->at(*element_to_run);
+    bool start_phase = StartPhase;
+    while (true) {
+      {
+        // The scheduler makes sure no other processor runs the element, so
+        // the lock only waits for other users of the element such as
+        // observers.
+        const std::lock_guard element_lock(element.element_lock());
+        if (start_phase) {
+          element.start_phase(
+              Parallel::local_branch(
+                  Parallel::get_parallel_component<ParallelComponent>(cache))
+                  ->phase());
+        } else {
+          element.perform_algorithm();
+        }
+      }
+      switch (scheduler.finished_running(*element_to_run)) {
+        case ElementScheduler<Dim>::NextRun::None:
+          return;
+        case ElementScheduler<Dim>::NextRun::PerformAlgorithm:
+          Parallel::threaded_action<Parallel::Actions::ReceiveDataForElement<>>(
+              my_proxy[my_node], *element_to_run);
+          return;
+        case ElementScheduler<Dim>::NextRun::StartPhase:
+          // A phase change reached the element while it was running.
+          start_phase = true;
+          break;
       }
     }
   }
@@ -11,8 +11,10 @@
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "Domain/Structure/ElementId.hpp"
 #include "Evolution/DiscontinuousGalerkin/AtomicInboxBoundaryData.hpp"
+#include "Parallel/ArrayCollection/ElementScheduler.hpp"
 #include "Parallel/ArrayCollection/ReceiveDataForElement.hpp"
 #include "Parallel/ArrayCollection/Tags/ElementLocations.hpp"
+#include "Parallel/ArrayCollection/Tags/ElementScheduler.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Info.hpp"
 #include "Parallel/NodeLock.hpp"
@@ -34,6 +36,10 @@ namespace Parallel::Actions {
  * system (e.g. Charm++) only when the receiver/neighbor element has all the
  * data it needs to take the next time step. This is done so as to reduce
  * pressure on the runtime system by sending fewer messages.
+ *
+ * The receiver is queued in the node's `Parallel::ElementScheduler` at the
+ * time of `instance`, so the entry method that runs it executes the most
+ * urgent element on the node.
  */
 struct SendDataToElement {
   using return_type = void;
@@ -63,6 +69,7 @@ struct SendDataToElement {
     auto& my_proxy =
         Parallel::get_parallel_component<ParallelComponent>(*cache);
     if (node_of_element == my_node) {
+      const double time = Parallel::detail::scheduling_time(instance);
       [[maybe_unused]] size_t count = 0;
       if constexpr (std::is_same_v<evolution::dg::AtomicInboxBoundaryData<Dim>,
                                    typename ReceiveTag::type>) {
@@ -70,9 +77,11 @@ struct SendDataToElement {
             make_not_null(&tuples::get<ReceiveTag>(element.inboxes())),
             instance, std::forward<ReceiveData>(receive_data));
       } else {
-        // Scope so that we minimize how long we lock the inbox.
+        // Scope so that we minimize how long we lock the inbox. Inbox tags
+        // such as `evolution::dg::subcell::Tags::InitialTciData` do not return
+        // the size of the inbox.
         std::lock_guard inbox_lock(element.inbox_lock());
-        count = ReceiveTag::insert_into_inbox(
+        ReceiveTag::insert_into_inbox(
             make_not_null(&tuples::get<ReceiveTag>(element.inboxes())),
             instance, std::forward<ReceiveData>(receive_data));
       }
@@ -83,6 +92,9 @@ struct SendDataToElement {
       // directions that don't have external boundaries in our neighbors block.
       // if (count >=
       //     (2 * Dim - element_to_execute_on.number_of_block_boundaries())) {
+      db::get_mutable_reference<Parallel::Tags::ElementScheduler<Dim>>(
+          make_not_null(&box))
+          .push(element_to_execute_on, time);
       Parallel::threaded_action<Parallel::Actions::ReceiveDataForElement<>>(
           my_proxy[node_of_element], element_to_execute_on);
       // }
@@ -0,0 +1,87 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <utility>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Parallel/ArrayCollection/ElementScheduler.hpp"
+#include "Parallel/ArrayCollection/ReceiveDataForElement.hpp"
+#include "Parallel/ArrayCollection/Tags/ElementScheduler.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Info.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Parallel/NodeLock.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace Parallel::Actions {
+/*!
+ * \brief A threaded action that calls the simple action `SimpleAction` on the
+ * element `element_id` of the `DgElementCollection` and then runs the element.
+ *
+ * The element is queued in the node's `Parallel::ElementScheduler` at time
+ * zero, since the simple action carries no time, so that an element that was
+ * waiting for the data of the simple action continues.
+ */
+template <typename SimpleAction>
+struct SimpleActionOnElement {
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, typename ArrayIndex, size_t Dim,
+            typename DistributedObject, typename... Args>
+  static void apply(db::DataBox<DbTagsList>& box,
+                    Parallel::GlobalCache<Metavariables>& cache,
+                    const ArrayIndex& /*array_index*/,
+                    const gsl::not_null<Parallel::NodeLock*> /*node_lock*/,
+                    const DistributedObject* /*distributed_object*/,
+                    const ElementId<Dim>& element_id, Args&&... args) {
+    auto& element = db::get_mutable_reference<
+                        typename ParallelComponent::element_collection_tag>(
+                        make_not_null(&box))
+                        .at(element_id);
+    {
+      const std::lock_guard element_lock(element.element_lock());
+      element.template simple_action<SimpleAction>(std::forward<Args>(args)...);
+    }
+    db::get_mutable_reference<Parallel::Tags::ElementScheduler<Dim>>(
+        make_not_null(&box))
+        .push(element_id, 0.0);
+    Parallel::threaded_action<Parallel::Actions::ReceiveDataForElement<>>(
+        Parallel::get_parallel_component<ParallelComponent>(
+            cache)[Parallel::my_node<size_t>(cache)],
+        element_id);
+  }
+};
+
+/*!
+ * \brief A simple action on the `DgElementCollection` that calls the simple
+ * action `SimpleAction` on every element of the node, e.g. as the target of a
+ * reduction over the elements (see
+ * `Parallel::Actions::ContributeFromElement`).
+ *
+ * Since the nodegroup holds its `Parallel::NodeLock` while running this
+ * action, the elements are not locked here. Instead, a
+ * `Parallel::Actions::SimpleActionOnElement` is sent to each element.
+ */
+template <typename SimpleAction>
+struct SimpleActionOnElements {
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, typename ArrayIndex, typename... Args>
+  static void apply(db::DataBox<DbTagsList>& box,
+                    Parallel::GlobalCache<Metavariables>& cache,
+                    const ArrayIndex& /*array_index*/, const Args&... args) {
+    auto proxy_to_this_node =
+        Parallel::get_parallel_component<ParallelComponent>(
+            cache)[Parallel::my_node<size_t>(cache)];
+    for (const auto& [element_id, element] :
+         db::get<typename ParallelComponent::element_collection_tag>(box)) {
+      (void)element;
+      Parallel::threaded_action<SimpleActionOnElement<SimpleAction>>(
+          proxy_to_this_node, element_id, args...);
+    }
+  }
+};
+}  // namespace Parallel::Actions
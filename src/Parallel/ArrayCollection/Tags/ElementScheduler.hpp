@@ -0,0 +1,25 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+
+#include "DataStructures/DataBox/Tag.hpp"
+
+/// \cond
+namespace Parallel {
+template <size_t Dim>
+class ElementScheduler;
+}  // namespace Parallel
+/// \endcond
+
+namespace Parallel::Tags {
+/// \brief The elements on the node that are ready to run.
+///
+/// This tag must be in the nodegroup DataBox.
+template <size_t Dim>
+struct ElementScheduler : db::SimpleTag {
+  using type = Parallel::ElementScheduler<Dim>;
+};
+}  // namespace Parallel::Tags
@@ -0,0 +1,169 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "Parallel/StaticSpscQueue.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace Parallel {
+/*!
+ * \brief An unbounded single-producer single-consumer lockfree queue.
+ *
+ * The queue is a linked list of `Parallel::StaticSpscQueue`s ("blocks") of
+ * capacity `BlockCapacity`. No memory is allocated until the first element is
+ * pushed. When the last block is full the producer allocates a new block and
+ * links it to the last block, so pushing never fails and never overwrites
+ * elements. The consumer frees a block once it has been drained and the
+ * producer has moved on to the next block. The number of times the queue had
+ * to grow is available from `number_of_overflows()`.
+ *
+ * The threadsafety guarantees are the same as for `Parallel::StaticSpscQueue`:
+ * at no time may more than one thread push and more than one thread read or
+ * pop.
+ *
+ * \note This class is intentionally not serializable since handling
+ * threadsafety around serialization requires careful thought of the individual
+ * circumstances.
+ */
+template <typename T, size_t BlockCapacity>
+class GrowableSpscQueue {
+  static_assert(BlockCapacity > 0, "The block capacity must be positive.");
+
+ public:
+  GrowableSpscQueue() = default;
+  ~GrowableSpscQueue() {
+    Block* block = head_.load(std::memory_order_acquire);
+    while (block != nullptr) {
+      Block* next = block->next.load(std::memory_order_acquire);
+      // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+      delete block;
+      block = next;
+    }
+  }
+
+  GrowableSpscQueue(const GrowableSpscQueue&) = delete;
+  GrowableSpscQueue& operator=(const GrowableSpscQueue&) = delete;
+  GrowableSpscQueue(GrowableSpscQueue&&) = delete;
+  GrowableSpscQueue& operator=(GrowableSpscQueue&&) = delete;
+
+  /// Construct a new element at the end of the queue in place, allocating a
+  /// new block if the last one is full.
+  template <typename... Args>
+  void emplace(Args&&... args) {
+    static_assert(std::is_constructible_v<T, Args&&...>,
+                  "T must be constructible with Args&&...");
+    if (UNLIKELY(tail_ == nullptr)) {
+      // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+      tail_ = new Block{};
+      head_.store(tail_, std::memory_order_release);
+    }
+    // `try_emplace` does not touch `args` if the block is full, so they can
+    // still be forwarded to the new block.
+    if (UNLIKELY(not tail_->queue.try_emplace(std::forward<Args>(args)...))) {
+      // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+      auto* const new_block = new Block{};
+      // NOLINTNEXTLINE(bugprone-use-after-move)
+      new_block->queue.emplace(std::forward<Args>(args)...);
+      // The producer never writes to a block again once the next block is
+      // linked, which is what allows the consumer to free drained blocks.
+      tail_->next.store(new_block, std::memory_order_release);
+      tail_ = new_block;
+      number_of_overflows_.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  /// Push a new element to the end of the queue.
+  void push(const T& v) { emplace(v); }
+
+  /// Push a new element to the end of the queue.
+  void push(T&& v) { emplace(std::move(v)); }
+
+  /// Returns the first element from the queue.
+  ///
+  /// \note Returns `nullptr` if the queue is empty.
+  [[nodiscard]] T* front() {
+    Block* head = head_.load(std::memory_order_acquire);
+    if (head == nullptr) {
+      return nullptr;
+    }
+    T* result = head->queue.front();
+    while (result == nullptr) {
+      Block* const next = head->next.load(std::memory_order_acquire);
+      if (next == nullptr) {
+        return nullptr;
+      }
+      // Elements may have been pushed to `head` before `next` was linked, so
+      // we check again before freeing it.
+      result = head->queue.front();
+      if (result != nullptr) {
+        break;
+      }
+      head_.store(next, std::memory_order_release);
+      // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+      delete head;
+      head = next;
+      result = head->queue.front();
+    }
+    return result;
+  }
+
+  /// Removes the first element from the queue.
+  ///
+  /// Must only be called after `front()` returned a non-null pointer.
+  void pop() {
+    Block* const head = head_.load(std::memory_order_acquire);
+    ASSERT(head != nullptr, "Can't pop an element from an empty queue.");
+    head->queue.pop();
+  }
+
+  /// Returns the size of the queue at a particular hardware state.
+  ///
+  /// \warning Since the consumer frees drained blocks this may only be called
+  /// from the consumer thread or while no thread is popping.
+  [[nodiscard]] size_t size() const {
+    size_t result = 0;
+    const Block* block = head_.load(std::memory_order_acquire);
+    while (block != nullptr) {
+      result += block->queue.size();
+      block = block->next.load(std::memory_order_acquire);
+    }
+    return result;
+  }
+
+  /// Returns `true` if the queue may be empty, otherwise `false`.
+  ///
+  /// \warning The same restrictions as for `size()` apply.
+  [[nodiscard]] bool empty() const { return size() == 0; }
+
+  /// The number of times a push found the last block full and had to allocate
+  /// a new block.
+  [[nodiscard]] size_t number_of_overflows() const {
+    return number_of_overflows_.load(std::memory_order_relaxed);
+  }
+
+  /// The capacity of each block.
+  [[nodiscard]] static constexpr size_t block_capacity() {
+    return BlockCapacity;
+  }
+
+ private:
+  struct Block {
+    StaticSpscQueue<T, BlockCapacity> queue{};
+    std::atomic<Block*> next{nullptr};
+  };
+
+  // Read and written by the consumer. Only written by the producer when the
+  // first block is allocated.
+  std::atomic<Block*> head_{nullptr};
+  // Only accessed by the producer.
+  Block* tail_{nullptr};
+  std::atomic_size_t number_of_overflows_{0};
+};
+}  // namespace Parallel
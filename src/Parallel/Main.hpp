@@ -42,6 +42,7 @@
 #include "Utilities/Formaline.hpp"
 #include "Utilities/MakeString.hpp"
 #include "Utilities/Overloader.hpp"
+#include "Utilities/PrettyType.hpp"
 #include "Utilities/StdHelpers.hpp"
 #include "Utilities/System/Exit.hpp"
 #include "Utilities/System/ParallelInfo.hpp"
@@ -97,6 +98,10 @@ class Main : public CBase_Main<Metavariables> {
   void allocate_remaining_components_and_execute_initialization_phase();
 
   /// Determine the next phase of the simulation and execute it.
+  ///
+  /// When the phase changes, the wall time spent in the phase being left is
+  /// printed, so together with the time at which each array component was
+  /// allocated this gives a timeline of the startup of the executable.
   void execute_next_phase();
 
   /// Place the Charm++ call that starts load balancing
@@ -156,6 +161,10 @@ class Main : public CBase_Main<Metavariables> {
   // Check if future checkpoint dirs are available; error if any already exist.
   void check_future_checkpoint_dirs_available() const;
 
+  // Print the wall time spent in the current phase and restart the timer for
+  // the next phase.
+  void print_phase_duration();
+
   // Starts a reduction on the component specified by
   // the current_termination_check_index_ member variable, then increment
   // current_termination_check_index_
@@ -196,6 +205,10 @@ class Main : public CBase_Main<Metavariables> {
           tmpl::bind<array_component_allocation_options, tmpl::_1>>>>>;
 
   Parallel::Phase current_phase_{Parallel::Phase::Initialization};
+  // The wall time at which `current_phase_` started. This is not serialized,
+  // so after a restart the time of the first phase is measured from the start
+  // of the executable.
+  double current_phase_start_time_{0.0};
   CProxy_GlobalCache<Metavariables> global_cache_proxy_;
   detail::CProxy_AtSyncIndicator<Metavariables> at_sync_indicator_proxy_;
   // This is only used during startup, and will be cleared after all
@@ -460,7 +473,8 @@ Main<Metavariables>::Main(CkArgMsg* msg) {
         tuples::get<Parallel::OptionTags::ResourceInfo<Metavariables>>(
             options_);
 
-    Parallel::printf("\nOption parsing completed.\n");
+    Parallel::printf("\nOption parsing completed at time %s.\n",
+                     sys::pretty_wall_time());
   } catch (const bpo::error& e) {
     ERROR(e.what());
   }
@@ -680,8 +694,11 @@ void Main<Metavariables>::
   // These are Spectre array components built on Charm++ array chares. Each
   // component is in charge of allocating and distributing its elements over the
   // computing system.
+  Parallel::printf("Allocating array components at time %s\n",
+                   sys::pretty_wall_time());
   tmpl::for_each<all_array_component_list>([this](auto parallel_component_v) {
     using parallel_component = tmpl::type_from<decltype(parallel_component_v)>;
+    const double allocation_start_time = sys::wall_time();
     parallel_component::allocate_array(
         global_cache_proxy_,
         Parallel::create_from_options<Metavariables>(
@@ -689,6 +706,9 @@ void Main<Metavariables>::
         Parallel::create_from_options<Metavariables>(
             options_, typename parallel_component::array_allocation_tags{}),
         resource_info_.procs_to_ignore());
+    Parallel::printf("Allocated %s in %g seconds\n",
+                     pretty_type::name<parallel_component>(),
+                     sys::wall_time() - allocation_start_time);
   });
 
   // Free any resources from the initial option parsing.
@@ -700,6 +720,7 @@ void Main<Metavariables>::
         *Parallel::local_branch(global_cache_proxy_))
         .start_phase(current_phase_);
   });
+  current_phase_start_time_ = sys::wall_time();
   CkStartQD(CkCallback(CkIndex_Main<Metavariables>::execute_next_phase(),
                        this->thisProxy));
 }
@@ -736,6 +757,7 @@ void Main<Metavariables>::execute_next_phase() {
     }
 
     // Errored during execution. Go to cleanup
+    print_phase_duration();
     current_phase_ = Parallel::Phase::PostFailureCleanup;
     Parallel::printf("Entering phase: %s at time %s\n", current_phase_,
                      sys::pretty_wall_time());
@@ -756,6 +778,7 @@ void Main<Metavariables>::execute_next_phase() {
     if (next_phase.has_value()) {
       // Only print info if there was an actual phase change.
       if (current_phase_ != next_phase.value()) {
+        print_phase_duration();
         Parallel::printf("Entering phase from phase control: %s at time %s\n",
                          next_phase.value(), sys::pretty_wall_time());
         current_phase_ = next_phase.value();
@@ -776,6 +799,7 @@ void Main<Metavariables>::execute_next_phase() {
               << "' is last in Metavariables::default_phase_order "
               << default_order << "\n");
       }
+      print_phase_duration();
       current_phase_ = *std::next(it);
 
       Parallel::printf("Entering phase: %s at time %s\n", current_phase_,
@@ -1007,6 +1031,14 @@ void Main<Metavariables>::check_future_checkpoint_dirs_available() const {
   }
 }
 
+template <typename Metavariables>
+void Main<Metavariables>::print_phase_duration() {
+  const double now = sys::wall_time();
+  Parallel::printf("Phase %s took %g seconds\n", current_phase_,
+                   now - current_phase_start_time_);
+  current_phase_start_time_ = now;
+}
+
 }  // namespace Parallel
 
 #define CK_TEMPLATES_ONLY
@@ -12,6 +12,7 @@
 #include "Options/Auto.hpp"
 #include "Options/Options.hpp"
 #include "Parallel/AlgorithmMetafunctions.hpp"
+#include "Parallel/ArrayCollection/IsDgElementCollection.hpp"
 #include "Parallel/ExitCode.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Phase.hpp"
@@ -180,7 +181,8 @@ void CheckpointAndExitAfterWallclock::contribute_phase_data_impl(
     Parallel::GlobalCache<Metavariables>& cache,
     const ArrayIndex& array_index) const {
   if constexpr (std::is_same_v<typename ParallelComponent::chare_type,
-                               Parallel::Algorithms::Array>) {
+                               Parallel::Algorithms::Array> or
+                Parallel::is_dg_element_collection_v<ParallelComponent>) {
     Parallel::contribute_to_phase_change_reduction<ParallelComponent>(
         tuples::TaggedTuple<Tags::CheckpointAndExitRequested>{true}, cache,
         array_index);
@@ -6,9 +6,13 @@
 #include <functional>
 #include <optional>
 #include <type_traits>
+#include <utility>
 
+#include "Parallel/ArrayCollection/ContributeFromElement.hpp"
+#include "Parallel/ArrayCollection/IsDgElementCollection.hpp"
 #include "Parallel/CharmRegistration.hpp"
 #include "Parallel/GlobalCache.hpp"
+#include "Parallel/Invoke.hpp"
 #include "Parallel/Local.hpp"
 #include "Parallel/PhaseControl/PhaseControlTags.hpp"
 #include "Parallel/PhaseControlReductionHelpers.hpp"
@@ -28,6 +32,11 @@ namespace Parallel {
 /// execute actions like most SpECTRE parallel components.
 /// For all cases other than sending phase-change decision data to the Main
 /// chare, you should use `Parallel::contribute_to_reduction`.
+///
+/// Array components, including the elements of a `DgElementCollection`, must
+/// pass their `array_index`. The contributions of the elements of a
+/// `DgElementCollection` are combined on each node by
+/// `Parallel::Actions::ContributeFromElement`.
 template <typename SenderComponent, typename ArrayIndex, typename Metavariables,
           class... Ts>
 void contribute_to_phase_change_reduction(
@@ -46,14 +55,32 @@ void contribute_to_phase_change_reduction(
                               PhaseControl::TaggedTupleCombine, Ts...>(nullptr),
                       cache.get_main_proxy().value());
   reduction_data_type reduction_data{data_for_reduction};
-  Parallel::local(
-      Parallel::get_parallel_component<SenderComponent>(cache)[array_index])
-      ->contribute(static_cast<int>(reduction_data.size()),
-                   reduction_data.packed().get(),
-                   Parallel::charmxx::charm_reducer_functions.at(
-                       std::hash<Parallel::charmxx::ReducerFunctions>{}(
-                           &reduction_data_type::combine)),
-                   callback);
+  if constexpr (Parallel::is_dg_element_collection_v<SenderComponent>) {
+    // The nodegroup contributes once all of its elements have.
+    Parallel::local_synchronous_action<
+        Parallel::Actions::ContributeFromElement>(
+        Parallel::get_parallel_component<SenderComponent>(cache), array_index,
+        std::move(reduction_data),
+        [&cache, &callback](reduction_data_type combined_data) {
+          Parallel::local_branch(
+              Parallel::get_parallel_component<SenderComponent>(cache))
+              ->contribute(static_cast<int>(combined_data.size()),
+                           combined_data.packed().get(),
+                           Parallel::charmxx::charm_reducer_functions.at(
+                               std::hash<Parallel::charmxx::ReducerFunctions>{}(
+                                   &reduction_data_type::combine)),
+                           callback);
+        });
+  } else {
+    Parallel::local(
+        Parallel::get_parallel_component<SenderComponent>(cache)[array_index])
+        ->contribute(static_cast<int>(reduction_data.size()),
+                     reduction_data.packed().get(),
+                     Parallel::charmxx::charm_reducer_functions.at(
+                         std::hash<Parallel::charmxx::ReducerFunctions>{}(
+                             &reduction_data_type::combine)),
+                     callback);
+  }
 }
 
 template <typename SenderComponent, typename Metavariables, class... Ts>
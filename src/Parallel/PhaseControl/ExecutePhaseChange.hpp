@@ -9,6 +9,7 @@
 #include <utility>
 
 #include "Parallel/AlgorithmExecution.hpp"
+#include "Parallel/ArrayCollection/IsDgElementCollection.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Phase.hpp"
 #include "Parallel/PhaseControl/ContributeToPhaseChangeReduction.hpp"
@@ -89,7 +90,8 @@ struct ExecutePhaseChange {
     // data was actually sent to make that decision.
     if (should_halt) {
       if constexpr (std::is_same_v<typename ParallelComponent::chare_type,
-                    Parallel::Algorithms::Array>) {
+                                   Parallel::Algorithms::Array> or
+                    Parallel::is_dg_element_collection_v<ParallelComponent>) {
         Parallel::contribute_to_phase_change_reduction<ParallelComponent>(
             tuples::TaggedTuple<TagsAndCombines::UsePhaseChangeArbitration>{
                 true},
@@ -10,6 +10,7 @@
 #include <type_traits>
 
 #include "Options/String.hpp"
+#include "Parallel/ArrayCollection/IsDgElementCollection.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Phase.hpp"
 #include "Parallel/PhaseControl/ContributeToPhaseChangeReduction.hpp"
@@ -129,7 +130,8 @@ struct VisitAndReturn : public PhaseChange {
   void contribute_phase_data_impl(Parallel::GlobalCache<Metavariables>& cache,
                                   const ArrayIndex& array_index) const {
     if constexpr (std::is_same_v<typename ParallelComponent::chare_type,
-                                 Parallel::Algorithms::Array>) {
+                                 Parallel::Algorithms::Array> or
+                  Parallel::is_dg_element_collection_v<ParallelComponent>) {
       Parallel::contribute_to_phase_change_reduction<ParallelComponent>(
           tuples::TaggedTuple<Tags::TemporaryPhaseRequested<TargetPhase>>{true},
           cache, array_index);
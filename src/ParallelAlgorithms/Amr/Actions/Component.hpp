@@ -3,15 +3,23 @@
 
 #pragma once
 
+#include <optional>
+#include <utility>
+
+#include "IO/Logging/Tags.hpp"
+#include "IO/Logging/Verbosity.hpp"
 #include "Parallel/Algorithms/AlgorithmSingleton.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Local.hpp"
 #include "Parallel/ParallelComponentHelpers.hpp"
 #include "Parallel/Phase.hpp"
+#include "Parallel/Printf/Printf.hpp"
 #include "ParallelAlgorithms/Amr/Actions/AdjustDomain.hpp"
 #include "ParallelAlgorithms/Amr/Actions/EvaluateRefinementCriteria.hpp"
 #include "ParallelAlgorithms/Amr/Criteria/Tags/Criteria.hpp"
 #include "ParallelAlgorithms/Amr/Policies/Tags.hpp"
+#include "ParallelAlgorithms/Amr/Tags.hpp"
+#include "Utilities/System/ParallelInfo.hpp"
 #include "Utilities/TMPL.hpp"
 
 /// \ingroup AmrGroup
@@ -24,6 +32,10 @@ namespace amr {
 ///   on global processor 0.
 /// - As a reduction target to perform sanity checks after AMR, output
 ///   AMR diagnostics, or determine when to trigger AMR.
+///
+/// At Verbosity::Verbose or higher, the wall time spent in the
+/// Parallel::Phase::EvaluateAmrCriteria and Parallel::Phase::AdjustDomain
+/// phases is printed when the following phase starts.
 template <class Metavariables>
 struct Component {
   using metavariables = Metavariables;
@@ -44,6 +56,23 @@ struct Component {
       const Parallel::Phase next_phase,
       Parallel::CProxy_GlobalCache<Metavariables>& global_cache_proxy) {
     auto& local_cache = *Parallel::local_branch(global_cache_proxy);
+    // Phases are separated by quiescence detection, so the time until the
+    // next phase starts is the time spent in the AMR phase.  This is always
+    // called on the same processing element as Main.
+    static std::optional<std::pair<Parallel::Phase, double>> amr_phase_start{};
+    if (amr_phase_start.has_value()) {
+      if (Parallel::get<logging::Tags::Verbosity<amr::OptionTags::AmrGroup>>(
+              local_cache) >= Verbosity::Verbose) {
+        Parallel::printf("AMR phase %s took %g seconds\n",
+                         amr_phase_start->first,
+                         sys::wall_time() - amr_phase_start->second);
+      }
+      amr_phase_start.reset();
+    }
+    if (Parallel::Phase::EvaluateAmrCriteria == next_phase or
+        Parallel::Phase::AdjustDomain == next_phase) {
+      amr_phase_start = std::make_pair(next_phase, sys::wall_time());
+    }
     Parallel::get_parallel_component<Component>(local_cache)
         .start_phase(next_phase);
     if (Parallel::Phase::EvaluateAmrCriteria == next_phase) {
@@ -37,6 +37,11 @@ namespace amr::Actions {
 /// Otherwise, it will invoke amr::Actions::CreateChild on the next element of
 /// `children_ids`.
 ///
+/// The children are inserted one at a time so that the callback of the last
+/// child is only executed once all of its siblings exist, which guarantees that
+/// amr::Actions::SendDataToChildren does not send data to an element that has
+/// not been created yet.
+///
 /// This action does not modify anything in the DataBox
 struct CreateChild {
   template <typename ParallelComponent, typename DbTagList,
@@ -69,7 +69,10 @@ namespace amr::Actions {
 /// \details
 /// - Evaluates each refinement criteria held by amr::Criteria::Tags::Criteria,
 ///   and in each dimension selects the amr::Flag with the highest
-///   priority (i.e the highest integral value).
+///   priority (i.e the highest integral value). The criteria are evaluated
+///   one after the other with the same ObservationBox, so compute tags
+///   requested by several criteria (e.g.
+///   amr::Criteria::Tags::ModalCoefficientsCompute) are computed at most once.
 /// - If necessary, changes the refinement decision in order to satisfy the
 ///   amr::Policies
 /// - An Element that is splitting in one dimension is not allowed to join
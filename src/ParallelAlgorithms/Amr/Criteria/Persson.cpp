@@ -8,8 +8,11 @@
 
 #include "DataStructures/ApplyMatrices.hpp"
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/IndexIterator.hpp"
 #include "DataStructures/Matrix.hpp"
+#include "DataStructures/ModalVector.hpp"
 #include "Domain/Amr/Flag.hpp"
+#include "NumericalAlgorithms/LinearOperators/CoefficientTransforms.hpp"
 #include "NumericalAlgorithms/Spectral/Filtering.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
@@ -38,6 +41,27 @@ double persson_smoothness_indicator(
          sqrt(filtered_component_buffer->size());
 }
 
+template <size_t Dim>
+double persson_smoothness_indicator(
+    const gsl::not_null<DataVector*> filtered_component_buffer,
+    const gsl::not_null<ModalVector*> filtered_modes_buffer,
+    const ModalVector& modal_coefficients, const Mesh<Dim>& mesh,
+    const size_t dimension, const size_t num_highest_modes) {
+  // Zero out the lowest modes in the given dimension
+  const size_t num_modes_to_zero = mesh.extents(dimension) - num_highest_modes;
+  *filtered_modes_buffer = modal_coefficients;
+  for (IndexIterator<Dim> index(mesh.extents()); index; ++index) {
+    if (index()[dimension] < num_modes_to_zero) {
+      (*filtered_modes_buffer)[index.collapsed_index()] = 0.;
+    }
+  }
+  to_nodal_coefficients(filtered_component_buffer, *filtered_modes_buffer,
+                        mesh);
+  // Take the L2 norm over all grid points
+  return blaze::l2Norm(*filtered_component_buffer) /
+         sqrt(filtered_component_buffer->size());
+}
+
 template <size_t Dim>
 std::array<double, Dim> persson_smoothness_indicator(
     const DataVector& tensor_component, const Mesh<Dim>& mesh,
@@ -56,7 +80,9 @@ namespace Persson_detail {
 template <size_t Dim>
 void max_over_components(const gsl::not_null<std::array<Flag, Dim>*> result,
                          const gsl::not_null<DataVector*> buffer,
+                         const gsl::not_null<ModalVector*> modes_buffer,
                          const DataVector& tensor_component,
+                         const ModalVector& modal_coefficients,
                          const Mesh<Dim>& mesh, const size_t num_highest_modes,
                          const double alpha, const double absolute_tolerance,
                          const double coarsening_factor) {
@@ -69,8 +95,8 @@ void max_over_components(const gsl::not_null<std::array<Flag, Dim>*> result,
     const double relative_tolerance =
         pow(mesh.extents(d) - num_highest_modes, -alpha);
     const double indicator =
-        persson_smoothness_indicator(buffer, tensor_component, mesh, d,
-                                     num_highest_modes) /
+        persson_smoothness_indicator(buffer, modes_buffer, modal_coefficients,
+                                     mesh, d, num_highest_modes) /
         (relative_tolerance * umax + absolute_tolerance);
     if (indicator > 1.) {
       gsl::at(*result, d) = Flag::Split;
@@ -98,13 +124,21 @@ void max_over_components(const gsl::not_null<std::array<Flag, Dim>*> result,
       gsl::not_null<DataVector*> buffer, const DataVector& tensor_component, \
       const Mesh<DIM(data)>& mesh, size_t dimension,                         \
       size_t num_highest_modes);                                             \
+  template double persson_smoothness_indicator(                              \
+      gsl::not_null<DataVector*> filtered_component_buffer,                  \
+      gsl::not_null<ModalVector*> filtered_modes_buffer,                     \
+      const ModalVector& modal_coefficients, const Mesh<DIM(data)>& mesh,    \
+      size_t dimension, size_t num_highest_modes);                           \
   template std::array<double, DIM(data)> persson_smoothness_indicator(       \
       const DataVector& tensor_component, const Mesh<DIM(data)>& mesh,       \
       size_t num_highest_modes);                                             \
   template void Persson_detail::max_over_components(                         \
       gsl::not_null<std::array<Flag, DIM(data)>*> result,                    \
-      gsl::not_null<DataVector*> buffer, const DataVector& tensor_component, \
-      const Mesh<DIM(data)>& mesh, size_t num_highest_modes, double alpha,   \
+      gsl::not_null<DataVector*> buffer,                                     \
+      gsl::not_null<ModalVector*> modes_buffer,                              \
+      const DataVector& tensor_component,                                    \
+      const ModalVector& modal_coefficients, const Mesh<DIM(data)>& mesh,    \
+      size_t num_highest_modes, double alpha,                                \
       double absolute_tolerance, double coarsening_factor);
 
 GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3))
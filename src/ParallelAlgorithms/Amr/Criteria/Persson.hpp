@@ -12,8 +12,10 @@
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/DataBoxTag.hpp"
+#include "DataStructures/DataBox/ObservationBox.hpp"
 #include "DataStructures/DataBox/ValidateSelection.hpp"
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/ModalVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Domain/Amr/Flag.hpp"
 #include "Domain/Tags.hpp"
@@ -22,6 +24,7 @@
 #include "Options/ParseError.hpp"
 #include "Options/String.hpp"
 #include "ParallelAlgorithms/Amr/Criteria/Criterion.hpp"
+#include "ParallelAlgorithms/Amr/Criteria/Tags/ModalCoefficients.hpp"
 #include "Utilities/TMPL.hpp"
 
 /// \cond
@@ -48,6 +51,12 @@ namespace amr::Criteria {
  * - The number of highest modes to keep can be chosen as a parameter.
  * - We don't normalize by the L2 norm of the unfiltered data $u$ here. This
  *   function just returns the L2 norm of the filtered data.
+ *
+ * The overload that takes the `modal_coefficients` of the tensor component
+ * zeroes the lowest modes directly and transforms the remaining modes back to
+ * nodal space. It is used by the `Persson` criterion so it can share the
+ * modal coefficients with other criteria (see
+ * `amr::Criteria::Tags::ModalCoefficientsCompute`).
  */
 template <size_t Dim>
 double persson_smoothness_indicator(
@@ -55,6 +64,12 @@ double persson_smoothness_indicator(
     const DataVector& tensor_component, const Mesh<Dim>& mesh, size_t dimension,
     size_t num_highest_modes);
 template <size_t Dim>
+double persson_smoothness_indicator(
+    gsl::not_null<DataVector*> filtered_component_buffer,
+    gsl::not_null<ModalVector*> filtered_modes_buffer,
+    const ModalVector& modal_coefficients, const Mesh<Dim>& mesh,
+    size_t dimension, size_t num_highest_modes);
+template <size_t Dim>
 std::array<double, Dim> persson_smoothness_indicator(
     const DataVector& tensor_component, const Mesh<Dim>& mesh,
     size_t num_highest_modes);
@@ -64,7 +79,9 @@ namespace Persson_detail {
 template <size_t Dim>
 void max_over_components(gsl::not_null<std::array<Flag, Dim>*> result,
                          gsl::not_null<DataVector*> buffer,
+                         gsl::not_null<ModalVector*> modes_buffer,
                          const DataVector& tensor_component,
+                         const ModalVector& modal_coefficients,
                          const Mesh<Dim>& mesh, size_t num_highest_modes,
                          double alpha, double absolute_tolerance,
                          double coarsening_factor);
@@ -73,6 +90,10 @@ void max_over_components(gsl::not_null<std::array<Flag, Dim>*> result,
 /*!
  * \brief h-refine the grid based on power in the highest modes
  *
+ * The modal coefficients of the monitored tensors are retrieved from
+ * `amr::Criteria::Tags::ModalCoefficients`, so they are shared with other
+ * criteria that use them, such as `amr::Criteria::TruncationError`.
+ *
  * \see persson_smoothness_indicator
  */
 template <size_t Dim, typename TensorTags>
@@ -141,14 +162,20 @@ class Persson : public Criterion {
   WRAPPED_PUPable_decl_template(Persson);  // NOLINT
   /// \endcond
 
-  using compute_tags_for_observation_box = tmpl::list<>;
+  template <typename Tag>
+  using modal_coefficients_compute = Tags::ModalCoefficientsCompute<Tag, Dim>;
+  using compute_tags_for_observation_box =
+      tmpl::transform<TensorTags,
+                      tmpl::bind<modal_coefficients_compute, tmpl::_1>>;
 
-  using argument_tags = tmpl::list<::Tags::DataBox>;
+  using argument_tags = tmpl::list<::Tags::ObservationBox>;
 
-  template <typename DbTagsList, typename Metavariables>
-  std::array<Flag, Dim> operator()(const db::DataBox<DbTagsList>& box,
-                                   Parallel::GlobalCache<Metavariables>& cache,
-                                   const ElementId<Dim>& element_id) const;
+  template <typename ComputeTagsList, typename DataBoxType,
+            typename Metavariables>
+  std::array<Flag, Dim> operator()(
+      const ObservationBox<ComputeTagsList, DataBoxType>& box,
+      Parallel::GlobalCache<Metavariables>& cache,
+      const ElementId<Dim>& element_id) const;
 
   void pup(PUP::er& p) override;
 
@@ -182,21 +209,23 @@ template <size_t Dim, typename TensorTags>
 Persson<Dim, TensorTags>::Persson(CkMigrateMessage* msg) : Criterion(msg) {}
 
 template <size_t Dim, typename TensorTags>
-template <typename DbTagsList, typename Metavariables>
+template <typename ComputeTagsList, typename DataBoxType,
+          typename Metavariables>
 std::array<Flag, Dim> Persson<Dim, TensorTags>::operator()(
-    const db::DataBox<DbTagsList>& box,
+    const ObservationBox<ComputeTagsList, DataBoxType>& box,
     Parallel::GlobalCache<Metavariables>& /*cache*/,
     const ElementId<Dim>& /*element_id*/) const {
   auto result = make_array<Dim>(Flag::Undefined);
-  const auto& mesh = db::get<domain::Tags::Mesh<Dim>>(box);
+  const auto& mesh = get<domain::Tags::Mesh<Dim>>(box);
   // Check all tensors and all tensor components in turn. We take the
   // highest-priority refinement flag in each dimension, so if any tensor
   // component is non-smooth, the element will split in that dimension. And only
   // if all tensor components are smooth enough will elements join in that
   // dimension.
   DataVector buffer(mesh.number_of_grid_points());
+  ModalVector modes_buffer(mesh.number_of_grid_points());
   tmpl::for_each<TensorTags>(
-      [&result, &box, &mesh, &buffer, this](const auto tag_v) {
+      [&result, &box, &mesh, &buffer, &modes_buffer, this](const auto tag_v) {
         // Stop if we have already decided to refine every dimension
         if (result == make_array<Dim>(Flag::Split)) {
           return;
@@ -207,10 +236,13 @@ std::array<Flag, Dim> Persson<Dim, TensorTags>::operator()(
         if (not alg::found(vars_to_monitor_, tag_name)) {
           return;
         }
-        const auto& tensor = db::get<tag>(box);
-        for (const DataVector& tensor_component : tensor) {
+        const auto& tensor = get<tag>(box);
+        const auto& modal_coefficients =
+            get<Tags::ModalCoefficients<tag>>(box);
+        for (size_t i = 0; i < tensor.size(); ++i) {
           Persson_detail::max_over_components(
-              make_not_null(&result), make_not_null(&buffer), tensor_component,
+              make_not_null(&result), make_not_null(&buffer),
+              make_not_null(&modes_buffer), tensor[i], modal_coefficients[i],
               mesh, num_highest_modes_, alpha_, absolute_tolerance_,
               coarsening_factor_);
         }
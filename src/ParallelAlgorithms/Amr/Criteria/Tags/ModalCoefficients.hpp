@@ -0,0 +1,53 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "DataStructures/DataBox/Tag.hpp"
+#include "DataStructures/ModalVector.hpp"
+#include "Domain/Tags.hpp"
+#include "NumericalAlgorithms/LinearOperators/CoefficientTransforms.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace amr::Criteria::Tags {
+/// The modal coefficients of each component of the tensor `Tag`
+template <typename Tag>
+struct ModalCoefficients : db::SimpleTag {
+  using type = std::vector<ModalVector>;
+};
+
+/*!
+ * \brief Transforms each component of the tensor `Tag` to modal coefficients
+ *
+ * Refinement criteria that work with the modal coefficients of the monitored
+ * tensors list this tag in their `compute_tags_for_observation_box`.
+ * `amr::Actions::EvaluateRefinementCriteria` creates a single observation box
+ * for all criteria, which holds each compute tag once and only evaluates it
+ * when it is first retrieved. Therefore, the transforms are done at most once
+ * per element and evaluation of the criteria.
+ *
+ * \note Currently `amr::Criteria::TruncationError` and `amr::Criteria::Persson`
+ * use this tag. The `Loehner` criterion and
+ * `evolution::dg::subcell::persson_tci` work in nodal space.
+ */
+template <typename Tag, size_t Dim>
+struct ModalCoefficientsCompute : ModalCoefficients<Tag>, db::ComputeTag {
+  using base = ModalCoefficients<Tag>;
+  using return_type = typename base::type;
+  using argument_tags = tmpl::list<Tag, domain::Tags::Mesh<Dim>>;
+  static void function(const gsl::not_null<return_type*> modal_coefficients,
+                       const typename Tag::type& tensor,
+                       const Mesh<Dim>& mesh) {
+    modal_coefficients->resize(tensor.size());
+    for (size_t i = 0; i < tensor.size(); ++i) {
+      to_modal_coefficients(make_not_null(&(*modal_coefficients)[i]),
+                            tensor[i], mesh);
+    }
+  }
+};
+}  // namespace amr::Criteria::Tags
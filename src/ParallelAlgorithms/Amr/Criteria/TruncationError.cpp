@@ -8,6 +8,7 @@
 #include <optional>
 
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/ModalVector.hpp"
 #include "Domain/Amr/Flag.hpp"
 #include "NumericalAlgorithms/LinearOperators/PowerMonitors.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
@@ -20,7 +21,8 @@ template <size_t Dim>
 void max_over_components(
     const gsl::not_null<std::array<Flag, Dim>*> result,
     const gsl::not_null<std::array<DataVector, Dim>*> power_monitors_buffer,
-    const DataVector& tensor_component, const Mesh<Dim>& mesh,
+    const DataVector& tensor_component, const ModalVector& modal_coefficients,
+    const Mesh<Dim>& mesh,
     const std::optional<double> target_abs_truncation_error,
     const std::optional<double> target_rel_truncation_error) {
   // We take the highest-priority refinement flag in each dimension, so if any
@@ -28,7 +30,8 @@ void max_over_components(
   // increase p refinement in that dimension. And only if all tensor components
   // still satisfy the target with the highest mode removed will the element
   // decrease p refinement in that dimension.
-  PowerMonitors::power_monitors(power_monitors_buffer, tensor_component, mesh);
+  PowerMonitors::power_monitors(power_monitors_buffer, modal_coefficients,
+                                mesh);
   const double umax = max(abs(tensor_component));
   for (size_t d = 0; d < Dim; ++d) {
     // Skip this dimension if we have already decided to refine it
@@ -81,13 +84,14 @@ void max_over_components(
 
 #define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
 
-#define INSTANTIATION(_, data)                                         \
-  template void max_over_components(                                   \
-      gsl::not_null<std::array<Flag, DIM(data)>*> result,              \
-      const gsl::not_null<std::array<DataVector, DIM(data)>*>          \
-          power_monitors_buffer,                                       \
-      const DataVector& tensor_component, const Mesh<DIM(data)>& mesh, \
-      std::optional<double> target_abs_truncation_error,               \
+#define INSTANTIATION(_, data)                                            \
+  template void max_over_components(                                      \
+      gsl::not_null<std::array<Flag, DIM(data)>*> result,                 \
+      const gsl::not_null<std::array<DataVector, DIM(data)>*>             \
+          power_monitors_buffer,                                          \
+      const DataVector& tensor_component,                                 \
+      const ModalVector& modal_coefficients, const Mesh<DIM(data)>& mesh, \
+      std::optional<double> target_abs_truncation_error,                  \
       std::optional<double> target_rel_truncation_error);
 
 GENERATE_INSTANTIATIONS(INSTANTIATION, (1, 2, 3))
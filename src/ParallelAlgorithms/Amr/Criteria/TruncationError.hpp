@@ -12,8 +12,10 @@
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/DataBoxTag.hpp"
+#include "DataStructures/DataBox/ObservationBox.hpp"
 #include "DataStructures/DataBox/ValidateSelection.hpp"
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/ModalVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Domain/Amr/Flag.hpp"
 #include "Domain/Tags.hpp"
@@ -22,6 +24,7 @@
 #include "Options/ParseError.hpp"
 #include "Options/String.hpp"
 #include "ParallelAlgorithms/Amr/Criteria/Criterion.hpp"
+#include "ParallelAlgorithms/Amr/Criteria/Tags/ModalCoefficients.hpp"
 #include "Utilities/Algorithm.hpp"
 #include "Utilities/TMPL.hpp"
 
@@ -46,7 +49,8 @@ template <size_t Dim>
 void max_over_components(
     gsl::not_null<std::array<Flag, Dim>*> result,
     const gsl::not_null<std::array<DataVector, Dim>*> power_monitors_buffer,
-    const DataVector& tensor_component, const Mesh<Dim>& mesh,
+    const DataVector& tensor_component, const ModalVector& modal_coefficients,
+    const Mesh<Dim>& mesh,
     std::optional<double> target_abs_truncation_error,
     std::optional<double> target_rel_truncation_error);
 }  // namespace TruncationError_detail
@@ -60,7 +64,9 @@ void max_over_components(
  *   removed, the element will be p-coarsened.
  *
  * For details on how the truncation error is computed see
- * `PowerMonitors::truncation_error`.
+ * `PowerMonitors::truncation_error`. The modal coefficients of the monitored
+ * tensors are retrieved from `amr::Criteria::Tags::ModalCoefficients`, so they
+ * are shared with other criteria that use them.
  *
  * \tparam Dim Spatial dimension of the grid
  * \tparam TensorTags List of tags of the tensors to be monitored
@@ -110,14 +116,20 @@ class TruncationError : public Criterion {
   WRAPPED_PUPable_decl_template(TruncationError);  // NOLINT
   /// \endcond
 
-  using compute_tags_for_observation_box = tmpl::list<>;
+  template <typename Tag>
+  using modal_coefficients_compute = Tags::ModalCoefficientsCompute<Tag, Dim>;
+  using compute_tags_for_observation_box =
+      tmpl::transform<TensorTags,
+                      tmpl::bind<modal_coefficients_compute, tmpl::_1>>;
 
-  using argument_tags = tmpl::list<::Tags::DataBox>;
+  using argument_tags = tmpl::list<::Tags::ObservationBox>;
 
-  template <typename DbTagsList, typename Metavariables>
-  std::array<Flag, Dim> operator()(const db::DataBox<DbTagsList>& box,
-                                   Parallel::GlobalCache<Metavariables>& cache,
-                                   const ElementId<Dim>& element_id) const;
+  template <typename ComputeTagsList, typename DataBoxType,
+            typename Metavariables>
+  std::array<Flag, Dim> operator()(
+      const ObservationBox<ComputeTagsList, DataBoxType>& box,
+      Parallel::GlobalCache<Metavariables>& cache,
+      const ElementId<Dim>& element_id) const;
 
   void pup(PUP::er& p) override;
 
@@ -152,13 +164,14 @@ TruncationError<Dim, TensorTags>::TruncationError(CkMigrateMessage* msg)
     : Criterion(msg) {}
 
 template <size_t Dim, typename TensorTags>
-template <typename DbTagsList, typename Metavariables>
+template <typename ComputeTagsList, typename DataBoxType,
+          typename Metavariables>
 std::array<Flag, Dim> TruncationError<Dim, TensorTags>::operator()(
-    const db::DataBox<DbTagsList>& box,
+    const ObservationBox<ComputeTagsList, DataBoxType>& box,
     Parallel::GlobalCache<Metavariables>& /*cache*/,
     const ElementId<Dim>& /*element_id*/) const {
   auto result = make_array<Dim>(Flag::Undefined);
-  const auto& mesh = db::get<domain::Tags::Mesh<Dim>>(box);
+  const auto& mesh = get<domain::Tags::Mesh<Dim>>(box);
   std::array<DataVector, Dim> power_monitors_buffer{};
   // Check all tensors and all tensor components in turn
   tmpl::for_each<TensorTags>(
@@ -173,12 +186,14 @@ std::array<Flag, Dim> TruncationError<Dim, TensorTags>::operator()(
         if (not alg::found(vars_to_monitor_, tag_name)) {
           return;
         }
-        const auto& tensor = db::get<tag>(box);
-        for (const DataVector& tensor_component : tensor) {
+        const auto& tensor = get<tag>(box);
+        const auto& modal_coefficients =
+            get<Tags::ModalCoefficients<tag>>(box);
+        for (size_t i = 0; i < tensor.size(); ++i) {
           TruncationError_detail::max_over_components(
               make_not_null(&result), make_not_null(&power_monitors_buffer),
-              tensor_component, mesh, target_abs_truncation_error_,
-              target_rel_truncation_error_);
+              tensor[i], modal_coefficients[i], mesh,
+              target_abs_truncation_error_, target_rel_truncation_error_);
         }
       });
   return result;
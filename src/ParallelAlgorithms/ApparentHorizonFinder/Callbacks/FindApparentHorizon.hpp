@@ -4,10 +4,13 @@
 #pragma once
 
 #include <cmath>
+#include <cstddef>
 #include <deque>
+#include <optional>
 #include <utility>
 
 #include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataVector.hpp"
 #include "DataStructures/VariablesTag.hpp"
 #include "Domain/Creators/Tags/Domain.hpp"
 #include "Domain/FunctionsOfTime/Tags.hpp"
@@ -16,12 +19,14 @@
 #include "IO/Logging/Verbosity.hpp"
 #include "NumericalAlgorithms/SphericalHarmonics/Spherepack.hpp"
 #include "NumericalAlgorithms/SphericalHarmonics/Strahlkorper.hpp"
+#include "NumericalAlgorithms/SphericalHarmonics/StrahlkorperFunctions.hpp"
 #include "NumericalAlgorithms/SphericalHarmonics/Tags.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Invoke.hpp"
 #include "Parallel/ParallelComponentHelpers.hpp"
 #include "Parallel/Printf/Printf.hpp"
 #include "ParallelAlgorithms/ApparentHorizonFinder/FastFlow.hpp"
+#include "ParallelAlgorithms/ApparentHorizonFinder/InterpolationTarget.hpp"
 #include "ParallelAlgorithms/ApparentHorizonFinder/Tags.hpp"
 #include "ParallelAlgorithms/Interpolation/Actions/SendPointsToInterpolator.hpp"
 #include "ParallelAlgorithms/Interpolation/InterpolationTargetDetail.hpp"
@@ -82,6 +87,8 @@ namespace callbacks {
 /// Uses:
 /// - Metavariables:
 ///   - `temporal_id`
+/// - GlobalCache:
+///   - `intrp::Tags::ApparentHorizon<InterpolationTargetTag, Frame>`
 /// - DataBox:
 ///   - `logging::Tags::Verbosity<InterpolationTargetTag>`
 ///   - `::gr::Tags::InverseSpatialMetric<DataVector, 3, Frame>`
@@ -162,12 +169,12 @@ struct FindApparentHorizon
       // We need to do this now, and not at the end of the previous horizon
       // search, because only now do we know the temporal_id of this horizon
       // search.
-      db::mutate<ylm::Tags::Strahlkorper<Frame>,
-                 ylm::Tags::PreviousStrahlkorpers<Frame>>(
-          [&temporal_id](
+      std::optional<double> initial_guess_error{};
+      bool extrapolation_rejected = false;
+      db::mutate<ylm::Tags::Strahlkorper<Frame>>(
+          [&extrapolation_rejected, &initial_guess_error, &temporal_id](
               const gsl::not_null<ylm::Strahlkorper<Frame>*> strahlkorper,
-              const gsl::not_null<
-                  std::deque<std::pair<double, ylm::Strahlkorper<Frame>>>*>
+              const std::deque<std::pair<double, ylm::Strahlkorper<Frame>>>&
                   previous_strahlkorpers) {
             // If we have zero previous_strahlkorpers, then the
             // initial guess is already in strahlkorper, so do
@@ -183,60 +190,55 @@ struct FindApparentHorizon
             // previous_strahlkorper is the original initial guess, so
             // again we do nothing.
             //
-            // If we have 2 valid previous_strahlkorpers, then
-            // we set the initial guess by linear extrapolation in time
-            // using the last 2 previous_strahlkorpers.
+            // Otherwise we set the initial guess by polynomial extrapolation
+            // in time through all the valid previous_strahlkorpers, i.e.
+            // linear for 2, quadratic for 3, and cubic for 4.
+            //
+            // The difference from the next lower order extrapolation
+            // estimates the error of the initial guess. If it is larger than
+            // the change the extrapolation makes to the most recent horizon,
+            // the horizon is not moving smoothly enough to be extrapolated
+            // (e.g. right after a jump) and we start from the most recent
+            // horizon instead.
             //
-            // If we have 3 valid previous_strahlkorpers, then
-            // we set the initial guess by quadratic extrapolation in time
-            // using the last 3 previous_strahlkorpers.
+            // The Strahlkorpers are in the frame of the horizon find, which
+            // for binaries is comoving with the control-system maps, so the
+            // extrapolation only has to follow the residual motion and
+            // deformation of the horizon.
             //
             // For extrapolation, we assume that
             // * Expansion center of all the Strahlkorpers are equal.
             // * Maximum L of all the Strahlkorpers are equal.
             // It is easy to relax the max L assumption once we start
             // adaptively changing the L of the strahlkorpers.
-            if (previous_strahlkorpers->size() > 1 and
-                not std::isnan((*previous_strahlkorpers)[1].first)) {
-              if (previous_strahlkorpers->size() > 2 and
-                  not std::isnan((*previous_strahlkorpers)[2].first)) {
-                // Quadratic extrapolation
-                const double new_time =
-                    InterpolationTarget_detail::get_temporal_id_value(
-                        temporal_id);
-                const double dt_0 =
-                    (*previous_strahlkorpers)[0].first - new_time;
-                const double dt_1 =
-                    (*previous_strahlkorpers)[1].first - new_time;
-                const double dt_2 =
-                    (*previous_strahlkorpers)[2].first - new_time;
-                const double fac_0 =
-                    dt_1 * dt_2 / ((dt_1 - dt_0) * (dt_2 - dt_0));
-                const double fac_1 =
-                    dt_0 * dt_2 / ((dt_2 - dt_1) * (dt_0 - dt_1));
-                const double fac_2 = 1.0 - fac_0 - fac_1;
-                strahlkorper->coefficients() =
-                    fac_0 * (*previous_strahlkorpers)[0].second.coefficients() +
-                    fac_1 * (*previous_strahlkorpers)[1].second.coefficients() +
-                    fac_2 * (*previous_strahlkorpers)[2].second.coefficients();
-              } else {
-                // Linear extrapolation
-                const double new_time =
-                    InterpolationTarget_detail::get_temporal_id_value(
-                        temporal_id);
-                const double dt_0 =
-                    (*previous_strahlkorpers)[0].first - new_time;
-                const double dt_1 =
-                    (*previous_strahlkorpers)[1].first - new_time;
-                const double fac_0 = dt_1 / (dt_1 - dt_0);
-                const double fac_1 = 1.0 - fac_0;
-                strahlkorper->coefficients() =
-                    fac_0 * (*previous_strahlkorpers)[0].second.coefficients() +
-                    fac_1 * (*previous_strahlkorpers)[1].second.coefficients();
+            initial_guess_error = ylm::extrapolate_strahlkorper(
+                strahlkorper, previous_strahlkorpers,
+                InterpolationTarget_detail::get_temporal_id_value(
+                    temporal_id));
+            if (initial_guess_error.has_value()) {
+              const DataVector& most_recent_coefficients =
+                  previous_strahlkorpers.front().second.coefficients();
+              if (*initial_guess_error >
+                  max(abs(strahlkorper->coefficients() -
+                          most_recent_coefficients))) {
+                strahlkorper->coefficients() = most_recent_coefficients;
+                extrapolation_rejected = true;
               }
             }
           },
-          box);
+          box, db::get<ylm::Tags::PreviousStrahlkorpers<Frame>>(*box));
+
+      if (initial_guess_error.has_value() and
+          db::get<logging::Tags::Verbosity<InterpolationTargetTag>>(*box) >
+              ::Verbosity::Quiet) {
+        Parallel::printf(
+            "%s: t=%.6g: %s initial guess, estimated extrapolation error "
+            "%.1e\n",
+            pretty_type::name<InterpolationTargetTag>(),
+            InterpolationTarget_detail::get_temporal_id_value(temporal_id),
+            extrapolation_rejected ? "most recent horizon as" : "extrapolated",
+            *initial_guess_error);
+      }
     }
 
     // Deal with the possibility that some of the points might be
@@ -400,17 +402,17 @@ struct FindApparentHorizon
       // Update the previous strahlkorpers. We do this before the callbacks
       // in case any of the callbacks need the previous strahlkorpers with the
       // current strahlkorper already in it.
+      const size_t num_previous_strahlkorpers =
+          Parallel::get<Tags::ApparentHorizon<InterpolationTargetTag, Frame>>(
+              *cache)
+              .number_of_previous_horizons;
       db::mutate<ylm::Tags::Strahlkorper<Frame>,
                  ylm::Tags::PreviousStrahlkorpers<Frame>>(
-          [&temporal_id](
+          [&num_previous_strahlkorpers, &temporal_id](
               const gsl::not_null<ylm::Strahlkorper<Frame>*> strahlkorper,
               const gsl::not_null<
                   std::deque<std::pair<double, ylm::Strahlkorper<Frame>>>*>
                   previous_strahlkorpers) {
-            // This is the number of previous strahlkorpers that we
-            // keep around.
-            const size_t num_previous_strahlkorpers = 3;
-
             // Save a new previous_strahlkorper.
             previous_strahlkorpers->emplace_front(
                 InterpolationTarget_detail::get_temporal_id_value(temporal_id),
@@ -6,9 +6,13 @@
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <limits>
+#include <optional>
 #include <pup.h>
+#include <pup_stl.h>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataVector.hpp"
@@ -18,6 +22,7 @@
 #include "NumericalAlgorithms/SphericalHarmonics/SpherepackIterator.hpp"
 #include "NumericalAlgorithms/SphericalHarmonics/Strahlkorper.hpp"
 #include "NumericalAlgorithms/SphericalHarmonics/Tags.hpp"
+#include "Options/ParseError.hpp"
 #include "Options/ParseOptions.hpp"
 #include "PointwiseFunctions/GeneralRelativity/Surfaces/Expansion.hpp"
 #include "PointwiseFunctions/GeneralRelativity/Surfaces/GradUnitNormalOneForm.hpp"
@@ -28,6 +33,7 @@
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
 #include "Utilities/MakeWithValue.hpp"
 // IWYU pragma: no_forward_declare Tensor
 
@@ -38,7 +44,9 @@ FastFlow::FastFlow(FastFlow::Flow::type flow, FastFlow::Alpha::type alpha,
                    FastFlow::TruncationTol::type trunc_tol,
                    FastFlow::DivergenceTol::type divergence_tol,
                    FastFlow::DivergenceIter::type divergence_iter,
-                   FastFlow::MaxIts::type max_its)
+                   FastFlow::MaxIts::type max_its,
+                   std::optional<size_t> initial_l_max,
+                   const Options::Context& context)
     : alpha_(alpha),
       beta_(beta),
       abs_tol_(abs_tol),
@@ -47,18 +55,35 @@ FastFlow::FastFlow(FastFlow::Flow::type flow, FastFlow::Alpha::type alpha,
       divergence_iter_(divergence_iter),
       max_its_(max_its),
       flow_(flow),
+      initial_l_max_(initial_l_max),
       current_iter_(0),
+      current_l_surface_(0),
       previous_residual_mesh_norm_(0.0),
       min_residual_mesh_norm_(std::numeric_limits<double>::max()),
-      iter_at_min_residual_mesh_norm_(0) {}
+      iter_at_min_residual_mesh_norm_(0) {
+  if (initial_l_max_.has_value() and *initial_l_max_ < 2) {
+    PARSE_ERROR(context,
+                "InitialLMax must be at least 2, not " << *initial_l_max_);
+  }
+}
+
+template <typename Frame>
+size_t FastFlow::current_l_surface(
+    const ylm::Strahlkorper<Frame>& strahlkorper) const {
+  const size_t l_max = strahlkorper.l_max();
+  if (current_l_surface_ != 0) {
+    return std::min(current_l_surface_, l_max);
+  }
+  return initial_l_max_.has_value() ? std::min(*initial_l_max_, l_max) : l_max;
+}
 
 template <typename Frame>
 size_t FastFlow::current_l_mesh(
     const ylm::Strahlkorper<Frame>& strahlkorper) const {
-  const size_t l_max = strahlkorper.ylm_spherepack().l_max();
+  const size_t l_surface = current_l_surface(strahlkorper);
   // This is the formula used in SpEC (if l_max>=4). We may want to make this
   // formula an option in the future, if we want to experiment with it.
-  return static_cast<size_t>(std::floor(1.5 * l_max));
+  return static_cast<size_t>(std::floor(1.5 * l_surface));
 }
 
 namespace {
@@ -86,6 +111,62 @@ DataVector fast_flow_weight(
 
   return 2.0 * get(one_form_magnitude) * square(radius) / denominator;
 }
+
+// The l_max needed to represent `surface` up to Y_lm coefficients of size
+// `tolerance`, estimated by fitting an exponential to the amplitudes of the
+// coefficients of each l in the upper half of the l of `surface`. The result
+// is at least the l_max of `surface` and at most `l_max`.
+template <typename Frame>
+size_t resolved_l_max(const ylm::Strahlkorper<Frame>& surface,
+                      const size_t l_max, const double tolerance) {
+  const size_t l_surface = surface.l_max();
+  std::vector<double> amplitudes(l_surface + 1, 0.0);
+  for (auto cit = ylm::SpherepackIterator(l_surface, l_surface); cit; ++cit) {
+    amplitudes[cit.l()] += square(surface.coefficients()[cit()]);
+  }
+  for (double& amplitude : amplitudes) {
+    amplitude = sqrt(amplitude);
+  }
+  // Symmetric surfaces have vanishing coefficients for every other l, so
+  // check the two largest l.
+  if (std::max(amplitudes[l_surface], amplitudes[l_surface - 1]) < tolerance) {
+    return l_surface;
+  }
+
+  // Least-squares fit of log(amplitude) = intercept + slope * l, ignoring
+  // the l that are already below the tolerance.
+  double number_of_points = 0.0;
+  double sum_l = 0.0;
+  double sum_l_squared = 0.0;
+  double sum_log = 0.0;
+  double sum_l_log = 0.0;
+  for (size_t l = std::max(l_surface / 2, 1_st); l <= l_surface; ++l) {
+    if (amplitudes[l] < tolerance) {
+      continue;
+    }
+    const auto l_double = static_cast<double>(l);
+    const double log_amplitude = log(amplitudes[l]);
+    number_of_points += 1.0;
+    sum_l += l_double;
+    sum_l_squared += square(l_double);
+    sum_log += log_amplitude;
+    sum_l_log += l_double * log_amplitude;
+  }
+  if (number_of_points < 2.0) {
+    return l_max;
+  }
+  const double slope = (number_of_points * sum_l_log - sum_l * sum_log) /
+                       (number_of_points * sum_l_squared - square(sum_l));
+  if (not(slope < 0.0)) {
+    return l_max;
+  }
+  const double intercept = (sum_log - slope * sum_l) / number_of_points;
+  const double l_resolved = std::ceil((log(tolerance) - intercept) / slope);
+  if (l_resolved >= static_cast<double>(l_max)) {
+    return l_max;
+  }
+  return std::max(l_surface, static_cast<size_t>(std::max(l_resolved, 0.0)));
+}
 }  // namespace
 
 template <typename Frame>
@@ -95,8 +176,18 @@ FastFlow::iterate_horizon_finder(
     const tnsr::II<DataVector, 3, Frame>& upper_spatial_metric,
     const tnsr::ii<DataVector, 3, Frame>& extrinsic_curvature,
     const tnsr::Ijj<DataVector, 3, Frame>& christoffel_2nd_kind) {
-  const size_t l_surface = current_strahlkorper->l_max();
+  const size_t l_max = current_strahlkorper->l_max();
+  const size_t l_surface = current_l_surface(*current_strahlkorper);
   const size_t l_mesh = current_l_mesh(*current_strahlkorper);
+  current_l_surface_ = l_surface;
+
+  // The part of the Strahlkorper that is solved for. Coefficients with
+  // l > l_surface are not modified.
+  const ylm::Strahlkorper<Frame> surface =
+      l_surface == l_max
+          ? *current_strahlkorper
+          : ylm::Strahlkorper<Frame>(l_surface, l_surface,
+                                     *current_strahlkorper);
 
   // Evaluate the Strahlkorper on a higher resolution mesh
   const ylm::Strahlkorper<Frame> strahlkorper(l_mesh, l_mesh,
@@ -180,15 +271,13 @@ FastFlow::iterate_horizon_finder(
   // Restrict to the basis of the surface
   const auto residual_on_surface =
       strahlkorper.ylm_spherepack().prolong_or_restrict(
-          weighted_residual_coefs, current_strahlkorper->ylm_spherepack());
+          weighted_residual_coefs, surface.ylm_spherepack());
 
   // Evaluate the norm of the residual on the surface of size l_surface.
   // See comment on pointwise norm vs integral norm above.
-  const auto residual_ylm_norm =
-      sqrt(current_strahlkorper->ylm_spherepack().average(
-          current_strahlkorper->ylm_spherepack().phys_to_spec(
-              square(current_strahlkorper->ylm_spherepack().spec_to_phys(
-                  residual_on_surface)))));
+  const auto residual_ylm_norm = sqrt(surface.ylm_spherepack().average(
+      surface.ylm_spherepack().phys_to_spec(square(
+          surface.ylm_spherepack().spec_to_phys(residual_on_surface)))));
 
   // Fill iter_info
   const auto minmax_residual =
@@ -218,9 +307,9 @@ FastFlow::iterate_horizon_finder(
   // residual_mesh_norm-previous_residual_mesh_norm_ is small on the
   // first step, since previous_residual_mesh_norm_ is not defined, so
   // we skip this part of the check on the first iteration.
+  std::optional<Status> convergence{};
   if (residual_ylm_norm < abs_tol_) {
-    // clang-tidy: std::move of trivially-copyable type
-    return std::make_pair(Status::AbsTol, std::move(iter_info));  // NOLINT
+    convergence = Status::AbsTol;
   } else if (residual_ylm_norm < trunc_tol_ * residual_mesh_norm) {
     // This may be convergence by TruncationTol, but first make sure
     // that either residual_mesh_norm is converging, or that it is the
@@ -229,14 +318,30 @@ FastFlow::iterate_horizon_finder(
     if (previous_residual_mesh_norm_ == 0 or
         equal_within_roundoff(residual_mesh_norm, previous_residual_mesh_norm_,
                               divergence_tol_ - 1.0, 0.0)) {
-      // clang-tidy: std::move of trivially-copyable type
-      return std::make_pair(Status::TruncationTol,
-                            std::move(iter_info));  // NOLINT
+      convergence = Status::TruncationTol;
     }
   }
 
+  // If we have converged at an l_surface below l_max, we continue at a larger
+  // l_surface. The decay of the coefficients picks an intermediate l_surface
+  // while the coefficients beyond l_surface are not negligible. Otherwise we
+  // go straight to l_max, so that every find ends with iterations at l_max
+  // and the convergence test there.
+  size_t next_l_surface = l_surface;
+  if (convergence.has_value() and l_surface < l_max) {
+    const size_t l_resolved =
+        resolved_l_max(surface, l_max, abs_tol_ * surface.average_radius());
+    next_l_surface =
+        l_resolved > l_surface ? std::min(2 * l_surface, l_resolved) : l_max;
+  }
+  if (convergence.has_value() and next_l_surface == l_surface) {
+    // clang-tidy: std::move of trivially-copyable type
+    return std::make_pair(*convergence, std::move(iter_info));  // NOLINT
+  }
+
   // Treat the case in which residual_mesh_norm is increasing
-  if (residual_mesh_norm > divergence_tol_ * min_residual_mesh_norm_ and
+  if (next_l_surface == l_surface and
+      residual_mesh_norm > divergence_tol_ * min_residual_mesh_norm_ and
       iter_at_min_residual_mesh_norm_ + divergence_iter_ <= current_iter_) {
     // clang-tidy: std::move of trivially-copyable type
     return std::make_pair(Status::DivergenceError,
@@ -256,19 +361,28 @@ FastFlow::iterate_horizon_finder(
   const double flow_A = alpha_ / (l_surface * (l_surface + 1)) + beta_;
   const double flow_B = beta_ / alpha_;
   auto coefs = current_strahlkorper->coefficients();
-  for (auto cit = ylm::SpherepackIterator(current_strahlkorper->l_max(),
-                                          current_strahlkorper->l_max());
-       cit; ++cit) {
-    coefs[cit()] -= flow_A /
-                    (1.0 + flow_B * static_cast<double>(cit.l()) *
-                               (static_cast<double>(cit.l()) + 1)) *
-                    residual_on_surface[cit()];
+  ylm::SpherepackIterator full_iter(l_max, l_max);
+  for (auto cit = ylm::SpherepackIterator(l_surface, l_surface); cit; ++cit) {
+    coefs[full_iter.set(cit.l(), cit.m(), cit.coefficient_array())()] -=
+        flow_A /
+        (1.0 + flow_B * static_cast<double>(cit.l()) *
+                   (static_cast<double>(cit.l()) + 1)) *
+        residual_on_surface[cit()];
   }
   *current_strahlkorper =
       ylm::Strahlkorper<Frame>(coefs, *current_strahlkorper);
 
   // Set up for next iter
-  previous_residual_mesh_norm_ = residual_mesh_norm;
+  if (next_l_surface == l_surface) {
+    previous_residual_mesh_norm_ = residual_mesh_norm;
+  } else {
+    // The residuals at the new l_surface are not comparable to the previous
+    // ones, so restart the checks for convergence and divergence.
+    current_l_surface_ = next_l_surface;
+    previous_residual_mesh_norm_ = 0.0;
+    min_residual_mesh_norm_ = std::numeric_limits<double>::max();
+    iter_at_min_residual_mesh_norm_ = current_iter_;
+  }
 
   // clang-tidy: std::move of trivially-copyable type
   return std::make_pair(Status::SuccessfulIteration,
@@ -300,7 +414,9 @@ void FastFlow::pup(PUP::er& p) {
   p | divergence_iter_;
   p | max_its_;
   p | flow_;
+  p | initial_l_max_;
   p | current_iter_;
+  p | current_l_surface_;
   p | previous_residual_mesh_norm_;
   p | min_residual_mesh_norm_;
   p | iter_at_min_residual_mesh_norm_;
@@ -335,7 +451,9 @@ bool operator==(const FastFlow& lhs, const FastFlow& rhs) {
          lhs.divergence_tol_ == rhs.divergence_tol_ and
          lhs.divergence_iter_ == rhs.divergence_iter_ and
          lhs.max_its_ == rhs.max_its_ and lhs.flow_ == rhs.flow_ and
+         lhs.initial_l_max_ == rhs.initial_l_max_ and
          lhs.current_iter_ == rhs.current_iter_ and
+         lhs.current_l_surface_ == rhs.current_l_surface_ and
          lhs.previous_residual_mesh_norm_ ==
              rhs.previous_residual_mesh_norm_ and
          lhs.min_residual_mesh_norm_ == rhs.min_residual_mesh_norm_ and
@@ -362,6 +480,8 @@ FastFlow::FlowType Options::create_from_yaml<FastFlow::FlowType>::create<void>(
 
 #define FRAME(data) BOOST_PP_TUPLE_ELEM(0, data)
 #define INSTANTIATE(_, data)                                            \
+  template size_t FastFlow::current_l_surface(                          \
+      const ylm::Strahlkorper<FRAME(data)>& strahlkorper) const;        \
   template size_t FastFlow::current_l_mesh(                             \
       const ylm::Strahlkorper<FRAME(data)>& strahlkorper) const;        \
   template std::pair<FastFlow::Status, FastFlow::IterInfo>              \
@@ -5,10 +5,13 @@
 
 #include <cstddef>
 #include <limits>
+#include <optional>
 #include <ostream>
 #include <utility>
 
 #include "DataStructures/Tensor/TypeAliases.hpp"
+#include "Options/Auto.hpp"
+#include "Options/Context.hpp"
 #include "Options/Options.hpp"
 #include "Options/String.hpp"
 #include "Utilities/ForceInline.hpp"
@@ -119,8 +122,18 @@ class FastFlow {
     static type suggested_value() { return 100; }
   };
 
+  struct InitialLMax {
+    using type = Options::Auto<size_t, Options::AutoLabel::None>;
+    static constexpr Options::String help = {
+        "If set, each horizon find starts iterating at this l_surface, which "
+        "is raised as the iteration converges until it reaches the l_max of "
+        "the Strahlkorper. Set to None to always iterate at the l_max of the "
+        "Strahlkorper."};
+  };
+
   using options = tmpl::list<Flow, Alpha, Beta, AbsTol, TruncationTol,
-                             DivergenceTol, DivergenceIter, MaxIts>;
+                             DivergenceTol, DivergenceIter, MaxIts,
+                             InitialLMax>;
 
   static constexpr Options::String help{
       "Find a Strahlkorper using a 'fast flow' method.\n"
@@ -141,14 +154,27 @@ class FastFlow {
       "If instead |R_{mesh}|_i > DivergenceTol * min_{j}(|R_{mesh}|_j) where\n"
       "i is the iteration index and j runs from 0 to i-DivergenceIter, then\n"
       "FastFlow exits with Status::DivergenceError.  Here DivergenceIter and\n"
-      "DivergenceTol are input parameters."};
+      "DivergenceTol are input parameters.\n\n"
+      "If InitialLMax is set, the iteration is done coarse to fine: it starts\n"
+      "at l_surface=InitialLMax, which needs fewer interpolation points, and\n"
+      "whenever it converges at an l_surface below the l_max of the surface\n"
+      "the exponential decay of the Y_lm coefficients is used to pick the\n"
+      "next l_surface, at most doubling it. Once the decay indicates that\n"
+      "the coefficients beyond l_surface are below AbsTol times the average\n"
+      "radius, the iteration continues at the l_max of the surface. The find\n"
+      "only converges at the l_max of the surface, using the convergence\n"
+      "criteria above."};
 
   FastFlow(Flow::type flow, Alpha::type alpha, Beta::type beta,
            AbsTol::type abs_tol, TruncationTol::type trunc_tol,
            DivergenceTol::type divergence_tol,
-           DivergenceIter::type divergence_iter, MaxIts::type max_its);
+           DivergenceIter::type divergence_iter, MaxIts::type max_its,
+           std::optional<size_t> initial_l_max,
+           const Options::Context& context = {});
 
-  FastFlow() : FastFlow(FlowType::Fast, 1.0, 0.5, 1.e-12, 1.e-2, 1.2, 5, 100) {}
+  FastFlow()
+      : FastFlow(FlowType::Fast, 1.0, 0.5, 1.e-12, 1.e-2, 1.2, 5, 100,
+                 std::nullopt) {}
 
   FastFlow(const FastFlow& /*rhs*/) = default;
   FastFlow& operator=(const FastFlow& /*rhs*/) = default;
@@ -173,15 +199,23 @@ class FastFlow {
 
   size_t current_iteration() const { return current_iter_; }
 
-  /// Given a Strahlkorper defined up to some maximum Y_lm l called
-  /// l_surface, returns a larger value of l, l_mesh, that is used for
-  /// evaluating convergence.
+  /// The maximum Y_lm l, l_surface, of the coefficients of `strahlkorper`
+  /// that are currently being solved for. This is the l_max of
+  /// `strahlkorper` unless `InitialLMax` is set.
+  template <typename Frame>
+  size_t current_l_surface(const ylm::Strahlkorper<Frame>& strahlkorper) const;
+
+  /// Given a Strahlkorper, returns a value of l, l_mesh, that is larger than
+  /// `current_l_surface()` and is used for evaluating convergence. The
+  /// residual is evaluated on a surface of this resolution, so this sets
+  /// the number of interpolation points.
   template <typename Frame>
   size_t current_l_mesh(const ylm::Strahlkorper<Frame>& strahlkorper) const;
 
   /// Resets the finder.
   SPECTRE_ALWAYS_INLINE void reset_for_next_find() {
     current_iter_ = 0;
+    current_l_surface_ = 0;
     previous_residual_mesh_norm_ = 0.0;
     min_residual_mesh_norm_ = std::numeric_limits<double>::max();
     iter_at_min_residual_mesh_norm_ = 0;
@@ -192,7 +226,10 @@ class FastFlow {
   double alpha_, beta_, abs_tol_, trunc_tol_, divergence_tol_;
   size_t divergence_iter_, max_its_;
   FlowType flow_;
+  std::optional<size_t> initial_l_max_;
   size_t current_iter_;
+  // Zero if the current find has not done an iteration yet.
+  size_t current_l_surface_;
   double previous_residual_mesh_norm_, min_residual_mesh_norm_;
   size_t iter_at_min_residual_mesh_norm_;
 };
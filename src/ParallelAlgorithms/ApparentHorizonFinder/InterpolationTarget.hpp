@@ -69,14 +69,25 @@ struct ApparentHorizon {
     static constexpr Options::String help = {"Verbosity"};
     using type = ::Verbosity;
   };
-  using options = tmpl::list<InitialGuess, FastFlow, Verbosity>;
+  struct NumberOfPreviousHorizons {
+    static constexpr Options::String help = {
+        "Number of previously found horizons that are kept to extrapolate the "
+        "initial guess in time and to compute the time derivative of the "
+        "horizon."};
+    using type = size_t;
+    static type lower_bound() { return 2; }
+    static type upper_bound() { return 4; }
+  };
+  using options = tmpl::list<InitialGuess, FastFlow, Verbosity,
+                             NumberOfPreviousHorizons>;
   static constexpr Options::String help = {
       "Provide an initial guess for the apparent horizon surface\n"
       "(Strahlkorper) and apparent-horizon-finding-algorithm (FastFlow)\n"
       "options."};
 
   ApparentHorizon(ylm::Strahlkorper<Frame> initial_guess_in,
-                  ::FastFlow fast_flow_in, ::Verbosity verbosity_in);
+                  ::FastFlow fast_flow_in, ::Verbosity verbosity_in,
+                  size_t number_of_previous_horizons_in);
 
   ApparentHorizon() = default;
   ApparentHorizon(const ApparentHorizon& /*rhs*/) = default;
@@ -91,6 +102,7 @@ struct ApparentHorizon {
   ylm::Strahlkorper<Frame> initial_guess{};
   ::FastFlow fast_flow{};
   ::Verbosity verbosity{::Verbosity::Quiet};
+  size_t number_of_previous_horizons{3};
 };
 
 template <typename Frame>
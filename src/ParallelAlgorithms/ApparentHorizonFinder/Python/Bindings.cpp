@@ -1,6 +1,8 @@
 // Distributed under the MIT License.
 // See LICENSE.txt for details.
 
+#include <cstddef>
+#include <optional>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
@@ -36,11 +38,11 @@ PYBIND11_MODULE(_Pybindings, m) {  // NOLINT
       .def_readonly("residual_mesh", &FastFlow::IterInfo::residual_mesh);
   py::class_<FastFlow>(m, "FastFlow")
       .def(py::init<FastFlow::FlowType, double, double, double, double, double,
-                    size_t, size_t>(),
+                    size_t, size_t, std::optional<size_t>>(),
            py::arg("flow_type"), py::arg("alpha"), py::arg("beta"),
            py::arg("abs_tol"), py::arg("truncation_tol"),
            py::arg("divergence_tol"), py::arg("divergence_iter"),
-           py::arg("max_its"))
+           py::arg("max_its"), py::arg("initial_l_max") = std::nullopt)
       .def(
           "iterate_horizon_finder",
           [](FastFlow& fast_flow,
@@ -54,6 +56,8 @@ PYBIND11_MODULE(_Pybindings, m) {  // NOLINT
           },
           py::arg("current_strahlkorper"), py::arg("upper_spatial_metric"),
           py::arg("extrinsic_curvature"), py::arg("christoffel_2nd_kind"))
+      .def("current_l_surface",
+           &FastFlow::current_l_surface<Frame::Inertial>)
       .def("current_l_mesh", &FastFlow::current_l_mesh<Frame::Inertial>)
       .def("reset_for_next_find", &FastFlow::reset_for_next_find);
 }
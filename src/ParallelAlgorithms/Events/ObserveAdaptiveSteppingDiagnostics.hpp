@@ -46,9 +46,13 @@ namespace Events {
  * - `Total steps on all elements`
  * - `Number of LTS step changes`
  * - `Number of step rejections`
+ * - `LTS coefficient cache hits`
+ * - `LTS coefficient cache misses`
  *
  * The slab information is the same on all elements.  The step
- * information is summed over the elements.
+ * information is summed over the elements.  The cache counts are the
+ * lookups of the LTS boundary coefficients of the element, see
+ * `TimeSteppers::adams_lts::lts_coefficients`.
  */
 class ObserveAdaptiveSteppingDiagnostics : public Event {
  private:
@@ -58,6 +62,8 @@ class ObserveAdaptiveSteppingDiagnostics : public Event {
       Parallel::ReductionDatum<uint64_t, funcl::AssertEqual<>>,
       Parallel::ReductionDatum<uint64_t, funcl::Plus<>>,
       Parallel::ReductionDatum<uint64_t, funcl::Plus<>>,
+      Parallel::ReductionDatum<uint64_t, funcl::Plus<>>,
+      Parallel::ReductionDatum<uint64_t, funcl::Plus<>>,
       Parallel::ReductionDatum<uint64_t, funcl::Plus<>>>;
 
  public:
@@ -86,6 +92,8 @@ class ObserveAdaptiveSteppingDiagnostics : public Event {
       " - Total steps on all elements\n"
       " - Number of LTS step changes\n"
       " - Number of step rejections\n"
+      " - LTS coefficient cache hits\n"
+      " - LTS coefficient cache misses\n"
       "\n"
       "The slab information is the same on all elements.  The step\n"
       "information is summed over the elements.";
@@ -121,11 +129,14 @@ class ObserveAdaptiveSteppingDiagnostics : public Event {
         std::vector<std::string>{
             observation_value.name, "Number of slabs",
             "Number of slab size changes", "Total steps on all elements",
-            "Number of LTS step changes", "Number of step rejections"},
+            "Number of LTS step changes", "Number of step rejections",
+            "LTS coefficient cache hits", "LTS coefficient cache misses"},
         ReductionData{observation_value.value, diags.number_of_slabs,
                       diags.number_of_slab_size_changes, diags.number_of_steps,
                       diags.number_of_step_fraction_changes,
-                      diags.number_of_step_rejections});
+                      diags.number_of_step_rejections,
+                      diags.number_of_lts_coefficient_cache_hits,
+                      diags.number_of_lts_coefficient_cache_misses});
   }
 
   using observation_registration_tags = tmpl::list<>;
@@ -3,9 +3,53 @@
 
 #include "ParallelAlgorithms/Events/ObserveDataBox.hpp"
 
+#include <cstddef>
+#include <map>
 #include <pup.h>
+#include <string>
+#include <vector>
+
+#include "Utilities/Gsl.hpp"
 
 namespace Events {
+namespace detail {
+NodeItemSizes map_add::operator()(NodeItemSizes map_1,
+                                  const NodeItemSizes& map_2) const {
+  for (const auto& [node, item_sizes] : map_2) {
+    add_item_sizes(make_not_null(&map_1[node]), item_sizes);
+  }
+  return map_1;
+}
+
+void add_item_sizes(const gsl::not_null<ItemSizes*> result,
+                    const ItemSizes& item_sizes) {
+  for (const auto& [name, size] : item_sizes) {
+    (*result)[name] += size;
+  }
+}
+
+ItemSizes total_item_sizes(const NodeItemSizes& node_item_sizes) {
+  ItemSizes result{};
+  for (const auto& [node, item_sizes] : node_item_sizes) {
+    (void)node;
+    add_item_sizes(make_not_null(&result), item_sizes);
+  }
+  return result;
+}
+
+void write_data_box_sizes(const gsl::not_null<std::vector<std::string>*> legend,
+                          const gsl::not_null<std::vector<double>*> columns,
+                          const ItemSizes& item_sizes) {
+  legend->reserve(legend->size() + item_sizes.size());
+  columns->reserve(columns->size() + item_sizes.size());
+  const double scaling = 1.0 / 1048576.0;  // so size is in MB
+  for (const auto& [name, size] : item_sizes) {
+    legend->emplace_back(name);
+    columns->emplace_back(scaling * static_cast<double>(size));
+  }
+}
+}  // namespace detail
+
 ObserveDataBox::ObserveDataBox(CkMigrateMessage* /*m*/) {}
 
 void ObserveDataBox::pup(PUP::er& p) { Event::pup(p); }
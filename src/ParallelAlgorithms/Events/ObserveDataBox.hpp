@@ -3,9 +3,13 @@
 
 #pragma once
 
+#include <cstddef>
 #include <map>
+#include <mutex>
 #include <pup.h>
+#include <string>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
@@ -13,11 +17,14 @@
 #include "IO/Observer/ObserverComponent.hpp"
 #include "IO/Observer/ReductionActions.hpp"
 #include "Options/String.hpp"
+#include "Parallel/ArrayCollection/IsDgElementCollection.hpp"
 #include "Parallel/DistributedObject.hpp"
 #include "Parallel/GlobalCache.hpp"
+#include "Parallel/Info.hpp"
 #include "Parallel/Invoke.hpp"
 #include "Parallel/Reduction.hpp"
 #include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/PrettyType.hpp"
 #include "Utilities/TMPL.hpp"
 
@@ -25,22 +32,36 @@ namespace Events {
 
 namespace detail {
 
+// The size in bytes of each item
+using ItemSizes = std::map<std::string, size_t>;
+
+// The size in bytes of each item on each node that contributed
+using NodeItemSizes = std::map<size_t, ItemSizes>;
+
+// Adds the sizes of `map_2` to those of `map_1`, inserting nodes and items
+// that are only in `map_2`
 struct map_add {
-  std::map<std::string, size_t> operator()(
-      std::map<std::string, size_t> map_1,
-      const std::map<std::string, size_t>& map_2) {
-    for (const auto& [key, value] : map_2) {
-      map_1.at(key) += value;
-    }
-    return map_1;
-  }
+  NodeItemSizes operator()(NodeItemSizes map_1,
+                           const NodeItemSizes& map_2) const;
 };
 
+// Adds `item_sizes` to `result`
+void add_item_sizes(gsl::not_null<ItemSizes*> result,
+                    const ItemSizes& item_sizes);
+
+// The size of each item summed over all nodes
+ItemSizes total_item_sizes(const NodeItemSizes& node_item_sizes);
+
 using ReductionType = Parallel::ReductionData<
     // Time
     Parallel::ReductionDatum<double, funcl::AssertEqual<>>,
-    // Map of total mem usage in MB per item in DataBoxes
-    Parallel::ReductionDatum<std::map<std::string, size_t>, map_add>>;
+    // Map of total mem usage per item in DataBoxes on each node
+    Parallel::ReductionDatum<NodeItemSizes, map_add>>;
+
+void write_data_box_sizes(
+    gsl::not_null<std::vector<std::string>*> legend,
+    gsl::not_null<std::vector<double>*> columns,
+    const ItemSizes& item_sizes);
 
 template <typename ContributingComponent>
 struct ReduceDataBoxSize {
@@ -49,27 +70,42 @@ struct ReduceDataBoxSize {
   static void apply(db::DataBox<DbTags>& /*box*/,
                     Parallel::GlobalCache<Metavariables>& cache,
                     const ArrayIndex& /*array_index*/, const double time,
-                    const std::map<std::string, size_t>& item_sizes) {
+                    const NodeItemSizes& node_item_sizes) {
     auto& observer_writer_proxy = Parallel::get_parallel_component<
         observers::ObserverWriter<Metavariables>>(cache);
-    const std::string subfile_name =
-        "/DataBoxSizeInMb/" + pretty_type::name<ContributingComponent>();
-    std::vector<std::string> legend;
-    legend.reserve(item_sizes.size() + 1);
-    legend.emplace_back("Time");
-    std::vector<double> columns;
-    columns.reserve(item_sizes.size() + 1);
-    columns.emplace_back(time);
-    const double scaling = 1.0 / 1048576.0;  // so size is in MB
-    for (const auto& [name, size] : item_sizes) {
-      legend.emplace_back(name);
-      columns.emplace_back(scaling * static_cast<double>(size));
+    const ItemSizes totals = total_item_sizes(node_item_sizes);
+    {
+      std::vector<std::string> legend{"Time"};
+      std::vector<double> columns{time};
+      write_data_box_sizes(make_not_null(&legend), make_not_null(&columns),
+                           totals);
+      Parallel::threaded_action<
+          observers::ThreadedActions::WriteReductionDataRow>(
+          // Node 0 is always the writer
+          observer_writer_proxy[0],
+          "/DataBoxSizeInMb/" + pretty_type::name<ContributingComponent>(),
+          std::move(legend), std::make_tuple(std::move(columns)));
+    }
+    for (const auto& [node, sizes_on_node] : node_item_sizes) {
+      // Every row has a column for each item, even if the item is not on
+      // this node
+      ItemSizes item_sizes{};
+      for (const auto& [name, total] : totals) {
+        (void)total;
+        const auto size = sizes_on_node.find(name);
+        item_sizes[name] = size == sizes_on_node.end() ? 0 : size->second;
+      }
+      std::vector<std::string> legend{"Time", "Node"};
+      std::vector<double> columns{time, static_cast<double>(node)};
+      write_data_box_sizes(make_not_null(&legend), make_not_null(&columns),
+                           item_sizes);
+      Parallel::threaded_action<
+          observers::ThreadedActions::WriteReductionDataRow>(
+          observer_writer_proxy[0],
+          "/DataBoxSizeInMbPerNode/" +
+              pretty_type::name<ContributingComponent>(),
+          std::move(legend), std::make_tuple(std::move(columns)));
     }
-    Parallel::threaded_action<
-        observers::ThreadedActions::WriteReductionDataRow>(
-        // Node 0 is always the writer
-        observer_writer_proxy[0], subfile_name, legend,
-        std::make_tuple(columns));
   }
 };
 
@@ -83,13 +119,38 @@ struct ContributeDataBoxSize {
         Parallel::get_parallel_component<ParallelComponent>(cache)[array_index];
     auto& target_proxy = Parallel::get_parallel_component<
         observers::ObserverWriter<Metavariables>>(cache);
-    const auto item_sizes = box.size_of_items();
+    ItemSizes item_sizes{};
+    if constexpr (Parallel::is_dg_element_collection_v<ParallelComponent>) {
+      // Sizing the element collection as a single item would not tell us
+      // anything, so we walk the DataBox of each element instead.
+      using element_collection_tag =
+          typename ParallelComponent::element_collection_tag;
+      add_item_sizes(
+          make_not_null(&item_sizes),
+          box.template size_of_items<tmpl::list<element_collection_tag>>());
+      for (auto& [element_id, element] :
+           db::get_mutable_reference<element_collection_tag>(
+               make_not_null(&box))) {
+        (void)element_id;
+        // Other threads may be running the element.
+        const std::lock_guard element_lock(element.element_lock());
+        add_item_sizes(make_not_null(&item_sizes),
+                       element.databox().size_of_items());
+      }
+    } else {
+      item_sizes = box.size_of_items();
+    }
+    // Only the sizes on this node are sent, so the size of the contribution
+    // does not grow with the number of nodes
+    NodeItemSizes node_item_sizes{
+        {Parallel::my_node<size_t>(cache), std::move(item_sizes)}};
     if constexpr (Parallel::is_singleton_v<ParallelComponent>) {
       Parallel::simple_action<ReduceDataBoxSize<ParallelComponent>>(
-          target_proxy[0], time, item_sizes);
+          target_proxy[0], time, node_item_sizes);
     } else {
       Parallel::contribute_to_reduction<ReduceDataBoxSize<ParallelComponent>>(
-          ReductionType{time, item_sizes}, my_proxy, target_proxy[0]);
+          ReductionType{time, std::move(node_item_sizes)}, my_proxy,
+          target_proxy[0]);
     }
   }
 };
@@ -101,7 +162,16 @@ struct ContributeDataBoxSize {
 /// \details The data will be written to disk in the reductions file under the
 /// `/DataBoxSizeInMb/` group. The name of each file is the `pretty_type::name`
 /// of each parallel component.  There will be a column for each item in the
-/// DataBox that is not a subitem or reference item.
+/// DataBox that is not a subitem or reference item, summed over all nodes.
+/// The same data is written per node to the `/DataBoxSizeInMbPerNode/` group,
+/// with one row per node and observation and a `Node` column. Nodes that hold
+/// no part of a component have no row for that component.
+///
+/// For a `Parallel::DgElementCollection` the items of the DataBox of every
+/// element on the node are included instead of the element collection.
+///
+/// Since every item of every DataBox is sized, this event is expensive and
+/// should be triggered rarely.
 class ObserveDataBox : public Event {
  public:
   /// \cond
@@ -42,7 +42,7 @@ ElementVolumeData construct_element_volume_data(
                                                TemporalIdTag>::Info& info) {
   std::vector<TensorComponent> components{};
 
-  const auto& all_source_vars = info.source_vars_from_element;
+  const auto& all_source_vars = *info.source_vars_from_element;
   tmpl::for_each<typename Metavariables::interpolator_source_vars>(
       [&components, &all_source_vars](auto source_var_tag_v) {
         using source_var_tag =
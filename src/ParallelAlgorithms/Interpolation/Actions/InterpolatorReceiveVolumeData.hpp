@@ -16,6 +16,7 @@
 #include "Parallel/GlobalCache.hpp"
 #include "ParallelAlgorithms/Interpolation/Actions/TryToInterpolate.hpp"
 #include "ParallelAlgorithms/Interpolation/Tags.hpp"
+#include "ParallelAlgorithms/Interpolation/VolumeDataSnapshot.hpp"
 #include "Utilities/Algorithm.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/TMPL.hpp"
@@ -52,6 +53,12 @@ constexpr bool using_interpolator_component_v = std::is_same_v<
 /// Attempts to interpolate if it already has received target points from
 /// any InterpolationTargets.
 ///
+/// The `Interpolator` stores a read-only `intrp::VolumeDataSnapshot` of each
+/// element's volume data in `Tags::VolumeVarsInfo`. A sender on the same core
+/// passes its snapshot, which is shared rather than copied. Data sent through a
+/// proxy arrives as a serialized copy, and `Variables` are moved into a new
+/// snapshot.
+///
 /// Uses:
 /// - DataBox:
 ///   - `Tags::NumberOfElements`
@@ -68,11 +75,26 @@ struct InterpolatorReceiveVolumeData {
             typename ArrayIndex, size_t VolumeDim>
   static void apply(
       db::DataBox<DbTags>& box, Parallel::GlobalCache<Metavariables>& cache,
-      const ArrayIndex& /*array_index*/,
+      const ArrayIndex& array_index,
       const typename TemporalId::type& temporal_id,
       const ElementId<VolumeDim>& element_id, const ::Mesh<VolumeDim>& mesh,
       Variables<typename Metavariables::interpolator_source_vars>&&
           interpolator_source_vars) {
+    apply<ParallelComponent>(
+        box, cache, array_index, temporal_id, element_id, mesh,
+        VolumeDataSnapshot<typename Metavariables::interpolator_source_vars>{
+            std::move(interpolator_source_vars)});
+  }
+
+  template <typename ParallelComponent, typename DbTags, typename Metavariables,
+            typename ArrayIndex, size_t VolumeDim>
+  static void apply(
+      db::DataBox<DbTags>& box, Parallel::GlobalCache<Metavariables>& cache,
+      const ArrayIndex& /*array_index*/,
+      const typename TemporalId::type& temporal_id,
+      const ElementId<VolumeDim>& element_id, const ::Mesh<VolumeDim>& mesh,
+      VolumeDataSnapshot<typename Metavariables::interpolator_source_vars>
+          interpolator_source_vars) {
     // Determine if we have already finished interpolating on this
     // temporal_id.  If so, then we simply return, ignore the incoming
     // data, and do not interpolate.
@@ -106,12 +106,12 @@ void interpolate_data(
                 // this element at this temporal_id.  So fill it.
                 vars_to_interpolate.initialize(
                     volume_info.source_vars_from_element
-                        .number_of_grid_points());
+                        ->number_of_grid_points());
 
                 InterpolationTarget_detail::compute_dest_vars_from_source_vars<
                     InterpolationTargetTag>(
                     make_not_null(&vars_to_interpolate),
-                    volume_info.source_vars_from_element, domain,
+                    *volume_info.source_vars_from_element, domain,
                     volume_info.mesh, element_id, cache, temporal_id);
               }
             }
@@ -141,7 +141,7 @@ void interpolate_data(
               // volume_info.source_vars_from_element is the same as
               // volume_info.vars_to_interpolate.
               interp_info.vars.emplace_back(interpolator.interpolate(
-                  volume_info.source_vars_from_element));
+                  *volume_info.source_vars_from_element));
             }
             interp_info.global_offsets.emplace_back(
                 element_coord_holder.offsets);
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <array>
+#include <cmath>
 #include <cstddef>
 #include <limits>
 #include <optional>
@@ -24,6 +25,7 @@
 #include "Domain/Structure/ElementId.hpp"
 #include "Domain/Tags.hpp"
 #include "NumericalAlgorithms/Interpolation/IrregularInterpolant.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "Options/String.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Invoke.hpp"
@@ -37,6 +39,7 @@
 #include "Utilities/Algorithm.hpp"
 #include "Utilities/CartesianProduct.hpp"
 #include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/PrettyType.hpp"
 #include "Utilities/Serialization/CharmPupable.hpp"
 #include "Utilities/TMPL.hpp"
@@ -64,6 +67,10 @@ struct InterpolationTarget;
 
 namespace intrp::Events {
 /// \cond
+namespace detail {
+CREATE_GET_STATIC_MEMBER_VARIABLE_OR_DEFAULT(interpolation_cache_tolerance)
+}  // namespace detail
+
 template <size_t VolumeDim, typename InterpolationTargetTag,
           typename SourceVarTags>
 class InterpolateWithoutInterpComponent;
@@ -78,6 +85,28 @@ class InterpolateWithoutInterpComponent;
  * out of all the stationary targets. An optimization for the future would be to
  * have each target be responsible for intelligently computing the
  * `block_logical_coordinates` for it's own points.
+ *
+ * Each element caches the logical coordinates of the target points in the
+ * element and the `intrp::Irregular` interpolation matrices to them. Targets
+ * such as `intrp::TargetPoints::Sphere` are usually interpolated to at the same
+ * points for many consecutive steps, so the expensive point location and
+ * construction of the interpolant are only redone when the cache key changes.
+ * The key consists of
+ * - the element and its mesh,
+ * - the target points held in `intrp::Tags::InterpPointInfo`,
+ * - the grid points of the element in the target frame, which move when
+ *   time-dependent maps move or deform the element relative to the target
+ *   points.
+ *
+ * The cached points are compared value by value, which is linear in the number
+ * of points and much cheaper than locating the target points in the element.
+ * The target points must match exactly. The grid points may move by the
+ * optional `static constexpr double interpolation_cache_tolerance` of the
+ * `InterpolationTargetTag` before the cache is rebuilt. It defaults to zero,
+ * i.e. the cache is only used if the element has not moved. A nonzero
+ * tolerance trades interpolation accuracy of order the tolerance times the
+ * gradient of the interpolated variables for not rebuilding the interpolant.
+ * The cache is not serialized and is rebuilt after the element migrates.
  */
 template <size_t VolumeDim, typename InterpolationTargetTag,
           typename... SourceVarTags>
@@ -137,6 +166,188 @@ class InterpolateWithoutInterpComponent<VolumeDim, InterpolationTargetTag,
       const ObservationValue& /*observation_value*/) const {
     const tnsr::I<DataVector, VolumeDim, frame>& all_target_points =
         get<Vars::PointInfoTag<InterpolationTargetTag, VolumeDim>>(point_infos);
+    if (not interpolation_cache_.has_value() or
+        not key_matches(interpolation_cache_->key, array_index, mesh,
+                        coordinates, all_target_points)) {
+      update_cache(
+          CacheKey{array_index, mesh, coordinates, all_target_points},
+          temporal_id, mesh, coordinates, all_target_points, cache,
+          array_index);
+    }
+
+    if (not interpolation_cache_->interpolator.has_value()) {
+      // There are no target points in this element, so we don't need
+      // to do anything.
+      return;
+    }
+
+    // There are points in this element, so interpolate to them and
+    // send the interpolated data to the target.  This is done
+    // in several steps:
+    // 1. Get the list of variables
+    Variables<typename InterpolationTargetTag::vars_to_interpolate_to_target>
+        interp_vars(mesh.number_of_grid_points());
+
+    if constexpr (InterpolationTarget_detail::has_compute_vars_to_interpolate_v<
+                      InterpolationTargetTag>) {
+      // 1a. Call compute_vars_to_interpolate.  Need the source in a
+      // Variables, so copy the variables here.
+      // This copy would be unnecessary if we passed a Variables into
+      // InterpolateWithoutInterpComponent instead of passing
+      // individual Tensors, which would require that this Variables is
+      // something in the DataBox. (Note that
+      // InterpolationTarget_detail::compute_dest_vars_from_source_vars
+      // allows the source variables to be different from the
+      // destination variables).
+      Variables<tmpl::list<SourceVarTags...>> source_vars(
+          mesh.number_of_grid_points());
+      [[maybe_unused]] const auto copy_to_variables =
+          [&source_vars](const auto source_var_tag_v, const auto& source_var) {
+            using source_var_tag = tmpl::type_from<decltype(source_var_tag_v)>;
+            get<source_var_tag>(source_vars) = source_var;
+            return 0;
+          };
+      expand_pack(copy_to_variables(tmpl::type_<SourceVarTags>{},
+                                    source_vars_input)...);
+
+      InterpolationTarget_detail::compute_dest_vars_from_source_vars<
+          InterpolationTargetTag>(make_not_null(&interp_vars), source_vars,
+                                  get<domain::Tags::Domain<VolumeDim>>(cache),
+                                  mesh, array_index, cache, temporal_id);
+    } else {
+      // 1b. There is no compute_vars_to_interpolate. So copy the
+      // source vars directly into the variables.
+      // This copy would be unnecessary if:
+      //   - We passed a Variables into InterpolateWithoutInterpComponent
+      //     instead of passing individual Tensors.
+      //  and
+      //   - This Variables was actually something in the DataBox.
+      //  and
+      //   - Either the passed-in Variables was exactly the same as
+      //     InterpolationTargetTag::vars_to_interpolate_to_target,
+      //     or IrregularInterpolant::interpolate had the ability to
+      //     interpolate only a subset of the Variables passed into it,
+      //     or IrregularInterpolant::interpolate can interpolate individual
+      //     DataVectors.
+      [[maybe_unused]] const auto copy_to_variables =
+          [&interp_vars](const auto tensor_tag_v, const auto& tensor) {
+            using tensor_tag = tmpl::type_from<decltype(tensor_tag_v)>;
+            get<tensor_tag>(interp_vars) = tensor;
+            return 0;
+          };
+      expand_pack(copy_to_variables(tmpl::type_<SourceVarTags>{},
+                                    source_vars_input)...);
+    }
+
+    // 2. The interpolator was set up when the cache was last updated
+    const intrp::Irregular<VolumeDim>& interpolator =
+        *interpolation_cache_->interpolator;
+
+    // 3. Interpolate and send interpolated data to target
+    auto& receiver_proxy = Parallel::get_parallel_component<
+        InterpolationTarget<Metavariables, InterpolationTargetTag>>(cache);
+    Parallel::simple_action<
+        Actions::InterpolationTargetVarsFromElement<InterpolationTargetTag>>(
+        receiver_proxy,
+        std::vector<Variables<
+            typename InterpolationTargetTag::vars_to_interpolate_to_target>>(
+            {interpolator.interpolate(interp_vars)}),
+        interpolation_cache_->block_logical_coords,
+        std::vector<std::vector<size_t>>({interpolation_cache_->offsets}),
+        temporal_id);
+  }
+
+  using is_ready_argument_tags = tmpl::list<>;
+
+  template <typename ArrayIndex, typename Component, typename Metavariables>
+  bool is_ready(Parallel::GlobalCache<Metavariables>& /*cache*/,
+                const ArrayIndex& /*array_index*/,
+                const Component* const /*meta*/) const {
+    return true;
+  }
+
+  bool needs_evolved_variables() const override { return true; }
+
+  /// The number of times the cached interpolant was (re)built
+  size_t number_of_cache_rebuilds() const { return number_of_cache_rebuilds_; }
+
+ private:
+  static constexpr double tolerance_ =
+      detail::get_interpolation_cache_tolerance_or_default_v<
+          InterpolationTargetTag, 0.0>;
+
+  struct CacheKey {
+    ElementId<VolumeDim> element_id{};
+    Mesh<VolumeDim> mesh{};
+    tnsr::I<DataVector, VolumeDim, frame> element_coordinates{};
+    tnsr::I<DataVector, VolumeDim, frame> target_points{};
+  };
+
+  struct InterpolationCache {
+    CacheKey key{};
+    std::vector<BlockLogicalCoords<VolumeDim>> block_logical_coords{};
+    std::vector<size_t> offsets{};
+    // std::nullopt if there are no target points in the element
+    std::optional<intrp::Irregular<VolumeDim>> interpolator{};
+  };
+
+  static bool key_matches(
+      const CacheKey& key, const ElementId<VolumeDim>& element_id,
+      const Mesh<VolumeDim>& mesh,
+      const tnsr::I<DataVector, VolumeDim, frame>& coordinates,
+      const tnsr::I<DataVector, VolumeDim, frame>& all_target_points) {
+    if (key.element_id != element_id or key.mesh != mesh or
+        key.target_points != all_target_points or
+        key.element_coordinates.get(0).size() != coordinates.get(0).size()) {
+      return false;
+    }
+    for (size_t d = 0; d < VolumeDim; ++d) {
+      const DataVector& cached = key.element_coordinates.get(d);
+      const DataVector& current = coordinates.get(d);
+      for (size_t i = 0; i < current.size(); ++i) {
+        // Written so that NaNs never match
+        if (not(std::abs(current[i] - cached[i]) <= tolerance_)) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  template <typename Metavariables>
+  void update_cache(
+      CacheKey key,
+      const typename InterpolationTargetTag::temporal_id::type& temporal_id,
+      const Mesh<VolumeDim>& mesh,
+      const tnsr::I<DataVector, VolumeDim, frame>& coordinates,
+      const tnsr::I<DataVector, VolumeDim, frame>& all_target_points,
+      Parallel::GlobalCache<Metavariables>& cache,
+      const ElementId<VolumeDim>& array_index) const {
+    ++number_of_cache_rebuilds_;
+    interpolation_cache_.emplace();
+    interpolation_cache_->key = std::move(key);
+    interpolation_cache_->block_logical_coords = target_block_logical_coords(
+        temporal_id, coordinates, all_target_points, cache, array_index);
+
+    const std::vector<ElementId<VolumeDim>> element_ids{{array_index}};
+    const auto element_coord_holders = element_logical_coordinates(
+        element_ids, interpolation_cache_->block_logical_coords);
+    if (element_coord_holders.count(array_index) == 0) {
+      return;
+    }
+    const auto& element_coord_holder = element_coord_holders.at(array_index);
+    interpolation_cache_->offsets = element_coord_holder.offsets;
+    interpolation_cache_->interpolator.emplace(
+        mesh, element_coord_holder.element_logical_coords);
+  }
+
+  template <typename Metavariables>
+  static std::vector<BlockLogicalCoords<VolumeDim>> target_block_logical_coords(
+      const typename InterpolationTargetTag::temporal_id::type& temporal_id,
+      const tnsr::I<DataVector, VolumeDim, frame>& coordinates,
+      const tnsr::I<DataVector, VolumeDim, frame>& all_target_points,
+      Parallel::GlobalCache<Metavariables>& cache,
+      const ElementId<VolumeDim>& array_index) {
     std::vector<BlockLogicalCoords<VolumeDim>> block_logical_coords{};
 
     // The sphere target is special because we have a better idea of where the
@@ -199,7 +410,7 @@ class InterpolateWithoutInterpComponent<VolumeDim, InterpolationTargetTag,
 
       // If no radii pass through this element, there's nothing to do so return
       if (not offset_and_num_points.has_value()) {
-        return;
+        return block_logical_coords;
       }
 
       // Get the x,y,z bounds
@@ -288,104 +499,13 @@ class InterpolateWithoutInterpComponent<VolumeDim, InterpolationTargetTag,
           InterpolationTargetTag>(cache, all_target_points, temporal_id);
     }
 
-    const std::vector<ElementId<VolumeDim>> element_ids{{array_index}};
-    const auto element_coord_holders =
-        element_logical_coordinates(element_ids, block_logical_coords);
-
-    if (element_coord_holders.count(array_index) == 0) {
-      // There are no target points in this element, so we don't need
-      // to do anything.
-      return;
-    }
-
-    // There are points in this element, so interpolate to them and
-    // send the interpolated data to the target.  This is done
-    // in several steps:
-    const auto& element_coord_holder = element_coord_holders.at(array_index);
-
-    // 1. Get the list of variables
-    Variables<typename InterpolationTargetTag::vars_to_interpolate_to_target>
-        interp_vars(mesh.number_of_grid_points());
-
-    if constexpr (InterpolationTarget_detail::has_compute_vars_to_interpolate_v<
-                      InterpolationTargetTag>) {
-      // 1a. Call compute_vars_to_interpolate.  Need the source in a
-      // Variables, so copy the variables here.
-      // This copy would be unnecessary if we passed a Variables into
-      // InterpolateWithoutInterpComponent instead of passing
-      // individual Tensors, which would require that this Variables is
-      // something in the DataBox. (Note that
-      // InterpolationTarget_detail::compute_dest_vars_from_source_vars
-      // allows the source variables to be different from the
-      // destination variables).
-      Variables<tmpl::list<SourceVarTags...>> source_vars(
-          mesh.number_of_grid_points());
-      [[maybe_unused]] const auto copy_to_variables =
-          [&source_vars](const auto source_var_tag_v, const auto& source_var) {
-            using source_var_tag = tmpl::type_from<decltype(source_var_tag_v)>;
-            get<source_var_tag>(source_vars) = source_var;
-            return 0;
-          };
-      expand_pack(copy_to_variables(tmpl::type_<SourceVarTags>{},
-                                    source_vars_input)...);
-
-      InterpolationTarget_detail::compute_dest_vars_from_source_vars<
-          InterpolationTargetTag>(make_not_null(&interp_vars), source_vars,
-                                  get<domain::Tags::Domain<VolumeDim>>(cache),
-                                  mesh, array_index, cache, temporal_id);
-    } else {
-      // 1b. There is no compute_vars_to_interpolate. So copy the
-      // source vars directly into the variables.
-      // This copy would be unnecessary if:
-      //   - We passed a Variables into InterpolateWithoutInterpComponent
-      //     instead of passing individual Tensors.
-      //  and
-      //   - This Variables was actually something in the DataBox.
-      //  and
-      //   - Either the passed-in Variables was exactly the same as
-      //     InterpolationTargetTag::vars_to_interpolate_to_target,
-      //     or IrregularInterpolant::interpolate had the ability to
-      //     interpolate only a subset of the Variables passed into it,
-      //     or IrregularInterpolant::interpolate can interpolate individual
-      //     DataVectors.
-      [[maybe_unused]] const auto copy_to_variables =
-          [&interp_vars](const auto tensor_tag_v, const auto& tensor) {
-            using tensor_tag = tmpl::type_from<decltype(tensor_tag_v)>;
-            get<tensor_tag>(interp_vars) = tensor;
-            return 0;
-          };
-      expand_pack(copy_to_variables(tmpl::type_<SourceVarTags>{},
-                                    source_vars_input)...);
-    }
-
-    // 2. Set up interpolator
-    intrp::Irregular<VolumeDim> interpolator(
-        mesh, element_coord_holder.element_logical_coords);
-
-    // 3. Interpolate and send interpolated data to target
-    auto& receiver_proxy = Parallel::get_parallel_component<
-        InterpolationTarget<Metavariables, InterpolationTargetTag>>(cache);
-    Parallel::simple_action<
-        Actions::InterpolationTargetVarsFromElement<InterpolationTargetTag>>(
-        receiver_proxy,
-        std::vector<Variables<
-            typename InterpolationTargetTag::vars_to_interpolate_to_target>>(
-            {interpolator.interpolate(interp_vars)}),
-        block_logical_coords,
-        std::vector<std::vector<size_t>>({element_coord_holder.offsets}),
-        temporal_id);
-  }
-
-  using is_ready_argument_tags = tmpl::list<>;
-
-  template <typename ArrayIndex, typename Component, typename Metavariables>
-  bool is_ready(Parallel::GlobalCache<Metavariables>& /*cache*/,
-                const ArrayIndex& /*array_index*/,
-                const Component* const /*meta*/) const {
-    return true;
+    return block_logical_coords;
   }
 
-  bool needs_evolved_variables() const override { return true; }
+  // Not serialized. Events are deserialized separately for each element, so
+  // the cache is local to an element and is rebuilt after migration.
+  mutable std::optional<InterpolationCache> interpolation_cache_{};
+  mutable size_t number_of_cache_rebuilds_ = 0;
 };
 
 /// \cond
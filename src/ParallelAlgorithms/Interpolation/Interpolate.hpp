@@ -6,6 +6,7 @@
 #include <cstddef>
 #include <tuple>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "DataStructures/Variables.hpp"
@@ -15,6 +16,7 @@
 #include "Parallel/Local.hpp"
 #include "ParallelAlgorithms/Interpolation/Actions/AddTemporalIdsToInterpolationTarget.hpp"
 #include "ParallelAlgorithms/Interpolation/Actions/InterpolatorReceiveVolumeData.hpp"
+#include "ParallelAlgorithms/Interpolation/VolumeDataSnapshot.hpp"
 #include "Utilities/TMPL.hpp"
 
 /// \cond
@@ -29,6 +31,16 @@ struct Interpolator;
 /// \endcond
 
 namespace intrp {
+/*!
+ * \brief Send the volume data of an element to the `Interpolator` on this node
+ * and tell the `InterpolationTarget` that it should interpolate.
+ *
+ * The `Interpolator` keeps the data until the target points arrive, while the
+ * element continues to evolve, so the element's fields are gathered into a
+ * read-only `intrp::VolumeDataSnapshot`. The `Interpolator` branch is on this
+ * core, so the simple action is invoked directly and the snapshot is shared
+ * with the `Interpolator` instead of being copied or serialized.
+ */
 template <typename InterpolationTargetTag, size_t VolumeDim,
           typename Metavariables, typename... InterpolatorSourceVars>
 void interpolate(
@@ -50,12 +62,15 @@ void interpolate(
             get<index>(interpolator_source_vars_tuple);
       });
 
-  // Send volume data to the Interpolator, to trigger interpolation.
+  // Share the snapshot with the Interpolator on this core, to trigger
+  // interpolation.
   auto& interpolator = *Parallel::local_branch(
       ::Parallel::get_parallel_component<Interpolator<Metavariables>>(cache));
   Parallel::simple_action<Actions::InterpolatorReceiveVolumeData<
       typename InterpolationTargetTag::temporal_id>>(
-      interpolator, temporal_id, array_index, mesh, interpolator_source_vars);
+      interpolator, temporal_id, array_index, mesh,
+      VolumeDataSnapshot<typename Metavariables::interpolator_source_vars>{
+          std::move(interpolator_source_vars)});
 
   // Tell the interpolation target that it should interpolate.
   auto& target = Parallel::get_parallel_component<
@@ -81,6 +81,11 @@ constexpr bool if_alias_exists_assert_conforms_to_v =
  *   be interpolating to the interpolation target. Only needed when *not* using
  *   the Interpolator ParallelComponent.
  *
+ * - a `static constexpr double interpolation_cache_tolerance`, the distance
+ *   the corners of an element may move in the target frame before
+ *   `intrp::Events::InterpolateWithoutInterpComponent` rebuilds its cached
+ *   interpolant. Defaults to zero.
+ *
  * An example of a struct that conforms to this protocol is
  *
  * \snippet Helpers/ParallelAlgorithms/Interpolation/Examples.hpp InterpolationTargetTag
@@ -16,6 +16,7 @@
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "Options/String.hpp"
 #include "ParallelAlgorithms/Interpolation/InterpolatedVars.hpp"
+#include "ParallelAlgorithms/Interpolation/VolumeDataSnapshot.hpp"
 #include "Utilities/TaggedTuple.hpp"
 
 /// \cond
@@ -129,8 +130,9 @@ template <typename Metavariables, typename TemporalId>
 struct VolumeVarsInfo : db::SimpleTag {
   struct Info {
     Mesh<Metavariables::volume_dim> mesh;
-    // Variables that have been sent from the Elements.
-    Variables<typename Metavariables::interpolator_source_vars>
+    // Variables that have been sent from the Elements. The snapshot is shared
+    // with the sender if it is on the same core.
+    VolumeDataSnapshot<typename Metavariables::interpolator_source_vars>
         source_vars_from_element;
     // Variables, for each InterpolationTargetTag, that have been
     // computed in the volume before interpolation, and that will
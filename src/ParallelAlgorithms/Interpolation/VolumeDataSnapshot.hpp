@@ -0,0 +1,60 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <memory>
+#include <pup.h>
+#include <utility>
+
+#include "DataStructures/Variables.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+
+namespace intrp {
+/*!
+ * \brief A read-only snapshot of the volume data of an element, passed to the
+ * `Interpolator`.
+ *
+ * Copies of a snapshot share the same data, so an element handing a snapshot
+ * to the `Interpolator` branch on its own core does not copy the data. The
+ * data is only copied when the snapshot is serialized, e.g. when it is sent
+ * through a proxy to another core or when the `Interpolator` is checkpointed.
+ */
+template <typename TagsList>
+class VolumeDataSnapshot {
+ public:
+  VolumeDataSnapshot() = default;
+
+  explicit VolumeDataSnapshot(Variables<TagsList> vars)
+      : vars_(std::make_shared<Variables<TagsList>>(std::move(vars))) {}
+
+  const Variables<TagsList>& operator*() const {
+    ASSERT(vars_ != nullptr, "The snapshot holds no data.");
+    return *vars_;
+  }
+
+  const Variables<TagsList>* operator->() const { return &**this; }
+
+  /// Whether `other` refers to the same data, rather than a copy of it.
+  bool shares_data_with(const VolumeDataSnapshot& other) const {
+    return vars_ != nullptr and vars_ == other.vars_;
+  }
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) {
+    bool has_data = vars_ != nullptr;
+    p | has_data;
+    if (p.isUnpacking()) {
+      vars_ = has_data ? std::make_shared<Variables<TagsList>>() : nullptr;
+    }
+    if (has_data) {
+      p | *vars_;
+    }
+  }
+
+ private:
+  // Not `const` so that the data can be serialized, but never modified after
+  // construction.
+  std::shared_ptr<Variables<TagsList>> vars_{};
+};
+}  // namespace intrp
@@ -17,6 +17,8 @@ struct AdaptiveSteppingDiagnostics {
   uint64_t number_of_steps = 0;
   uint64_t number_of_step_fraction_changes = 0;
   uint64_t number_of_step_rejections = 0;
+  uint64_t number_of_lts_coefficient_cache_hits = 0;
+  uint64_t number_of_lts_coefficient_cache_misses = 0;
 
   AdaptiveSteppingDiagnostics& operator+=(
       const AdaptiveSteppingDiagnostics& other);
@@ -15,7 +15,12 @@
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "Options/String.hpp"
+#include "Parallel/ArrayCollection/ContributeFromElement.hpp"
+#include "Parallel/ArrayCollection/IsDgElementCollection.hpp"
+#include "Parallel/ArrayCollection/SimpleActionOnElement.hpp"
 #include "Parallel/GlobalCache.hpp"
+#include "Parallel/Info.hpp"
+#include "Parallel/Invoke.hpp"
 #include "Parallel/Reduction.hpp"
 #include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
 #include "Time/ChangeSlabSize/Tags.hpp"
@@ -145,14 +150,31 @@ class ChangeSlabSize : public Event {
         },
         box);
 
-    const auto& component_proxy =
-        Parallel::get_parallel_component<ParallelComponent>(cache);
-    const auto& self_proxy = component_proxy[array_index];
     if (synchronization_required) {
-      Parallel::contribute_to_reduction<
-          ChangeSlabSize_detail::StoreNewSlabSize>(
-          ReductionData(slab_to_change, desired_slab_size), self_proxy,
-          component_proxy);
+      const auto& component_proxy =
+          Parallel::get_parallel_component<ParallelComponent>(cache);
+      if constexpr (Parallel::is_dg_element_collection_v<ParallelComponent>) {
+        // The node contributes once all of its elements have, and the result
+        // is passed on to every element.
+        Parallel::local_synchronous_action<
+            Parallel::Actions::ContributeFromElement>(
+            component_proxy, array_index,
+            ReductionData(slab_to_change, desired_slab_size),
+            [&cache, &component_proxy](ReductionData combined_data) {
+              Parallel::contribute_to_reduction<
+                  Parallel::Actions::SimpleActionOnElements<
+                      ChangeSlabSize_detail::StoreNewSlabSize>>(
+                  std::move(combined_data),
+                  component_proxy[Parallel::my_node<int>(cache)],
+                  component_proxy);
+            });
+      } else {
+        const auto& self_proxy = component_proxy[array_index];
+        Parallel::contribute_to_reduction<
+            ChangeSlabSize_detail::StoreNewSlabSize>(
+            ReductionData(slab_to_change, desired_slab_size), self_proxy,
+            component_proxy);
+      }
     } else {
       db::mutate<::Tags::ChangeSlabSize::NewSlabSize>(
           [&](const gsl::not_null<
@@ -16,8 +16,12 @@ namespace Tags {
 /// generally is whatever time is appropriate for the calculation
 /// being run.  Usually this is the substep time, but things such as
 /// dense-output calculations may temporarily change the value.
+///
+/// Items depending on the time, such as time-dependent Jacobians, are only
+/// reset when the value actually changes.
 struct Time : db::SimpleTag {
   using type = double;
+  static constexpr bool reset_dependents_only_if_changed = true;
   using option_tags = tmpl::list<OptionTags::InitialTime>;
 
   static constexpr bool pass_metavariables = false;
@@ -4,16 +4,23 @@
 #include "Time/TimeSteppers/AdamsLts.hpp"
 
 #include <algorithm>
+#include <boost/functional/hash.hpp>
+#include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <iterator>
+#include <list>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "DataStructures/MathWrapper.hpp"
 #include "NumericalAlgorithms/Interpolation/LagrangePolynomial.hpp"
 #include "Time/ApproximateTime.hpp"
 #include "Time/BoundaryHistory.hpp"
 #include "Time/EvolutionOrdering.hpp"
+#include "Time/SelfStart.hpp"
 #include "Time/Time.hpp"
 #include "Time/TimeStepId.hpp"
 #include "Time/TimeSteppers/AdamsCoefficients.hpp"
@@ -301,19 +308,13 @@ LtsCoefficients lts_coefficients_for_gts(
   }
   return lts_coefficients;
 }
-}  // namespace
 
 template <typename TimeType>
-LtsCoefficients lts_coefficients(const ConstBoundaryHistoryTimes& local_times,
-                                 const ConstBoundaryHistoryTimes& remote_times,
-                                 const Time& start_time,
-                                 const TimeType& end_time,
-                                 const AdamsScheme& local_scheme,
-                                 const AdamsScheme& remote_scheme,
-                                 const AdamsScheme& small_step_scheme) {
-  if (start_time == end_time) {
-    return {};
-  }
+LtsCoefficients compute_lts_coefficients(
+    const ConstBoundaryHistoryTimes& local_times,
+    const ConstBoundaryHistoryTimes& remote_times, const Time& start_time,
+    const TimeType& end_time, const AdamsScheme& local_scheme,
+    const AdamsScheme& remote_scheme, const AdamsScheme& small_step_scheme) {
   const evolution_less<Time> time_less{local_times.front().time_runs_forward()};
 
   LtsCoefficients step_coefficients{};
@@ -422,6 +423,208 @@ LtsCoefficients lts_coefficients(const ConstBoundaryHistoryTimes& local_times,
   return step_coefficients;
 }
 
+// Normalized times in the cache keys are rounded to multiples of this
+// value.  Histories that are equal up to roundoff in the normalization
+// then usually share an entry (unless the roundoff straddles a rounding
+// boundary), histories whose times differ by less than this fraction
+// of the step being taken may share one, and histories whose times
+// differ by more never do.
+constexpr double normalized_time_resolution = 1.0 / 4294967296.0;
+
+// The normalized signature of a boundary step: the schemes, the
+// direction of time, and the times of every entry of the local and
+// remote histories, relative to the start of the step and in units of
+// the step size.  The coefficients for two steps with the same
+// signature differ only by the factor of the step size.
+using StepPatternSignature = std::vector<int64_t>;
+
+// An entry of `LtsCoefficients` with the ids replaced by their
+// (step, substep) indices in the histories and the coefficient divided
+// by the step size.
+struct NormalizedLtsCoefficient {
+  std::pair<size_t, size_t> local_index;
+  std::pair<size_t, size_t> remote_index;
+  double coefficient;
+};
+
+// A least-recently-used cache of the patterns seen by one thread.
+// Every lookup reorders the entries, so a cache shared between threads
+// would need a lock on every hit.  Each thread instead keeps its own
+// cache and only ever uses the coefficients it calculated itself.
+struct LtsCoefficientsCache {
+  using Entry =
+      std::pair<StepPatternSignature, std::vector<NormalizedLtsCoefficient>>;
+
+  size_t capacity = default_lts_coefficients_cache_capacity;
+  // Ordered from most to least recently used.
+  std::list<Entry> entries{};
+  std::unordered_map<StepPatternSignature, std::list<Entry>::iterator,
+                     boost::hash<StepPatternSignature>>
+      index{};
+
+  const std::vector<NormalizedLtsCoefficient>* find(
+      const StepPatternSignature& signature) {
+    const auto entry = index.find(signature);
+    if (entry == index.end()) {
+      return nullptr;
+    }
+    entries.splice(entries.begin(), entries, entry->second);
+    return &entry->second->second;
+  }
+
+  void insert(StepPatternSignature signature,
+              std::vector<NormalizedLtsCoefficient> coefficients,
+              const gsl::not_null<LtsCoefficientsCacheStatistics*> statistics) {
+    if (capacity == 0) {
+      return;
+    }
+    shrink_to(capacity - 1, statistics);
+    entries.emplace_front(std::move(signature), std::move(coefficients));
+    index.emplace(entries.front().first, entries.begin());
+  }
+
+  // Remove the least recently used entries until at most `size`
+  // remain.
+  void shrink_to(
+      const size_t size,
+      const gsl::not_null<LtsCoefficientsCacheStatistics*> statistics) {
+    while (entries.size() > size) {
+      index.erase(entries.back().first);
+      entries.pop_back();
+      ++statistics->evictions;
+    }
+  }
+
+  void clear() {
+    index.clear();
+    entries.clear();
+  }
+};
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+thread_local LtsCoefficientsCache lts_coefficients_cache{};
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+thread_local LtsCoefficientsCacheStatistics cache_statistics{};
+
+void append_scheme(const gsl::not_null<StepPatternSignature*> signature,
+                   const AdamsScheme& scheme) {
+  signature->push_back(scheme.type == SchemeType::Implicit ? 1 : 0);
+  signature->push_back(static_cast<int64_t>(scheme.order));
+}
+
+// Returns false if the history cannot be cached because it is
+// self-starting, in which case the ids do not follow from the times.
+bool append_history(const gsl::not_null<StepPatternSignature*> signature,
+                    const ConstBoundaryHistoryTimes& times,
+                    const double start_time, const double step_size) {
+  signature->push_back(static_cast<int64_t>(times.size()));
+  for (size_t step = 0; step < times.size(); ++step) {
+    if (::SelfStart::is_self_starting(times[step])) {
+      return false;
+    }
+    const size_t number_of_substeps = times.number_of_substeps(step);
+    signature->push_back(static_cast<int64_t>(number_of_substeps));
+    for (size_t substep = 0; substep < number_of_substeps; ++substep) {
+      signature->push_back(static_cast<int64_t>(std::llround(
+          (times[{step, substep}].substep_time() - start_time) /
+          (step_size * normalized_time_resolution))));
+    }
+  }
+  return true;
+}
+
+std::pair<size_t, size_t> history_index(const ConstBoundaryHistoryTimes& times,
+                                        const TimeStepId& id) {
+  for (size_t step = 0; step < times.size(); ++step) {
+    for (size_t substep = 0; substep < times.number_of_substeps(step);
+         ++substep) {
+      if (times[{step, substep}] == id) {
+        return {step, substep};
+      }
+    }
+  }
+  ERROR("Coefficient generated for " << id << ", which is not in the history.");
+}
+}  // namespace
+
+const LtsCoefficientsCacheStatistics& lts_coefficients_cache_statistics() {
+  return cache_statistics;
+}
+
+void set_lts_coefficients_cache_capacity(const size_t capacity) {
+  lts_coefficients_cache.capacity = capacity;
+  lts_coefficients_cache.shrink_to(capacity, make_not_null(&cache_statistics));
+}
+
+void clear_lts_coefficients_cache() { lts_coefficients_cache.clear(); }
+
+template <typename TimeType>
+LtsCoefficients lts_coefficients(const ConstBoundaryHistoryTimes& local_times,
+                                 const ConstBoundaryHistoryTimes& remote_times,
+                                 const Time& start_time,
+                                 const TimeType& end_time,
+                                 const AdamsScheme& local_scheme,
+                                 const AdamsScheme& remote_scheme,
+                                 const AdamsScheme& small_step_scheme) {
+  if (start_time == end_time) {
+    return {};
+  }
+  if constexpr (not std::is_same_v<TimeType, Time>) {
+    // Dense output is requested at arbitrary times, so the patterns
+    // rarely repeat.
+    return compute_lts_coefficients(local_times, remote_times, start_time,
+                                    end_time, local_scheme, remote_scheme,
+                                    small_step_scheme);
+  } else {
+    const double step_size = (end_time - start_time).value();
+    StepPatternSignature signature{};
+    signature.reserve(10 + 3 * (local_times.size() + remote_times.size()));
+    signature.push_back(local_times.front().time_runs_forward() ? 1 : 0);
+    append_scheme(make_not_null(&signature), local_scheme);
+    append_scheme(make_not_null(&signature), remote_scheme);
+    append_scheme(make_not_null(&signature), small_step_scheme);
+    if (not(append_history(make_not_null(&signature), local_times,
+                           start_time.value(), step_size) and
+            append_history(make_not_null(&signature), remote_times,
+                           start_time.value(), step_size))) {
+      return compute_lts_coefficients(local_times, remote_times, start_time,
+                                      end_time, local_scheme, remote_scheme,
+                                      small_step_scheme);
+    }
+
+    if (const auto* const pattern = lts_coefficients_cache.find(signature);
+        pattern != nullptr) {
+      ++cache_statistics.hits;
+      // The entries were sorted when the pattern was stored, and the
+      // ordering of the ids is determined by their times.
+      LtsCoefficients step_coefficients{};
+      for (const auto& entry : *pattern) {
+        step_coefficients.emplace_back(local_times[entry.local_index],
+                                       remote_times[entry.remote_index],
+                                       step_size * entry.coefficient);
+      }
+      return step_coefficients;
+    }
+
+    ++cache_statistics.misses;
+    auto step_coefficients = compute_lts_coefficients(
+        local_times, remote_times, start_time, end_time, local_scheme,
+        remote_scheme, small_step_scheme);
+    std::vector<NormalizedLtsCoefficient> normalized_coefficients{};
+    normalized_coefficients.reserve(step_coefficients.size());
+    for (const auto& entry : step_coefficients) {
+      normalized_coefficients.push_back(
+          {history_index(local_times, get<0>(entry)),
+           history_index(remote_times, get<1>(entry)),
+           get<2>(entry) / step_size});
+    }
+    lts_coefficients_cache.insert(std::move(signature),
+                                  std::move(normalized_coefficients),
+                                  make_not_null(&cache_statistics));
+    return step_coefficients;
+  }
+}
+
 #define MATH_WRAPPER_TYPE(data) BOOST_PP_TUPLE_ELEM(0, data)
 
 #define INSTANTIATE(_, data)                          \
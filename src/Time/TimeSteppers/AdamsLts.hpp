@@ -5,6 +5,7 @@
 
 #include <boost/container/small_vector.hpp>
 #include <cstddef>
+#include <cstdint>
 #include <tuple>
 
 #include "Time/TimeStepId.hpp"
@@ -80,6 +81,33 @@ struct AdamsScheme {
 bool operator==(const AdamsScheme& a, const AdamsScheme& b);
 bool operator!=(const AdamsScheme& a, const AdamsScheme& b);
 
+/// Counts of the lookups in the cache used by `lts_coefficients`.
+struct LtsCoefficientsCacheStatistics {
+  uint64_t hits = 0;
+  uint64_t misses = 0;
+  uint64_t evictions = 0;
+};
+
+/// The number of step patterns each thread keeps in the
+/// `lts_coefficients` cache unless changed by
+/// `set_lts_coefficients_cache_capacity`.
+constexpr size_t default_lts_coefficients_cache_capacity = 1024;
+
+/// The lookups in the `lts_coefficients` cache performed by the
+/// calling thread.  The counts are only ever incremented, so callers
+/// interested in a particular computation should take the difference
+/// of the values before and after it.
+const LtsCoefficientsCacheStatistics& lts_coefficients_cache_statistics();
+
+/// Set the number of step patterns the calling thread keeps in the
+/// `lts_coefficients` cache, evicting the least recently used ones if
+/// there are too many.  A capacity of zero disables the cache.
+void set_lts_coefficients_cache_capacity(size_t capacity);
+
+/// Remove all entries from the calling thread's `lts_coefficients`
+/// cache.
+void clear_lts_coefficients_cache();
+
 /*!
  * Calculate the nonzero terms in an Adams LTS boundary contribution.
  *
@@ -114,6 +142,35 @@ bool operator!=(const AdamsScheme& a, const AdamsScheme& b);
  * times.  Any additional terms can be generated by a second call
  * treating the remainder of the step as non-dense.
  *
+ * Steps with `TimeType` `Time` are cached, as in a steady LTS
+ * evolution the same arrangement of the local and remote steps recurs
+ * on every boundary that steps in the same pattern.  The coefficients
+ * are stored in a least-recently-used cache keyed on the schemes and
+ * the times of all the entries in the two histories relative to \p
+ * start_time and in units of the step size, each rounded to the
+ * nearest multiple of \f$2^{-32}\f$.  A hit rescales coefficients
+ * that were calculated for a history whose normalized times round to
+ * the same values, i.e., whose control times may differ from the
+ * requested ones by up to \f$2^{-32} \approx 2.3 \times 10^{-10}\f$
+ * of the step size.  A hit therefore differs from a direct calculation
+ * by the change in the coefficients under such a shift of the control
+ * times, i.e., by a relative amount of order \f$10^{-10}\f$ times the
+ * sensitivity of the coefficients to the control times, in addition to
+ * roundoff.  For comparison, the normalized times themselves carry a
+ * roundoff error of order \f$10^{-16} |t| / \Delta t\f$.
+ *
+ * The cache and its statistics are `thread_local`: each thread (i.e.,
+ * each PE when running with Charm++ SMP) fills its own cache, and an
+ * element only hits entries calculated by elements previously stepped
+ * on the same thread.  Whether a step hits, and therefore the
+ * result at the level described above, can depend on the order
+ * in which elements are scheduled and on the PE they run on.  Set the
+ * capacity to zero with `set_lts_coefficients_cache_capacity()` on
+ * every thread for results that are independent of the scheduling.
+ * Self-starting histories and dense output are not cached.  The hits,
+ * misses, and evictions of the calling thread are recorded in
+ * `lts_coefficients_cache_statistics()`.
+ *
  * \tparam TimeType The type `Time` for a step aligned with the
  * control times or `ApproximateTime` for dense output.
  */
@@ -0,0 +1,180 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Utilities/System/ThreadPool.hpp"
+
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+namespace sys {
+
+ThreadPool::ThreadPool(const size_t number_of_threads) {
+  resize(number_of_threads);
+}
+
+ThreadPool::~ThreadPool() { stop_workers(); }
+
+void ThreadPool::resize(const size_t number_of_threads) {
+  if (number_of_threads == 0) {
+    throw std::invalid_argument(
+        "A ThreadPool must have at least one thread, the calling thread.");
+  }
+  acquire();
+  if (request_help_ != nullptr or
+      number_of_threads != workers_.size() + 1) {
+    stop_workers();
+    {
+      const std::lock_guard lock(mutex_);
+      stop_ = false;
+    }
+    request_help_ = nullptr;
+    workers_.reserve(number_of_threads - 1);
+    for (size_t i = 0; i < number_of_threads - 1; ++i) {
+      workers_.emplace_back([this]() { worker_loop(); });
+    }
+    number_of_threads_.store(number_of_threads);
+  }
+  release();
+}
+
+void ThreadPool::use_external_helpers(
+    const size_t number_of_helpers, std::function<void(size_t)> request_help) {
+  acquire();
+  stop_workers();
+  {
+    const std::lock_guard lock(mutex_);
+    stop_ = false;
+  }
+  request_help_ = std::move(request_help);
+  number_of_threads_.store(number_of_helpers + 1);
+  release();
+}
+
+void ThreadPool::help() {
+  std::unique_lock lock(mutex_);
+  if (chunk_function_ == nullptr) {
+    return;
+  }
+  const std::function<void(size_t)>& chunk = *chunk_function_;
+  const size_t number_of_chunks = number_of_chunks_;
+  ++active_workers_;
+  lock.unlock();
+  process_chunks(chunk, number_of_chunks);
+  lock.lock();
+  --active_workers_;
+  if (active_workers_ == 0) {
+    work_done_.notify_all();
+  }
+}
+
+void ThreadPool::acquire() {
+  std::unique_lock lock(mutex_);
+  idle_.wait(lock, [this]() { return not busy_.exchange(true); });
+}
+
+void ThreadPool::release() {
+  {
+    const std::lock_guard lock(mutex_);
+    busy_.store(false);
+  }
+  idle_.notify_all();
+}
+
+void ThreadPool::run(const size_t number_of_chunks,
+                     const std::function<void(size_t)>& chunk) {
+  {
+    const std::lock_guard lock(mutex_);
+    chunk_function_ = &chunk;
+    number_of_chunks_ = number_of_chunks;
+    next_chunk_.store(0);
+    error_ = nullptr;
+    ++generation_;
+  }
+  work_available_.notify_all();
+  if (request_help_ != nullptr) {
+    request_help_(number_of_chunks - 1);
+  }
+  process_chunks(chunk, number_of_chunks);
+
+  // Every chunk has been claimed once the calling thread runs out of chunks,
+  // and each worker that claimed one remains active until it is processed.
+  std::exception_ptr error{};
+  {
+    std::unique_lock lock(mutex_);
+    work_done_.wait(lock, [this]() { return active_workers_ == 0; });
+    chunk_function_ = nullptr;
+    std::swap(error, error_);
+  }
+  release();
+  if (error != nullptr) {
+    std::rethrow_exception(error);
+  }
+}
+
+void ThreadPool::process_chunks(const std::function<void(size_t)>& chunk,
+                                const size_t number_of_chunks) {
+  for (size_t chunk_index = next_chunk_.fetch_add(1);
+       chunk_index < number_of_chunks; chunk_index = next_chunk_.fetch_add(1)) {
+    try {
+      chunk(chunk_index);
+    } catch (...) {
+      const std::lock_guard lock(mutex_);
+      if (error_ == nullptr) {
+        error_ = std::current_exception();
+      }
+    }
+  }
+}
+
+void ThreadPool::worker_loop() {
+  std::unique_lock lock(mutex_);
+  size_t seen_generation = generation_;
+  while (true) {
+    work_available_.wait(lock, [this, &seen_generation]() {
+      return stop_ or generation_ != seen_generation;
+    });
+    if (stop_) {
+      return;
+    }
+    seen_generation = generation_;
+    // the loop may have been completed by the other threads before this one
+    // woke up
+    if (chunk_function_ == nullptr) {
+      continue;
+    }
+    const std::function<void(size_t)>& chunk = *chunk_function_;
+    const size_t number_of_chunks = number_of_chunks_;
+    ++active_workers_;
+    lock.unlock();
+    process_chunks(chunk, number_of_chunks);
+    lock.lock();
+    --active_workers_;
+    if (active_workers_ == 0) {
+      work_done_.notify_all();
+    }
+  }
+}
+
+void ThreadPool::stop_workers() {
+  {
+    const std::lock_guard lock(mutex_);
+    stop_ = true;
+  }
+  work_available_.notify_all();
+  for (auto& worker : workers_) {
+    worker.join();
+  }
+  workers_.clear();
+  number_of_threads_.store(1);
+}
+
+ThreadPool& node_thread_pool() {
+  static ThreadPool pool{};
+  return pool;
+}
+}  // namespace sys
@@ -0,0 +1,145 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace sys {
+
+/*!
+ * \ingroup UtilitiesGroup
+ * \brief A set of worker threads that splits loops over independent indices
+ * among the cores of a node.
+ *
+ * \details `parallel_for()` divides the range `[0, size)` into at most
+ * `number_of_threads()` contiguous chunks of nearly equal length and calls the
+ * loop body once per chunk. The calling thread processes chunks alongside the
+ * workers, so a pool with `number_of_threads()` equal to `N` holds `N - 1`
+ * worker threads, and a pool of size 1 runs every loop serially on the calling
+ * thread.
+ *
+ * The pool runs one loop at a time. A `parallel_for()` that is called while a
+ * loop is already running, either from another thread or from within the body
+ * of the running loop, is executed serially on the calling thread. Concurrent
+ * callers therefore never block one another, at the cost of not sharing the
+ * workers.
+ *
+ * The work can be shared either with worker threads owned by the pool (see
+ * `resize()`) or with threads that are managed elsewhere (see
+ * `use_external_helpers()`), e.g. the PEs of a Charm++ nodegroup. Threads
+ * owned by the pool are not managed by Charm++, so they should only be given
+ * cores that are not already occupied by Charm++ PEs. In either case the loop
+ * body must not call into the Charm++ runtime.
+ */
+class ThreadPool {
+ public:
+  explicit ThreadPool(size_t number_of_threads = 1);
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+  // the worker threads refer to `this`, so the pool must not move.
+  ThreadPool(ThreadPool&&) = delete;
+  ThreadPool& operator=(ThreadPool&&) = delete;
+  ~ThreadPool();
+
+  /// The number of threads, including the calling thread, that share the work
+  /// of each loop.
+  size_t number_of_threads() const { return number_of_threads_.load(); }
+
+  /// Change the number of threads that share the work of each loop, creating
+  /// `number_of_threads - 1` worker threads owned by the pool. Waits for any
+  /// running loop to complete. Does nothing if the pool already owns that
+  /// many workers.
+  void resize(size_t number_of_threads);
+
+  /// Share the work of each loop with up to `number_of_helpers` threads that
+  /// are not owned by the pool, replacing any workers owned by the pool.
+  /// Waits for any running loop to complete.
+  ///
+  /// At the start of each loop `request_help(n)` is called on the calling
+  /// thread, and should arrange for `help()` to be called on up to `n` other
+  /// threads. The loop does not wait for the helpers to arrive: chunks that
+  /// haven't been claimed by a helper are processed by the calling thread, so
+  /// the loop completes even if none of the helpers are available.
+  void use_external_helpers(size_t number_of_helpers,
+                            std::function<void(size_t)> request_help);
+
+  /// Process chunks of the running loop, if any, on the calling thread.
+  /// Returns immediately if no loop is running.
+  void help();
+
+  /// Call `function(begin, end)` on disjoint contiguous ranges that together
+  /// cover `[0, size)`, and return once every range has been processed. Any
+  /// exception thrown by `function` is rethrown on the calling thread.
+  template <typename F>
+  void parallel_for(size_t size, const F& function);
+
+ private:
+  void run(size_t number_of_chunks, const std::function<void(size_t)>& chunk);
+
+  void process_chunks(const std::function<void(size_t)>& chunk,
+                      size_t number_of_chunks);
+
+  void worker_loop();
+
+  void stop_workers();
+
+  // Wait until no loop is running and claim `busy_`.
+  void acquire();
+
+  void release();
+
+  std::vector<std::thread> workers_{};
+  std::function<void(size_t)> request_help_{};
+  std::atomic<size_t> number_of_threads_{1};
+  // held by the running loop, by `resize()` or by `use_external_helpers()`
+  std::atomic<bool> busy_{false};
+  std::mutex mutex_{};
+  std::condition_variable work_available_{};
+  std::condition_variable work_done_{};
+  std::condition_variable idle_{};
+  // The following are guarded by `mutex_`, except for `next_chunk_`, which is
+  // modified without the lock while a loop is running.
+  const std::function<void(size_t)>* chunk_function_ = nullptr;
+  size_t number_of_chunks_ = 0;
+  size_t generation_ = 0;
+  size_t active_workers_ = 0;
+  bool stop_ = false;
+  std::exception_ptr error_{};
+  std::atomic<size_t> next_chunk_{0};
+};
+
+template <typename F>
+void ThreadPool::parallel_for(const size_t size, const F& function) {
+  if (size == 0) {
+    return;
+  }
+  if (size == 1 or number_of_threads() == 1 or busy_.exchange(true)) {
+    function(size_t{0}, size);
+    return;
+  }
+  // the number of threads cannot change while `busy_` is held
+  const size_t number_of_chunks = std::min(size, number_of_threads());
+  const std::function<void(size_t)> chunk =
+      [&function, &size, &number_of_chunks](const size_t chunk_index) {
+        function(chunk_index * size / number_of_chunks,
+                 (chunk_index + 1) * size / number_of_chunks);
+      };
+  run(number_of_chunks, chunk);
+}
+
+/// \ingroup UtilitiesGroup
+/// The `ThreadPool` shared by all code running in this process, i.e. on this
+/// node when running with Charm++ SMP. It starts with a single thread, so loops
+/// run serially until the pool is resized.
+ThreadPool& node_thread_pool();
+}  // namespace sys
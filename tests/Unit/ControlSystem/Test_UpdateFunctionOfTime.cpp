@@ -9,11 +9,13 @@
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include "ControlSystem/Tags/MeasurementTimescales.hpp"
 #include "ControlSystem/Tags/SystemTags.hpp"
 #include "ControlSystem/UpdateFunctionOfTime.hpp"
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/Matrix.hpp"
 #include "Domain/Creators/Tags/FunctionsOfTime.hpp"
 #include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
 #include "Domain/FunctionsOfTime/PiecewisePolynomial.hpp"
@@ -22,6 +24,8 @@
 #include "Domain/FunctionsOfTime/SettleToConstant.hpp"
 #include "Domain/FunctionsOfTime/Tags.hpp"
 #include "Framework/ActionTesting.hpp"
+#include "Helpers/IO/Observers/MockWriteReductionDataRow.hpp"
+#include "IO/H5/Dat.hpp"
 #include "Parallel/Phase.hpp"
 #include "Parallel/PhaseDependentActionList.hpp"
 #include "Utilities/CloneUniquePtrs.hpp"
@@ -45,7 +49,8 @@ struct TestSingleton {
   using chare_type = ActionTesting::MockSingletonChare;
   using array_index = size_t;
   using metavariables = Metavariables;
-  using const_global_cache_tags = tmpl::list<>;
+  using const_global_cache_tags =
+      tmpl::list<control_system::Tags::WriteDataToDisk>;
   using mutable_global_cache_tags =
       tmpl::list<domain::Tags::FunctionsOfTimeInitialize,
                  control_system::Tags::MeasurementTimescales,
@@ -229,9 +234,12 @@ void test_update_aggregator() {
 
 struct AggregatorMetavariables {
   using metavariables = AggregatorMetavariables;
-  using component_list = tmpl::list<TestSingleton<metavariables, 1>,
-                                    TestSingleton<metavariables, 2>,
-                                    TestSingleton<metavariables, 3>>;
+  using observed_reduction_data_tags = tmpl::list<>;
+  using component_list =
+      tmpl::list<TestSingleton<metavariables, 1>,
+                 TestSingleton<metavariables, 2>,
+                 TestSingleton<metavariables, 3>,
+                 TestHelpers::observers::MockObserverWriter<metavariables>>;
 };
 
 struct SetSystemToCombinedNames {
@@ -250,6 +258,7 @@ void test_aggregate_update_action() {
   using component1 = TestSingleton<metavars, 1>;
   using component2 = TestSingleton<metavars, 2>;
   using component3 = TestSingleton<metavars, 3>;
+  using observer = TestHelpers::observers::MockObserverWriter<metavars>;
   const double t0 = 0.0;
   const double old_fot_expiration13 = 4.0;
   const double old_fot_expiration2 = 2.0;
@@ -306,9 +315,11 @@ void test_aggregate_update_action() {
   auto system_to_combined_names_copy = system_to_combined_names;
 
   ActionTesting::MockRuntimeSystem<metavars> runner{
-      {},
+      {true},
       {std::move(f_of_t_map), std::move(measurement_map),
        std::move(system_to_combined_names_copy)}};
+  ActionTesting::emplace_nodegroup_component_and_initialize<observer>(
+      make_not_null(&runner), {});
   ActionTesting::emplace_singleton_component_and_initialize<component1>(
       make_not_null(&runner), ActionTesting::NodeId{0},
       ActionTesting::LocalCoreId{0}, {std::move(aggregators_copy)});
@@ -473,6 +484,35 @@ void test_aggregate_update_action() {
   check_equal("FoT2", functions_of_time, expected_f_of_t_map);
   check_equal("FoT2", measurement_timescales, expected_measurement_map);
 
+  // The cost of each functions of time broadcast is written to the reduction
+  // file
+  const auto check_written_update = [&runner](
+                                        const std::string& combined_name,
+                                        const double update_time,
+                                        const size_t number_of_fots) {
+    CAPTURE(combined_name);
+    REQUIRE(ActionTesting::number_of_queued_threaded_actions<observer>(
+                runner, 0) == 1);
+    ActionTesting::invoke_queued_threaded_action<observer>(
+        make_not_null(&runner), 0);
+    const auto& read_file = ActionTesting::get_databox_tag<
+        observer, TestHelpers::observers::MockReductionFileTag>(runner, 0);
+    const auto& dataset = read_file.get_dat(
+        "/ControlSystems/FunctionOfTimeUpdates/" + combined_name);
+    CHECK(dataset.get_legend() ==
+          std::vector<std::string>{"Time", "NumberOfFunctionsOfTime",
+                                   "UpdateSizeInBytes", "NumberOfNodes",
+                                   "TotalBytesSent"});
+    const Matrix& data = dataset.get_data();
+    REQUIRE(data.rows() == 1);
+    CHECK(data(0, 0) == update_time);
+    CHECK(data(0, 1) == static_cast<double>(number_of_fots));
+    CHECK(data(0, 2) > 0.0);
+    CHECK(data(0, 3) == 1.0);
+    CHECK(data(0, 4) == data(0, 2) * data(0, 3));
+  };
+  check_written_update("FoT2", old_fot_expiration2, 1);
+
   // Update the second of the 13 measurement which should update both functions
   // of time and just the one measurement timescale
   ActionTesting::simple_action<component1,
@@ -497,6 +537,7 @@ void test_aggregate_update_action() {
   check_equal("FoT1", functions_of_time, expected_f_of_t_map);
   check_equal("FoT3", functions_of_time, expected_f_of_t_map);
   check_equal("FoT1FoT3", measurement_timescales, expected_measurement_map);
+  check_written_update("FoT1FoT3", old_fot_expiration13, 2);
 }
 
 SPECTRE_TEST_CASE("Unit.ControlSystem.UpdateFunctionOfTime",
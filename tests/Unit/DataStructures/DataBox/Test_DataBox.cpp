@@ -11,12 +11,14 @@
 #include <optional>
 #include <ostream>
 #include <pup.h>
+#include <sstream>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "DataStructures/DataBox/Access.hpp"
 #include "DataStructures/DataBox/AsAccess.hpp"
+#include "DataStructures/DataBox/ComputeItemEvaluations.hpp"
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/DataBoxTag.hpp"
 #include "DataStructures/DataBox/DataOnSlice.hpp"
@@ -34,6 +36,7 @@
 #include "Helpers/DataStructures/DataBox/TestHelpers.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/Literals.hpp"
+#include "Utilities/PrettyType.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
 #include "Utilities/TypeTraits.hpp"
@@ -1265,6 +1268,91 @@ void test_reset_compute_items() {
   }
 }
 
+namespace ResetIfChangedTags {
+struct Compared : db::SimpleTag {
+  using type = int;
+  static constexpr bool reset_dependents_only_if_changed = true;
+};
+struct NotCompared : db::SimpleTag {
+  using type = int;
+};
+struct Sum : db::SimpleTag {
+  using type = int;
+};
+struct SumCompute : Sum, db::ComputeTag {
+  using base = Sum;
+  using return_type = int;
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+  static size_t evaluations;
+  static void function(const gsl::not_null<int*> result, const int compared,
+                       const int not_compared) {
+    ++evaluations;
+    *result = compared + not_compared;
+  }
+  using argument_tags = tmpl::list<Compared, NotCompared>;
+};
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+size_t SumCompute::evaluations = 0;
+}  // namespace ResetIfChangedTags
+
+void test_reset_dependents_only_if_changed() {
+  INFO("test reset dependents only if changed");
+  using ResetIfChangedTags::SumCompute;
+  static_assert(db::reset_dependents_only_if_changed_v<
+                ResetIfChangedTags::Compared>);
+  static_assert(not db::reset_dependents_only_if_changed_v<
+                ResetIfChangedTags::NotCompared>);
+#ifdef SPECTRE_PROFILING
+  db::reset_compute_item_evaluations();
+#endif  // SPECTRE_PROFILING
+  auto box = db::create<db::AddSimpleTags<ResetIfChangedTags::Compared,
+                                          ResetIfChangedTags::NotCompared>,
+                        db::AddComputeTags<SumCompute>>(1, 2);
+  CHECK(db::get<ResetIfChangedTags::Sum>(box) == 3);
+  CHECK(SumCompute::evaluations == 1);
+
+  db::mutate<ResetIfChangedTags::Compared>(
+      [](const gsl::not_null<int*> compared) { *compared = 1; },
+      make_not_null(&box));
+  CHECK(db::get<ResetIfChangedTags::Sum>(box) == 3);
+  CHECK(SumCompute::evaluations == 1);
+
+  db::mutate<ResetIfChangedTags::NotCompared>(
+      [](const gsl::not_null<int*> not_compared) { *not_compared = 2; },
+      make_not_null(&box));
+  CHECK(db::get<ResetIfChangedTags::Sum>(box) == 3);
+  CHECK(SumCompute::evaluations == 2);
+
+  db::mutate<ResetIfChangedTags::Compared, ResetIfChangedTags::NotCompared>(
+      [](const gsl::not_null<int*> compared,
+         const gsl::not_null<int*> /*not_compared*/) { *compared = 4; },
+      make_not_null(&box));
+  CHECK(db::get<ResetIfChangedTags::Sum>(box) == 6);
+  CHECK(SumCompute::evaluations == 3);
+
+  db::mutate<ResetIfChangedTags::Compared>(
+      [](const gsl::not_null<int*> compared) { *compared = 5; },
+      make_not_null(&box));
+  CHECK(db::get<ResetIfChangedTags::Sum>(box) == 7);
+  CHECK(SumCompute::evaluations == 4);
+#ifdef SPECTRE_PROFILING
+  const std::string sum_name = pretty_type::get_name<SumCompute>();
+  CHECK(db::compute_item_evaluations().at(sum_name) == 4);
+  {
+    std::stringstream report{};
+    db::write_compute_item_evaluations(report);
+    CHECK(report.str().find(sum_name + ": 4\n") != std::string::npos);
+  }
+  db::reset_compute_item_evaluations();
+  CHECK(db::compute_item_evaluations().at(sum_name) == 0);
+#else
+  CHECK(db::compute_item_evaluations().empty());
+  std::stringstream report{};
+  db::write_compute_item_evaluations(report);
+  CHECK(report.str().empty());
+#endif  // SPECTRE_PROFILING
+}
+
 namespace ExtraResetTags {
 struct Var : db::SimpleTag {
   using type = Scalar<DataVector>;
@@ -3153,6 +3241,45 @@ void test_get_mutable_reference() {
   // db::get_mutable_reference<First<0>>(make_not_null(&box));
 }
 
+void test_release_compute_items() {
+  INFO("test release_compute_items");
+  auto box = db::create<
+      db::AddSimpleTags<test_databox_tags::Tag0, test_databox_tags::Tag2>,
+      db::AddComputeTags<test_databox_tags::Tag4Compute,
+                         test_databox_tags::Tag5Compute>>(
+      3.14, "My Sample String"s);
+  const std::string tag5_name =
+      "(anonymous namespace)::test_databox_tags::Tag5Compute";
+  // Releasing unevaluated items is a no-op
+  db::release_compute_items<tmpl::list<test_databox_tags::Tag5>>(
+      make_not_null(&box));
+  CHECK(box.size_of_items().at(tag5_name) == 8);
+
+  CHECK(db::get<test_databox_tags::Tag5>(box) == "My Sample String6.28"s);
+  CHECK(box.size_of_items().at(tag5_name) == 28);
+  db::release_compute_items<tmpl::list<test_databox_tags::Tag5Compute>>(
+      make_not_null(&box));
+  CHECK(box.size_of_items().at(tag5_name) == 8);
+  CHECK(db::get<test_databox_tags::Tag5>(box) == "My Sample String6.28"s);
+  CHECK(box.size_of_items().at(tag5_name) == 28);
+
+  // Released items are recomputed from the current values of their arguments
+  db::release_compute_items<tmpl::list<test_databox_tags::Tag4,
+                                       test_databox_tags::Tag5>>(
+      make_not_null(&box));
+  db::mutate<test_databox_tags::Tag0>(
+      [](const gsl::not_null<double*> val) { *val = 1.5; },
+      make_not_null(&box));
+  CHECK(db::get<test_databox_tags::Tag4>(box) == 3.0);
+  CHECK(db::get<test_databox_tags::Tag5>(box) == "My Sample String3"s);
+
+  // These should all fail to compile:
+  // db::release_compute_items<tmpl::list<test_databox_tags::Tag0>>(
+  //     make_not_null(&box));
+  // db::release_compute_items<tmpl::list<test_databox_tags::Tag3>>(
+  //     make_not_null(&box));
+}
+
 void test_output() {
   INFO("test output");
   auto box = db::create<
@@ -3272,6 +3399,13 @@ void test_output() {
         8);
   CHECK(item_size.at("(anonymous namespace)::test_databox_tags::Tag5Compute") ==
         28);
+  const auto item_size_skipped =
+      box.size_of_items<tmpl::list<test_databox_tags::Tag1>>();
+  CHECK(item_size_skipped.size() == 4);
+  CHECK(item_size_skipped.count(
+            "(anonymous namespace)::test_databox_tags::Tag1") == 0);
+  CHECK(item_size_skipped.at(
+            "(anonymous namespace)::test_databox_tags::Tag2") == 24);
 
   const auto box_with_ptrs =
       db::create<db::AddSimpleTags<test_databox_tags::Pointer>,
@@ -3394,6 +3528,7 @@ SPECTRE_TEST_CASE("Unit.DataStructures.DataBox", "[Unit][DataStructures]") {
   test_variables();
   test_variables2();
   test_reset_compute_items();
+  test_reset_dependents_only_if_changed();
   test_variables_extra_reset();
   test_mutate_apply();
   test_mutating_compute_item();
@@ -3405,6 +3540,7 @@ SPECTRE_TEST_CASE("Unit.DataStructures.DataBox", "[Unit][DataStructures]") {
   test_serialization_and_copy_items();
   test_reference_item();
   test_get_mutable_reference();
+  test_release_compute_items();
   test_output();
   test_exception_safety();
 }
@@ -9,7 +9,9 @@
 #include <cstddef>
 #include <functional>
 #include <random>
+#include <thread>
 #include <type_traits>
+#include <vector>
 
 #include "DataStructures/ApplyMatrices.hpp"
 #include "DataStructures/ComplexDataVector.hpp"
@@ -27,6 +29,7 @@
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/MakeArray.hpp"
+#include "Utilities/System/ThreadPool.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TypeTraits/GetFundamentalType.hpp"
 
@@ -198,6 +201,50 @@ void test_interpolation() {
     }
   }
 }
+template <typename VectorType>
+void test_split_among_threads() {
+  MAKE_GENERATOR(gen);
+  UniformCustomDistribution<double> dist{-1.0, 1.0};
+  // Three components on this grid are enough for the transformation to be
+  // split among the threads of the pool.
+  const Index<3> extents{24, 24, 24};
+  const auto data = make_with_random_values<VectorType>(
+      make_not_null(&gen), make_not_null(&dist),
+      VectorType(3 * extents.product()));
+  std::array<Matrix, 3> matrices{Matrix(20, 24), Matrix{}, Matrix(17, 24)};
+  for (auto& matrix : matrices) {
+    for (size_t i = 0; i < matrix.rows(); ++i) {
+      for (size_t j = 0; j < matrix.columns(); ++j) {
+        matrix(i, j) = dist(gen);
+      }
+    }
+  }
+
+  const auto serial_result = apply_matrices(matrices, data, extents);
+  sys::node_thread_pool().resize(3);
+  const auto threaded_result = apply_matrices(matrices, data, extents);
+  CHECK(threaded_result.size() == 3 * 20 * 24 * 17);
+  CHECK_ITERABLE_APPROX(threaded_result, serial_result);
+
+  // Several elements on the same node may transform their data at the same
+  // time. Only one of them gets the workers of the pool and the others
+  // transform their data serially, but all of them get the correct result.
+  std::vector<VectorType> concurrent_results(4);
+  std::vector<std::thread> callers{};
+  for (size_t i = 0; i < concurrent_results.size(); ++i) {
+    callers.emplace_back([&concurrent_results, &matrices, &data, &extents,
+                          i]() {
+      concurrent_results[i] = apply_matrices(matrices, data, extents);
+    });
+  }
+  for (auto& caller : callers) {
+    caller.join();
+  }
+  sys::node_thread_pool().resize(1);
+  for (const auto& concurrent_result : concurrent_results) {
+    CHECK_ITERABLE_APPROX(concurrent_result, serial_result);
+  }
+}
 }  // namespace
 
 // [[TimeOut, 8]]
@@ -215,6 +262,11 @@ SPECTRE_TEST_CASE("Unit.DataStructures.ApplyMatrices",
     test_interpolation<ComplexScalarTag, ComplexTensorTag, 2>();
     test_interpolation<ComplexScalarTag, ComplexTensorTag, 3>();
   }
+  {
+    INFO("Components split among threads");
+    test_split_among_threads<DataVector>();
+    test_split_among_threads<ComplexDataVector>();
+  }
   // Can't use test_interpolation for 0 because Tensor errors on
   // Dim=0.
   const Index<0> extents{};
@@ -42,6 +42,7 @@
 #include "Evolution/DgSubcell/Tags/Jacobians.hpp"
 #include "Evolution/DgSubcell/Tags/Mesh.hpp"
 #include "Evolution/DgSubcell/Tags/ReconstructionOrder.hpp"
+#include "Evolution/DgSubcell/Tags/StepsOnDg.hpp"
 #include "Evolution/DgSubcell/Tags/StepsSinceTciCall.hpp"
 #include "Evolution/DgSubcell/Tags/SubcellOptions.hpp"
 #include "Evolution/DgSubcell/Tags/TciCallsSinceRollback.hpp"
@@ -494,6 +495,8 @@ void test(const bool always_use_subcell, const bool interior_element,
   CHECK(ActionTesting::tag_is_retrievable<
         comp, evolution::dg::subcell::Tags::StepsSinceTciCall>(runner,
                                                                self_id));
+  CHECK(ActionTesting::tag_is_retrievable<
+        comp, evolution::dg::subcell::Tags::StepsOnDg>(runner, self_id));
   CHECK(ActionTesting::tag_is_retrievable<
         comp, evolution::dg::subcell::Tags::TciGridHistory>(runner, self_id));
   CHECK(ActionTesting::tag_is_retrievable<
@@ -554,6 +557,9 @@ void test(const bool always_use_subcell, const bool interior_element,
   CHECK(ActionTesting::get_databox_tag<
             comp, evolution::dg::subcell::Tags::StepsSinceTciCall>(
             runner, self_id) == 0);
+  CHECK(ActionTesting::get_databox_tag<
+            comp, evolution::dg::subcell::Tags::StepsOnDg>(runner, self_id) ==
+        0);
   CHECK(ActionTesting::get_databox_tag<
             comp, evolution::dg::subcell::Tags::NeighborTciDecisions<Dim>>(
             runner, self_id)
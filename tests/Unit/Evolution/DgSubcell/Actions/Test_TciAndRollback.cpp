@@ -34,9 +34,12 @@
 #include "Evolution/DgSubcell/ReconstructionMethod.hpp"
 #include "Evolution/DgSubcell/SubcellOptions.hpp"
 #include "Evolution/DgSubcell/Tags/ActiveGrid.hpp"
+#include "Evolution/DgSubcell/Tags/Coordinates.hpp"
 #include "Evolution/DgSubcell/Tags/DataForRdmpTci.hpp"
 #include "Evolution/DgSubcell/Tags/GhostDataForReconstruction.hpp"
+#include "Evolution/DgSubcell/Tags/Jacobians.hpp"
 #include "Evolution/DgSubcell/Tags/Mesh.hpp"
+#include "Evolution/DgSubcell/Tags/StepsOnDg.hpp"
 #include "Evolution/DgSubcell/Tags/SubcellOptions.hpp"
 #include "Evolution/DgSubcell/Tags/TciGridHistory.hpp"
 #include "Evolution/DgSubcell/Tags/TciStatus.hpp"
@@ -52,8 +55,12 @@
 #include "Time/Time.hpp"
 #include "Time/TimeStepId.hpp"
 #include "Utilities/CartesianProduct.hpp"
+#include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/MakeWithValue.hpp"
+#include "Utilities/PrettyType.hpp"
+#include "Utilities/Serialization/Serialize.hpp"
 #include "Utilities/Serialization/RegisterDerivedClassesWithCharm.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
@@ -91,6 +98,35 @@ struct System {
 template <size_t>
 struct DummyLabel;
 
+// Stands in for `fd::Tags::InverseJacobianLogicalToGridCompute`, which needs
+// the element map.
+template <size_t Dim>
+struct InverseJacobianLogicalToGridCompute
+    : evolution::dg::subcell::fd::Tags::InverseJacobianLogicalToGrid<Dim>,
+      db::ComputeTag {
+  using base =
+      evolution::dg::subcell::fd::Tags::InverseJacobianLogicalToGrid<Dim>;
+  using return_type = typename base::type;
+  using argument_tags = tmpl::list<
+      evolution::dg::subcell::Tags::Coordinates<Dim, Frame::ElementLogical>>;
+  static void function(
+      const gsl::not_null<return_type*> inverse_jacobian,
+      const tnsr::I<DataVector, Dim, Frame::ElementLogical>& logical_coords) {
+    *inverse_jacobian =
+        make_with_value<return_type>(get<0>(logical_coords), 0.0);
+    for (size_t i = 0; i < Dim; ++i) {
+      inverse_jacobian->get(i, i) = 2.0;
+    }
+  }
+};
+
+template <size_t Dim>
+using subcell_compute_tags = tmpl::list<
+    evolution::dg::subcell::Tags::LogicalCoordinatesCompute<Dim>,
+    InverseJacobianLogicalToGridCompute<Dim>,
+    evolution::dg::subcell::fd::Tags::DetInverseJacobianLogicalToGridCompute<
+        Dim>>;
+
 template <size_t Dim, typename Metavariables>
 struct component {
   using metavariables = Metavariables;
@@ -110,7 +146,8 @@ struct component {
           ::Tags::HistoryEvolvedVariables<::Tags::Variables<tmpl::list<Var1>>>,
           SelfStart::Tags::InitialValue<::Tags::Variables<tmpl::list<Var1>>>,
           evolution::dg::subcell::Tags::NeighborTciDecisions<Dim>,
-          evolution::dg::subcell::Tags::InterpolatorsFromNeighborDgToFd<Dim>>,
+          evolution::dg::subcell::Tags::InterpolatorsFromNeighborDgToFd<Dim>,
+          evolution::dg::subcell::Tags::StepsOnDg>,
       tmpl::conditional_t<
           Metavariables::has_prims,
           tmpl::list<::Tags::Variables<tmpl::list<PrimVar1>>,
@@ -120,7 +157,8 @@ struct component {
 
   using phase_dependent_action_list = tmpl::list<Parallel::PhaseActions<
       Parallel::Phase::Initialization,
-      tmpl::list<ActionTesting::InitializeDataBox<initial_tags>,
+      tmpl::list<ActionTesting::InitializeDataBox<initial_tags,
+                                                  subcell_compute_tags<Dim>>,
                  evolution::dg::subcell::Actions::TciAndRollback<
                      typename Metavariables::TciOnDgGrid>,
                  Actions::Label<DummyLabel<0>>,
@@ -251,6 +289,24 @@ class TestCreator : public DomainCreator<Dim> {
   }
 };
 
+// The number of subcell compute items that hold an evaluated value. The sizes
+// are used so that checking does not evaluate the items.
+template <size_t Dim, typename Component, typename Metavariables>
+size_t number_of_allocated_subcell_items(
+    const ActionTesting::MockRuntimeSystem<Metavariables>& runner) {
+  const auto item_sizes =
+      ActionTesting::get_databox<Component>(runner, 0).size_of_items();
+  size_t result = 0;
+  tmpl::for_each<subcell_compute_tags<Dim>>([&item_sizes, &result](auto tag_v) {
+    using tag = tmpl::type_from<decltype(tag_v)>;
+    if (item_sizes.at(pretty_type::get_name<tag>()) !=
+        size_of_object_in_bytes(typename tag::type{})) {
+      ++result;
+    }
+  });
+  return result;
+}
+
 template <size_t Dim, bool HasPrims>
 void test_impl(const bool rdmp_fails, const bool tci_fails,
                const bool always_use_subcell, const bool self_starting,
@@ -285,7 +341,7 @@ void test_impl(const bool rdmp_fails, const bool tci_fails,
               disable_subcell_in_block
                   ? std::optional{std::vector<std::string>{"Block1"}}
                   : std::optional<std::vector<std::string>>{},
-              ::fd::DerivativeOrder::Two, 1, 1, 1},
+              ::fd::DerivativeOrder::Two, 1, 1, 1, 3},
           TestCreator<Dim>{}};
 
   using MockRuntimeSystem = ActionTesting::MockRuntimeSystem<metavars>;
@@ -408,6 +464,8 @@ void test_impl(const bool rdmp_fails, const bool tci_fails,
       DirectionalId<Dim>{Direction<Dim>::lower_xi(), ElementId<Dim>{10}},
       neighbor_is_troubled ? 10 : 0});
 
+  const size_t steps_on_dg = 2;
+
   if constexpr (HasPrims) {
     ActionTesting::emplace_array_component_and_initialize<comp>(
         &runner, ActionTesting::NodeId{0}, ActionTesting::LocalCoreId{0}, 0,
@@ -415,7 +473,7 @@ void test_impl(const bool rdmp_fails, const bool tci_fails,
          subcell_mesh, element, active_grid, did_rollback, ghost_data,
          tci_decision, rdmp_tci_data, neighbor_meshes, evolved_vars,
          time_stepper_history, initial_value_evolved_vars, neighbor_decisions,
-         Interps{}, prim_vars, initial_value_prim_vars});
+         Interps{}, steps_on_dg, prim_vars, initial_value_prim_vars});
   } else {
     (void)prim_vars;
     (void)initial_value_prim_vars;
@@ -425,9 +483,16 @@ void test_impl(const bool rdmp_fails, const bool tci_fails,
          subcell_mesh, element, active_grid, did_rollback, ghost_data,
          tci_decision, rdmp_tci_data, neighbor_meshes, evolved_vars,
          time_stepper_history, initial_value_evolved_vars, neighbor_decisions,
-         Interps{}});
+         Interps{}, steps_on_dg});
   }
 
+  // Evaluate the subcell coordinates and Jacobians so we can check whether the
+  // action frees them.
+  const auto det_inverse_jacobian = ActionTesting::get_databox_tag<
+      comp, evolution::dg::subcell::fd::Tags::DetInverseJacobianLogicalToGrid>(
+      runner, 0);
+  CHECK(number_of_allocated_subcell_items<Dim, comp>(runner) == 3);
+
   // Invoke the TciAndRollback action on the runner
   ActionTesting::next_action<comp>(make_not_null(&runner), 0);
 
@@ -465,6 +530,7 @@ void test_impl(const bool rdmp_fails, const bool tci_fails,
     CHECK(ActionTesting::get_databox_tag<
               comp, evolution::dg::subcell::Tags::DataForRdmpTci>(runner, 0) ==
           initial_rdmp_tci_data);
+    CHECK(number_of_allocated_subcell_items<Dim, comp>(runner) == 3);
 
     CHECK(time_stepper_history_from_box.size() == history_size);
     CHECK(time_stepper_history_from_box.substeps().size() ==
@@ -537,6 +603,19 @@ void test_impl(const bool rdmp_fails, const bool tci_fails,
     CHECK(ActionTesting::get_next_action_index<comp>(runner, 0) == 2);
     CHECK(active_grid_from_box == evolution::dg::subcell::ActiveGrid::Dg);
     CHECK_FALSE(did_rollback_from_box);
+    CHECK(ActionTesting::get_databox_tag<
+              comp, evolution::dg::subcell::Tags::StepsOnDg>(runner, 0) ==
+          steps_on_dg + 1);
+    // StepsOnDg reached StepsOnDgBeforeFreeingSubcellData (3), so the subcell
+    // data is freed and then recomputed when it is retrieved again.
+    CHECK(number_of_allocated_subcell_items<Dim, comp>(runner) == 0);
+    using det_inverse_jacobian_tag =
+        evolution::dg::subcell::fd::Tags::DetInverseJacobianLogicalToGrid;
+    CHECK(ActionTesting::get_databox_tag<comp, det_inverse_jacobian_tag>(
+              runner, 0) == det_inverse_jacobian);
+    CHECK(get(det_inverse_jacobian) ==
+          DataVector{subcell_mesh.number_of_grid_points(), pow<Dim>(2.0)});
+    CHECK(number_of_allocated_subcell_items<Dim, comp>(runner) == 3);
 
     const auto subcell_vars = evolution::dg::subcell::fd::project(
         evolved_vars, dg_mesh,
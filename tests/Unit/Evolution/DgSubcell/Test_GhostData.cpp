@@ -6,6 +6,7 @@
 #include <cstddef>
 #include <random>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "DataStructures/DataVector.hpp"
@@ -95,6 +96,54 @@ void test(const size_t number_of_buffers) {
   test_serialization(ghost_data);
 }
 
+void test_received_buffer() {
+  // The received buffer holds the ghost data followed by other data, e.g. the
+  // RDMP TCI data
+  const DataVector received{1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+  const DataVector expected_ghost_data{1.0, 2.0, 3.0, 4.0};
+  GhostData ghost_data{2};
+  ghost_data.next_buffer();
+  DataVector received_copy = received;
+  const double* const received_ptr = received_copy.data();
+  ghost_data.set_neighbor_ghost_data_for_reconstruction(
+      std::move(received_copy), expected_ghost_data.size());
+  CHECK(ghost_data.neighbor_ghost_data_for_reconstruction() ==
+        expected_ghost_data);
+  // The data was not copied
+  CHECK(ghost_data.neighbor_ghost_data_for_reconstruction().data() ==
+        received_ptr);
+
+  // Moving keeps the view, copying owns the data
+  GhostData moved_ghost_data = std::move(ghost_data);
+  CHECK(moved_ghost_data.neighbor_ghost_data_for_reconstruction().data() ==
+        received_ptr);
+  const GhostData copied_ghost_data = moved_ghost_data;
+  CHECK(copied_ghost_data == moved_ghost_data);
+  CHECK(copied_ghost_data.neighbor_ghost_data_for_reconstruction().data() !=
+        received_ptr);
+  CHECK(copied_ghost_data.neighbor_ghost_data_for_reconstruction().is_owning());
+  GhostData copy_assigned_ghost_data{2};
+  copy_assigned_ghost_data = moved_ghost_data;
+  CHECK(copy_assigned_ghost_data == moved_ghost_data);
+  test_serialization(moved_ghost_data);
+
+  // Replacing the data releases the previous buffer
+  moved_ghost_data.set_neighbor_ghost_data_for_reconstruction(
+      DataVector{7.0, 8.0}, 2);
+  CHECK(moved_ghost_data.neighbor_ghost_data_for_reconstruction() ==
+        DataVector{7.0, 8.0});
+  CHECK(moved_ghost_data.neighbor_ghost_data_for_reconstruction().is_owning());
+
+  // Non-owning data is copied
+  DataVector non_owning{const_cast<double*>(received.data()),  // NOLINT
+                        received.size()};
+  moved_ghost_data.set_neighbor_ghost_data_for_reconstruction(
+      std::move(non_owning), 4);
+  CHECK(moved_ghost_data.neighbor_ghost_data_for_reconstruction() ==
+        expected_ghost_data);
+  CHECK(moved_ghost_data.neighbor_ghost_data_for_reconstruction().is_owning());
+}
+
 void test_errors() {
   CHECK_THROWS_WITH(
       GhostData{0},
@@ -107,6 +156,7 @@ SPECTRE_TEST_CASE("Unit.Evolution.Subcell.GhostData", "[Unit][Evolution]") {
   for (size_t i = 1; i < 5; i++) {
     test(i);
   }
+  test_received_buffer();
   test_errors();
 }
 }  // namespace evolution::dg::subcell
@@ -4,6 +4,7 @@
 #include "Framework/TestingFramework.hpp"
 
 #include <cstddef>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -115,6 +116,15 @@ void test_impl(const std::vector<double>& expected_values,
                   expected_values[0], static_cast<size_t>(expected_values[1]),
                   expected_values[2], expected_values[3], false, recons_method,
                   false, std::nullopt, ::fd::DerivativeOrder::Two, 1, 1, 1));
+  CHECK_FALSE(SubcellOptions(
+                  expected_values[0], static_cast<size_t>(expected_values[1]),
+                  expected_values[2], expected_values[3], false, recons_method,
+                  false, std::nullopt, ::fd::DerivativeOrder::Two, 1, 1, 1,
+                  3) ==
+              SubcellOptions(
+                  expected_values[0], static_cast<size_t>(expected_values[1]),
+                  expected_values[2], expected_values[3], false, recons_method,
+                  false, std::nullopt, ::fd::DerivativeOrder::Two, 1, 1, 1));
 }
 
 SPECTRE_TEST_CASE("Unit.Evolution.Subcell.SubcellOptions",
@@ -129,10 +139,12 @@ SPECTRE_TEST_CASE("Unit.Evolution.Subcell.SubcellOptions",
       expected_values[0], static_cast<size_t>(expected_values[1]),
       expected_values[2], expected_values[3], true,
       fd::ReconstructionMethod::DimByDim, true, std::nullopt,
-      ::fd::DerivativeOrder::Four, 1, 1, 1);
+      ::fd::DerivativeOrder::Four, 1, 1, 1, 3);
   const SubcellOptions deserialized_options =
       serialize_and_deserialize(options);
   CHECK(options == deserialized_options);
+  CHECK(options.steps_on_dg_before_freeing_subcell_data() ==
+        std::optional{3_st});
 
   CHECK(options == TestHelpers::test_option_tag<OptionTags::SubcellOptions>(
                        "TroubledCellIndicator:\n"
@@ -150,7 +162,8 @@ SPECTRE_TEST_CASE("Unit.Evolution.Subcell.SubcellOptions",
                        "  UseHalo: true\n"
                        "  OnlyDgBlocksAndGroups: None\n"
                        "SubcellToDgReconstructionMethod: DimByDim\n"
-                       "FiniteDifferenceDerivativeOrder: 4\n"));
+                       "FiniteDifferenceDerivativeOrder: 4\n"
+                       "StepsOnDgBeforeFreeingSubcellData: 3\n"));
 
   INFO("Test with block names and groups");
   const domain::creators::Cylinder cylinder{2.0,   10.0, 1.0,  8.0,
@@ -171,7 +184,8 @@ SPECTRE_TEST_CASE("Unit.Evolution.Subcell.SubcellOptions",
       "  UseHalo: true\n";
   const std::string opts_end =
       "SubcellToDgReconstructionMethod: DimByDim\n"
-      "FiniteDifferenceDerivativeOrder: 4\n";
+      "FiniteDifferenceDerivativeOrder: 4\n"
+      "StepsOnDgBeforeFreeingSubcellData: None\n";
   CHECK_THROWS_WITH(
       SubcellOptions(
           TestHelpers::test_option_tag<OptionTags::SubcellOptions>(
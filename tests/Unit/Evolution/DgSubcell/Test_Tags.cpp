@@ -39,6 +39,7 @@
 #include "Evolution/DgSubcell/Tags/OnSubcells.hpp"
 #include "Evolution/DgSubcell/Tags/ReconstructionOrder.hpp"
 #include "Evolution/DgSubcell/Tags/Reconstructor.hpp"
+#include "Evolution/DgSubcell/Tags/StepsOnDg.hpp"
 #include "Evolution/DgSubcell/Tags/StepsSinceTciCall.hpp"
 #include "Evolution/DgSubcell/Tags/SubcellOptions.hpp"
 #include "Evolution/DgSubcell/Tags/TciCallsSinceRollback.hpp"
@@ -120,6 +121,7 @@ void test(const bool moving_mesh) {
       "InterpolatorsFromNeighborDgToFd");
   TestHelpers::db::test_simple_tag<subcell::Tags::TciCallsSinceRollback>(
       "TciCallsSinceRollback");
+  TestHelpers::db::test_simple_tag<subcell::Tags::StepsOnDg>("StepsOnDg");
   TestHelpers::db::test_simple_tag<subcell::Tags::StepsSinceTciCall>(
       "StepsSinceTciCall");
 
@@ -5,12 +5,17 @@
 
 #include <atomic>
 #include <cstddef>
+#include <cstdint>
+#include <tuple>
 
 #include "Domain/Structure/Direction.hpp"
 #include "Domain/Structure/DirectionalId.hpp"
 #include "Domain/Structure/ElementId.hpp"
 #include "Evolution/DiscontinuousGalerkin/AtomicInboxBoundaryData.hpp"
 #include "Framework/TestHelpers.hpp"
+#include "Time/Slab.hpp"
+#include "Time/Time.hpp"
+#include "Time/TimeStepId.hpp"
 
 namespace evolution::dg {
 namespace {
@@ -158,8 +163,9 @@ void test_serialization() {
     gsl::at(data_has_queue.boundary_data_in_directions, i).push({});
     CHECK_THROWS_WITH(
         serialize_and_deserialize(data_has_queue),
-        Catch::Matchers::ContainsSubstring(
-            "We can only serialize empty StaticSpscQueues but the queue in "));
+        Catch::Matchers::ContainsSubstring("We can only serialize empty "
+                                           "GrowableSpscQueues but the queue "
+                                           "in "));
   }
 
   std::unordered_map<int, AtomicInboxBoundaryData<Dim>> data_map{};
@@ -173,6 +179,34 @@ void test_serialization() {
   check_all_empty(data_map_out.at(0));
 }
 
+template <size_t Dim>
+void test_overflow() {
+  // A neighbor can send more messages than fit in one block of the queue
+  AtomicInboxBoundaryData<Dim> data{};
+  CHECK(data.number_of_overflows() == 0);
+  const size_t number_of_messages =
+      3 * AtomicInboxBoundaryData<Dim>::queue_block_capacity;
+  const Slab slab{0.0, 1.0};
+  auto& queue = data.boundary_data_in_directions[1];
+  for (size_t i = 0; i < number_of_messages; ++i) {
+    queue.emplace(TimeStepId{true, static_cast<int64_t>(i), slab.start()},
+                  typename AtomicInboxBoundaryData<Dim>::stored_type{},
+                  DirectionalId<Dim>{});
+  }
+  CHECK(data.number_of_overflows() == 2);
+  CHECK(queue.size() == number_of_messages);
+  for (size_t i = 0; i < number_of_messages; ++i) {
+    const auto* message = queue.front();
+    REQUIRE(message != nullptr);
+    CHECK(std::get<0>(*message).slab_number() == static_cast<int64_t>(i));
+    queue.pop();
+  }
+  CHECK(queue.front() == nullptr);
+  for (size_t i = 0; i < data.boundary_data_in_directions.size(); ++i) {
+    CHECK(gsl::at(data.boundary_data_in_directions, i).empty());
+  }
+}
+
 template <size_t Dim>
 void test() {
   static_assert(Dim < 4);
@@ -281,5 +315,8 @@ SPECTRE_TEST_CASE("Unit.Evolution.DG.AtomicInboxBoundaryData",
   test<1>();
   test<2>();
   test<3>();
+  test_overflow<1>();
+  test_overflow<2>();
+  test_overflow<3>();
 }
 }  // namespace evolution::dg
@@ -8,12 +8,15 @@
 
 #include "DataStructures/DataVector.hpp"
 #include "Evolution/DiscontinuousGalerkin/BoundaryData.hpp"
+#include "Evolution/DiscontinuousGalerkin/BoundaryDataEncoding.hpp"
+#include "Framework/TestHelpers.hpp"
 #include "NumericalAlgorithms/Spectral/Basis.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "NumericalAlgorithms/Spectral/Quadrature.hpp"
 #include "Time/Time.hpp"
 #include "Time/TimeStepId.hpp"
 #include "Utilities/GetOutput.hpp"
+#include "Utilities/Gsl.hpp"
 
 namespace evolution::dg {
 namespace {
@@ -57,13 +60,49 @@ void test() {
   CHECK(data0 != BoundaryData<Dim>{volume_mesh, interface_mesh,
                                    DataVector{2, 2.3}, DataVector{1, 4.4},
                                    TimeStepId{true, 1, time}, 9});
+  CHECK(data0 != BoundaryData<Dim>{volume_mesh, interface_mesh,
+                                   DataVector{2, 2.3}, DataVector{1, 4.4},
+                                   TimeStepId{true, 1, time}, 7,
+                                   BoundaryDataEncoding::Float});
+  CHECK(data0 != BoundaryData<Dim>{volume_mesh,
+                                   interface_mesh,
+                                   DataVector{2, 2.3},
+                                   DataVector{1, 4.4},
+                                   TimeStepId{true, 1, time},
+                                   7,
+                                   BoundaryDataEncoding::Double,
+                                   BoundaryDataEncoding::Lossless});
   CHECK(get_output(data0) ==
         std::string("Ghost mesh: " + get_output(volume_mesh) +
                     "\nInterface mesh: " + get_output(interface_mesh) +
                     "\nGhost cell data: " + get_output(DataVector{2, 2.3}) +
                     "\nBoundary correction: " + get_output(DataVector{1, 4.4}) +
                     "\nValidy range: " + get_output(TimeStepId{true, 1, time}) +
-                    "\nTCI status: 7"));
+                    "\nTCI status: 7"
+                    "\nGhost cell data encoding: Double"
+                    "\nBoundary correction encoding: Double"));
+  CHECK(serialize_and_deserialize(data0) == data0);
+
+  BoundaryData<Dim> encoded_data = data0;
+  encoded_data.ghost_cell_data = DataVector{0.1, -2.5e10, 3.0};
+  encoded_data.boundary_correction_data = DataVector{1.0 / 3.0, 1.0, 7.25};
+  encoded_data.ghost_cell_data_encoding = BoundaryDataEncoding::Float;
+  encoded_data.boundary_correction_data_encoding =
+      BoundaryDataEncoding::Lossless;
+  CHECK(encoded_data != data0);
+  // Serialization is exact whether or not the sender rounded the data.
+  CHECK(serialize_and_deserialize(encoded_data) == encoded_data);
+  round_to_encoding_precision(make_not_null(&*encoded_data.ghost_cell_data),
+                              BoundaryDataEncoding::Float);
+  CHECK(serialize_and_deserialize(encoded_data) == encoded_data);
+
+  encoded_data.ghost_cell_data = std::nullopt;
+  encoded_data.boundary_correction_data_encoding = BoundaryDataEncoding::Float;
+  CHECK(serialize_and_deserialize(encoded_data) == encoded_data);
+
+  encoded_data.boundary_correction_data = std::nullopt;
+  encoded_data.ghost_cell_data_encoding = BoundaryDataEncoding::Lossless;
+  CHECK(serialize_and_deserialize(encoded_data) == encoded_data);
 }
 }  // namespace
 
@@ -0,0 +1,224 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <pup.h>
+#include <random>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "Evolution/DiscontinuousGalerkin/BoundaryDataEncoding.hpp"
+#include "Evolution/DiscontinuousGalerkin/BoundaryDataEncodingTags.hpp"
+#include "Framework/TestCreation.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Helpers/DataStructures/DataBox/TestHelpers.hpp"
+#include "Helpers/DataStructures/MakeWithRandomValues.hpp"
+#include "Utilities/GetOutput.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
+
+namespace evolution::dg {
+namespace {
+void check_bitwise_equal(const DataVector& a, const DataVector& b) {
+  REQUIRE(a.size() == b.size());
+  CHECK(std::memcmp(a.data(), b.data(), a.size() * sizeof(double)) == 0);
+}
+
+void test_lossless_compression() {
+  MAKE_GENERATOR(generator);
+  std::uniform_real_distribution<> distribution(-1.0, 1.0);
+
+  for (const size_t size : {0_st, 1_st, 2_st, 7_st, 64_st}) {
+    CAPTURE(size);
+    const auto data = make_with_random_values<DataVector>(
+        make_not_null(&generator), make_not_null(&distribution),
+        DataVector(size));
+    const std::vector<uint8_t> compressed = detail::lossless_compress(data);
+    DataVector decompressed(size);
+    detail::lossless_decompress(make_not_null(&decompressed), compressed);
+    check_bitwise_equal(decompressed, data);
+  }
+
+  const DataVector special_values{0.0,
+                                  -0.0,
+                                  1.0,
+                                  1.0,
+                                  std::numeric_limits<double>::max(),
+                                  std::numeric_limits<double>::denorm_min(),
+                                  std::numeric_limits<double>::infinity(),
+                                  -std::numeric_limits<double>::infinity()};
+  DataVector decompressed(special_values.size());
+  detail::lossless_decompress(make_not_null(&decompressed),
+                              detail::lossless_compress(special_values));
+  check_bitwise_equal(decompressed, special_values);
+
+  // Smooth data shares leading bytes between neighboring values, and
+  // repeated values are stored in half a byte.
+  DataVector smooth_data(1000);
+  for (size_t i = 0; i < smooth_data.size(); ++i) {
+    smooth_data[i] = 1.0 + 1.0e-3 * std::sin(0.01 * static_cast<double>(i));
+  }
+  CHECK(detail::lossless_compress(smooth_data).size() <
+        smooth_data.size() * sizeof(double));
+  CHECK(detail::lossless_compress(DataVector(1000, 2.5)).size() == 508);
+}
+
+void test_round_to_encoding_precision() {
+  const DataVector data{0.1, -3.0e-20, 1.0e30, 4.0};
+  for (const auto encoding :
+       {BoundaryDataEncoding::Double, BoundaryDataEncoding::Lossless}) {
+    DataVector rounded = data;
+    round_to_encoding_precision(make_not_null(&rounded), encoding);
+    check_bitwise_equal(rounded, data);
+  }
+  DataVector rounded = data;
+  round_to_encoding_precision(make_not_null(&rounded),
+                              BoundaryDataEncoding::Float);
+  for (size_t i = 0; i < data.size(); ++i) {
+    CHECK(rounded[i] == static_cast<double>(static_cast<float>(data[i])));
+  }
+  CHECK(rounded[0] != data[0]);
+  CHECK(rounded[3] == data[3]);
+
+  // Values outside the range of a float leave the whole vector unchanged.
+  const DataVector out_of_range{0.1, 1.0e300,
+                                std::numeric_limits<double>::infinity()};
+  rounded = out_of_range;
+  round_to_encoding_precision(make_not_null(&rounded),
+                              BoundaryDataEncoding::Float);
+  check_bitwise_equal(rounded, out_of_range);
+}
+
+// Returns the size of the packed data
+size_t check_pup_encoded(const DataVector& data,
+                         const BoundaryDataEncoding encoding) {
+  CAPTURE(encoding);
+  std::optional<DataVector> to_send = data;
+  std::optional<DataVector> received{};
+  const auto pup_with_encoding = [&encoding](PUP::er& p,
+                                             std::optional<DataVector>& d) {
+    detail::pup_encoded(p, make_not_null(&d), encoding);
+  };
+
+  std::vector<char> buffer{};
+  {
+    PUP::sizer sizer{};
+    pup_with_encoding(sizer, to_send);
+    buffer.resize(sizer.size());
+    PUP::toMem packer{buffer.data()};
+    pup_with_encoding(packer, to_send);
+    CHECK(packer.size() == sizer.size());
+    PUP::fromMem unpacker{buffer.data()};
+    pup_with_encoding(unpacker, received);
+  }
+  REQUIRE(received.has_value());
+  CHECK(*to_send == data);
+  // Serialization never changes the data, so checkpoints and
+  // migration are exact.
+  check_bitwise_equal(*received, data);
+  const size_t packed_size = buffer.size();
+
+  to_send = std::nullopt;
+  {
+    PUP::sizer sizer{};
+    pup_with_encoding(sizer, to_send);
+    buffer.resize(sizer.size());
+    PUP::toMem packer{buffer.data()};
+    pup_with_encoding(packer, to_send);
+    PUP::fromMem unpacker{buffer.data()};
+    pup_with_encoding(unpacker, received);
+  }
+  CHECK_FALSE(received.has_value());
+  return packed_size;
+}
+
+void test_pup_encoded() {
+  const DataVector data{0.1, -3.0e-20, 1.0e30, 4.0};
+  DataVector rounded_data = data;
+  round_to_encoding_precision(make_not_null(&rounded_data),
+                              BoundaryDataEncoding::Float);
+  const size_t double_size =
+      check_pup_encoded(data, BoundaryDataEncoding::Double);
+  check_pup_encoded(data, BoundaryDataEncoding::Lossless);
+  // Data that is not representable in single precision is sent as
+  // doubles.
+  CHECK(check_pup_encoded(data, BoundaryDataEncoding::Float) > double_size);
+  CHECK(check_pup_encoded(rounded_data, BoundaryDataEncoding::Float) <
+        double_size);
+  const DataVector out_of_range{0.1, -1.0e300};
+  CHECK(check_pup_encoded(out_of_range, BoundaryDataEncoding::Float) >
+        check_pup_encoded(out_of_range, BoundaryDataEncoding::Double));
+
+  // The encoding computed when sizing is reused by the next packing pass, so
+  // packing without sizing and sizing again after changing the data must
+  // both encode the current data.
+  for (const auto encoding :
+       {BoundaryDataEncoding::Float, BoundaryDataEncoding::Lossless}) {
+    CAPTURE(encoding);
+    std::optional<DataVector> to_send = rounded_data;
+    std::optional<DataVector> received{};
+    std::vector<char> buffer(1000);
+    PUP::toMem packer{buffer.data()};
+    detail::pup_encoded(packer, make_not_null(&to_send), encoding);
+    PUP::fromMem unpacker{buffer.data()};
+    detail::pup_encoded(unpacker, make_not_null(&received), encoding);
+    REQUIRE(received.has_value());
+    check_bitwise_equal(*received, rounded_data);
+
+    PUP::sizer sizer{};
+    detail::pup_encoded(sizer, make_not_null(&to_send), encoding);
+    (*to_send)[1] = 0.5;
+    PUP::sizer resizer{};
+    detail::pup_encoded(resizer, make_not_null(&to_send), encoding);
+    PUP::toMem repacker{buffer.data()};
+    detail::pup_encoded(repacker, make_not_null(&to_send), encoding);
+    CHECK(repacker.size() == resizer.size());
+    PUP::fromMem reunpacker{buffer.data()};
+    detail::pup_encoded(reunpacker, make_not_null(&received), encoding);
+    REQUIRE(received.has_value());
+    check_bitwise_equal(*received, *to_send);
+  }
+}
+
+void test_options_and_tags() {
+  CHECK(get_output(BoundaryDataEncoding::Double) == "Double");
+  CHECK(get_output(BoundaryDataEncoding::Float) == "Float");
+  CHECK(get_output(BoundaryDataEncoding::Lossless) == "Lossless");
+  CHECK(TestHelpers::test_creation<BoundaryDataEncoding>("Double") ==
+        BoundaryDataEncoding::Double);
+  CHECK(TestHelpers::test_creation<BoundaryDataEncoding>("Float") ==
+        BoundaryDataEncoding::Float);
+  CHECK(TestHelpers::test_creation<BoundaryDataEncoding>("Lossless") ==
+        BoundaryDataEncoding::Lossless);
+
+  TestHelpers::db::test_simple_tag<Tags::GhostCellDataEncoding>(
+      "GhostCellDataEncoding");
+  TestHelpers::db::test_simple_tag<Tags::BoundaryCorrectionDataEncoding>(
+      "BoundaryCorrectionDataEncoding");
+  CHECK(OptionTags::GhostCellDataEncoding::default_value() ==
+        BoundaryDataEncoding::Double);
+  CHECK(OptionTags::BoundaryCorrectionDataEncoding::default_value() ==
+        BoundaryDataEncoding::Double);
+  CHECK(TestHelpers::test_option_tag<OptionTags::GhostCellDataEncoding>(
+            "Float") == BoundaryDataEncoding::Float);
+  CHECK(TestHelpers::test_option_tag<
+            OptionTags::BoundaryCorrectionDataEncoding>("Lossless") ==
+        BoundaryDataEncoding::Lossless);
+}
+
+SPECTRE_TEST_CASE("Unit.Evolution.DG.BoundaryDataEncoding",
+                  "[Unit][Evolution]") {
+  test_lossless_compression();
+  test_round_to_encoding_precision();
+  test_pup_encoded();
+  test_options_and_tags();
+}
+}  // namespace
+}  // namespace evolution::dg
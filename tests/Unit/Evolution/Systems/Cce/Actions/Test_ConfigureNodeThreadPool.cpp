@@ -0,0 +1,115 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <vector>
+
+#include "Evolution/Systems/Cce/Actions/ConfigureNodeThreadPool.hpp"
+#include "Evolution/Systems/Cce/Components/CharacteristicEvolution.hpp"
+#include "Evolution/Systems/Cce/Components/NodeThreadPoolHelpers.hpp"
+#include "Evolution/Systems/Cce/OptionTags.hpp"
+#include "Framework/ActionTesting.hpp"
+#include "Parallel/Phase.hpp"
+#include "Utilities/Literals.hpp"
+#include "Utilities/System/ThreadPool.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace Cce {
+
+namespace {
+template <typename Metavariables>
+struct mock_characteristic_evolution {
+  using component_being_mocked = CharacteristicEvolution<Metavariables>;
+  using replace_these_simple_actions = tmpl::list<>;
+  using with_these_simple_actions = tmpl::list<>;
+
+  using initialize_action_list =
+      tmpl::list<ActionTesting::InitializeDataBox<tmpl::list<>>>;
+  using simple_tags_from_options =
+      Parallel::get_simple_tags_from_options<initialize_action_list>;
+
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockArrayChare;
+  using array_index = size_t;
+  using phase_dependent_action_list = tmpl::list<
+      Parallel::PhaseActions<Parallel::Phase::Initialization,
+                             initialize_action_list>,
+      Parallel::PhaseActions<Parallel::Phase::Evolve,
+                             tmpl::list<Actions::ConfigureNodeThreadPool>>>;
+  using const_global_cache_tags =
+      Parallel::get_const_global_cache_tags_from_actions<
+          phase_dependent_action_list>;
+};
+
+template <typename Metavariables>
+struct mock_node_thread_pool_helpers {
+  using component_being_mocked = NodeThreadPoolHelpers<Metavariables>;
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockNodeGroupChare;
+  using array_index = size_t;
+  using phase_dependent_action_list = tmpl::list<
+      Parallel::PhaseActions<Parallel::Phase::Initialization, tmpl::list<>>>;
+};
+
+struct metavariables {
+  using component_list =
+      tmpl::list<mock_characteristic_evolution<metavariables>>;
+};
+
+struct metavariables_with_helpers {
+  using component_list = tmpl::list<
+      mock_characteristic_evolution<metavariables_with_helpers>,
+      mock_node_thread_pool_helpers<metavariables_with_helpers>>;
+};
+
+void test_node_thread_pool_helpers() {
+  using component = mock_characteristic_evolution<metavariables_with_helpers>;
+  using helpers = mock_node_thread_pool_helpers<metavariables_with_helpers>;
+  // more threads are requested than there are PEs on the node
+  ActionTesting::MockRuntimeSystem<metavariables_with_helpers> runner{
+      {4_st}, {}, {3_st}};
+  ActionTesting::emplace_component_and_initialize<component>(&runner, 0, {});
+  ActionTesting::emplace_nodegroup_component<helpers>(&runner);
+  ActionTesting::set_phase(make_not_null(&runner), Parallel::Phase::Evolve);
+
+  ActionTesting::next_action<component>(make_not_null(&runner), 0);
+  CHECK(sys::node_thread_pool().number_of_threads() == 3);
+
+  // The mock runtime is serial, so the calling thread processes the whole
+  // loop and the requested helpers return immediately when they run.
+  std::vector<size_t> visits(6, 0);
+  sys::node_thread_pool().parallel_for(
+      6, [&visits](const size_t begin, const size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+          ++visits[i];
+        }
+      });
+  CHECK(visits == std::vector<size_t>(6, 1));
+  CHECK(ActionTesting::number_of_queued_threaded_actions<helpers>(runner, 0) ==
+        2);
+  ActionTesting::invoke_queued_threaded_action<helpers>(make_not_null(&runner),
+                                                        0);
+  ActionTesting::invoke_queued_threaded_action<helpers>(make_not_null(&runner),
+                                                        0);
+  sys::node_thread_pool().resize(1);
+  CHECK(sys::node_thread_pool().number_of_threads() == 1);
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Evolution.Systems.Cce.Actions.ConfigureNodeThreadPool",
+                  "[Unit][Cce]") {
+  using component = mock_characteristic_evolution<metavariables>;
+  ActionTesting::MockRuntimeSystem<metavariables> runner{{3_st}};
+  ActionTesting::emplace_component_and_initialize<component>(&runner, 0, {});
+  ActionTesting::set_phase(make_not_null(&runner), Parallel::Phase::Evolve);
+
+  CHECK(sys::node_thread_pool().number_of_threads() == 1);
+  ActionTesting::next_action<component>(make_not_null(&runner), 0);
+  CHECK(sys::node_thread_pool().number_of_threads() == 3);
+  sys::node_thread_pool().resize(1);
+
+  test_node_thread_pool_helpers();
+}
+}  // namespace Cce
@@ -252,7 +252,7 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.Cce.Actions.H5BoundaryCommunication",
   ActionTesting::emplace_component<worldtube_component>(
       &runner, 0,
       Tags::H5WorldtubeBoundaryDataManager::create_from_options(
-          l_max, filename, buffer_size,
+          l_max, filename, buffer_size, false,
           std::make_unique<intrp::BarycentricRationalSpanInterpolator>(3u, 4u),
           false, false, std::optional<double>{}));
 
@@ -227,11 +227,11 @@ void test_klein_gordon_h5_boundary_communication(
   ActionTesting::emplace_component<worldtube_component>(
       &runner, 0,
       Tags::H5WorldtubeBoundaryDataManager::create_from_options(
-          l_max, filename, buffer_size,
+          l_max, filename, buffer_size, false,
           std::make_unique<intrp::BarycentricRationalSpanInterpolator>(3u, 4u),
           false, false, std::optional<double>{}),
       Tags::KleinGordonH5WorldtubeBoundaryDataManager::create_from_options(
-          l_max, filename, buffer_size,
+          l_max, filename, buffer_size, false,
           std::make_unique<intrp::BarycentricRationalSpanInterpolator>(3u, 4u),
           std::optional<double>{}));
 
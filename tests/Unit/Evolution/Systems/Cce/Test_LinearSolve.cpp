@@ -15,6 +15,7 @@
 #include "Helpers/DataStructures/MakeWithRandomValues.hpp"
 #include "Helpers/Evolution/Systems/Cce/CceComputationTestHelpers.hpp"
 #include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/SwshCollocation.hpp"
+#include "Utilities/System/ThreadPool.hpp"
 #include "Utilities/VectorAlgebra.hpp"
 
 namespace Cce {
@@ -482,6 +483,12 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.Cce.LinearSolve", "[Unit][Cce]") {
                                       number_of_radial_grid_points, l_max);
   test_pole_integration_with_linear_operator<Tags::BondiH>(
       make_not_null(&gen), number_of_radial_grid_points, l_max);
+
+  // the angular points of the BondiH solve are split across threads
+  sys::node_thread_pool().resize(3);
+  test_pole_integration_with_linear_operator<Tags::BondiH>(
+      make_not_null(&gen), number_of_radial_grid_points, l_max);
+  sys::node_thread_pool().resize(1);
 }
 }  // namespace
 }  // namespace Cce
@@ -10,6 +10,7 @@
 #include "NumericalAlgorithms/Interpolation/CubicSpanInterpolator.hpp"
 #include "NumericalAlgorithms/Interpolation/LinearSpanInterpolator.hpp"
 #include "NumericalAlgorithms/Interpolation/SpanInterpolator.hpp"
+#include "Utilities/System/ThreadPool.hpp"
 #include "Utilities/VectorAlgebra.hpp"
 
 namespace Cce {
@@ -219,6 +220,12 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.Cce.ScriPlusInterpolationManager",
   test_interpolate_quadratic<ComplexDataVector, false>();
   test_interpolate_quadratic<DataVector, true>();
   test_interpolate_quadratic<ComplexDataVector, true>();
+
+  // the angular points are split across threads
+  sys::node_thread_pool().resize(3);
+  test_interpolate_quadratic<DataVector, false>();
+  test_interpolate_quadratic<ComplexDataVector, false>();
+  sys::node_thread_pool().resize(1);
 }
 }  // namespace
 }  // namespace Cce
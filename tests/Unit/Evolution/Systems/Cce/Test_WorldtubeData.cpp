@@ -14,6 +14,7 @@
 #include "DataStructures/Tensor/TypeAliases.hpp"
 #include "Evolution/Systems/Cce/BoundaryData.hpp"
 #include "Evolution/Systems/Cce/ReducedWorldtubeModeRecorder.hpp"
+#include "Evolution/Systems/Cce/WorldtubeBufferPrefetcher.hpp"
 #include "Evolution/Systems/Cce/WorldtubeBufferUpdater.hpp"
 #include "Evolution/Systems/Cce/WorldtubeDataManager.hpp"
 #include "Framework/CheckWithRandomValues.hpp"
@@ -776,6 +777,94 @@ void test_reduced_spec_worldtube_buffer_updater(
       });
   CHECK(buffer_updater.get_extraction_radius() == 100.0);
 }
+
+template <typename Generator>
+void test_data_manager_with_prefetched_buffer(
+    const gsl::not_null<Generator*> gen) {
+  UniformCustomDistribution<double> value_dist{0.1, 0.5};
+  const double mass = value_dist(*gen);
+  const std::array<double, 3> spin{
+      {value_dist(*gen), value_dist(*gen), value_dist(*gen)}};
+  const std::array<double, 3> center{
+      {value_dist(*gen), value_dist(*gen), value_dist(*gen)}};
+  gr::Solutions::KerrSchild solution{mass, spin, center};
+
+  const double extraction_radius = 100.0;
+  const double frequency = 0.1 * value_dist(*gen);
+  const double amplitude = 0.1 * value_dist(*gen);
+  const double target_time = 50.0 * value_dist(*gen);
+
+  const size_t buffer_size = 4;
+  const size_t l_max = 8;
+
+  const std::string filename = "BoundaryDataH5PrefetchTest_CceR0100.h5";
+  if (file_system::check_if_file_exists(filename)) {
+    file_system::rm(filename, true);
+  }
+  TestHelpers::write_test_file(solution, filename, target_time,
+                               extraction_radius, frequency, amplitude, l_max);
+
+  // the lock must outlive the managers, which may have a read in flight
+  Parallel::NodeLock hdf5_lock{};
+  MetricWorldtubeDataManager synchronous_data_manager{
+      std::make_unique<MetricWorldtubeH5BufferUpdater>(filename), l_max,
+      buffer_size,
+      std::make_unique<intrp::BarycentricRationalSpanInterpolator>(3u, 4u),
+      false, false};
+  MetricWorldtubeDataManager prefetching_data_manager{
+      std::make_unique<MetricWorldtubeH5BufferUpdater>(filename), l_max,
+      buffer_size,
+      std::make_unique<intrp::BarycentricRationalSpanInterpolator>(3u, 4u),
+      false, true};
+
+  const size_t number_of_angular_points =
+      Spectral::Swsh::number_of_swsh_collocation_points(l_max);
+  Variables<Tags::characteristic_worldtube_boundary_tags<Tags::BoundaryValue>>
+      synchronous_boundary_variables{number_of_angular_points};
+  Variables<Tags::characteristic_worldtube_boundary_tags<Tags::BoundaryValue>>
+      prefetched_boundary_variables{number_of_angular_points};
+
+  // step through most of the file with a step that doesn't align with the
+  // file's time steps, so that the buffer is refilled several times.
+  for (double time = target_time - 1.25; time < target_time + 1.2;
+       time += 0.0371) {
+    CHECK(synchronous_data_manager.populate_hypersurface_boundary_data(
+        make_not_null(&synchronous_boundary_variables), time,
+        make_not_null(&hdf5_lock)));
+    CHECK(prefetching_data_manager.populate_hypersurface_boundary_data(
+        make_not_null(&prefetched_boundary_variables), time,
+        make_not_null(&hdf5_lock)));
+    CHECK(synchronous_data_manager.get_time_span() ==
+          prefetching_data_manager.get_time_span());
+    CHECK(synchronous_boundary_variables == prefetched_boundary_variables);
+  }
+
+  const auto& synchronous_statistics =
+      synchronous_data_manager.get_buffer_statistics();
+  const auto& prefetch_statistics =
+      prefetching_data_manager.get_buffer_statistics();
+  CHECK(synchronous_statistics.number_of_refills > 1);
+  CHECK(synchronous_statistics.number_of_prefetch_hits == 0);
+  CHECK(prefetch_statistics.number_of_refills ==
+        synchronous_statistics.number_of_refills);
+  CHECK(prefetch_statistics.number_of_prefetch_hits > 0);
+  CHECK(prefetch_statistics.number_of_prefetch_hits <
+        prefetch_statistics.number_of_refills);
+  CHECK(synchronous_statistics.stall_time > 0.0);
+  CHECK(prefetch_statistics.stall_time >= 0.0);
+
+  const auto serialized_and_deserialized_manager =
+      serialize_and_deserialize(prefetching_data_manager);
+  CHECK(serialized_and_deserialized_manager.get_buffer_statistics()
+            .number_of_refills == prefetch_statistics.number_of_refills);
+  CHECK(serialized_and_deserialized_manager.get_buffer_statistics()
+            .number_of_prefetch_hits ==
+        prefetch_statistics.number_of_prefetch_hits);
+
+  if (file_system::check_if_file_exists(filename)) {
+    file_system::rm(filename, true);
+  }
+}
 }  // namespace
 
 // An increased timeout because this test seems to have high variance in
@@ -823,5 +912,9 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.Cce.ReadBoundaryDataH5",
                                                 ReducedDummyBufferUpdater>(
         make_not_null(&gen));
   }
+  {
+    INFO("Testing data manager with prefetched buffers");
+    test_data_manager_with_prefetched_buffer(make_not_null(&gen));
+  }
 }
 }  // namespace Cce
@@ -3,18 +3,22 @@
 
 #include "Framework/TestingFramework.hpp"
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <optional>
 #include <random>
 
+#include "DataStructures/DataBox/Prefixes.hpp"
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tags/TempTensor.hpp"
 #include "DataStructures/Tensor/EagerMath/DeterminantAndInverse.hpp"
 #include "DataStructures/Tensor/EagerMath/RaiseOrLowerIndex.hpp"
 #include "DataStructures/Tensor/EagerMath/Trace.hpp"
 #include "DataStructures/Tensor/Identity.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Variables.hpp"
+#include "Domain/Tags.hpp"
 #include "Domain/TagsTimeDependent.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/ConstraintDamping/Tags.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/Constraints.hpp"
@@ -41,6 +45,7 @@
 #include "PointwiseFunctions/GeneralRelativity/SpacetimeNormalVector.hpp"
 #include "PointwiseFunctions/GeneralRelativity/SpatialMetric.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
 #include "Utilities/MakeWithValue.hpp"
 
 // IWYU pragma: no_forward_declare Tensor
@@ -466,7 +471,8 @@ void test_reference_impl_against_spec() {
 }
 
 template <size_t Dim, typename Generator>
-void test_compute_dudt(const gsl::not_null<Generator*> generator) {
+void test_compute_dudt(const gsl::not_null<Generator*> generator,
+                       const size_t num_grid_points_1d) {
   std::uniform_real_distribution<> distribution(0.1, 1.0);
   using gh_tags_list =
       tmpl::list<gr::Tags::SpacetimeMetric<DataVector, Dim>,
@@ -475,7 +481,6 @@ void test_compute_dudt(const gsl::not_null<Generator*> generator) {
   const double time = 1.3;
   const gh::gauges::DampedHarmonic gauge_condition{
       100., std::array{1.2, 1.5, 1.7}, std::array{2, 4, 6}};
-  const size_t num_grid_points_1d = 3;
   const Mesh<Dim> mesh(num_grid_points_1d, Spectral::Basis::Legendre,
                        Spectral::Quadrature::GaussLobatto);
   const DataVector used_for_size(mesh.number_of_grid_points());
@@ -699,6 +704,39 @@ void test_compute_dudt(const gsl::not_null<Generator*> generator) {
   CHECK_ITERABLE_CUSTOM_APPROX(expected_dt_pi, dt_pi, custom_approx);
   CHECK_ITERABLE_CUSTOM_APPROX(expected_dt_phi, dt_phi, custom_approx);
 
+  // Most temporaries are computed in blocks of grid points together with the
+  // time derivatives, so check that they are set on every grid point.
+  CHECK_ITERABLE_CUSTOM_APPROX(
+      (get<gr::Tags::SpacetimeChristoffelFirstKind<DataVector, Dim>>(buffer)),
+      christoffel_first_kind, custom_approx);
+  CHECK_ITERABLE_CUSTOM_APPROX(
+      (get<gr::Tags::SpacetimeChristoffelSecondKind<DataVector, Dim>>(buffer)),
+      christoffel_second_kind, custom_approx);
+  CHECK_ITERABLE_APPROX(
+      (get<gh::Tags::ThreeIndexConstraint<DataVector, Dim>>(buffer)),
+      ::gh::three_index_constraint(d_spacetime_metric, phi));
+  tnsr::Iaa<DataVector, Dim> expected_phi_1_up{mesh.number_of_grid_points(),
+                                                0.0};
+  for (size_t i = 0; i < Dim; ++i) {
+    for (size_t a = 0; a < Dim + 1; ++a) {
+      for (size_t b = a; b < Dim + 1; ++b) {
+        for (size_t j = 0; j < Dim; ++j) {
+          expected_phi_1_up.get(i, a, b) +=
+              inverse_spatial_metric.get(i, j) * phi.get(j, a, b);
+        }
+      }
+    }
+  }
+  CHECK_ITERABLE_CUSTOM_APPROX((get<gh::Tags::PhiFirstIndexUp<Dim>>(buffer)),
+                               expected_phi_1_up, custom_approx);
+  auto expected_gauge_constraint = trace_christoffel_first_kind;
+  for (size_t a = 0; a < Dim + 1; ++a) {
+    expected_gauge_constraint.get(a) += gauge_h.get(a);
+  }
+  CHECK_ITERABLE_CUSTOM_APPROX(
+      (get<gh::Tags::GaugeConstraint<DataVector, Dim>>(buffer)),
+      expected_gauge_constraint, custom_approx);
+
   // Test the moving mesh damping terms:
   // 1. Compute 3-index constraint from existing d_spacetime_metric, phi
   // 2. Generate random mesh velocity
@@ -863,6 +901,192 @@ void test_compute_dudt(const gsl::not_null<Generator*> generator) {
                                mesh_velocity_dot_three_index_constraint,
                                custom_approx_mesh_constraint);
 }
+
+template <size_t Dim>
+using dudt_input_tags = tmpl::list<
+    gr::Tags::SpacetimeMetric<DataVector, Dim>, gh::Tags::Pi<DataVector, Dim>,
+    gh::Tags::Phi<DataVector, Dim>,
+    Tags::deriv<gr::Tags::SpacetimeMetric<DataVector, Dim>, tmpl::size_t<Dim>,
+                Frame::Inertial>,
+    Tags::deriv<gh::Tags::Pi<DataVector, Dim>, tmpl::size_t<Dim>,
+                Frame::Inertial>,
+    Tags::deriv<gh::Tags::Phi<DataVector, Dim>, tmpl::size_t<Dim>,
+                Frame::Inertial>,
+    gh::ConstraintDamping::Tags::ConstraintGamma0,
+    gh::ConstraintDamping::Tags::ConstraintGamma1,
+    gh::ConstraintDamping::Tags::ConstraintGamma2,
+    domain::Tags::Coordinates<Dim, Frame::Inertial>,
+    domain::Tags::InverseJacobian<Dim, Frame::ElementLogical, Frame::Inertial>,
+    ::Tags::TempI<0, Dim, Frame::Inertial>>;
+
+template <size_t Dim>
+using dudt_output_tags = tmpl::list<
+    Tags::dt<gr::Tags::SpacetimeMetric<DataVector, Dim>>,
+    Tags::dt<gh::Tags::Pi<DataVector, Dim>>,
+    Tags::dt<gh::Tags::Phi<DataVector, Dim>>,
+    gh::ConstraintDamping::Tags::ConstraintGamma1,
+    gh::ConstraintDamping::Tags::ConstraintGamma2,
+    gh::Tags::GaugeH<DataVector, Dim>,
+    gh::Tags::SpacetimeDerivGaugeH<DataVector, Dim>, gh::Tags::Gamma1Gamma2,
+    gh::Tags::HalfPiTwoNormals, gh::Tags::NormalDotOneIndexConstraint,
+    gh::Tags::Gamma1Plus1, gh::Tags::PiOneNormal<Dim>,
+    gh::Tags::GaugeConstraint<DataVector, Dim>,
+    gh::Tags::HalfPhiTwoNormals<Dim>,
+    gh::Tags::ShiftDotThreeIndexConstraint<Dim>,
+    gh::Tags::MeshVelocityDotThreeIndexConstraint<Dim>,
+    gh::Tags::PhiOneNormal<Dim>, gh::Tags::PiSecondIndexUp<Dim>,
+    gh::Tags::ThreeIndexConstraint<DataVector, Dim>,
+    gh::Tags::PhiFirstIndexUp<Dim>, gh::Tags::PhiThirdIndexUp<Dim>,
+    gh::Tags::SpacetimeChristoffelFirstKindThirdIndexUp<Dim>,
+    gr::Tags::Lapse<DataVector>, gr::Tags::Shift<DataVector, Dim>,
+    gr::Tags::InverseSpatialMetric<DataVector, Dim>,
+    gr::Tags::DetSpatialMetric<DataVector>,
+    gr::Tags::SqrtDetSpatialMetric<DataVector>,
+    gr::Tags::InverseSpacetimeMetric<DataVector, Dim>,
+    gr::Tags::SpacetimeChristoffelFirstKind<DataVector, Dim>,
+    gr::Tags::SpacetimeChristoffelSecondKind<DataVector, Dim>,
+    gr::Tags::TraceSpacetimeChristoffelFirstKind<DataVector, Dim>,
+    gr::Tags::SpacetimeNormalVector<DataVector, Dim>>;
+
+// Calls `gh::TimeDerivative` on the grid points of `inputs`, using the
+// `TempI` as the mesh velocity. The damped harmonic gauge does not use the
+// mesh, so it is only passed through.
+template <size_t Dim>
+Variables<dudt_output_tags<Dim>> compute_dudt(
+    const Variables<dudt_input_tags<Dim>>& inputs,
+    const gh::gauges::GaugeCondition& gauge_condition, const Mesh<Dim>& mesh,
+    const double time) {
+  // Start from zero so that outputs that are not set compare equal
+  Variables<dudt_output_tags<Dim>> outputs(inputs.number_of_grid_points(),
+                                           0.0);
+  gh::TimeDerivative<Dim>::apply(
+      make_not_null(
+          &get<Tags::dt<gr::Tags::SpacetimeMetric<DataVector, Dim>>>(outputs)),
+      make_not_null(&get<Tags::dt<gh::Tags::Pi<DataVector, Dim>>>(outputs)),
+      make_not_null(&get<Tags::dt<gh::Tags::Phi<DataVector, Dim>>>(outputs)),
+      make_not_null(
+          &get<gh::ConstraintDamping::Tags::ConstraintGamma1>(outputs)),
+      make_not_null(
+          &get<gh::ConstraintDamping::Tags::ConstraintGamma2>(outputs)),
+      make_not_null(&get<gh::Tags::GaugeH<DataVector, Dim>>(outputs)),
+      make_not_null(
+          &get<gh::Tags::SpacetimeDerivGaugeH<DataVector, Dim>>(outputs)),
+      make_not_null(&get<gh::Tags::Gamma1Gamma2>(outputs)),
+      make_not_null(&get<gh::Tags::HalfPiTwoNormals>(outputs)),
+      make_not_null(&get<gh::Tags::NormalDotOneIndexConstraint>(outputs)),
+      make_not_null(&get<gh::Tags::Gamma1Plus1>(outputs)),
+      make_not_null(&get<gh::Tags::PiOneNormal<Dim>>(outputs)),
+      make_not_null(&get<gh::Tags::GaugeConstraint<DataVector, Dim>>(outputs)),
+      make_not_null(&get<gh::Tags::HalfPhiTwoNormals<Dim>>(outputs)),
+      make_not_null(&get<gh::Tags::ShiftDotThreeIndexConstraint<Dim>>(outputs)),
+      make_not_null(
+          &get<gh::Tags::MeshVelocityDotThreeIndexConstraint<Dim>>(outputs)),
+      make_not_null(&get<gh::Tags::PhiOneNormal<Dim>>(outputs)),
+      make_not_null(&get<gh::Tags::PiSecondIndexUp<Dim>>(outputs)),
+      make_not_null(
+          &get<gh::Tags::ThreeIndexConstraint<DataVector, Dim>>(outputs)),
+      make_not_null(&get<gh::Tags::PhiFirstIndexUp<Dim>>(outputs)),
+      make_not_null(&get<gh::Tags::PhiThirdIndexUp<Dim>>(outputs)),
+      make_not_null(
+          &get<gh::Tags::SpacetimeChristoffelFirstKindThirdIndexUp<Dim>>(
+              outputs)),
+      make_not_null(&get<gr::Tags::Lapse<DataVector>>(outputs)),
+      make_not_null(&get<gr::Tags::Shift<DataVector, Dim>>(outputs)),
+      make_not_null(
+          &get<gr::Tags::InverseSpatialMetric<DataVector, Dim>>(outputs)),
+      make_not_null(&get<gr::Tags::DetSpatialMetric<DataVector>>(outputs)),
+      make_not_null(&get<gr::Tags::SqrtDetSpatialMetric<DataVector>>(outputs)),
+      make_not_null(
+          &get<gr::Tags::InverseSpacetimeMetric<DataVector, Dim>>(outputs)),
+      make_not_null(
+          &get<gr::Tags::SpacetimeChristoffelFirstKind<DataVector, Dim>>(
+              outputs)),
+      make_not_null(
+          &get<gr::Tags::SpacetimeChristoffelSecondKind<DataVector, Dim>>(
+              outputs)),
+      make_not_null(
+          &get<gr::Tags::TraceSpacetimeChristoffelFirstKind<DataVector, Dim>>(
+              outputs)),
+      make_not_null(
+          &get<gr::Tags::SpacetimeNormalVector<DataVector, Dim>>(outputs)),
+      get<Tags::deriv<gr::Tags::SpacetimeMetric<DataVector, Dim>,
+                      tmpl::size_t<Dim>, Frame::Inertial>>(inputs),
+      get<Tags::deriv<gh::Tags::Pi<DataVector, Dim>, tmpl::size_t<Dim>,
+                      Frame::Inertial>>(inputs),
+      get<Tags::deriv<gh::Tags::Phi<DataVector, Dim>, tmpl::size_t<Dim>,
+                      Frame::Inertial>>(inputs),
+      get<gr::Tags::SpacetimeMetric<DataVector, Dim>>(inputs),
+      get<gh::Tags::Pi<DataVector, Dim>>(inputs),
+      get<gh::Tags::Phi<DataVector, Dim>>(inputs),
+      get<gh::ConstraintDamping::Tags::ConstraintGamma0>(inputs),
+      get<gh::ConstraintDamping::Tags::ConstraintGamma1>(inputs),
+      get<gh::ConstraintDamping::Tags::ConstraintGamma2>(inputs),
+      gauge_condition, mesh, time,
+      get<domain::Tags::Coordinates<Dim, Frame::Inertial>>(inputs),
+      get<domain::Tags::InverseJacobian<Dim, Frame::ElementLogical,
+                                        Frame::Inertial>>(inputs),
+      std::optional{get<::Tags::TempI<0, Dim, Frame::Inertial>>(inputs)});
+  return outputs;
+}
+
+// Copies the grid points `[offset, offset + size)` of `vars`
+template <typename TagsList>
+Variables<TagsList> copy_points(const Variables<TagsList>& vars,
+                                const size_t offset, const size_t size) {
+  Variables<TagsList> result(size);
+  for (size_t component = 0;
+       component < Variables<TagsList>::number_of_independent_components;
+       ++component) {
+    for (size_t i = 0; i < size; ++i) {
+      result.data()[component * size + i] =
+          vars.data()[component * vars.number_of_grid_points() + offset + i];
+    }
+  }
+  return result;
+}
+
+// The time derivative is evaluated in blocks of grid points. Here we check
+// that the blocks give the same result as evaluating all grid points at once,
+// which the time derivative does for elements with fewer points than a block.
+// Each slice of the element is evaluated in one pass and straddles the block
+// boundaries of the full evaluation. The operations done at each grid point
+// are the same either way, so the results agree to roundoff: only the
+// compiler's choice of vectorized or remainder loop, and therefore of fused
+// multiply-adds, can differ.
+template <size_t Dim, typename Generator>
+void test_blocked_against_unblocked(const gsl::not_null<Generator*> generator) {
+  std::uniform_real_distribution<> distribution(0.1, 1.0);
+  const double time = 1.3;
+  const gh::gauges::DampedHarmonic gauge_condition{
+      100., std::array{1.2, 1.5, 1.7}, std::array{2, 4, 6}};
+  const Mesh<Dim> mesh(7, Spectral::Basis::Legendre,
+                       Spectral::Quadrature::GaussLobatto);
+  const size_t number_of_points = mesh.number_of_grid_points();
+  const DataVector used_for_size(number_of_points);
+
+  auto inputs = make_with_random_values<Variables<dudt_input_tags<Dim>>>(
+      generator, make_not_null(&distribution), used_for_size);
+  gr::spacetime_metric(
+      make_not_null(&get<gr::Tags::SpacetimeMetric<DataVector, Dim>>(inputs)),
+      TestHelpers::gr::random_lapse(generator, used_for_size),
+      TestHelpers::gr::random_shift<Dim>(generator, used_for_size),
+      TestHelpers::gr::random_spatial_metric<Dim>(generator, used_for_size));
+
+  const auto blocked_outputs =
+      compute_dudt(inputs, gauge_condition, mesh, time);
+
+  Approx roundoff_approx = Approx::custom().epsilon(1.e-13).scale(1.0);
+  const size_t points_per_slice = 20;
+  for (size_t offset = 0; offset < number_of_points;
+       offset += points_per_slice) {
+    CAPTURE(offset);
+    const size_t size = std::min(points_per_slice, number_of_points - offset);
+    const auto unblocked_outputs = compute_dudt(
+        copy_points(inputs, offset, size), gauge_condition, mesh, time);
+    CHECK_VARIABLES_CUSTOM_APPROX(copy_points(blocked_outputs, offset, size),
+                                  unblocked_outputs, roundoff_approx);
+  }
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Evolution.Systems.GeneralizedHarmonic.DuDt",
@@ -870,7 +1094,14 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.GeneralizedHarmonic.DuDt",
   test_reference_impl_against_spec();
 
   MAKE_GENERATOR(generator);
-  test_compute_dudt<1>(make_not_null(&generator));
-  test_compute_dudt<2>(make_not_null(&generator));
-  test_compute_dudt<3>(make_not_null(&generator));
+  // The larger meshes span several blocks of grid points in the time
+  // derivative, with a partially filled last block
+  for (const size_t num_grid_points_1d : {3_st, 7_st}) {
+    test_compute_dudt<1>(make_not_null(&generator), num_grid_points_1d);
+    test_compute_dudt<2>(make_not_null(&generator), num_grid_points_1d);
+    test_compute_dudt<3>(make_not_null(&generator), num_grid_points_1d);
+  }
+  test_blocked_against_unblocked<1>(make_not_null(&generator));
+  test_blocked_against_unblocked<2>(make_not_null(&generator));
+  test_blocked_against_unblocked<3>(make_not_null(&generator));
 }
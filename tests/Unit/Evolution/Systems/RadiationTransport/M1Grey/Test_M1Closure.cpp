@@ -11,6 +11,7 @@
 #include "DataStructures/Tensor/EagerMath/DeterminantAndInverse.hpp"
 #include "DataStructures/Tensor/EagerMath/DotProduct.hpp"
 #include "DataStructures/Tensor/EagerMath/Magnitude.hpp"
+#include "DataStructures/Tensor/EagerMath/RaiseOrLowerIndex.hpp"
 #include "DataStructures/Tensor/IndexType.hpp"  // IWYU pragma: keep
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Evolution/Systems/RadiationTransport/M1Grey/M1Closure.hpp"
@@ -58,6 +59,48 @@ SPECTRE_TEST_CASE("Evolution.Systems.RadiationTransport.M1Grey.M1Closure",
       1. / sqrt(1. - get(dot_product(fluid_velocity, fluid_velocity,
                                      spatial_metric)));
 
+  // The comoving moments returned by the closure must be the projections
+  // onto the fluid frame of the stress-energy tensor built from the
+  // inertial moments and the returned pressure tensor:
+  //   J = W^2 (E - 2 v^i F_i + P_{ij} v^i v^j),
+  //   H_i = W (F_i - P_{ij} v^j) - W v_i J,
+  //   H^a t_a = W (J - E + v^i F_i).
+  static Approx projection_approx = Approx::custom().epsilon(1.e-10).scale(1.0);
+  const auto fluid_velocity_lower =
+      raise_or_lower_index(fluid_velocity, spatial_metric);
+  const auto check_comoving_moments = [&]() {
+    for (size_t s = 0; s < used_for_size.size(); ++s) {
+      const double w = get(fluid_lorentz_factor)[s];
+      const double e = get(energy_density)[s];
+      double v_dot_f = 0.;
+      double p_v_v = 0.;
+      std::array<double, 3> p_v{};
+      for (size_t i = 0; i < 3; ++i) {
+        v_dot_f += fluid_velocity.get(i)[s] * momentum_density.get(i)[s];
+        for (size_t k = 0; k < 3; ++k) {
+          p_v_v += pressure_tensor.get(i, k)[s] *
+                   fluid_velocity_lower.get(i)[s] *
+                   fluid_velocity_lower.get(k)[s];
+          for (size_t l = 0; l < 3; ++l) {
+            gsl::at(p_v, i) += spatial_metric.get(i, k)[s] *
+                               pressure_tensor.get(k, l)[s] *
+                               fluid_velocity_lower.get(l)[s];
+          }
+        }
+      }
+      const double j = square(w) * (e - 2. * v_dot_f + p_v_v);
+      CHECK(get(comoving_energy_density)[s] == projection_approx(j));
+      CHECK(get(comoving_momentum_density_normal)[s] ==
+            projection_approx(w * (j - e + v_dot_f)));
+      for (size_t i = 0; i < 3; ++i) {
+        CHECK(comoving_momentum_density_spatial.get(i)[s] ==
+              projection_approx(w * (momentum_density.get(i)[s] -
+                                     gsl::at(p_v, i)) -
+                                w * fluid_velocity_lower.get(i)[s] * j));
+      }
+    }
+  };
+
   // Initialize closure factor (as the input value is used as initial
   // guess for the root finding algorithm).
   get(closure_factor) = -1.;
@@ -82,6 +125,20 @@ SPECTRE_TEST_CASE("Evolution.Systems.RadiationTransport.M1Grey.M1Closure",
   const DataVector expected_xi0{0.0, 0.0, 0.0, 0.0, 0.0};
   CHECK_ITERABLE_CUSTOM_APPROX(get(closure_factor), expected_xi0,
                                custom_approx);
+  // This is isotropic radiation with J = 1 in the fluid frame, boosted to
+  // the inertial frame, so the closure must recover J = 1 and H^a = 0.
+  CHECK_ITERABLE_CUSTOM_APPROX(get(comoving_energy_density),
+                               DataVector(used_for_size.size(), 1.),
+                               projection_approx);
+  CHECK_ITERABLE_CUSTOM_APPROX(get(comoving_momentum_density_normal),
+                               DataVector(used_for_size.size(), 0.),
+                               projection_approx);
+  for (size_t i = 0; i < 3; ++i) {
+    CHECK_ITERABLE_CUSTOM_APPROX(comoving_momentum_density_spatial.get(i),
+                                 DataVector(used_for_size.size(), 0.),
+                                 projection_approx);
+  }
+  check_comoving_moments();
 
   // (2) Optically thin limit
   momentum_density.get(0) = -1.;
@@ -97,4 +154,70 @@ SPECTRE_TEST_CASE("Evolution.Systems.RadiationTransport.M1Grey.M1Closure",
   const DataVector expected_xi1{1.0, 1.0, 1.0, 1.0, 1.0};
   CHECK_ITERABLE_CUSTOM_APPROX(get(closure_factor), expected_xi1,
                                custom_approx);
+  // With E = |F| this is a beam along the null vector k = n + F^i / E, so
+  // the fluid-frame energy density is J = E (u_a k^a)^2 = W^2 (E - v^i F_i)^2
+  // / E and the fluid-frame momentum density has magnitude J.
+  {
+    const DataVector v_dot_f =
+        get(dot_product(fluid_velocity, momentum_density));
+    const DataVector expected_j = square(get(fluid_lorentz_factor)) *
+                                  square(get(energy_density) - v_dot_f) /
+                                  get(energy_density);
+    CHECK_ITERABLE_CUSTOM_APPROX(get(comoving_energy_density), expected_j,
+                                 projection_approx);
+    const DataVector h_sqr =
+        get(dot_product(comoving_momentum_density_spatial,
+                        comoving_momentum_density_spatial,
+                        inv_spatial_metric)) -
+        square(get(comoving_momentum_density_normal));
+    CHECK_ITERABLE_CUSTOM_APPROX(h_sqr, square(expected_j), projection_approx);
+  }
+  check_comoving_moments();
+
+  // (3) Intermediate regime, which requires a root find
+  for (size_t s = 0; s < used_for_size.size(); ++s) {
+    get(energy_density)[s] = 1.0 + 0.25 * static_cast<double>(s);
+    const double scale = 1.0 + 0.5 * static_cast<double>(s);
+    momentum_density.get(0)[s] = 0.2 * scale;
+    momentum_density.get(1)[s] = -0.1 * scale;
+    momentum_density.get(2)[s] = 0.3 * scale;
+  }
+  const DataVector expected_xi2{0.3370433189587082, 0.3731215679612094,
+                                0.40311075849595096, 0.42707789308314803,
+                                0.4463230009333541};
+  const auto check_intermediate_closure = [&](const bool use_simd_root_find) {
+    RadiationTransport::M1Grey::detail::compute_closure_impl(
+        make_not_null(&closure_factor), make_not_null(&pressure_tensor),
+        make_not_null(&comoving_energy_density),
+        make_not_null(&comoving_momentum_density_normal),
+        make_not_null(&comoving_momentum_density_spatial), energy_density,
+        momentum_density, fluid_velocity, fluid_lorentz_factor, spatial_metric,
+        inv_spatial_metric, use_simd_root_find);
+    CHECK_ITERABLE_CUSTOM_APPROX(get(closure_factor), expected_xi2,
+                                 custom_approx);
+    // The closure factor solves zeta^2 J^2 = H^a H_a with the comoving
+    // moments that are returned.
+    const DataVector h_sqr =
+        get(dot_product(comoving_momentum_density_spatial,
+                        comoving_momentum_density_spatial,
+                        inv_spatial_metric)) -
+        square(get(comoving_momentum_density_normal));
+    const DataVector residual =
+        (square(get(closure_factor) * get(comoving_energy_density)) - h_sqr) /
+        square(get(energy_density));
+    CHECK_ITERABLE_CUSTOM_APPROX(residual, DataVector(used_for_size.size(), 0.),
+                                 custom_approx);
+    check_comoving_moments();
+  };
+  // Starting from outside the allowed domain for the closure factor
+  get(closure_factor) = -1.;
+  check_intermediate_closure(true);
+  get(closure_factor) = -1.;
+  check_intermediate_closure(false);
+  // Warm start from a nearby closure factor
+  get(closure_factor) = expected_xi2 + 0.01;
+  check_intermediate_closure(true);
+  // Warm start from a closure factor too far away to bracket the root
+  get(closure_factor) = 0.95;
+  check_intermediate_closure(true);
 }
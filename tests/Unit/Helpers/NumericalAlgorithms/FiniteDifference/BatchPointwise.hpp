@@ -0,0 +1,70 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include "Framework/TestingFramework.hpp"
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+#include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/Simd/Simd.hpp"
+
+namespace TestHelpers::fd::reconstruction {
+#ifdef SPECTRE_USE_XSIMD
+/*!
+ * \brief Check that `Reconstructor::batch_pointwise` agrees with
+ * `Reconstructor::pointwise` in every lane.
+ *
+ * The first cell of the batch is `q[Reconstructor::stencil_width() / 2]`, so
+ * `q` must hold at least `simd::size<simd::batch<double>>()` cells plus the
+ * stencil on either side.
+ *
+ * Returns `false` if `batch_pointwise` deferred to `pointwise` by returning
+ * `std::nullopt`. The comparison allows for roundoff because the compiler may
+ * contract the operations differently in the two functions.
+ */
+template <typename Reconstructor, typename... Args>
+bool check_batch_pointwise(const std::vector<double>& q,
+                           const Args&... args) {
+  using Batch = simd::batch<double>;
+  constexpr size_t batch_size = simd::size<Batch>();
+  constexpr size_t center_offset = Reconstructor::stencil_width() / 2;
+  REQUIRE(q.size() >= 2 * center_offset + batch_size);
+  const std::optional<std::array<Batch, 2>> batch_result =
+      Reconstructor::template batch_pointwise<Batch>(q.data() + center_offset,
+                                                     1, args...);
+  if (not batch_result.has_value()) {
+    return false;
+  }
+  std::array<std::array<double, batch_size>, 2> lanes{};
+  simd::store_unaligned(lanes[0].data(), (*batch_result)[0]);
+  simd::store_unaligned(lanes[1].data(), (*batch_result)[1]);
+  for (size_t i = 0; i < batch_size; ++i) {
+    CAPTURE(i);
+    const auto expected =
+        Reconstructor::pointwise(q.data() + center_offset + i, 1, args...);
+    CHECK(lanes[0][i] == approx(std::get<0>(expected)));
+    CHECK(lanes[1][i] == approx(std::get<1>(expected)));
+  }
+  return true;
+}
+
+/// Smooth, positive data for `check_batch_pointwise` covering a batch of
+/// cells and the stencils of `Reconstructor` around them.
+template <typename Reconstructor>
+std::vector<double> smooth_batch_data() {
+  std::vector<double> q(simd::size<simd::batch<double>>() +
+                        Reconstructor::stencil_width() - 1);
+  for (size_t i = 0; i < q.size(); ++i) {
+    q[i] = 1.0 + 0.1 * static_cast<double>(i) +
+           0.01 * square(static_cast<double>(i));
+  }
+  return q;
+}
+#endif  // SPECTRE_USE_XSIMD
+}  // namespace TestHelpers::fd::reconstruction
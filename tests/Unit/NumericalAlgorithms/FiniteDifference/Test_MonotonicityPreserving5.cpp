@@ -4,12 +4,14 @@
 #include "Framework/TestingFramework.hpp"
 
 #include <cstddef>
+#include <vector>
 
 #include "DataStructures/Index.hpp"
 #include "Domain/Structure/Direction.hpp"
 #include "Domain/Structure/DirectionMap.hpp"
 #include "Framework/Pypp.hpp"
 #include "Framework/SetupLocalPythonEnvironment.hpp"
+#include "Helpers/NumericalAlgorithms/FiniteDifference/BatchPointwise.hpp"
 #include "Helpers/NumericalAlgorithms/FiniteDifference/Exact.hpp"
 #include "Helpers/NumericalAlgorithms/FiniteDifference/Python.hpp"
 #include "NumericalAlgorithms/FiniteDifference/MonotonicityPreserving5.hpp"
@@ -60,6 +62,25 @@ void test() {
       Index<Dim>{5}, 5, "MonotonicityPreserving5", "test_mp5", recons,
       recons_neighbor_data);
 }
+
+#ifdef SPECTRE_USE_XSIMD
+// The batched reconstruction must agree with the pointwise reconstruction in
+// every lane, and must defer to the pointwise reconstruction when the limiter
+// is active in any lane.
+void test_batch_pointwise() {
+  using Reconstructor =
+      fd::reconstruction::detail::MonotonicityPreserving5Reconstructor;
+  std::vector<double> q =
+      TestHelpers::fd::reconstruction::smooth_batch_data<Reconstructor>();
+  CHECK(TestHelpers::fd::reconstruction::check_batch_pointwise<Reconstructor>(
+      q, alpha, epsilon));
+  // A jump in the last stencil activates the limiter in its lane
+  q.back() = -10.0;
+  CHECK_FALSE(
+      TestHelpers::fd::reconstruction::check_batch_pointwise<Reconstructor>(
+          q, alpha, epsilon));
+}
+#endif  // SPECTRE_USE_XSIMD
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.FiniteDifference.MonotonicityPreserving5",
@@ -69,4 +90,7 @@ SPECTRE_TEST_CASE("Unit.FiniteDifference.MonotonicityPreserving5",
   test<1>();
   test<2>();
   test<3>();
+#ifdef SPECTRE_USE_XSIMD
+  test_batch_pointwise();
+#endif  // SPECTRE_USE_XSIMD
 }
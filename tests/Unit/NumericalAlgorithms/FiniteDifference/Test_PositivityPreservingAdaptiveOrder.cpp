@@ -6,6 +6,7 @@
 #include <array>
 #include <cstddef>
 #include <limits>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Index.hpp"
@@ -13,6 +14,7 @@
 #include "Domain/Structure/DirectionMap.hpp"
 #include "Framework/Pypp.hpp"
 #include "Framework/SetupLocalPythonEnvironment.hpp"
+#include "Helpers/NumericalAlgorithms/FiniteDifference/BatchPointwise.hpp"
 #include "Helpers/NumericalAlgorithms/FiniteDifference/Exact.hpp"
 #include "Helpers/NumericalAlgorithms/FiniteDifference/Python.hpp"
 #include "NumericalAlgorithms/FiniteDifference/FallbackReconstructorType.hpp"
@@ -242,6 +244,42 @@ void test_impl(const FallbackReconstructorType fallback_recons) {
                          ReturnReconstructionOrder>(fallback_recons);
 }
 
+#ifdef SPECTRE_USE_XSIMD
+// The batched reconstruction only tries the highest order. It must agree with
+// the pointwise reconstruction in every lane when all lanes accept that order,
+// and defer to the pointwise reconstruction otherwise.
+template <class FallbackReconstructor, bool PositivityPreserving,
+          bool Use9thOrder, bool Use7thOrder>
+void test_batch_pointwise() {
+  CAPTURE(PositivityPreserving);
+  CAPTURE(Use9thOrder);
+  CAPTURE(Use7thOrder);
+  using Reconstructor = detail::PositivityPreservingAdaptiveOrderReconstructor<
+      FallbackReconstructor, PositivityPreserving, Use9thOrder, Use7thOrder>;
+  const double four_to_the_alpha_5 = pow(4.0, 4.0);
+  const double six_to_the_alpha_7 = pow(6.0, 4.3);
+  const double eight_to_the_alpha_9 = pow(8.0, 4.6);
+  const auto check = [&](const std::vector<double>& q) {
+    return TestHelpers::fd::reconstruction::check_batch_pointwise<
+        Reconstructor>(q, four_to_the_alpha_5, six_to_the_alpha_7,
+                       eight_to_the_alpha_9);
+  };
+
+  std::vector<double> q =
+      TestHelpers::fd::reconstruction::smooth_batch_data<Reconstructor>();
+  CHECK(check(q));
+  // Negative smooth data is only rejected when preserving positivity
+  for (double& value : q) {
+    value *= -1.0;
+  }
+  CHECK(check(q) == not PositivityPreserving);
+  // A jump in the last stencil is not smooth in its lane
+  q = TestHelpers::fd::reconstruction::smooth_batch_data<Reconstructor>();
+  q.back() = 100.0;
+  CHECK_FALSE(check(q));
+}
+#endif  // SPECTRE_USE_XSIMD
+
 template <class FallbackReconstructor, bool ReturnReconstructionOrder>
 void test(const FallbackReconstructorType fallback_recons) {
   const auto order_helper = [&fallback_recons](auto use_order_9,
@@ -271,6 +309,19 @@ void test(const FallbackReconstructorType fallback_recons) {
   order_helper(std::false_type{}, std::true_type{});
   order_helper(std::true_type{}, std::false_type{});
   order_helper(std::true_type{}, std::true_type{});
+
+#ifdef SPECTRE_USE_XSIMD
+  if constexpr (not ReturnReconstructionOrder) {
+    test_batch_pointwise<FallbackReconstructor, true, false, false>();
+    test_batch_pointwise<FallbackReconstructor, true, false, true>();
+    test_batch_pointwise<FallbackReconstructor, true, true, false>();
+    test_batch_pointwise<FallbackReconstructor, true, true, true>();
+    test_batch_pointwise<FallbackReconstructor, false, false, false>();
+    test_batch_pointwise<FallbackReconstructor, false, false, true>();
+    test_batch_pointwise<FallbackReconstructor, false, true, false>();
+    test_batch_pointwise<FallbackReconstructor, false, true, true>();
+  }
+#endif  // SPECTRE_USE_XSIMD
 }
 }  // namespace
 
@@ -11,6 +11,7 @@
 #include "Domain/Structure/Direction.hpp"
 #include "Domain/Structure/DirectionMap.hpp"
 #include "Domain/Structure/Side.hpp"
+#include "Helpers/NumericalAlgorithms/FiniteDifference/BatchPointwise.hpp"
 #include "Helpers/NumericalAlgorithms/FiniteDifference/Exact.hpp"
 #include "NumericalAlgorithms/FiniteDifference/Unlimited.hpp"
 #include "Utilities/Gsl.hpp"
@@ -61,11 +62,26 @@ void test_impl() {
   // shocks.
 }
 
+#ifdef SPECTRE_USE_XSIMD
+// The batched reconstruction has no limiter, so it must always succeed and
+// agree with the pointwise reconstruction in every lane.
+template <size_t Degree>
+void test_batch_pointwise() {
+  using Reconstructor =
+      fd::reconstruction::detail::UnlimitedReconstructor<Degree>;
+  CHECK(TestHelpers::fd::reconstruction::check_batch_pointwise<Reconstructor>(
+      TestHelpers::fd::reconstruction::smooth_batch_data<Reconstructor>()));
+}
+#endif  // SPECTRE_USE_XSIMD
+
 template <size_t Degree>
 void test() {
   test_impl<Degree, 1>();
   test_impl<Degree, 2>();
   test_impl<Degree, 3>();
+#ifdef SPECTRE_USE_XSIMD
+  test_batch_pointwise<Degree>();
+#endif  // SPECTRE_USE_XSIMD
 }
 }  // namespace
 
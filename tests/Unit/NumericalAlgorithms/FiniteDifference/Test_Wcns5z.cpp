@@ -5,6 +5,8 @@
 
 #include <array>
 #include <cstddef>
+#include <type_traits>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Index.hpp"
@@ -12,6 +14,7 @@
 #include "Domain/Structure/DirectionMap.hpp"
 #include "Framework/Pypp.hpp"
 #include "Framework/SetupLocalPythonEnvironment.hpp"
+#include "Helpers/NumericalAlgorithms/FiniteDifference/BatchPointwise.hpp"
 #include "Helpers/NumericalAlgorithms/FiniteDifference/Exact.hpp"
 #include "Helpers/NumericalAlgorithms/FiniteDifference/Python.hpp"
 #include "NumericalAlgorithms/FiniteDifference/FallbackReconstructorType.hpp"
@@ -161,6 +164,27 @@ void test(const FallbackReconstructorType fallback_recons) {
                     Catch::Matchers::ContainsSubstring(
                         "Nonlinear weight exponent should be 1 or 2"));
 }
+
+#ifdef SPECTRE_USE_XSIMD
+// The batched reconstruction must agree with the pointwise reconstruction in
+// every lane, and must defer to the pointwise reconstruction when any lane
+// switches to the fallback.
+template <class FallbackReconstructor>
+void test_batch_pointwise() {
+  using Reconstructor = detail::Wcns5zReconstructor<2, FallbackReconstructor>;
+  const double epsilon = 2.0e-16;
+  const size_t max_number_of_extrema = 0;
+  std::vector<double> q =
+      TestHelpers::fd::reconstruction::smooth_batch_data<Reconstructor>();
+  CHECK(TestHelpers::fd::reconstruction::check_batch_pointwise<Reconstructor>(
+      q, epsilon, max_number_of_extrema));
+  // An extremum in the last stencil requires the fallback in its lane
+  q.back() = 0.0;
+  CHECK(TestHelpers::fd::reconstruction::check_batch_pointwise<Reconstructor>(
+            q, epsilon, max_number_of_extrema) ==
+        std::is_same_v<FallbackReconstructor, void>);
+}
+#endif  // SPECTRE_USE_XSIMD
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.FiniteDifference.Wcns5z",
@@ -182,6 +206,12 @@ SPECTRE_TEST_CASE("Unit.FiniteDifference.Wcns5z",
   test<3, detail::MonotonisedCentralReconstructor>(
       FallbackReconstructorType::MonotonisedCentral);
   test<3, void>(FallbackReconstructorType::None);
+
+#ifdef SPECTRE_USE_XSIMD
+  test_batch_pointwise<detail::MinmodReconstructor>();
+  test_batch_pointwise<detail::MonotonisedCentralReconstructor>();
+  test_batch_pointwise<void>();
+#endif  // SPECTRE_USE_XSIMD
 }
 
 }  // namespace fd::reconstruction
@@ -38,6 +38,7 @@
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/MakeArray.hpp"
+#include "Utilities/System/ThreadPool.hpp"
 #include "Utilities/TMPL.hpp"
 
 // IWYU pragma: no_forward_declare Tags::deriv
@@ -490,6 +491,38 @@ void test_partial_derivatives_3d(const Mesh<3>& mesh) {
     }
   }
 }
+
+void test_partial_derivatives_split_among_threads() {
+  // The four components on this mesh are enough for the contraction with the
+  // inverse Jacobian to be split among the threads of the pool.
+  const Mesh<3> mesh{16, Spectral::Basis::Legendre,
+                     Spectral::Quadrature::GaussLobatto};
+  const size_t number_of_grid_points = mesh.number_of_grid_points();
+  const auto prod_map3d =
+      domain::make_coordinate_map<Frame::ElementLogical, Frame::Grid>(
+          Affine3D{Affine{-1.0, 1.0, -0.3, 0.7}, Affine{-1.0, 1.0, 0.3, 0.55},
+                   Affine{-1.0, 1.0, 2.3, 2.8}});
+  const auto x = prod_map3d(logical_coordinates(mesh));
+  InverseJacobian<DataVector, 3, Frame::ElementLogical, Frame::Grid>
+      inverse_jacobian(number_of_grid_points, 0.0);
+  inverse_jacobian.get(0, 0) = 2.0;
+  inverse_jacobian.get(1, 1) = 8.0;
+  inverse_jacobian.get(2, 2) = 4.0;
+
+  Variables<two_vars<3>> u(number_of_grid_points);
+  tmpl::for_each<two_vars<3>>([&x, &u](auto tag) {
+    using Tag = typename decltype(tag)::type;
+    get<Tag>(u) = Tag::f({{3, 2, 4}}, x);
+  });
+
+  const auto serial_du =
+      partial_derivatives<two_vars<3>>(u, mesh, inverse_jacobian);
+  sys::node_thread_pool().resize(3);
+  const auto threaded_du =
+      partial_derivatives<two_vars<3>>(u, mesh, inverse_jacobian);
+  sys::node_thread_pool().resize(1);
+  CHECK_VARIABLES_APPROX(threaded_du, serial_du);
+}
 }  // namespace
 
 // [[Timeout, 20]]
@@ -549,6 +582,7 @@ SPECTRE_TEST_CASE("Unit.Numerical.LinearOperators.PartialDerivs",
                         Spectral::Quadrature::GaussLobatto};
   test_partial_derivatives_3d<two_vars<3>>(mesh_3d);
   test_partial_derivatives_3d<two_vars<3>, one_var<3>>(mesh_3d);
+  test_partial_derivatives_split_among_threads();
 
   TestHelpers::db::test_prefix_tag<
       Tags::deriv<Var1<3>, tmpl::size_t<3>, Frame::Grid>>("deriv(Var1)");
@@ -6,6 +6,7 @@
 #include <array>
 #include <cstddef>
 #include <deque>
+#include <limits>
 #include <utility>
 
 #include "DataStructures/DataVector.hpp"
@@ -16,6 +17,7 @@
 #include "NumericalAlgorithms/SphericalHarmonics/SpherepackIterator.hpp"
 #include "NumericalAlgorithms/SphericalHarmonics/Strahlkorper.hpp"
 #include "NumericalAlgorithms/SphericalHarmonics/StrahlkorperFunctions.hpp"
+#include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/Gsl.hpp"
 
 namespace Frame {
@@ -511,6 +513,51 @@ void test_time_deriv_strahlkorper() {
     }
   }
 }
+
+void test_extrapolate_strahlkorper() {
+  const size_t l_max = 2;
+  const Strahlkorper<Frame::Inertial> strahlkorper{l_max, l_max, 1.0,
+                                                   std::array{0.0, 0.0, 0.0}};
+  SpherepackIterator iter{l_max, l_max};
+  const size_t index = iter.set(2, 1)();
+  // One coefficient is 1 + t / 2 + t^2 / 4
+  std::deque<std::pair<double, Strahlkorper<Frame::Inertial>>>
+      previous_strahlkorpers{};
+  for (const double time : {1.0, 2.0, 3.0}) {
+    previous_strahlkorpers.emplace_front(time, strahlkorper);
+    previous_strahlkorpers.front().second.coefficients()[index] =
+        1.0 + 0.5 * time + 0.25 * square(time);
+  }
+
+  // Quadratic extrapolation is exact, and differs from linear extrapolation
+  // through the two most recent Strahlkorpers by 0.5.
+  auto extrapolated = strahlkorper;
+  auto error = extrapolate_strahlkorper(make_not_null(&extrapolated),
+                                        previous_strahlkorpers, 4.0);
+  DataVector expected_coefs = strahlkorper.coefficients();
+  expected_coefs[index] = 7.0;
+  CHECK_ITERABLE_APPROX(extrapolated.coefficients(), expected_coefs);
+  REQUIRE(error.has_value());
+  CHECK(*error == approx(0.5));
+
+  // Strahlkorpers with a NaN time and older ones are ignored, so this is a
+  // linear extrapolation.
+  previous_strahlkorpers.back().first =
+      std::numeric_limits<double>::quiet_NaN();
+  error = extrapolate_strahlkorper(make_not_null(&extrapolated),
+                                   previous_strahlkorpers, 4.0);
+  expected_coefs[index] = 6.5;
+  CHECK_ITERABLE_APPROX(extrapolated.coefficients(), expected_coefs);
+  REQUIRE(error.has_value());
+  CHECK(*error == approx(1.75));
+
+  // No extrapolation from a single Strahlkorper.
+  previous_strahlkorpers[1].first = std::numeric_limits<double>::quiet_NaN();
+  error = extrapolate_strahlkorper(make_not_null(&extrapolated),
+                                   previous_strahlkorpers, 4.0);
+  CHECK_FALSE(error.has_value());
+  CHECK_ITERABLE_APPROX(extrapolated.coefficients(), expected_coefs);
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.ApparentHorizonFinder.StrahlkorperFunctions",
@@ -523,5 +570,6 @@ SPECTRE_TEST_CASE("Unit.ApparentHorizonFinder.StrahlkorperFunctions",
   test_fit_ylm_coeffs_same();
   test_fit_ylm_coeffs_diff();
   test_time_deriv_strahlkorper();
+  test_extrapolate_strahlkorper();
 }
 }  // namespace ylm
@@ -27,6 +27,7 @@
 #include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/SwshTags.hpp"
 #include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/SwshTransform.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/System/ThreadPool.hpp"
 #include "Utilities/TMPL.hpp"
 
 // IWYU pragma: no_forward_declare ComplexDataVector
@@ -430,6 +431,15 @@ SPECTRE_TEST_CASE("Unit.NumericalAlgorithms.Spectral.AngularDerivatives",
     test_compute_angular_derivatives<ComplexRepresentation::RealsThenImags, -2,
                                      0, Tags::Eth, Tags::EthEth>();
   }
+  {
+    INFO("Test derivatives with the radial shells split across threads");
+    sys::node_thread_pool().resize(2);
+    test_derivative_via_transforms<Tags::EthEthbar,
+                                   ComplexRepresentation::Interleaved, -2>();
+    test_compute_angular_derivatives<ComplexRepresentation::RealsThenImags, -1,
+                                     1, Tags::EthEthbar, Tags::EthbarEth>();
+    sys::node_thread_pool().resize(1);
+  }
 }
 }  // namespace
 }  // namespace Spectral::Swsh
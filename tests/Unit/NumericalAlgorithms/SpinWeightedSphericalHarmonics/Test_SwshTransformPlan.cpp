@@ -0,0 +1,122 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <random>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/ComplexDataVector.hpp"
+#include "DataStructures/ComplexModalVector.hpp"
+#include "DataStructures/SpinWeighted.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Helpers/NumericalAlgorithms/SpinWeightedSphericalHarmonics/SwshTestHelpers.hpp"
+#include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/ComplexDataView.hpp"
+#include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/SwshCoefficients.hpp"
+#include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/SwshCollocation.hpp"
+#include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/SwshTransform.hpp"
+#include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/SwshTransformPlan.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace Spectral::Swsh {
+namespace {
+
+template <ComplexRepresentation Representation>
+void test_plan_blocks() {
+  // 60 spin-0 slices are 120 libsharp transforms, which must be split into two
+  // even blocks
+  const auto& spin_zero_plan =
+      detail::cached_transform_plan<Representation>(4, 0, 60);
+  CHECK(spin_zero_plan.l_max() == 4);
+  CHECK(spin_zero_plan.spin() == 0);
+  CHECK(spin_zero_plan.number_of_slices() == 60);
+  CHECK(spin_zero_plan.blocks() ==
+        std::vector<std::pair<size_t, size_t>>{{0, 60}, {60, 60}});
+
+  // spin-weighted slices are a single libsharp transform each
+  const auto& spin_one_plan =
+      detail::cached_transform_plan<Representation>(4, 1, 60);
+  CHECK(spin_one_plan.blocks() ==
+        std::vector<std::pair<size_t, size_t>>{{0, 60}});
+  const auto& uneven_plan =
+      detail::cached_transform_plan<Representation>(4, -2, 201);
+  CHECK(uneven_plan.blocks() ==
+        std::vector<std::pair<size_t, size_t>>{{0, 67}, {67, 67}, {134, 67}});
+
+  // repeated requests retrieve the same plan on the same thread, and a distinct
+  // plan on a different thread
+  CHECK(&detail::cached_transform_plan<Representation>(4, 0, 60) ==
+        &spin_zero_plan);
+  CHECK(&detail::cached_transform_plan<Representation>(5, 0, 60) !=
+        &spin_zero_plan);
+  const detail::TransformPlan<Representation>* other_thread_plan = nullptr;
+  std::thread other_thread{[&other_thread_plan]() {
+    other_thread_plan =
+        &detail::cached_transform_plan<Representation>(4, 0, 60);
+  }};
+  other_thread.join();
+  CHECK(other_thread_plan != &spin_zero_plan);
+}
+
+template <ComplexRepresentation Representation, int Spin>
+void test_transform_with_several_blocks() {
+  MAKE_GENERATOR(gen);
+  UniformCustomDistribution<double> coefficient_distribution{-10.0, 10.0};
+  const size_t l_max = 4;
+  // enough radial points that the transforms of two vectors together exceed
+  // the libsharp limit on simultaneous transforms
+  const size_t number_of_radial_points = 70;
+
+  SpinWeighted<ComplexModalVector, Spin> expected_modes{
+      number_of_radial_points * size_of_libsharp_coefficient_vector(l_max)};
+  TestHelpers::generate_swsh_modes<Spin>(
+      make_not_null(&expected_modes.data()), make_not_null(&gen),
+      make_not_null(&coefficient_distribution), number_of_radial_points, l_max);
+  const SpinWeighted<ComplexModalVector, Spin> two_times_expected_modes =
+      2.0 * expected_modes;
+
+  SpinWeighted<ComplexDataVector, Spin> collocation{};
+  SpinWeighted<ComplexDataVector, Spin> two_times_collocation{};
+  inverse_swsh_transform<Representation>(
+      l_max, number_of_radial_points, make_not_null(&collocation),
+      make_not_null(&two_times_collocation), expected_modes,
+      two_times_expected_modes);
+  CHECK_ITERABLE_APPROX(two_times_collocation.data(),
+                        2.0 * collocation.data());
+  const auto collocation_copy = collocation;
+
+  SpinWeighted<ComplexModalVector, Spin> modes{};
+  SpinWeighted<ComplexModalVector, Spin> two_times_modes{};
+  swsh_transform<Representation>(l_max, number_of_radial_points,
+                                 make_not_null(&modes),
+                                 make_not_null(&two_times_modes), collocation,
+                                 two_times_collocation);
+  CHECK(collocation == collocation_copy);
+  CHECK_ITERABLE_APPROX(modes.data(), expected_modes.data());
+  CHECK_ITERABLE_APPROX(two_times_modes.data(),
+                        two_times_expected_modes.data());
+
+  // repeating the transform with the cached plan gives the same result
+  swsh_transform<Representation>(l_max, number_of_radial_points,
+                                 make_not_null(&modes),
+                                 make_not_null(&two_times_modes), collocation,
+                                 two_times_collocation);
+  CHECK_ITERABLE_APPROX(modes.data(), expected_modes.data());
+}
+
+SPECTRE_TEST_CASE("Unit.NumericalAlgorithms.Spectral.SwshTransformPlan",
+                  "[Unit][NumericalAlgorithms]") {
+  test_plan_blocks<ComplexRepresentation::Interleaved>();
+  test_plan_blocks<ComplexRepresentation::RealsThenImags>();
+  test_transform_with_several_blocks<ComplexRepresentation::Interleaved, -1>();
+  test_transform_with_several_blocks<ComplexRepresentation::Interleaved, 0>();
+  test_transform_with_several_blocks<ComplexRepresentation::RealsThenImags,
+                                     -2>();
+  test_transform_with_several_blocks<ComplexRepresentation::RealsThenImags,
+                                     0>();
+}
+}  // namespace
+}  // namespace Spectral::Swsh
@@ -354,6 +354,46 @@ void test_options_suggested() {
           "below the lower bound of 4"));
 }
 
+struct Defaulted {
+  using type = bool;
+  static constexpr Options::String help = {"Option with a default value"};
+  static type default_value() { return false; }
+};
+
+struct GroupedDefaulted {
+  using type = int;
+  static constexpr Options::String help = {"Grouped option with a default"};
+  static type default_value() { return 4; }
+  using group = Group;
+};
+
+void test_options_default() {
+  {
+    Options::Parser<tmpl::list<Defaulted>> opts("");
+    opts.parse("");
+    CHECK_FALSE(opts.get<Defaulted>());
+  }
+  {
+    Options::Parser<tmpl::list<Defaulted>> opts("");
+    opts.parse("Defaulted: true");
+    CHECK(opts.get<Defaulted>());
+  }
+  {
+    Options::Parser<tmpl::list<Defaulted, GroupedDefaulted, GroupedTag>> opts(
+        "");
+    opts.parse(
+        "Group:\n"
+        "  GroupedTag: 3");
+    CHECK_FALSE(opts.get<Defaulted>());
+    CHECK(opts.get<GroupedDefaulted>() == 4);
+    CHECK(opts.get<GroupedTag>() == 3);
+  }
+  {
+    Options::Parser<tmpl::list<Defaulted>> opts("");
+    CHECK(opts.help().find("default=false") != std::string::npos);
+  }
+}
+
 // [[OutputRegex, Bounded, line 1:.  Specified: 5.  Suggested: 3]]
 SPECTRE_TEST_CASE("Unit.Options.suggestion_warning", "[Unit][Options]") {
   OUTPUT_TEST();
@@ -1655,6 +1695,7 @@ SPECTRE_TEST_CASE("Unit.Options", "[Unit][Options]") {
   test_options_print_long_help();
   test_options_grouped();
   test_options_suggested();
+  test_options_default();
   test_options_bounded();
   test_options_bounded_vector();
   test_options_array();
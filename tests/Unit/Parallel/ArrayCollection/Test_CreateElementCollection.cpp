@@ -0,0 +1,169 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <pup.h>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/Tag.hpp"
+#include "Domain/Creators/Interval.hpp"
+#include "Domain/Creators/RegisterDerivedWithCharm.hpp"
+#include "Domain/Creators/Tags/Domain.hpp"
+#include "Domain/Creators/Tags/InitialExtents.hpp"
+#include "Domain/Creators/Tags/InitialRefinementLevels.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Structure/SegmentId.hpp"
+#include "Domain/Tags/ElementDistribution.hpp"
+#include "Evolution/DiscontinuousGalerkin/Initialization/QuadratureTag.hpp"
+#include "Framework/ActionTesting.hpp"
+#include "NumericalAlgorithms/Spectral/Quadrature.hpp"
+#include "Parallel/ArrayCollection/CreateElementCollection.hpp"
+#include "Parallel/ArrayCollection/ElementScheduler.hpp"
+#include "Parallel/ArrayCollection/Tags/ElementLocations.hpp"
+#include "Parallel/ArrayCollection/Tags/ElementScheduler.hpp"
+#include "Parallel/ArrayCollection/Tags/NumberOfElementsTerminated.hpp"
+#include "Parallel/Phase.hpp"
+#include "Parallel/PhaseDependentActionList.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
+
+namespace {
+using initialization_tags =
+    tmpl::list<domain::Tags::InitialExtents<1>,
+               domain::Tags::InitialRefinementLevels<1>,
+               evolution::dg::Tags::Quadrature>;
+
+// Stands in for `Parallel::DgElementArrayMember`, which needs a Charm++ proxy
+// to the global cache.
+struct MockElement {
+  MockElement() = default;
+  template <typename CacheProxy>
+  MockElement(const CacheProxy& /*global_cache_proxy*/,
+              tuples::tagged_tuple_from_typelist<initialization_tags>
+                  initialization_items,
+              ElementId<1> element_id)
+      : id(element_id),
+        initial_extents(std::move(
+            get<domain::Tags::InitialExtents<1>>(initialization_items))) {}
+
+  void set_core(const size_t core_in) { core = core_in; }
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) {
+    p | id;
+    p | initial_extents;
+    p | core;
+  }
+
+  ElementId<1> id{};
+  std::vector<std::array<size_t, 1>> initial_extents{};
+  std::optional<size_t> core{};
+};
+
+struct MockElementCollection : db::SimpleTag {
+  using type = std::unordered_map<ElementId<1>, MockElement>;
+};
+
+template <typename Metavariables>
+struct MockCollectionComponent {
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockNodeGroupChare;
+  using array_index = size_t;
+  using simple_tags_from_options = initialization_tags;
+  using phase_dependent_action_list = tmpl::list<Parallel::PhaseActions<
+      Parallel::Phase::Initialization,
+      tmpl::list<ActionTesting::InitializeDataBox<simple_tags_from_options>,
+                 Parallel::Actions::CreateElementCollection<
+                     1, MockElementCollection>>>>;
+};
+
+struct Metavariables {
+  using component_list = tmpl::list<MockCollectionComponent<Metavariables>>;
+};
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Parallel.ArrayCollection.CreateElementCollection",
+                  "[Unit][Parallel]") {
+  domain::creators::register_derived_with_charm();
+  using component = MockCollectionComponent<Metavariables>;
+
+  // Four elements distributed round robin over two nodes with two cores each
+  const domain::creators::Interval domain_creator{
+      {{-1.0}}, {{1.0}}, {{2}}, {{3}}};
+  ActionTesting::MockRuntimeSystem<Metavariables> runner{
+      tuples::TaggedTuple<domain::Tags::Domain<1>,
+                          domain::Tags::ElementDistribution>{
+          domain_creator.create_domain(), std::nullopt},
+      {},
+      {2, 2}};
+  ActionTesting::emplace_nodegroup_component_and_initialize<component>(
+      make_not_null(&runner),
+      {domain_creator.initial_extents(),
+       domain_creator.initial_refinement_levels(),
+       Spectral::Quadrature::GaussLobatto});
+  for (size_t node = 0; node < 2; ++node) {
+    ActionTesting::next_action<component>(make_not_null(&runner), node);
+  }
+
+  const std::array<ElementId<1>, 4> element_ids{
+      {ElementId<1>{0, {{SegmentId{2, 0}}}},
+       ElementId<1>{0, {{SegmentId{2, 1}}}},
+       ElementId<1>{0, {{SegmentId{2, 2}}}},
+       ElementId<1>{0, {{SegmentId{2, 3}}}}}};
+  const std::unordered_map<ElementId<1>, size_t> expected_locations{
+      {element_ids[0], 0},
+      {element_ids[1], 0},
+      {element_ids[2], 1},
+      {element_ids[3], 1}};
+
+  for (size_t node = 0; node < 2; ++node) {
+    CAPTURE(node);
+    // Every node knows where all elements are
+    CHECK(ActionTesting::get_databox_tag<component,
+                                         Parallel::Tags::ElementLocations<1>>(
+              runner, node) == expected_locations);
+
+    // Each node holds the elements placed on one of its cores
+    const auto& elements =
+        ActionTesting::get_databox_tag<component, MockElementCollection>(
+            runner, node);
+    REQUIRE(elements.size() == 2);
+    for (size_t i = 0; i < 2; ++i) {
+      const size_t global_index = 2 * node + i;
+      const ElementId<1>& element_id = gsl::at(element_ids, global_index);
+      CAPTURE(element_id);
+      REQUIRE(elements.count(element_id) == 1);
+      const MockElement& element = elements.at(element_id);
+      CHECK(element.id == element_id);
+      CHECK(element.core == std::optional{global_index});
+      CHECK(element.initial_extents == domain_creator.initial_extents());
+    }
+    CHECK(ActionTesting::get_databox_tag<
+              component, Parallel::Tags::NumberOfElementsTerminated>(
+              runner, node) == 2);
+
+    // The element with a neighbor on the other node is run first
+    const ElementId<1>& interior_element =
+        gsl::at(element_ids, node == 0 ? 0 : 3);
+    const ElementId<1>& boundary_element =
+        gsl::at(element_ids, node == 0 ? 1 : 2);
+    db::mutate<Parallel::Tags::ElementScheduler<1>>(
+        [&interior_element, &boundary_element](
+            const gsl::not_null<Parallel::ElementScheduler<1>*> scheduler) {
+          scheduler->push(interior_element, 0.0);
+          scheduler->push(boundary_element, 0.0);
+          CHECK(scheduler->pop() == std::optional{boundary_element});
+          CHECK(scheduler->pop() == std::optional{interior_element});
+        },
+        make_not_null(&ActionTesting::get_databox<component>(
+            make_not_null(&runner), node)));
+  }
+}
@@ -0,0 +1,90 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <optional>
+#include <tuple>
+
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Structure/SegmentId.hpp"
+#include "Parallel/ArrayCollection/ElementReductionCombiner.hpp"
+#include "Parallel/Reduction.hpp"
+#include "Utilities/Functional.hpp"
+#include "Utilities/Literals.hpp"
+
+namespace Parallel {
+namespace {
+using ReductionType =
+    ReductionData<ReductionDatum<size_t, funcl::Plus<>>,
+                  ReductionDatum<double, funcl::Min<>>>;
+
+size_t count(const std::optional<ReductionType>& reduction_data) {
+  REQUIRE(reduction_data.has_value());
+  return std::get<0>(reduction_data->data());
+}
+
+double minimum(const std::optional<ReductionType>& reduction_data) {
+  REQUIRE(reduction_data.has_value());
+  return std::get<1>(reduction_data->data());
+}
+
+void test_in_order() {
+  const ElementId<1> id_a{0, {{SegmentId{1, 0}}}};
+  const ElementId<1> id_b{0, {{SegmentId{1, 1}}}};
+  const ElementId<1> id_c{1, {{SegmentId{0, 0}}}};
+
+  ElementReductionCombiner<1, ReductionType> combiner{};
+  CHECK(combiner.number_of_pending_reductions() == 0);
+  CHECK_FALSE(combiner.add(id_a, ReductionType{1_st, 3.0}, 3).has_value());
+  CHECK_FALSE(combiner.add(id_b, ReductionType{1_st, 1.0}, 3).has_value());
+  CHECK(combiner.number_of_pending_reductions() == 1);
+  const auto combined = combiner.add(id_c, ReductionType{1_st, 2.0}, 3);
+  CHECK(count(combined) == 3);
+  CHECK(minimum(combined) == 1.0);
+  CHECK(combiner.number_of_pending_reductions() == 0);
+}
+
+void test_elements_ahead() {
+  const ElementId<1> id_a{0, {{SegmentId{1, 0}}}};
+  const ElementId<1> id_b{0, {{SegmentId{1, 1}}}};
+
+  // Element a contributes to three reductions before element b contributes to
+  // the first one. The reductions complete in order.
+  ElementReductionCombiner<1, ReductionType> combiner{};
+  CHECK_FALSE(combiner.add(id_a, ReductionType{1_st, 1.0}, 2).has_value());
+  CHECK_FALSE(combiner.add(id_a, ReductionType{1_st, 2.0}, 2).has_value());
+  CHECK_FALSE(combiner.add(id_a, ReductionType{1_st, 3.0}, 2).has_value());
+  CHECK(combiner.number_of_pending_reductions() == 3);
+  CHECK(minimum(combiner.add(id_b, ReductionType{1_st, 4.0}, 2)) == 1.0);
+  CHECK(minimum(combiner.add(id_b, ReductionType{1_st, 0.5}, 2)) == 0.5);
+  CHECK(combiner.number_of_pending_reductions() == 1);
+  const auto last = combiner.add(id_b, ReductionType{1_st, 6.0}, 2);
+  CHECK(count(last) == 2);
+  CHECK(minimum(last) == 3.0);
+  CHECK(combiner.number_of_pending_reductions() == 0);
+}
+
+void test_changing_elements() {
+  const ElementId<1> id_a{0, {{SegmentId{0, 0}}}};
+  const ElementId<1> id_b{0, {{SegmentId{1, 0}}}};
+  const ElementId<1> id_c{0, {{SegmentId{1, 1}}}};
+
+  ElementReductionCombiner<1, ReductionType> combiner{};
+  CHECK(count(combiner.add(id_a, ReductionType{1_st, 1.0}, 1)) == 1);
+  CHECK(count(combiner.add(id_a, ReductionType{1_st, 1.0}, 1)) == 1);
+
+  // Element a was refined into b and c while no reduction was pending
+  CHECK_FALSE(combiner.add(id_b, ReductionType{1_st, 1.0}, 2).has_value());
+  CHECK(count(combiner.add(id_c, ReductionType{1_st, 1.0}, 2)) == 2);
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Parallel.ArrayCollection.ElementReductionCombiner",
+                  "[Unit][Parallel]") {
+  test_in_order();
+  test_elements_ahead();
+  test_changing_elements();
+}
+}  // namespace Parallel
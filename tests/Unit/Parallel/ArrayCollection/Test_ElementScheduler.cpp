@@ -0,0 +1,161 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <optional>
+#include <unordered_set>
+
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Structure/SegmentId.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Parallel/ArrayCollection/ElementScheduler.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace Parallel {
+namespace {
+// Pop the next element and finish running it right away
+std::optional<ElementId<1>> run_next(
+    const gsl::not_null<ElementScheduler<1>*> scheduler) {
+  const auto element_id = scheduler->pop();
+  if (element_id.has_value()) {
+    CHECK(scheduler->finished_running(*element_id) ==
+          ElementScheduler<1>::NextRun::None);
+  }
+  return element_id;
+}
+
+void test_order() {
+  const ElementId<1> id_a{0, {{SegmentId{1, 0}}}};
+  const ElementId<1> id_b{0, {{SegmentId{1, 1}}}};
+  const ElementId<1> id_c{1, {{SegmentId{1, 0}}}};
+
+  ElementScheduler<1> scheduler{};
+  CHECK(scheduler.size() == 0);
+  CHECK_FALSE(scheduler.pop().has_value());
+
+  // Earliest time first
+  scheduler.push(id_a, 2.0);
+  scheduler.push(id_b, 1.0);
+  scheduler.push(id_c, 3.0);
+  CHECK(scheduler.size() == 3);
+  CHECK(run_next(make_not_null(&scheduler)) == std::optional{id_b});
+  CHECK(run_next(make_not_null(&scheduler)) == std::optional{id_a});
+  CHECK(run_next(make_not_null(&scheduler)) == std::optional{id_c});
+  CHECK_FALSE(scheduler.pop().has_value());
+
+  // Elements on the node boundary go first at equal times
+  scheduler.set_elements_on_node_boundary({id_c});
+  scheduler.push(id_a, 1.0);
+  scheduler.push(id_c, 1.0);
+  scheduler.push(id_b, 0.5);
+  CHECK(run_next(make_not_null(&scheduler)) == std::optional{id_b});
+  CHECK(run_next(make_not_null(&scheduler)) == std::optional{id_c});
+  CHECK(run_next(make_not_null(&scheduler)) == std::optional{id_a});
+
+  // An element is queued once, at its earliest time
+  scheduler.push(id_a, 4.0);
+  scheduler.push(id_b, 3.0);
+  scheduler.push(id_a, 5.0);
+  CHECK(scheduler.size() == 2);
+  CHECK(run_next(make_not_null(&scheduler)) == std::optional{id_b});
+  CHECK(run_next(make_not_null(&scheduler)) == std::optional{id_a});
+  scheduler.push(id_a, 4.0);
+  scheduler.push(id_b, 3.0);
+  scheduler.push(id_a, 2.0);
+  CHECK(scheduler.size() == 2);
+  CHECK(run_next(make_not_null(&scheduler)) == std::optional{id_a});
+  CHECK(run_next(make_not_null(&scheduler)) == std::optional{id_b});
+
+  // Only the node boundary is serialized
+  scheduler.push(id_a, 1.0);
+  ElementScheduler<1> deserialized = serialize_and_deserialize(scheduler);
+  CHECK(deserialized.size() == 0);
+  deserialized.push(id_a, 1.0);
+  deserialized.push(id_c, 1.0);
+  CHECK(run_next(make_not_null(&deserialized)) == std::optional{id_c});
+  CHECK(run_next(make_not_null(&deserialized)) == std::optional{id_a});
+}
+
+void test_running_elements() {
+  const ElementId<1> id_a{0, {{SegmentId{1, 0}}}};
+  const ElementId<1> id_b{0, {{SegmentId{1, 1}}}};
+
+  ElementScheduler<1> scheduler{};
+  scheduler.push(id_a, 1.0);
+  scheduler.push(id_b, 2.0);
+  CHECK(scheduler.pop() == std::optional{id_a});
+
+  // Data arrives for the running element. It stays queued, but is skipped in
+  // favor of the next element.
+  scheduler.push(id_a, 3.0);
+  CHECK(scheduler.size() == 2);
+  CHECK(scheduler.pop() == std::optional{id_b});
+  CHECK_FALSE(scheduler.pop().has_value());
+  CHECK(scheduler.size() == 1);
+
+  // Once done, the element must be run again
+  CHECK(scheduler.finished_running(id_b) ==
+        ElementScheduler<1>::NextRun::None);
+  CHECK(scheduler.finished_running(id_a) ==
+        ElementScheduler<1>::NextRun::PerformAlgorithm);
+  CHECK(run_next(make_not_null(&scheduler)) == std::optional{id_a});
+  CHECK(scheduler.size() == 0);
+
+  // Elements started by a phase change are also skipped
+  CHECK(scheduler.set_running(id_b));
+  scheduler.push(id_b, 4.0);
+  CHECK_FALSE(scheduler.pop().has_value());
+  CHECK(scheduler.finished_running(id_b) ==
+        ElementScheduler<1>::NextRun::PerformAlgorithm);
+  CHECK(run_next(make_not_null(&scheduler)) == std::optional{id_b});
+
+  // Running elements are not serialized
+  CHECK(scheduler.set_running(id_a));
+  ElementScheduler<1> deserialized = serialize_and_deserialize(scheduler);
+  deserialized.push(id_a, 1.0);
+  CHECK(deserialized.pop() == std::optional{id_a});
+}
+
+void test_phase_start_while_running() {
+  const ElementId<1> id_a{0, {{SegmentId{1, 0}}}};
+
+  ElementScheduler<1> scheduler{};
+  scheduler.push(id_a, 1.0);
+  CHECK(scheduler.pop() == std::optional{id_a});
+
+  // The phase starts on an element that runs on another processor. The phase
+  // start is deferred and the element stays running for it.
+  CHECK_FALSE(scheduler.set_running(id_a));
+  scheduler.push(id_a, 2.0);
+  CHECK(scheduler.finished_running(id_a) ==
+        ElementScheduler<1>::NextRun::StartPhase);
+  CHECK_FALSE(scheduler.pop().has_value());
+
+  // Data that arrived in the meantime is handled after the phase start
+  CHECK(scheduler.finished_running(id_a) ==
+        ElementScheduler<1>::NextRun::PerformAlgorithm);
+  CHECK(run_next(make_not_null(&scheduler)) == std::optional{id_a});
+
+  // Without a pending phase start the element is started right away
+  CHECK(scheduler.set_running(id_a));
+  CHECK(scheduler.finished_running(id_a) ==
+        ElementScheduler<1>::NextRun::None);
+
+  // Pending phase starts are not serialized
+  CHECK(scheduler.set_running(id_a));
+  CHECK_FALSE(scheduler.set_running(id_a));
+  ElementScheduler<1> deserialized = serialize_and_deserialize(scheduler);
+  CHECK(deserialized.set_running(id_a));
+  CHECK(deserialized.finished_running(id_a) ==
+        ElementScheduler<1>::NextRun::None);
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Parallel.ArrayCollection.ElementScheduler",
+                  "[Unit][Parallel]") {
+  test_order();
+  test_running_elements();
+  test_phase_start_while_running();
+}
+}  // namespace Parallel
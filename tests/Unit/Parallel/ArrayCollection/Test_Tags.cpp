@@ -9,6 +9,7 @@
 #include "Parallel/ArrayCollection/Tags/ElementCollection.hpp"
 #include "Parallel/ArrayCollection/Tags/ElementLocations.hpp"
 #include "Parallel/ArrayCollection/Tags/ElementLocationsReference.hpp"
+#include "Parallel/ArrayCollection/Tags/ElementScheduler.hpp"
 #include "Parallel/ArrayCollection/Tags/NumberOfElementsTerminated.hpp"
 
 namespace Parallel {
@@ -17,6 +18,8 @@ SPECTRE_TEST_CASE("Unit.Parallel.ArrayCollection.Tags", "[Unit][Parallel]") {
       Tags::ElementCollection<3, void, void, void>>("ElementCollection");
   TestHelpers::db::test_simple_tag<Tags::ElementLocations<3>>(
       "ElementLocations");
+  TestHelpers::db::test_simple_tag<Tags::ElementScheduler<3>>(
+      "ElementScheduler");
   TestHelpers::db::test_reference_tag<
       Tags::ElementLocationsReference<3, void, void>>("ElementLocations");
   TestHelpers::db::test_simple_tag<Tags::NumberOfElementsTerminated>(
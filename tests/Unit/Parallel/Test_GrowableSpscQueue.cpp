@@ -0,0 +1,97 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <thread>
+
+#include "Parallel/GrowableSpscQueue.hpp"
+
+namespace {
+void test_serial() {
+  Parallel::GrowableSpscQueue<int, 2> queue{};
+  CHECK(queue.block_capacity() == 2);
+  CHECK(queue.empty());
+  CHECK(queue.size() == 0);  // NOLINT
+  CHECK(queue.front() == nullptr);
+  CHECK(queue.number_of_overflows() == 0);
+
+  queue.emplace(3);
+  queue.push(5);
+  CHECK(queue.size() == 2);
+  CHECK(queue.number_of_overflows() == 0);
+  const int a = 7;
+  queue.push(a);
+  queue.emplace(11);
+  queue.push(15);
+  CHECK_FALSE(queue.empty());
+  CHECK(queue.size() == 5);
+  CHECK(queue.number_of_overflows() == 2);
+
+  for (const int expected : {3, 5, 7}) {
+    int* front = queue.front();
+    REQUIRE(front != nullptr);
+    CHECK(*front == expected);
+    queue.pop();
+  }
+  CHECK(queue.size() == 2);
+
+  // Push into a partially drained queue
+  queue.push(19);
+  queue.push(21);
+  CHECK(queue.size() == 4);
+  CHECK(queue.number_of_overflows() == 3);
+  for (const int expected : {11, 15, 19, 21}) {
+    int* front = queue.front();
+    REQUIRE(front != nullptr);
+    CHECK(*front == expected);
+    queue.pop();
+  }
+  CHECK(queue.empty());
+  CHECK(queue.front() == nullptr);
+
+  // Elements that are still queued are destroyed with the queue
+  auto shared = std::make_shared<int>(1);
+  {
+    Parallel::GrowableSpscQueue<std::shared_ptr<int>, 1> shared_queue{};
+    shared_queue.push(shared);
+    shared_queue.push(shared);
+    shared_queue.push(shared);
+    CHECK(shared.use_count() == 4);
+  }
+  CHECK(shared.use_count() == 1);
+}
+
+void test_threaded() {
+  // One producer and one consumer. The consumer must see every element in
+  // order even though the queue grows and frees blocks concurrently.
+  constexpr size_t number_of_elements = 100000;
+  Parallel::GrowableSpscQueue<size_t, 8> queue{};
+  std::thread producer{[&queue]() {
+    for (size_t i = 0; i < number_of_elements; ++i) {
+      queue.push(i);
+    }
+  }};
+  size_t number_received = 0;
+  bool in_order = true;
+  while (number_received < number_of_elements) {
+    const size_t* front = queue.front();
+    if (front == nullptr) {
+      continue;
+    }
+    in_order = in_order and *front == number_received;
+    queue.pop();
+    ++number_received;
+  }
+  producer.join();
+  CHECK(in_order);
+  CHECK(queue.empty());
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Parallel.GrowableSpscQueue", "[Unit][Parallel]") {
+  test_serial();
+  test_threaded();
+}
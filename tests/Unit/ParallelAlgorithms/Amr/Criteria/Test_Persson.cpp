@@ -8,18 +8,22 @@
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/ObservationBox.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/ModalVector.hpp"
 #include "Domain/Amr/Flag.hpp"
 #include "Domain/Structure/ElementId.hpp"
 #include "Framework/TestCreation.hpp"
 #include "Framework/TestHelpers.hpp"
 #include "Helpers/DataStructures/DataBox/TestHelpers.hpp"
 #include "Helpers/DataStructures/MakeWithRandomValues.hpp"
+#include "NumericalAlgorithms/LinearOperators/CoefficientTransforms.hpp"
 #include "NumericalAlgorithms/Spectral/LogicalCoordinates.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "Options/Protocols/FactoryCreation.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "ParallelAlgorithms/Amr/Criteria/Criterion.hpp"
 #include "ParallelAlgorithms/Amr/Criteria/Persson.hpp"
+#include "ParallelAlgorithms/Amr/Criteria/Tags/ModalCoefficients.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/Serialization/RegisterDerivedClassesWithCharm.hpp"
 #include "Utilities/TMPL.hpp"
@@ -68,6 +72,16 @@ SPECTRE_TEST_CASE("Unit.Amr.Criteria.Persson", "[Unit][ParallelAlgorithms]") {
     const auto indicator = persson_smoothness_indicator(test_data, mesh, 2);
     CHECK(indicator[0] == approx(0.04065096467876369));
     CHECK(indicator[1] == approx(0.));
+    // Computing the indicator from the modal coefficients gives the same result
+    const auto modal_coefficients = to_modal_coefficients(test_data, mesh);
+    DataVector buffer{};
+    ModalVector modes_buffer{};
+    for (size_t d = 0; d < Dim; ++d) {
+      CHECK(persson_smoothness_indicator(make_not_null(&buffer),
+                                         make_not_null(&modes_buffer),
+                                         modal_coefficients, mesh, d, 2) ==
+            approx(gsl::at(indicator, d)));
+    }
   }
 
   register_factory_classes_with_charm<Metavariables<Dim>>();
@@ -93,13 +107,23 @@ SPECTRE_TEST_CASE("Unit.Amr.Criteria.Persson", "[Unit][ParallelAlgorithms]") {
       db::create<tmpl::list<::domain::Tags::Mesh<Dim>, TestVector<Dim>>>(
           mesh, std::move(test_data));
   ObservationBox<
-      tmpl::list<>,
+      typename Persson<Dim, tmpl::list<TestVector<Dim>>>::
+          compute_tags_for_observation_box,
       db::DataBox<tmpl::list<::domain::Tags::Mesh<Dim>, TestVector<Dim>>>>
       box{make_not_null(&databox)};
 
   const auto flags = criterion->evaluate(box, empty_cache, ElementId<Dim>{0});
   CHECK(flags[0] == amr::Flag::Split);
   CHECK(flags[1] == amr::Flag::Join);
+  // The criterion retrieves the modal coefficients from the observation box
+  const auto& modal_coefficients =
+      get<Tags::ModalCoefficients<TestVector<Dim>>>(box);
+  REQUIRE(modal_coefficients.size() == Dim);
+  for (size_t d = 0; d < Dim; ++d) {
+    CHECK_ITERABLE_APPROX(
+        modal_coefficients[d],
+        to_modal_coefficients(get<TestVector<Dim>>(box).get(d), mesh));
+  }
 }
 
 }  // namespace amr::Criteria
@@ -8,16 +8,19 @@
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/ObservationBox.hpp"
+#include "DataStructures/ModalVector.hpp"
 #include "Domain/Amr/Flag.hpp"
 #include "Domain/Structure/ElementId.hpp"
 #include "Framework/TestCreation.hpp"
 #include "Framework/TestHelpers.hpp"
 #include "Helpers/DataStructures/DataBox/TestHelpers.hpp"
+#include "NumericalAlgorithms/LinearOperators/CoefficientTransforms.hpp"
 #include "NumericalAlgorithms/Spectral/LogicalCoordinates.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "Options/Protocols/FactoryCreation.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "ParallelAlgorithms/Amr/Criteria/Criterion.hpp"
+#include "ParallelAlgorithms/Amr/Criteria/Tags/ModalCoefficients.hpp"
 #include "ParallelAlgorithms/Amr/Criteria/TruncationError.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/Serialization/RegisterDerivedClassesWithCharm.hpp"
@@ -77,11 +80,23 @@ SPECTRE_TEST_CASE("Unit.Amr.Criteria.TruncationError",
         db::create<tmpl::list<::domain::Tags::Mesh<Dim>, TestVector<Dim>>>(
             mesh, std::move(test_data));
     ObservationBox<
-        tmpl::list<>,
+        typename TruncationError<
+            Dim, tmpl::list<TestVector<Dim>>>::compute_tags_for_observation_box,
         db::DataBox<tmpl::list<::domain::Tags::Mesh<Dim>, TestVector<Dim>>>>
         box{make_not_null(&databox)};
 
-    return criterion.evaluate(box, empty_cache, ElementId<Dim>{0});
+    const auto flags =
+        criterion.evaluate(box, empty_cache, ElementId<Dim>{0});
+    // The criterion retrieves the modal coefficients from the observation box
+    const auto& modal_coefficients =
+        get<Tags::ModalCoefficients<TestVector<Dim>>>(box);
+    REQUIRE(modal_coefficients.size() == Dim);
+    for (size_t d = 0; d < Dim; ++d) {
+      CHECK_ITERABLE_APPROX(
+          modal_coefficients[d],
+          to_modal_coefficients(get<TestVector<Dim>>(box).get(d), mesh));
+    }
+    return flags;
   };
 
   // Expectation:
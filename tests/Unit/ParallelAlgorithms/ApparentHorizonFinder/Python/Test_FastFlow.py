@@ -4,6 +4,7 @@
 import unittest
 
 from spectre.ApparentHorizonFinder import FastFlow, FlowType
+from spectre.SphericalHarmonics import Strahlkorper
 
 
 class TestFastFlow(unittest.TestCase):
@@ -18,10 +19,33 @@ class TestFastFlow(unittest.TestCase):
             divergence_iter=5,
             max_its=100,
         )
+        strahlkorper = Strahlkorper(
+            l_max=12, m_max=12, radius=2.0, center=[0.0, 0.0, 0.0]
+        )
+        self.assertEqual(fast_flow.current_l_surface(strahlkorper), 12)
+        self.assertEqual(fast_flow.current_l_mesh(strahlkorper), 18)
         # Can't test any iterations until we bind a Schwarzschild or Kerr
         # solution in Python, or have numeric data with a horizon stored
         # somewhere.
 
+    def test_initial_l_max(self):
+        fast_flow = FastFlow(
+            FlowType.Fast,
+            alpha=1.0,
+            beta=0.5,
+            abs_tol=1e-12,
+            truncation_tol=0.01,
+            divergence_tol=1.2,
+            divergence_iter=5,
+            max_its=100,
+            initial_l_max=4,
+        )
+        strahlkorper = Strahlkorper(
+            l_max=12, m_max=12, radius=2.0, center=[0.0, 0.0, 0.0]
+        )
+        self.assertEqual(fast_flow.current_l_surface(strahlkorper), 4)
+        self.assertEqual(fast_flow.current_l_mesh(strahlkorper), 6)
+
 
 if __name__ == "__main__":
     unittest.main(verbosity=2)
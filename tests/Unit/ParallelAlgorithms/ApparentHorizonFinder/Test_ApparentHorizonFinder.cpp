@@ -7,6 +7,7 @@
 #include <array>
 #include <cstddef>
 #include <memory>
+#include <optional>
 #include <pup.h>
 #include <random>
 #include <utility>
@@ -45,6 +46,7 @@
 #include "NumericalAlgorithms/Spectral/Quadrature.hpp"
 #include "NumericalAlgorithms/SphericalHarmonics/Spherepack.hpp"
 #include "NumericalAlgorithms/SphericalHarmonics/Strahlkorper.hpp"
+#include "NumericalAlgorithms/SphericalHarmonics/Tags.hpp"
 #include "Parallel/ParallelComponentHelpers.hpp"
 #include "Parallel/Phase.hpp"
 #include "Parallel/PhaseDependentActionList.hpp"  // IWYU pragma: keep
@@ -314,8 +316,8 @@ void test_apparent_horizon(const gsl::not_null<size_t*> test_horizon_called,
   intrp::OptionHolders::ApparentHorizon<Frame> apparent_horizon_opts(
       ylm::Strahlkorper<Frame>{l_max, 2.8, {{0.0, 0.0, 0.0}}},
       FastFlow{FastFlow::FlowType::Fast, 1.0, 0.5, 1.e-12, 1.e-2, 1.2, 5,
-               max_its},
-      Verbosity::Verbose);
+               max_its, std::nullopt},
+      Verbosity::Verbose, 2);
 
   std::unique_ptr<DomainCreator<3>> domain_creator;
   std::unique_ptr<ActionTesting::MockRuntimeSystem<metavars>> runner_ptr{};
@@ -742,6 +744,14 @@ void test_apparent_horizon(const gsl::not_null<size_t*> test_horizon_called,
   // Make sure function was called three times per
   // post_horizon_find_callback.
   CHECK(*test_horizon_called == 3 * tmpl::size<PostHorizonFindCallbacks>{});
+
+  // Only the requested number of previous horizons is kept
+  if constexpr (not MakeHorizonFinderFailOnPurpose) {
+    CHECK(ActionTesting::get_databox_tag<
+              target_component, ylm::Tags::PreviousStrahlkorpers<Frame>>(
+              runner, 0)
+              .size() == 2);
+  }
 }
 
 // This tests the entire AH finder including numerical interpolation.
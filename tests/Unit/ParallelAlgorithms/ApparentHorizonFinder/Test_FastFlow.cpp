@@ -7,6 +7,7 @@
 #include <array>
 #include <cmath>
 #include <cstddef>
+#include <optional>
 #include <random>
 #include <string>
 #include <utility>
@@ -93,9 +94,11 @@ void test_construct_from_options_fast() {
       "TruncationTol: 1.e-3\n"
       "DivergenceTol: 1.1\n"
       "DivergenceIter: 6\n"
-      "MaxIts: 200");
+      "MaxIts: 200\n"
+      "InitialLMax: None");
   CHECK(created ==
-        FastFlow(FastFlow::FlowType::Fast, 1.1, 0.6, 1e-10, 1e-3, 1.1, 6, 200));
+        FastFlow(FastFlow::FlowType::Fast, 1.1, 0.6, 1e-10, 1e-3, 1.1, 6, 200,
+                 std::nullopt));
 }
 
 void test_construct_from_options_jacobi() {
@@ -107,9 +110,10 @@ void test_construct_from_options_jacobi() {
       "TruncationTol: 1.e-3\n"
       "DivergenceTol: 1.1\n"
       "DivergenceIter: 6\n"
-      "MaxIts: 200");
+      "MaxIts: 200\n"
+      "InitialLMax: None");
   CHECK(created == FastFlow(FastFlow::FlowType::Jacobi, 1.1, 0.6, 1e-10, 1e-3,
-                            1.1, 6, 200));
+                            1.1, 6, 200, std::nullopt));
 }
 
 void test_construct_from_options_curvature() {
@@ -121,20 +125,21 @@ void test_construct_from_options_curvature() {
       "TruncationTol: 1.e-3\n"
       "DivergenceTol: 1.1\n"
       "DivergenceIter: 6\n"
-      "MaxIts: 200");
+      "MaxIts: 200\n"
+      "InitialLMax: None");
   CHECK(created == FastFlow(FastFlow::FlowType::Curvature, 1.1, 0.6, 1e-10,
-                            1e-3, 1.1, 6, 200));
+                            1e-3, 1.1, 6, 200, std::nullopt));
 }
 
 void test_serialize() {
   FastFlow fastflow(FastFlow::FlowType::Jacobi, 1.1, 0.6, 1e-10, 1e-3, 1.1, 6,
-                    200);
+                    200, 4);
   test_serialization(fastflow);
 }
 
 void test_copy_and_move() {
   FastFlow fastflow(FastFlow::FlowType::Curvature, 1.1, 0.6, 1e-10, 1e-3, 1.1,
-                    6, 200);
+                    6, 200, std::nullopt);
   test_copy_semantics(fastflow);
   auto fastflow_copy = fastflow;
   // clang-tidy: std::move of triviable-copyable type
@@ -160,7 +165,8 @@ void test_negative_radius_error() {
   // Set initial Strahlkorper radius to negative on purpose to get
   // error exit status.
   ylm::Strahlkorper<Frame::Inertial> strahlkorper(5, 5, -1.0, {{0, 0, 0}});
-  FastFlow flow(FastFlow::FlowType::Fast, 1.0, 0.5, 1e-12, 1e-10, 1.2, 5, 100);
+  FastFlow flow(FastFlow::FlowType::Fast, 1.0, 0.5, 1e-12, 1e-10, 1.2, 5, 100,
+                std::nullopt);
 
   const gr::Solutions::KerrSchild solution(1.0, {{0., 0., 0.}}, {{0., 0., 0.}});
 
@@ -171,7 +177,8 @@ void test_negative_radius_error() {
 void test_too_many_iterations_error() {
   ylm::Strahlkorper<Frame::Inertial> strahlkorper(5, 5, 3.0, {{0, 0, 0}});
   // Set number of iterations to 1 on purpose to get error exit status.
-  FastFlow flow(FastFlow::FlowType::Fast, 1.0, 0.5, 1e-12, 1e-10, 1.2, 5, 1);
+  FastFlow flow(FastFlow::FlowType::Fast, 1.0, 0.5, 1e-12, 1e-10, 1.2, 5, 1,
+                std::nullopt);
 
   const gr::Solutions::KerrSchild solution(1.0, {{0., 0., 0.}}, {{0., 0., 0.}});
 
@@ -182,7 +189,8 @@ void test_too_many_iterations_error() {
 void test_schwarzschild(FastFlow::Flow::type type_of_flow,
                         const size_t max_iterations) {
   ylm::Strahlkorper<Frame::Inertial> strahlkorper(5, 5, 3.0, {{0, 0, 0}});
-  FastFlow flow(type_of_flow, 1.0, 0.5, 1e-12, 1e-10, 1.2, 5, max_iterations);
+  FastFlow flow(type_of_flow, 1.0, 0.5, 1e-12, 1e-10, 1.2, 5, max_iterations,
+                std::nullopt);
 
   const gr::Solutions::KerrSchild solution(1.0, {{0., 0., 0.}}, {{0., 0., 0.}});
 
@@ -225,10 +233,13 @@ void test_schwarzschild(FastFlow::Flow::type type_of_flow,
 }
 
 void test_kerr(FastFlow::Flow::type type_of_flow, const double mass,
-               const size_t max_iterations) {
+               const size_t max_iterations,
+               const std::optional<size_t> initial_l_max = std::nullopt) {
   ylm::Strahlkorper<Frame::Inertial> strahlkorper(8, 8, 2.0 * mass,
                                                   {{0, 0, 0}});
-  FastFlow flow(type_of_flow, 1.0, 0.5, 1e-12, 1e-2, 1.2, 5, max_iterations);
+  FastFlow flow(type_of_flow, 1.0, 0.5, 1e-12, 1e-2, 1.2, 5, max_iterations,
+                initial_l_max);
+  CHECK(flow.current_l_surface(strahlkorper) == initial_l_max.value_or(8));
 
   const std::array<double, 3> spin = {{0.1, 0.2, 0.3}};
   const gr::Solutions::KerrSchild solution(mass, spin, {{0., 0., 0.}});
@@ -263,6 +274,51 @@ void test_kerr(FastFlow::Flow::type type_of_flow, const double mass,
   Approx custom_approx = Approx::custom().epsilon(1.e-10).scale(1.);
   CHECK(r_min_pt == custom_approx(r_min_val));
   CHECK(r_max_pt == custom_approx(r_max_val));
+  // The coarse-to-fine iteration always ends at the full resolution.
+  CHECK(flow.current_l_surface(strahlkorper) == 8);
+}
+
+void test_initial_l_max() {
+  // A Schwarzschild horizon is resolved by the initial l_surface, so once
+  // that converges the find continues directly at the full l_max and must
+  // converge there.
+  ylm::Strahlkorper<Frame::Inertial> strahlkorper(12, 12, 3.0, {{0, 0, 0}});
+  FastFlow flow(FastFlow::FlowType::Fast, 1.0, 0.5, 1e-12, 1e-10, 1.2, 5, 100,
+                4);
+  CHECK(flow.current_l_surface(strahlkorper) == 4);
+  CHECK(flow.current_l_mesh(strahlkorper) == 6);
+  const gr::Solutions::KerrSchild solution(1.0, {{0., 0., 0.}}, {{0., 0., 0.}});
+  CHECK(converged(do_iteration(&strahlkorper, &flow, solution)));
+  CHECK(flow.current_l_surface(strahlkorper) == 12);
+  CHECK(flow.current_l_mesh(strahlkorper) == 18);
+  CHECK(strahlkorper.l_max() == 12);
+  CHECK(strahlkorper.average_radius() == approx(2.0));
+
+  flow.reset_for_next_find();
+  CHECK(flow.current_l_surface(strahlkorper) == 4);
+
+  CHECK_THROWS_WITH(
+      TestHelpers::test_creation<FastFlow>("Flow: Fast\n"
+                                           "Alpha: 1.1\n"
+                                           "Beta: 0.6\n"
+                                           "AbsTol: 1.e-10\n"
+                                           "TruncationTol: 1.e-3\n"
+                                           "DivergenceTol: 1.1\n"
+                                           "DivergenceIter: 6\n"
+                                           "MaxIts: 200\n"
+                                           "InitialLMax: 1"),
+      Catch::Matchers::ContainsSubstring("InitialLMax must be at least 2"));
+  CHECK(TestHelpers::test_creation<FastFlow>("Flow: Fast\n"
+                                             "Alpha: 1.1\n"
+                                             "Beta: 0.6\n"
+                                             "AbsTol: 1.e-10\n"
+                                             "TruncationTol: 1.e-3\n"
+                                             "DivergenceTol: 1.1\n"
+                                             "DivergenceIter: 6\n"
+                                             "MaxIts: 200\n"
+                                             "InitialLMax: 6") ==
+        FastFlow(FastFlow::FlowType::Fast, 1.1, 0.6, 1e-10, 1e-3, 1.1, 6, 200,
+                 6));
 }
 
 }  // namespace
@@ -287,6 +343,11 @@ SPECTRE_TEST_CASE("Unit.ApparentHorizonFinder.FastFlowKerr",
   test_kerr(FastFlow::FlowType::Fast, 2.0, 100);
 }
 
+SPECTRE_TEST_CASE("Unit.ApparentHorizonFinder.FastFlowKerrCoarseToFine",
+                  "[Utilities][Unit]") {
+  test_kerr(FastFlow::FlowType::Fast, 2.0, 100, 4);
+}
+
 SPECTRE_TEST_CASE("Unit.ApparentHorizonFinder.JacobiKerr",
                   "[Utilities][Unit]") {
   // Keep mass at 1.0 so test doesn't timeout.
@@ -309,6 +370,7 @@ SPECTRE_TEST_CASE("Unit.ApparentHorizonFinder.FastFlowMisc",
   test_copy_and_move();
   test_serialize();
   test_ostream();
+  test_initial_l_max();
 
   CHECK_THROWS_WITH(
       TestHelpers::test_creation<FastFlow>("Flow: Fast\n"
@@ -318,7 +380,8 @@ SPECTRE_TEST_CASE("Unit.ApparentHorizonFinder.FastFlowMisc",
                                            "TruncationTol: 1.e-3\n"
                                            "DivergenceTol: 0.5\n"
                                            "DivergenceIter: 6\n"
-                                           "MaxIts: 200"),
+                                           "MaxIts: 200\n"
+                                           "InitialLMax: None"),
       Catch::Matchers::ContainsSubstring(
           "Value 0.5 is below the lower bound of 1."));
   CHECK_THROWS_WITH(
@@ -329,7 +392,8 @@ SPECTRE_TEST_CASE("Unit.ApparentHorizonFinder.FastFlowMisc",
                                            "TruncationTol: 1.e-3\n"
                                            "DivergenceTol: 1.1\n"
                                            "DivergenceIter: 6\n"
-                                           "MaxIts: 200"),
+                                           "MaxIts: 200\n"
+                                           "InitialLMax: None"),
       Catch::Matchers::ContainsSubstring(
           "Failed to convert \"Crud\" to FastFlow::FlowType"));
 }
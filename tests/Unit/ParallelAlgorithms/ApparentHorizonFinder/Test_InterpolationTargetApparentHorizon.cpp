@@ -72,7 +72,7 @@ SPECTRE_TEST_CASE(
   // Options for ApparentHorizon
   intrp::OptionHolders::ApparentHorizon<Frame::Inertial> apparent_horizon_opts(
       ylm::Strahlkorper<Frame::Inertial>{l_max, radius, center}, FastFlow{},
-      Verbosity::Verbose);
+      Verbosity::Verbose, 3);
 
   // Test creation of options
   const auto created_opts = TestHelpers::test_creation<
@@ -86,7 +86,9 @@ SPECTRE_TEST_CASE(
       "  DivergenceTol: 1.2\n"
       "  DivergenceIter: 5\n"
       "  MaxIts: 100\n"
+      "  InitialLMax: None\n"
       "Verbosity: Verbose\n"
+      "NumberOfPreviousHorizons: 3\n"
       "InitialGuess:\n"
       "  Center: [0.05, 0.06, 0.07]\n"
       "  Radius: 2.0\n"
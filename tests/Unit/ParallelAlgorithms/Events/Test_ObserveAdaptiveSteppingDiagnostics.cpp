@@ -147,17 +147,24 @@ void test_observe(const Observer& observer) {
   uint64_t total_num_steps = 0;
   uint64_t total_num_step_changes = 0;
   uint64_t total_num_step_rejections = 0;
+  uint64_t total_num_cache_hits = 0;
+  uint64_t total_num_cache_misses = 0;
 
   const auto create_element = [&](const uint64_t num_steps,
                                   const uint64_t num_step_changes,
-                                  const uint64_t num_step_rejections) {
+                                  const uint64_t num_step_rejections,
+                                  const uint64_t num_cache_hits,
+                                  const uint64_t num_cache_misses) {
     auto box = db::create<tag_list>(
         Metavariables{}, observation_time,
         AdaptiveSteppingDiagnostics{num_slabs, num_slab_changes, num_steps,
-                                    num_step_changes, num_step_rejections});
+                                    num_step_changes, num_step_rejections,
+                                    num_cache_hits, num_cache_misses});
     total_num_steps += num_steps;
     total_num_step_changes += num_step_changes;
     total_num_step_rejections += num_step_rejections;
+    total_num_cache_hits += num_cache_hits;
+    total_num_cache_misses += num_cache_misses;
 
     const auto ids_to_register =
         observers::get_registration_observation_type_and_key(observer, box);
@@ -170,9 +177,9 @@ void test_observe(const Observer& observer) {
         &runner, element_boxes.size() - 1);
   };
 
-  create_element(100, 12, 5);
-  create_element(130, 90, 54);
-  create_element(18, 2, 2);
+  create_element(100, 12, 5, 300, 4);
+  create_element(130, 90, 54, 0, 0);
+  create_element(18, 2, 2, 36, 12);
 
   for (size_t index = 0; index < element_boxes.size(); ++index) {
     CHECK(static_cast<const Event&>(observer).is_ready(
@@ -216,6 +223,10 @@ void test_observe(const Observer& observer) {
   CHECK(std::get<4>(reduction_data.data()) == total_num_step_changes);
   CHECK(results->reduction_names[5] == "Number of step rejections");
   CHECK(std::get<5>(reduction_data.data()) == total_num_step_rejections);
+  CHECK(results->reduction_names[6] == "LTS coefficient cache hits");
+  CHECK(std::get<6>(reduction_data.data()) == total_num_cache_hits);
+  CHECK(results->reduction_names[7] == "LTS coefficient cache misses");
+  CHECK(std::get<7>(reduction_data.data()) == total_num_cache_misses);
 }
 }  // namespace
 
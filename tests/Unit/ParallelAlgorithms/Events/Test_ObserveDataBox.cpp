@@ -0,0 +1,53 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "ParallelAlgorithms/Events/ObserveDataBox.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace Events {
+namespace {
+void test_node_item_sizes() {
+  detail::ItemSizes sizes_on_node_0{{"A", 10}, {"B", 20}};
+  // A second element on the same node
+  detail::add_item_sizes(make_not_null(&sizes_on_node_0), {{"A", 1}, {"B", 2}});
+  CHECK(sizes_on_node_0 == detail::ItemSizes{{"A", 11}, {"B", 22}});
+
+  // Contributions only hold their own node
+  const detail::NodeItemSizes node_0{{0, sizes_on_node_0}};
+  const detail::NodeItemSizes node_2{{2, {{"A", 100}, {"B", 200}}}};
+  const detail::NodeItemSizes combined = detail::map_add{}(node_0, node_2);
+  CHECK(combined == detail::NodeItemSizes{{0, {{"A", 11}, {"B", 22}}},
+                                          {2, {{"A", 100}, {"B", 200}}}});
+  CHECK(detail::total_item_sizes(combined) ==
+        detail::ItemSizes{{"A", 111}, {"B", 222}});
+
+  // Items and nodes that are only in one of the maps are merged
+  const detail::NodeItemSizes more = detail::map_add{}(
+      combined, {{0, {{"A", 1}, {"C", 5}}}, {1, {{"C", 7}}}});
+  CHECK(more == detail::NodeItemSizes{{0, {{"A", 12}, {"B", 22}, {"C", 5}}},
+                                      {1, {{"C", 7}}},
+                                      {2, {{"A", 100}, {"B", 200}}}});
+  CHECK(detail::total_item_sizes(more) ==
+        detail::ItemSizes{{"A", 112}, {"B", 222}, {"C", 12}});
+
+  std::vector<std::string> legend{"Time"};
+  std::vector<double> columns{1.5};
+  detail::write_data_box_sizes(make_not_null(&legend), make_not_null(&columns),
+                               {{"A", 1048576}, {"B", 524288}});
+  CHECK(legend == std::vector<std::string>{"Time", "A", "B"});
+  CHECK(columns == std::vector<double>{1.5, 1.0, 0.5});
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.ParallelAlgorithms.Events.ObserveDataBox",
+                  "[Unit][ParallelAlgorithms]") {
+  test_node_item_sizes();
+}
+}  // namespace Events
@@ -5,9 +5,11 @@
 
 #include <cstddef>
 #include <type_traits>
+#include <utility>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/ObservationBox.hpp"
+#include "DataStructures/Index.hpp"
 #include "DataStructures/Variables.hpp"
 #include "Domain/Creators/DomainCreator.hpp"
 #include "Domain/Creators/RegisterDerivedWithCharm.hpp"
@@ -98,9 +100,52 @@ struct initialize_elements_and_queue_simple_actions {
       auto obs_box = make_observation_box<
           typename metavars::event::compute_tags_for_observation_box>(
           make_not_null(&box));
+      const size_t rebuilds_before = event.number_of_cache_rebuilds();
       event.run(make_not_null(&obs_box),
                 ActionTesting::cache<elem_component>(runner, element_id),
                 element_id, std::add_pointer_t<elem_component>{}, {});
+      // Each element has a new key, so the cache is rebuilt
+      CHECK(event.number_of_cache_rebuilds() == rebuilds_before + 1);
+
+      // 4. Run the event again. This reuses the interpolant cached by the
+      // first run, and must send the same data to the target.
+      event.run(make_not_null(&obs_box),
+                ActionTesting::cache<elem_component>(runner, element_id),
+                element_id, std::add_pointer_t<elem_component>{}, {});
+      CHECK(event.number_of_cache_rebuilds() == rebuilds_before + 1);
+
+      // 5. The target points are compared by value, so the same points in a
+      // new allocation reuse the cache.
+      db::mutate<intrp::Tags::InterpPointInfo<metavars>>(
+          [](const auto point_info) {
+            auto moved_point_info = *point_info;
+            *point_info = std::move(moved_point_info);
+          },
+          make_not_null(&box));
+      event.run(make_not_null(&obs_box),
+                ActionTesting::cache<elem_component>(runner, element_id),
+                element_id, std::add_pointer_t<elem_component>{}, {});
+      CHECK(event.number_of_cache_rebuilds() == rebuilds_before + 1);
+
+      // 6. Moving an interior grid point, e.g. by a deformation that leaves
+      // the corners of the element in place, rebuilds the cache. Only the
+      // key depends on the moved point, so the same data is sent.
+      const size_t interior_point = collapsed_index(
+          Index<3>{mesh.extents(0) / 2, mesh.extents(1) / 2,
+                   mesh.extents(2) / 2},
+          mesh.extents());
+      for (const double shift : {1.0e-10, -1.0e-10}) {
+        db::mutate<
+            domain::Tags::Coordinates<metavars::volume_dim, Frame::Inertial>>(
+            [&interior_point, &shift](const auto coords) {
+              get<0>(*coords)[interior_point] += shift;
+            },
+            make_not_null(&box));
+        event.run(make_not_null(&obs_box),
+                  ActionTesting::cache<elem_component>(runner, element_id),
+                  element_id, std::add_pointer_t<elem_component>{}, {});
+      }
+      CHECK(event.number_of_cache_rebuilds() == rebuilds_before + 3);
     }
   }
 };
@@ -135,6 +180,7 @@ struct MockMetavariables {
     using compute_items_on_target = tmpl::list<>;
     using vars_to_interpolate_to_target =
         tmpl::list<InterpolateOnElementTestHelpers::Tags::TestSolution>;
+    static constexpr double interpolation_cache_tolerance = 1.0e-12;
     // The following are not used in this test, but must be there to
     // conform to the protocol.
     using compute_target_points = ::intrp::TargetPoints::Sphere<
@@ -56,6 +56,7 @@
 #include "ParallelAlgorithms/Interpolation/Protocols/ComputeVarsToInterpolate.hpp"
 #include "ParallelAlgorithms/Interpolation/Protocols/InterpolationTargetTag.hpp"
 #include "ParallelAlgorithms/Interpolation/Targets/LineSegment.hpp"
+#include "ParallelAlgorithms/Interpolation/VolumeDataSnapshot.hpp"
 #include "PointwiseFunctions/GeneralRelativity/Tags.hpp"
 #include "Time/Slab.hpp"
 #include "Time/Tags/TimeStepId.hpp"
@@ -348,15 +349,23 @@ struct MockMetavariables {
       mock_observer_writer<MockMetavariables>>;
 };
 
-// Create volume data and send it to the interpolator.
+// Create volume data and send it to the interpolator. Returns the snapshots
+// that were sent.
 template <typename interp_component, typename Metavariables,
           typename DomainCreatorType, typename DomainType>
-void create_volume_data_and_send_it_to_interpolator(
+std::unordered_map<
+    ElementId<3>,
+    intrp::VolumeDataSnapshot<typename Metavariables::interpolator_source_vars>>
+create_volume_data_and_send_it_to_interpolator(
     const gsl::not_null<ActionTesting::MockRuntimeSystem<Metavariables>*>
         runner,
     const DomainCreatorType& domain_creator, const DomainType& domain,
     const std::vector<ElementId<3>>& element_ids,
     const TimeStepId& temporal_id) {
+  std::unordered_map<ElementId<3>,
+                     intrp::VolumeDataSnapshot<
+                         typename Metavariables::interpolator_source_vars>>
+      snapshots{};
   for (const auto& element_id : element_ids) {
     const auto& block = domain.blocks()[element_id.block_id()];
     ::Mesh<3> mesh{domain_creator.initial_extents()[element_id.block_id()],
@@ -375,13 +384,19 @@ void create_volume_data_and_send_it_to_interpolator(
                    3.0 * get<1>(inertial_coords) +
                    5.0 * get<2>(inertial_coords);
 
-    // Call the action on each element_id.
+    // Call the action on each element_id, sharing a snapshot of the data as
+    // ::intrp::interpolate does.
+    const intrp::VolumeDataSnapshot<
+        typename Metavariables::interpolator_source_vars>
+        snapshot{std::move(output_vars)};
+    snapshots.emplace(element_id, snapshot);
     runner->template simple_action<
         interp_component,
         ::intrp::Actions::InterpolatorReceiveVolumeData<
             typename Metavariables::InterpolationTargetA::temporal_id>>(
-        0, temporal_id, element_id, mesh, std::move(output_vars));
+        0, temporal_id, element_id, mesh, snapshot);
   }
+  return snapshots;
 }
 
 void test(const bool dump_vol_data) {
@@ -478,8 +493,10 @@ void test(const bool dump_vol_data) {
 
   ActionTesting::set_phase(make_not_null(&runner), Parallel::Phase::Testing);
 
-  create_volume_data_and_send_it_to_interpolator<interp_component>(
-      make_not_null(&runner), domain_creator, domain, element_ids, temporal_id);
+  const auto snapshots =
+      create_volume_data_and_send_it_to_interpolator<interp_component>(
+          make_not_null(&runner), domain_creator, domain, element_ids,
+          temporal_id);
 
   const auto& holders = ActionTesting::get_databox_tag<
       interp_component, intrp::Tags::InterpolatedVarsHolders<metavars>>(runner,
@@ -525,6 +542,13 @@ void test(const bool dump_vol_data) {
       runner, 0);
   CHECK(volume_vars_info.size() == 1);
   CHECK(volume_vars_info.at(temporal_id).size() == element_ids.size());
+  // The Interpolator shares the snapshots it was sent rather than copying them.
+  for (const auto& element_id : element_ids) {
+    CHECK(volume_vars_info.at(temporal_id)
+              .at(element_id)
+              .source_vars_from_element.shares_data_with(
+                  snapshots.at(element_id)));
+  }
 
   // Now that VolumeVarsInfo is full, test dumping the data
   // Go to the post failure cleanup phase just for now so we can run the action
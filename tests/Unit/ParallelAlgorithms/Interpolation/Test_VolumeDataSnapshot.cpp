@@ -0,0 +1,44 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <utility>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "ParallelAlgorithms/Interpolation/VolumeDataSnapshot.hpp"
+#include "PointwiseFunctions/GeneralRelativity/Tags.hpp"
+#include "Utilities/TMPL.hpp"
+
+SPECTRE_TEST_CASE("Unit.Interpolation.VolumeDataSnapshot",
+                  "[Unit][NumericalAlgorithms]") {
+  using vars_type = Variables<tmpl::list<gr::Tags::Lapse<DataVector>>>;
+  vars_type vars(4);
+  get(get<gr::Tags::Lapse<DataVector>>(vars)) = DataVector{1.0, 2.0, 3.0, 4.0};
+  const vars_type expected_vars = vars;
+  const double* const data = vars.data();
+
+  const intrp::VolumeDataSnapshot<vars_type::tags_list> snapshot{
+      std::move(vars)};
+  // The data is moved into the snapshot, not copied.
+  CHECK(snapshot->data() == data);
+  CHECK(*snapshot == expected_vars);
+  CHECK(snapshot.shares_data_with(snapshot));
+
+  // Copies share the data.
+  const auto copy = snapshot;
+  CHECK(copy.shares_data_with(snapshot));
+  CHECK(copy->data() == data);
+
+  // Serialization copies the data.
+  const auto deserialized = serialize_and_deserialize(snapshot);
+  CHECK_FALSE(deserialized.shares_data_with(snapshot));
+  CHECK(*deserialized == expected_vars);
+
+  const intrp::VolumeDataSnapshot<vars_type::tags_list> empty{};
+  CHECK_FALSE(empty.shares_data_with(empty));
+  CHECK_FALSE(serialize_and_deserialize(empty).shares_data_with(snapshot));
+}
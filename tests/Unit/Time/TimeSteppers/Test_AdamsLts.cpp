@@ -749,11 +749,131 @@ void test_lts_coefficients() {
   }
 }
 
+void test_lts_coefficients_cache() {
+  using step_coefficients_detail::make_id;
+  using step_coefficients_detail::make_time;
+  const auto history_order = std::numeric_limits<size_t>::max();  // unused
+  const adams_lts::AdamsScheme ab3{adams_lts::SchemeType::Explicit, 3};
+
+  // The AB 2:1 order 3 pattern from test_lts_coefficients, and
+  // copies of it translated in time and scaled by a factor of 2.
+  const auto make_history = [&history_order](const int offset,
+                                             const int scale) {
+    TimeSteppers::BoundaryHistory<double, double, double> history{};
+    for (const int step : {-8, -4, 0}) {
+      history.local().insert(make_id({offset + scale * step}), history_order,
+                             0.0);
+    }
+    for (const int step : {-4, -2, 0, 2}) {
+      history.remote().insert(make_id({offset + scale * step}), history_order,
+                              0.0);
+    }
+    return history;
+  };
+  const auto coefficients_for = [&ab3](const auto& history, const int start,
+                                       const int end) {
+    return adams_lts::lts_coefficients(history.local(), history.remote(),
+                                       make_time(start), make_time(end), ab3,
+                                       ab3, ab3);
+  };
+
+  adams_lts::clear_lts_coefficients_cache();
+  const adams_lts::LtsCoefficientsCacheStatistics initial_statistics =
+      adams_lts::lts_coefficients_cache_statistics();
+  const auto check_statistics = [&initial_statistics](const uint64_t hits,
+                                                      const uint64_t misses) {
+    CHECK(adams_lts::lts_coefficients_cache_statistics().hits ==
+          initial_statistics.hits + hits);
+    CHECK(adams_lts::lts_coefficients_cache_statistics().misses ==
+          initial_statistics.misses + misses);
+  };
+
+  const auto history = make_history(0, 1);
+  const auto coefficients = coefficients_for(history, 0, 4);
+  check_statistics(0, 1);
+
+  const auto check_transformed = [&coefficients](
+                                     const adams_lts::LtsCoefficients& result,
+                                     const int offset, const int scale) {
+    REQUIRE(result.size() == coefficients.size());
+    for (size_t i = 0; i < coefficients.size(); ++i) {
+      const auto transform_id = [&offset, &scale](const TimeStepId& id) {
+        return make_id(
+            {offset + scale * static_cast<int>(id.step_time().value())});
+      };
+      CHECK(get<0>(result[i]) == transform_id(get<0>(coefficients[i])));
+      CHECK(get<1>(result[i]) == transform_id(get<1>(coefficients[i])));
+      CHECK(get<2>(result[i]) == approx(scale * get<2>(coefficients[i])));
+    }
+  };
+
+  // Cached coefficients are rescaled by the step size, so may differ
+  // from the computed ones by roundoff.
+  check_transformed(coefficients_for(history, 0, 4), 0, 1);
+  check_statistics(1, 1);
+
+  const auto translated_history = make_history(4, 1);
+  check_transformed(coefficients_for(translated_history, 4, 8), 4, 1);
+  check_statistics(2, 1);
+
+  const auto scaled_history = make_history(0, 2);
+  check_transformed(coefficients_for(scaled_history, 0, 8), 0, 2);
+  check_statistics(3, 1);
+
+  // A different step with the same history is a different pattern.
+  const auto second_small_step = coefficients_for(history, 0, 2);
+  check_statistics(3, 2);
+  adams_lts::clear_lts_coefficients_cache();
+  CHECK(coefficients_for(history, 0, 2) == second_small_step);
+  check_statistics(3, 3);
+
+  // Dense output is not cached.
+  adams_lts::lts_coefficients(history.local(), history.remote(),
+                              make_time(0), make_time(1.0), ab3, ab3, ab3);
+  check_statistics(3, 3);
+
+  // Only the most recently used patterns are kept.
+  adams_lts::set_lts_coefficients_cache_capacity(2);
+  CHECK(adams_lts::lts_coefficients_cache_statistics().evictions ==
+        initial_statistics.evictions);
+  coefficients_for(history, 0, 4);
+  check_statistics(3, 4);
+  coefficients_for(history, 0, 2);
+  check_statistics(4, 4);
+  const auto swapped_coefficients = adams_lts::lts_coefficients(
+      history.remote(), history.local(), make_time(0), make_time(2), ab3, ab3,
+      ab3);
+  check_statistics(4, 5);
+  CHECK(adams_lts::lts_coefficients_cache_statistics().evictions ==
+        initial_statistics.evictions + 1);
+  coefficients_for(history, 0, 2);
+  check_statistics(5, 5);
+  coefficients_for(history, 0, 4);
+  check_statistics(5, 6);
+  CHECK(adams_lts::lts_coefficients_cache_statistics().evictions ==
+        initial_statistics.evictions + 2);
+  CHECK(adams_lts::lts_coefficients(history.remote(), history.local(),
+                                    make_time(0), make_time(2), ab3, ab3,
+                                    ab3) == swapped_coefficients);
+  check_statistics(5, 7);
+
+  // A capacity of zero disables the cache.
+  adams_lts::set_lts_coefficients_cache_capacity(0);
+  CHECK(adams_lts::lts_coefficients_cache_statistics().evictions ==
+        initial_statistics.evictions + 5);
+  coefficients_for(history, 0, 2);
+  coefficients_for(history, 0, 2);
+  check_statistics(5, 9);
+  adams_lts::set_lts_coefficients_cache_capacity(
+      adams_lts::default_lts_coefficients_cache_capacity);
+}
+
 SPECTRE_TEST_CASE("Unit.Time.TimeSteppers.AdamsLts", "[Unit][Time]") {
   test_exact_substep_time();
   test_lts_coefficients_struct();
   test_apply_coefficients(0.0);
   test_apply_coefficients(DataVector(5, 0.0));
   test_lts_coefficients();
+  test_lts_coefficients_cache();
 }
 }  // namespace
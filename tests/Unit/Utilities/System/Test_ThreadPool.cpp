@@ -0,0 +1,156 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
+#include "Utilities/System/ThreadPool.hpp"
+
+namespace {
+// Catch is not thread-safe, so the loop bodies only record results that are
+// checked once the loop completes.
+void check_each_index_visited_once(
+    const gsl::not_null<sys::ThreadPool*> pool, const size_t size) {
+  std::vector<size_t> number_of_visits(size, 0);
+  pool->parallel_for(size, [&number_of_visits](const size_t begin,
+                                               const size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      ++number_of_visits[i];
+    }
+  });
+  for (size_t i = 0; i < size; ++i) {
+    CHECK(number_of_visits[i] == 1);
+  }
+}
+
+void test_parallel_for() {
+  sys::ThreadPool pool{};
+  CHECK(pool.number_of_threads() == 1);
+  for (const size_t number_of_threads : {1_st, 2_st, 3_st, 5_st}) {
+    pool.resize(number_of_threads);
+    CHECK(pool.number_of_threads() == number_of_threads);
+    for (const size_t size : {0_st, 1_st, 2_st, 7_st, 64_st}) {
+      // repeat so that loops are started while workers from the previous loop
+      // may still be waking up
+      for (size_t repeat = 0; repeat < 20; ++repeat) {
+        check_each_index_visited_once(make_not_null(&pool), size);
+      }
+    }
+  }
+  // resizing to the same size is a no-op
+  pool.resize(5);
+  CHECK(pool.number_of_threads() == 5);
+  pool.resize(1);
+  CHECK(pool.number_of_threads() == 1);
+  CHECK_THROWS_WITH(pool.resize(0), Catch::Matchers::ContainsSubstring(
+                                        "must have at least one thread"));
+}
+
+void test_nested_and_concurrent_loops() {
+  sys::ThreadPool pool{4};
+  // a loop started from inside a running loop is run serially by the thread
+  // that starts it
+  std::vector<size_t> inner_visits(8 * 5, 0);
+  pool.parallel_for(8, [&pool, &inner_visits](const size_t begin,
+                                              const size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      pool.parallel_for(5, [&inner_visits, &i](const size_t inner_begin,
+                                               const size_t inner_end) {
+        if (inner_begin != 0 or inner_end != 5) {
+          return;
+        }
+        for (size_t j = inner_begin; j < inner_end; ++j) {
+          ++inner_visits[5 * i + j];
+        }
+      });
+    }
+  });
+  for (const size_t visits : inner_visits) {
+    CHECK(visits == 1);
+  }
+
+  // loops started from several threads at once all complete
+  const auto run_loops = [&pool](const gsl::not_null<bool*> success) {
+    for (size_t repeat = 0; repeat < 100; ++repeat) {
+      std::vector<size_t> visits(23, 0);
+      pool.parallel_for(23, [&visits](const size_t begin, const size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+          ++visits[i];
+        }
+      });
+      for (const size_t number_of_visits : visits) {
+        *success = *success and number_of_visits == 1;
+      }
+    }
+  };
+  bool first_success = true;
+  bool second_success = true;
+  std::thread other_thread{run_loops, make_not_null(&second_success)};
+  run_loops(make_not_null(&first_success));
+  other_thread.join();
+  CHECK(first_success);
+  CHECK(second_success);
+}
+
+void test_exception() {
+  sys::ThreadPool pool{3};
+  CHECK_THROWS_WITH(
+      pool.parallel_for(9,
+                        [](const size_t begin, const size_t /*end*/) {
+                          if (begin != 0) {
+                            throw std::runtime_error("Failed chunk");
+                          }
+                        }),
+      Catch::Matchers::ContainsSubstring("Failed chunk"));
+  // the pool is still usable after a failed loop
+  check_each_index_visited_once(make_not_null(&pool), 9);
+}
+
+void test_external_helpers() {
+  sys::ThreadPool pool{3};
+  std::vector<std::thread> helpers{};
+  size_t number_of_requests = 0;
+  pool.use_external_helpers(3, [&pool, &helpers, &number_of_requests](
+                                  const size_t number_of_helpers) {
+    ++number_of_requests;
+    for (size_t i = 0; i < number_of_helpers; ++i) {
+      helpers.emplace_back([&pool]() { pool.help(); });
+    }
+  });
+  CHECK(pool.number_of_threads() == 4);
+  for (const size_t size : {1_st, 2_st, 7_st, 64_st}) {
+    check_each_index_visited_once(make_not_null(&pool), size);
+  }
+  // helpers that arrive after the loop has completed return immediately
+  for (auto& helper : helpers) {
+    helper.join();
+  }
+  // loops of size 1 are run directly on the calling thread
+  CHECK(number_of_requests == 3);
+  CHECK(helpers.size() == 1 + 3 + 3);
+  pool.help();
+
+  // the loop completes even if no helper ever arrives
+  pool.use_external_helpers(5, [](const size_t /*number_of_helpers*/) {});
+  check_each_index_visited_once(make_not_null(&pool), 11);
+
+  pool.resize(2);
+  CHECK(pool.number_of_threads() == 2);
+  check_each_index_visited_once(make_not_null(&pool), 11);
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Utilities.System.ThreadPool", "[Unit][Utilities]") {
+  test_parallel_for();
+  test_nested_and_concurrent_loops();
+  test_exception();
+  test_external_helpers();
+  CHECK(sys::node_thread_pool().number_of_threads() == 1);
+  CHECK(&sys::node_thread_pool() == &sys::node_thread_pool());
+}